@@ -3,7 +3,6 @@
  * program which demonstrates sprites colliding with tiles
  */
 
-#include <stdio.h>
 #include <stdbool.h>
 
 #define SCREEN_WIDTH 240
@@ -21,11 +20,43 @@
 /* include the tile maps we are using */
 #include "map.h"
 #include "map2.h"
+#include "title.h"
+
+/* include the sine table used for wave and rotation effects, and the
+ * reciprocal table used for perspective */
+#include "sine.h"
+#include "reciprocal.h"
+
+/* include the font used for text */
+#include "font.h"
+
+/* include the animatronic AI programs and the rooms they walk between */
+#include "guest_ai.h"
+#include "rooms.h"
+
+/* include the video played when the last guest gets afton */
+#include "scream.h"
+
+/* large buffers go in the 256K of external work ram, the 32K of internal
+ * work ram is kept for the stack and code which has to run fast */
+#ifdef __arm__
+#define EWRAM_BSS __attribute__((section(".sbss")))
+#define LONG_CALL __attribute__((long_call))
+#define IWRAM_CODE __attribute__((section(".iwram"), long_call, target("arm")))
+#else
+#define EWRAM_BSS
+#define LONG_CALL
+#define IWRAM_CODE
+#endif
 
 /* the tile mode flags needed for display control register */
 #define MODE0 0x00
 #define MODE1 0x01
 #define MODE2 0x02
+#define MODE4 0x04
+
+/* in mode 4 this picks which of the two pages of video memory is shown */
+#define PAGE_SELECT 0x10
 
 /* enable bits for the four tile layers */
 #define BG0_ENABLE 0x100
@@ -92,6 +123,10 @@ volatile short *bg3_y_scroll = (unsigned short *)0x400001e;
 #define BUTTON_R (1 << 8)
 #define BUTTON_L (1 << 9)
 
+/* all ten buttons */
+#define NUM_BUTTONS 10
+#define ALL_BUTTONS 0x3ff
+
 /* the scanline counter is a memory cell which is updated to indicate how
  * much of the screen has been drawn */
 volatile unsigned short *scanline_counter = (volatile unsigned short *)0x4000006;
@@ -99,9 +134,6 @@ volatile unsigned short *scanline_counter = (volatile unsigned short *)0x4000006
 /* returns the next frame int */
 int next_frame(int frame, int num);
 
-/* returns true when a is greater than b */
-int times_two(int num);
-
 /* wait for the screen to be fully drawn so we can do something during vblank */
 void wait_vblank()
 {
@@ -111,23 +143,6 @@ void wait_vblank()
     }
 }
 
-/* this function checks whether a particular button has been pressed */
-unsigned char button_pressed(unsigned short button)
-{
-    /* and the button register with the button constant we want */
-    unsigned short pressed = *buttons & button;
-
-    /* if this value is zero, then it's not pressed */
-    if (pressed == 0)
-    {
-        return 1;
-    }
-    else
-    {
-        return 0;
-    }
-}
-
 /* return a pointer to one of the 4 character blocks (0-3) */
 volatile unsigned short *char_block(unsigned long block)
 {
@@ -142,6 +157,121 @@ volatile unsigned short *screen_block(unsigned long block)
     return (volatile unsigned short *)(0x6000000 + (block * 0x800));
 }
 
+/* the global interrupt enable register */
+volatile unsigned short *interrupt_enable = (unsigned short *)0x4000208;
+
+/* this register stores the individual interrupts we want */
+volatile unsigned short *interrupt_selection = (unsigned short *)0x4000200;
+
+/* this registers stores which interrupts if any occured */
+volatile unsigned short *interrupt_state = (unsigned short *)0x4000202;
+
+/* CONCURRENCY */
+
+/* stop the compiler moving memory accesses across this point, the cpu itself
+ * does everything in order so nothing more is needed */
+#define memory_barrier() asm volatile("" ::: "memory")
+
+/* turn off interrupts for a short section, returning whether they were on
+ * so that sections can be nested */
+unsigned short critical_begin()
+{
+    unsigned short enabled = *interrupt_enable;
+    *interrupt_enable = 0;
+    return enabled;
+}
+
+/* end a section, turning interrupts back on only if they were on before it */
+void critical_end(unsigned short enabled)
+{
+    *interrupt_enable = enabled;
+}
+
+/* a ring buffer with one side adding and the other taking away, such as the
+ * main loop and an interrupt handler - the adding side only ever changes head
+ * and the taking side only changes tail, so neither has to stop the other
+ * the entries live in a separate array whose size is a power of two */
+struct Ring
+{
+    volatile unsigned int head;
+    volatile unsigned int tail;
+    unsigned int mask;
+};
+
+/* returns the index of the entry to fill in, or -1 if the ring is full */
+int ring_reserve(struct Ring *ring)
+{
+    if (ring->head - ring->tail > ring->mask)
+    {
+        return -1;
+    }
+    return ring->head & ring->mask;
+}
+
+/* hand over the entry which was filled in */
+void ring_publish(struct Ring *ring)
+{
+    memory_barrier();
+    ring->head++;
+}
+
+/* returns the index of the oldest entry, or -1 if the ring is empty */
+int ring_peek(struct Ring *ring)
+{
+    if (ring->head == ring->tail)
+    {
+        return -1;
+    }
+    memory_barrier();
+    return ring->tail & ring->mask;
+}
+
+/* give back the oldest entry once it has been used */
+void ring_release(struct Ring *ring)
+{
+    memory_barrier();
+    ring->tail++;
+}
+
+/* a sequence lock lets the vblank handler publish several values together,
+ * the count is odd while they are being written, and a reader which sees it
+ * change just reads them again */
+struct Seqlock
+{
+    volatile unsigned int sequence;
+};
+
+void seqlock_write_begin(struct Seqlock *lock)
+{
+    lock->sequence++;
+    memory_barrier();
+}
+
+void seqlock_write_end(struct Seqlock *lock)
+{
+    memory_barrier();
+    lock->sequence++;
+}
+
+/* returns the count to check against once the values are read */
+unsigned int seqlock_read_begin(struct Seqlock *lock)
+{
+    unsigned int sequence;
+    do
+    {
+        sequence = lock->sequence;
+    } while (sequence & 1);
+    memory_barrier();
+    return sequence;
+}
+
+/* returns whether the values changed while being read */
+int seqlock_read_retry(struct Seqlock *lock, unsigned int sequence)
+{
+    memory_barrier();
+    return lock->sequence != sequence;
+}
+
 /* flag for turning on DMA */
 #define DMA_ENABLE 0x80000000
 
@@ -161,9 +291,12 @@ volatile unsigned int *dma_count = (volatile unsigned int *)0x40000DC;
 /* copy data using DMA */
 void memcpy16_dma(unsigned short *dest, unsigned short *source, int amount)
 {
+    /* the vblank handler uses this channel too, so it must not come in half way */
+    unsigned short enabled = critical_begin();
     *dma_source = (unsigned int)source;
     *dma_destination = (unsigned int)dest;
     *dma_count = amount | DMA_16 | DMA_ENABLE;
+    critical_end(enabled);
 }
 
 /* MUSIC */
@@ -181,7 +314,9 @@ volatile unsigned short *timer0_control = (volatile unsigned short *)0x4000102;
 
 /* the GBA clock speed is fixed at this rate */
 #define CLOCK 16777216
-#define CYCLES_PER_BLANK 280806
+
+/* a frame is 228 lines of 1232 cycles, vblank included */
+#define CYCLES_PER_FRAME (228 * 1232)
 
 /* turn DMA on for different sizes */
 #define DMA_ENABLE 0x80000000
@@ -210,15 +345,6 @@ volatile unsigned int *dma3_source = (volatile unsigned int *)0x40000D4;
 volatile unsigned int *dma3_destination = (volatile unsigned int *)0x40000D8;
 volatile unsigned int *dma3_control = (volatile unsigned int *)0x40000DC;
 
-/* the global interrupt enable register */
-volatile unsigned short *interrupt_enable = (unsigned short *)0x4000208;
-
-/* this register stores the individual interrupts we want */
-volatile unsigned short *interrupt_selection = (unsigned short *)0x4000200;
-
-/* this registers stores which interrupts if any occured */
-volatile unsigned short *interrupt_state = (unsigned short *)0x4000202;
-
 /* the address of the function to call when an interrupt occurs */
 volatile unsigned int *interrupt_callback = (unsigned int *)0x3007FFC;
 
@@ -307,698 +433,5478 @@ void play_sound(const signed char *sound, int total_samples, int sample_rate, ch
      * divided by the number of machine cycles per vblank (a constant) */
     if (channel == 'A')
     {
-        channel_a_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_BLANK);
+        channel_a_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_FRAME);
         channel_a_total_vblanks = channel_a_vblanks_remaining;
     }
     else if (channel == 'B')
     {
-        channel_b_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_BLANK);
+        channel_b_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_FRAME);
     }
 
     /* enable the timer */
     *timer0_control = TIMER_ENABLE | TIMER_FREQ_1;
 }
 
-/* this function is called each vblank to get the timing of sounds right */
-void on_vblank()
+/* a sound for the vblank handler to start */
+struct SoundCommand
 {
-    /* disable interrupts for now and save current state of interrupt */
-    *interrupt_enable = 0;
-    unsigned short temp = *interrupt_state;
+    const signed char *sound;
+    int total_samples;
+    int sample_rate;
+    char channel;
+};
 
-    /* look for vertical refresh */
-    if ((*interrupt_state & INTERRUPT_VBLANK) == INTERRUPT_VBLANK)
+/* the main loop asks for sounds through this ring, so the counters above are
+ * only ever changed by the vblank handler once it is running */
+#define SOUND_QUEUE_SIZE 4
+struct SoundCommand sound_queue[SOUND_QUEUE_SIZE];
+struct Ring sound_ring = {0, 0, SOUND_QUEUE_SIZE - 1};
+
+/* ask for a sound to start at the next vblank, returns 0 if too many are waiting */
+int sound_play(const signed char *sound, int total_samples, int sample_rate, char channel)
+{
+    int slot = ring_reserve(&sound_ring);
+    if (slot < 0)
     {
+        return 0;
+    }
 
-        /* update channel A */
-        if (channel_a_vblanks_remaining == 0)
-        {
-            /* restart the sound again when it runs out */
-            channel_a_vblanks_remaining = channel_a_total_vblanks;
-            *dma1_control = 0;
-            *dma1_source = (unsigned int)music;
-            *dma1_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 |
-                            DMA_SYNC_TO_TIMER | DMA_ENABLE;
-        }
-        else
-        {
-            channel_a_vblanks_remaining--;
-        }
+    sound_queue[slot].sound = sound;
+    sound_queue[slot].total_samples = total_samples;
+    sound_queue[slot].sample_rate = sample_rate;
+    sound_queue[slot].channel = channel;
+    ring_publish(&sound_ring);
+    return 1;
+}
+
+/* called from the vblank handler to start waiting sounds and keep track of
+ * how long the playing ones have left */
+void sound_vblank()
+{
+    int slot;
+    while ((slot = ring_peek(&sound_ring)) >= 0)
+    {
+        play_sound(sound_queue[slot].sound, sound_queue[slot].total_samples,
+                   sound_queue[slot].sample_rate, sound_queue[slot].channel);
+        ring_release(&sound_ring);
+    }
 
-        /* update channel B */
-        if (channel_b_vblanks_remaining == 0)
+    /* update channel A */
+    if (channel_a_vblanks_remaining == 0)
+    {
+        /* restart the sound again when it runs out */
+        channel_a_vblanks_remaining = channel_a_total_vblanks;
+        *dma1_control = 0;
+        *dma1_source = (unsigned int)music;
+        *dma1_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 |
+                        DMA_SYNC_TO_TIMER | DMA_ENABLE;
+    }
+    else
+    {
+        channel_a_vblanks_remaining--;
+    }
+
+    /* update channel B */
+    if (channel_b_vblanks_remaining == 0)
+    {
+        /* disable the sound and DMA transfer on channel B */
+        *sound_control &= ~(SOUND_B_RIGHT_CHANNEL | SOUND_B_LEFT_CHANNEL | SOUND_B_FIFO_RESET);
+        *dma2_control = 0;
+    }
+    else
+    {
+        channel_b_vblanks_remaining--;
+    }
+}
+
+/* SCANLINE EFFECTS */
+
+/* pointers to the DMA 0 source/dest locations and control register, this is
+ * the channel used for streaming register values every horizontal blank */
+volatile unsigned int *dma0_source = (volatile unsigned int *)0x40000B0;
+volatile unsigned int *dma0_destination = (volatile unsigned int *)0x40000B4;
+volatile unsigned int *dma0_control = (volatile unsigned int *)0x40000B8;
+
+/* this causes the DMA to start at each horizontal blank instead of right away */
+#define DMA_SYNC_TO_HBLANK 0x20000000
+
+/* this causes the DMA destination to increment, but go back to the start on each repeat */
+#define DMA_DEST_RELOAD 0x600000
+
+/* the per-line registers are the 32 halfwords from the bg0 x scroll at 0x4000010
+ * up to the mosaic register, these are their indices in that window */
+#define SCANLINE_BASE 0x4000010
+#define SCANLINE_BG0_X 0
+#define SCANLINE_BG0_Y 1
+#define SCANLINE_BG1_X 2
+#define SCANLINE_BG1_Y 3
+#define SCANLINE_BG2_X 4
+#define SCANLINE_BG2_Y 5
+#define SCANLINE_BG3_X 6
+#define SCANLINE_BG3_Y 7
+#define SCANLINE_BG2_PA 8
+#define SCANLINE_BG3_PA 16
+#define SCANLINE_WIN0_H 24
+#define SCANLINE_WIN1_H 25
+#define SCANLINE_WIN0_V 26
+#define SCANLINE_WIN1_V 27
+#define SCANLINE_WININ 28
+#define SCANLINE_WINOUT 29
+#define SCANLINE_MOSAIC 30
+#define SCANLINE_REGS 32
+
+/* the tables are double buffered - one is built during the frame while dma
+ * streams the other, there is one extra line because the hblank of the last
+ * line on screen also triggers a transfer */
+unsigned short scanline_tables[2][(SCREEN_HEIGHT + 1) * SCANLINE_REGS] EWRAM_BSS;
+
+/* the registers which get a value per line, one bit each */
+unsigned int scanline_claimed = 0;
+
+/* the value of each register for when it is not given per line */
+unsigned short scanline_static[SCANLINE_REGS];
+
+/* the table being built this frame, the first register in it and how many
+ * registers are stored for each line */
+int scanline_back = 0;
+int scanline_first = 0;
+int scanline_stride = 0;
+
+/* the table dma is streaming from, set by the vblank handler */
+volatile int scanline_front = -1;
+volatile int scanline_front_first = 0;
+volatile int scanline_front_stride = 0;
+
+/* set when a finished table is waiting for the next vblank */
+volatile int scanline_pending = 0;
+
+/* stream a register from a per line table rather than a single value */
+void scanline_claim(int reg)
+{
+    scanline_claimed |= (1 << reg);
+}
+
+/* go back to a single value for a register */
+void scanline_release(int reg)
+{
+    scanline_claimed &= ~(1 << reg);
+}
+
+/* set the value of a register which is not given per line, registers which
+ * fall inside the dma window are rewritten with this value on every line */
+void scanline_set_static(int reg, unsigned short value)
+{
+    scanline_static[reg] = value;
+    ((volatile unsigned short *)SCANLINE_BASE)[reg] = value;
+}
+
+/* register changes which have to show on the same frame as the tables being
+ * built, each sets the bits of mask to value at the vblank the tables start,
+ * so other bits written straight to the register in the meantime are kept */
+#define SCANLINE_MAX_WRITES 8
+
+struct ScanlineWrite
+{
+    volatile unsigned short *reg;
+    unsigned short mask;
+    unsigned short value;
+};
+
+struct ScanlineWrite scanline_writes[SCANLINE_MAX_WRITES];
+volatile int scanline_num_writes = 0;
+
+/* change some bits of a register along with the tables being built, a later
+ * change to the same register is merged into the earlier one */
+void scanline_write(volatile unsigned short *reg, unsigned short mask, unsigned short value)
+{
+    for (int i = 0; i < scanline_num_writes; i++)
+    {
+        if (scanline_writes[i].reg == reg)
         {
-            /* disable the sound and DMA transfer on channel B */
-            *sound_control &= ~(SOUND_B_RIGHT_CHANNEL | SOUND_B_LEFT_CHANNEL | SOUND_B_FIFO_RESET);
-            *dma2_control = 0;
+            scanline_writes[i].mask |= mask;
+            scanline_writes[i].value = (scanline_writes[i].value & ~mask) | (value & mask);
+            return;
         }
-        else
+    }
+
+    /* with no room left it just goes straight in */
+    if (scanline_num_writes >= SCANLINE_MAX_WRITES)
+    {
+        *reg = (*reg & ~mask) | (value & mask);
+        return;
+    }
+
+    scanline_writes[scanline_num_writes].reg = reg;
+    scanline_writes[scanline_num_writes].mask = mask;
+    scanline_writes[scanline_num_writes].value = value & mask;
+    scanline_num_writes++;
+}
+
+/* start building the tables for the next frame */
+void scanline_begin()
+{
+    /* hold back any table from an earlier call so the vblank handler never
+     * swaps in one that is half built */
+    scanline_pending = 0;
+
+    /* pick whichever table is not being streamed */
+    scanline_back = (scanline_front == 0) ? 1 : 0;
+
+    if (scanline_claimed == 0)
+    {
+        scanline_first = 0;
+        scanline_stride = 0;
+        return;
+    }
+
+    /* the dma writes one contiguous run of registers, from the first claimed
+     * register up to the last */
+    int first = __builtin_ctz(scanline_claimed);
+    int last = 31 - __builtin_clz(scanline_claimed);
+    scanline_first = first;
+    scanline_stride = last - first + 1;
+
+    /* any unclaimed register caught inside the run keeps its single value */
+    unsigned short *table = scanline_tables[scanline_back];
+    for (int reg = first; reg <= last; reg++)
+    {
+        if (!(scanline_claimed & (1 << reg)))
         {
-            channel_b_vblanks_remaining--;
+            unsigned short value = scanline_static[reg];
+            unsigned short *entry = table + (reg - first);
+            for (int line = 0; line <= SCREEN_HEIGHT; line++)
+            {
+                *entry = value;
+                entry += scanline_stride;
+            }
         }
     }
+}
 
-    /* restore/enable interrupts */
-    *interrupt_state = temp;
-    *interrupt_enable = 1;
+/* returns the entry for line 0 of a claimed register in the table being built,
+ * the entry for each next line is scanline_stride further along */
+unsigned short *scanline_column(int reg)
+{
+    return scanline_tables[scanline_back] + (reg - scanline_first);
 }
 
-/* function to set text on the screen at a given location */
-void set_text(char *str, int row, int col)
+/* fill a whole column with one value */
+void scanline_fill(int reg, unsigned short value)
 {
-    /* find the index in the texmap to draw to */
-    int index = row * 32 + col;
+    unsigned short *entry = scanline_column(reg);
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        *entry = value;
+        entry += scanline_stride;
+    }
+}
 
-    /* the first 32 characters are missing from the map (controls etc.) */
-    int missing = 32;
+/* add a sine wave to a column, amplitude is in pixels, frequency is how many
+ * 256ths of a wave each line steps, and phase is where line 0 starts */
+void scanline_wobble(int reg, int amplitude, int frequency, int phase)
+{
+    unsigned short *entry = scanline_column(reg);
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        *entry += (sin_lut[(phase + line * frequency) & 255] * amplitude) >> 12;
+        entry += scanline_stride;
+    }
+}
+
+/* hand the finished tables to the vblank handler */
+void scanline_end()
+{
+    scanline_pending = 1;
+}
 
-    /* pointer to text map */
-    volatile unsigned short *ptr = screen_block(24);
+/* called from the vblank handler to restart the dma from the top of the screen */
+void scanline_vblank()
+{
+    /* stop the transfer from last frame */
+    *dma0_control = 0;
 
-    /* for each character */
-    while (*str)
+    /* swap in the newly finished table if there is one */
+    if (scanline_pending)
     {
-        /* place this character in the map */
-        ptr[index] = *str - missing;
+        scanline_pending = 0;
 
-        /* move onto the next character */
-        index++;
-        str++;
+        /* the register changes made along with the tables go in now too */
+        for (int i = 0; i < scanline_num_writes; i++)
+        {
+            struct ScanlineWrite *write = &scanline_writes[i];
+            *write->reg = (*write->reg & ~write->mask) | write->value;
+        }
+        scanline_num_writes = 0;
+
+        if (scanline_stride == 0)
+        {
+            /* nothing is per line any more, put back the single values */
+            for (int reg = 0; reg < SCANLINE_REGS; reg++)
+            {
+                ((volatile unsigned short *)SCANLINE_BASE)[reg] = scanline_static[reg];
+            }
+            scanline_front = -1;
+        }
+        else
+        {
+            scanline_front = scanline_back;
+        }
+        scanline_front_first = scanline_first;
+        scanline_front_stride = scanline_stride;
+    }
+
+    if (scanline_front < 0)
+    {
+        return;
+    }
+
+    /* line 0 is drawn before the first hblank, so set it up directly */
+    unsigned short *table = scanline_tables[scanline_front];
+    volatile unsigned short *regs = (volatile unsigned short *)SCANLINE_BASE + scanline_front_first;
+    for (int i = 0; i < scanline_front_stride; i++)
+    {
+        regs[i] = table[i];
     }
+
+    /* then each hblank copies the next line's values in */
+    *dma0_source = (unsigned int)(table + scanline_front_stride);
+    *dma0_destination = (unsigned int)regs;
+    *dma0_control = scanline_front_stride | DMA_DEST_RELOAD | DMA_REPEAT | DMA_16 |
+                    DMA_SYNC_TO_HBLANK | DMA_ENABLE;
 }
 
-/* function to setup background 0 for this program */
-void setup_background()
-{
+/* VBLANK QUEUE */
 
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short *)bg_palette, (unsigned short *)background_palette, PALETTE_SIZE);
+/* a copy into video memory which has to wait for the next vblank */
+struct VblankCopy
+{
+    volatile void *dest;
+    const void *source;
+    int words;
+};
 
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short *)char_block(0), (unsigned short *)background_data,
-                 (background_width * background_height) / 2);
+/* copies are done in the order they were added, the main loop adds them and
+ * the vblank handler takes them off */
+#define VBLANK_QUEUE_SIZE 32
+struct VblankCopy vblank_queue[VBLANK_QUEUE_SIZE];
+struct Ring vblank_ring = {0, 0, VBLANK_QUEUE_SIZE - 1};
 
-    /* set all control the bits in this register */
-    *bg0_control = 1 |         /* priority, 0 is highest, 3 is lowest */
-                   (0 << 2) |  /* the char block the image data is stored in */
-                   (0 << 6) |  /* the mosaic flag */
-                   (1 << 7) |  /* color mode, 0 is 16 colors, 1 is 256 colors */
-                   (16 << 8) | /* the screen block the tile data is stored in */
-                   (1 << 13) | /* wrapping flag */
-                   (0 << 14);  /* bg size, 0 is 256x256 */
+/* counts up once per vblank, only the vblank handler uses it, the main
+ * loop gets it from frame_info_read along with the sound counters */
+unsigned int frame_count = 0;
 
-    /* set all control the bits in this register */
-    *bg1_control = 0 |         /* priority, 0 is highest, 3 is lowest */
-                   (0 << 2) |  /* the char block the image data is stored in */
-                   (0 << 6) |  /* the mosaic flag */
-                   (1 << 7) |  /* color mode, 0 is 16 colors, 1 is 256 colors */
-                   (17 << 8) | /* the screen block the tile data is stored in */
-                   (1 << 13) | /* wrapping flag */
-                   (0 << 14);  /* bg size, 0 is 256x256 */
+/* add a copy of some 32 bit words for the next vblank, returns 0 if the queue is full */
+int vblank_queue_push(volatile void *dest, const void *source, int words)
+{
+    int slot = ring_reserve(&vblank_ring);
+    if (slot < 0)
+    {
+        return 0;
+    }
 
-    /* load the tile data into screen block 16 */
-    memcpy16_dma((unsigned short *)screen_block(16), (unsigned short *)map, map_width * map_height);
-    /* load the tile data into screen block 17 */
-    memcpy16_dma((unsigned short *)screen_block(17), (unsigned short *)map2, map2_width * map2_height);
+    struct VblankCopy *copy = &vblank_queue[slot];
+    copy->dest = dest;
+    copy->source = source;
+    copy->words = words;
+    ring_publish(&vblank_ring);
+    return 1;
 }
 
-/* just kill time */
-void delay(unsigned int amount)
+/* called from the vblank handler to do all of the waiting copies */
+void vblank_queue_flush()
 {
-    for (int i = 0; i < amount * 10; i++)
-        ;
+    int slot;
+    while ((slot = ring_peek(&vblank_ring)) >= 0)
+    {
+        *dma3_source = (unsigned int)vblank_queue[slot].source;
+        *dma3_destination = (unsigned int)vblank_queue[slot].dest;
+        *dma3_control = vblank_queue[slot].words | DMA_32 | DMA_ENABLE;
+        ring_release(&vblank_ring);
+    }
 }
 
-/* a sprite is a moveable image on the screen */
-struct Sprite
+/* the values the vblank handler publishes each frame */
+struct FrameInfo
 {
-    unsigned short attribute0;
-    unsigned short attribute1;
-    unsigned short attribute2;
-    unsigned short attribute3;
+    unsigned int frame;
+    unsigned int channel_a_vblanks_remaining;
+    unsigned int channel_b_vblanks_remaining;
 };
 
-/* array of all the sprites available on the GBA */
-struct Sprite sprites[NUM_SPRITES];
-int next_sprite_index = 0;
+struct FrameInfo frame_info;
+struct Seqlock frame_info_lock;
 
-/* the different sizes of sprites which are possible */
-enum SpriteSize
+/* get a copy of the values from the last vblank which all go together */
+void frame_info_read(struct FrameInfo *info)
 {
-    SIZE_8_8,
-    SIZE_16_16,
-    SIZE_32_32,
-    SIZE_64_64,
-    SIZE_16_8,
-    SIZE_32_8,
-    SIZE_32_16,
-    SIZE_64_32,
-    SIZE_8_16,
-    SIZE_8_32,
-    SIZE_16_32,
-    SIZE_32_64
-};
+    unsigned int sequence;
+    do
+    {
+        sequence = seqlock_read_begin(&frame_info_lock);
+        *info = frame_info;
+    } while (seqlock_read_retry(&frame_info_lock, sequence));
+}
 
-/* SPRITE */
+/* wait until the next vblank has started, unlike wait_vblank this never
+ * returns twice in the same frame */
+void wait_next_frame()
+{
+    struct FrameInfo info;
+    frame_info_read(&info);
+    unsigned int frame = info.frame;
+    do
+    {
+        frame_info_read(&info);
+    } while (info.frame == frame);
+}
 
-/* function to initialize a sprite with its properties, and return a pointer */
-struct Sprite *sprite_init(int x, int y, enum SpriteSize size,
-                           int horizontal_flip, int vertical_flip, int tile_index, int priority)
+/* this function is called each vblank to get the timing of sounds right, the
+ * bios keeps other interrupts out while it runs so nothing needs turning off */
+void on_vblank()
 {
+    /* save current state of interrupt */
+    unsigned short temp = *interrupt_state;
 
-    /* grab the next index */
-    int index = next_sprite_index++;
+    /* look for vertical refresh */
+    if ((temp & INTERRUPT_VBLANK) == INTERRUPT_VBLANK)
+    {
+        frame_count++;
 
-    /* setup the bits used for each shape/size possible */
+        /* restart the per line register tables */
+        scanline_vblank();
+
+        /* do the copies which were waiting for vblank */
+        vblank_queue_flush();
+
+        /* start any sounds the main loop asked for and keep the timing */
+        sound_vblank();
+
+        seqlock_write_begin(&frame_info_lock);
+        frame_info.frame = frame_count;
+        frame_info.channel_a_vblanks_remaining = channel_a_vblanks_remaining;
+        frame_info.channel_b_vblanks_remaining = channel_b_vblanks_remaining;
+        seqlock_write_end(&frame_info_lock);
+    }
+
+    /* acknowledge the interrupts */
+    *interrupt_state = temp;
+}
+
+/* RANDOM NUMBERS */
+
+/* the random numbers start from here, and again at the start of a recording or replay */
+#define RANDOM_SEED 0x2545f491
+unsigned int random_state = RANDOM_SEED;
+
+/* step a xorshift generator on from state and return its next number, the
+ * AI calls this from fast memory so calls to it go the long way */
+LONG_CALL unsigned int xorshift(unsigned int *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* returns the next number from the game's generator */
+unsigned int random_next()
+{
+    return xorshift(&random_state);
+}
+
+/* RECORDING */
+
+/* the cartridge save memory, which can only be read and written a byte at a
+ * time - emulators keep it in a .sav file next to the rom, and a host build
+ * keeps it in an array for as long as it runs */
+#define SAVE_SIZE 0x8000
+#ifdef __arm__
+volatile unsigned char *save_memory = (volatile unsigned char *)0xE000000;
+#else
+unsigned char save_backing[SAVE_SIZE];
+volatile unsigned char *save_memory = save_backing;
+#endif
+
+/* flash carts and emulators find the kind of save memory by looking through
+ * the rom for this string, it has to be word aligned and must be kept even
+ * though nothing reads it */
+const char save_type[] __attribute__((aligned(4), used)) = "SRAM_V113";
+
+/* a recording starts with this tag and the number of runs in it, then each
+ * run is the buttons held and how many frames in a row they were held for */
+#define RECORD_TAG 0x31434552
+#define RECORD_HEADER 8
+#define RECORD_RUN_SIZE 4
+#define MAX_RECORD_RUNS ((SAVE_SIZE - RECORD_HEADER) / RECORD_RUN_SIZE)
+
+/* where the buttons come from */
+#define INPUT_LIVE 0
+#define INPUT_RECORDING 1
+#define INPUT_REPLAYING 2
+int input_mode = INPUT_LIVE;
+
+/* the run being built or played back, and which run number it is */
+unsigned short record_mask = 0;
+unsigned int record_length = 0;
+unsigned int record_run = 0;
+unsigned int record_runs = 0;
+
+/* write a number to save memory a byte at a time */
+void save_write(int offset, unsigned int value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        save_memory[offset + i] = value >> (i * 8);
+    }
+}
+
+/* read a number from save memory a byte at a time */
+unsigned int save_read(int offset, int bytes)
+{
+    unsigned int value = 0;
+    for (int i = 0; i < bytes; i++)
+    {
+        value |= save_memory[offset + i] << (i * 8);
+    }
+    return value;
+}
+
+/* store the run built so far */
+void record_flush()
+{
+    if (record_length && record_run < MAX_RECORD_RUNS)
+    {
+        int offset = RECORD_HEADER + record_run * RECORD_RUN_SIZE;
+        save_write(offset, record_mask, 2);
+        save_write(offset + 2, record_length, 2);
+        record_run++;
+    }
+    record_length = 0;
+}
+
+/* start recording the buttons from the next frame on */
+void record_start()
+{
+    input_mode = INPUT_RECORDING;
+    record_length = 0;
+    record_run = 0;
+    random_state = RANDOM_SEED;
+}
+
+/* finish the recording and write the header so it can be played back */
+void record_stop()
+{
+    if (input_mode != INPUT_RECORDING)
+    {
+        return;
+    }
+    record_flush();
+    save_write(0, RECORD_TAG, 4);
+    save_write(4, record_run, 4);
+    input_mode = INPUT_LIVE;
+}
+
+/* start playing back the saved recording in place of the buttons, returns
+ * 0 if there is not one */
+int replay_start()
+{
+    if (save_read(0, 4) != RECORD_TAG)
+    {
+        return 0;
+    }
+    record_runs = save_read(4, 4);
+    record_run = 0;
+    record_length = 0;
+    input_mode = INPUT_REPLAYING;
+    random_state = RANDOM_SEED;
+    return 1;
+}
+
+/* returns the buttons for this frame with a set bit for each held down,
+ * from the keypad or the recording, and records them if recording */
+unsigned short input_read()
+{
+    if (input_mode == INPUT_REPLAYING)
+    {
+        /* move on to the next run when this one is used up */
+        if (record_length == 0)
+        {
+            if (record_run >= record_runs)
+            {
+                /* the recording is over, hand back to the keypad */
+                input_mode = INPUT_LIVE;
+                return ~*buttons & ALL_BUTTONS;
+            }
+            int offset = RECORD_HEADER + record_run * RECORD_RUN_SIZE;
+            record_mask = save_read(offset, 2);
+            record_length = save_read(offset + 2, 2);
+            record_run++;
+        }
+        record_length--;
+        return record_mask;
+    }
+
+    /* the register has a bit cleared for each button held down */
+    unsigned short held = ~*buttons & ALL_BUTTONS;
+
+    if (input_mode == INPUT_RECORDING)
+    {
+        /* runs of the same buttons are stored once with a count */
+        if (held != record_mask || record_length == 0xffff)
+        {
+            record_flush();
+            record_mask = held;
+        }
+        record_length++;
+    }
+    return held;
+}
+
+/* INPUT */
+
+/* the keypad interrupt control register, and its bits */
+volatile unsigned short *keypad_control = (volatile unsigned short *)0x4000132;
+#define KEYPAD_IRQ_ENABLE 0x4000
+#define KEYPAD_IRQ_ALL 0x8000
+
+/* the interrupt bit for the keypad */
+#define INTERRUPT_KEYPAD 0x1000
+
+/* this display control bit blanks the screen */
+#define FORCED_BLANK 0x80
+
+/* a held button starts repeating after this many frames, then every so many */
+#define REPEAT_DELAY 20
+#define REPEAT_RATE 4
+
+/* the buttons held down this frame, and the ones which went down or came up
+ * since last frame, a set bit means the button */
+unsigned short input_held = 0;
+unsigned short input_pressed = 0;
+unsigned short input_released = 0;
+
+/* the buttons which went down or are repeating this frame */
+unsigned short input_repeat = 0;
+
+/* how many frames each button has been held for */
+unsigned char input_held_frames[NUM_BUTTONS];
+
+/* how many frames ago each button was last pressed, and whether that press
+ * has been used yet - this lets a press count a little before it can be used */
+unsigned char input_press_age[NUM_BUTTONS];
+unsigned short input_unused = 0;
+
+/* read the buttons once, at the start of each frame */
+void input_latch()
+{
+    unsigned short held = input_read();
+
+    input_pressed = held & ~input_held;
+    input_released = input_held & ~held;
+    input_held = held;
+    input_repeat = input_pressed;
+    input_unused |= input_pressed;
+
+    for (int i = 0; i < NUM_BUTTONS; i++)
+    {
+        unsigned short bit = 1 << i;
+
+        /* time held, for repeating */
+        if (held & bit)
+        {
+            /* once repeating, the count loops back to the delay each time */
+            input_held_frames[i]++;
+            if (input_held_frames[i] == REPEAT_DELAY + REPEAT_RATE)
+            {
+                input_held_frames[i] = REPEAT_DELAY;
+            }
+            if (input_held_frames[i] == REPEAT_DELAY)
+            {
+                input_repeat |= bit;
+            }
+        }
+        else
+        {
+            input_held_frames[i] = 0;
+        }
+
+        /* time since pressed, for buffering */
+        if (input_pressed & bit)
+        {
+            input_press_age[i] = 0;
+        }
+        else if (input_press_age[i] < 255)
+        {
+            input_press_age[i]++;
+        }
+    }
+}
+
+/* this function checks whether a particular button is held down */
+unsigned char button_pressed(unsigned short button)
+{
+    return (input_held & button) != 0;
+}
+
+/* returns whether a button went down this frame */
+unsigned char button_hit(unsigned short button)
+{
+    return (input_pressed & button) != 0;
+}
+
+/* returns whether a button came up this frame */
+unsigned char button_released(unsigned short button)
+{
+    return (input_released & button) != 0;
+}
+
+/* returns whether a button went down or is repeating this frame, for menus */
+unsigned char button_repeat(unsigned short button)
+{
+    return (input_repeat & button) != 0;
+}
+
+/* returns whether a button was pressed within the last few frames and that
+ * press has not been used yet */
+unsigned char button_buffered(unsigned short button, int frames)
+{
+    int i = __builtin_ctz(button);
+    return (input_unused & button) && input_press_age[i] < frames;
+}
+
+/* use up a buffered press so it does not count twice */
+void button_consume(unsigned short button)
+{
+    input_unused &= ~button;
+}
+
+/* sleep with the screen and sound off until a button is pressed, the keypad
+ * interrupt wakes the system back up */
+void input_sleep(unsigned short wake_buttons)
+{
+    /* a replay carries straight on */
+    if (input_mode == INPUT_REPLAYING)
+    {
+        return;
+    }
+
+    /* the buttons must be let go of first or they wake it right away */
+    while (~*buttons & wake_buttons)
+    {
+        wait_next_frame();
+    }
+
+    unsigned long display = *display_control;
+    unsigned short sound = *master_sound;
+    *display_control = display | FORCED_BLANK;
+    *master_sound = 0;
+
+    /* wake up when any of the buttons goes down */
+    *keypad_control = wake_buttons | KEYPAD_IRQ_ENABLE;
+    *interrupt_selection |= INTERRUPT_KEYPAD;
+
+    /* the bios stop call turns off the clocks until an interrupt */
+#if defined(__thumb__)
+    asm volatile("swi 0x03" ::: "r0", "r1", "r2", "r3", "memory");
+#elif defined(__arm__)
+    asm volatile("swi 0x030000" ::: "r0", "r1", "r2", "r3", "memory");
+#endif
+
+    *interrupt_selection &= ~INTERRUPT_KEYPAD;
+    *keypad_control = 0;
+    *master_sound = sound;
+    *display_control = display;
+
+    /* the press which woke it up is not passed on to the game, and the
+     * buttons are read straight from the keypad so the frame isn't recorded,
+     * since a replay never sleeps to read it back */
+    input_held = ~*buttons & ALL_BUTTONS;
+    input_pressed = 0;
+    input_released = 0;
+    input_repeat = 0;
+    input_unused = 0;
+}
+
+/* TEXT */
+
+/* text goes on bg2, with the font in char block 1 and the map in screen block 24 */
+#define TEXT_CHAR_BLOCK 1
+#define TEXT_SCREEN_BLOCK 24
+
+/* the font uses the last 16 color palette bank, color 1 of it is the text color */
+#define TEXT_PALETTE_BANK 15
+#define TEXT_COLOR 0x7fff
+
+/* the text map is 32x32 characters */
+#define TEXT_MAP_SIZE 32
+
+/* a copy of the text map as it should be */
+unsigned short text_shadow[TEXT_MAP_SIZE * TEXT_MAP_SIZE];
+
+/* the cells which differ from video memory, with one bit per cell so that a
+ * cell is only ever in the list once */
+unsigned short text_dirty[TEXT_MAP_SIZE * TEXT_MAP_SIZE];
+unsigned int text_dirty_bits[TEXT_MAP_SIZE * TEXT_MAP_SIZE / 32];
+int text_num_dirty = 0;
+
+/* set up bg2 to show text, and load the font into it */
+void text_init()
+{
+    /* expand each row of the font to 4 bits per pixel, the first pixel is the low bits */
+    volatile unsigned int *dest = (volatile unsigned int *)char_block(TEXT_CHAR_BLOCK);
+    for (int i = 0; i < font_glyphs * 8; i++)
+    {
+        unsigned int row = 0;
+        for (int x = 0; x < 8; x++)
+        {
+            if (font[i] & (0x80 >> x))
+            {
+                row |= 1 << (x * 4);
+            }
+        }
+        dest[i] = row;
+    }
+
+    bg_palette[TEXT_PALETTE_BANK * 16 + 1] = TEXT_COLOR;
+
+    /* start with every cell a space */
+    volatile unsigned short *map = screen_block(TEXT_SCREEN_BLOCK);
+    for (int i = 0; i < TEXT_MAP_SIZE * TEXT_MAP_SIZE; i++)
+    {
+        text_shadow[i] = TEXT_PALETTE_BANK << 12;
+        map[i] = text_shadow[i];
+    }
+
+    /* set all control the bits in this register */
+    *bg2_control = 0 |                          /* priority, 0 is highest, 3 is lowest */
+                   (TEXT_CHAR_BLOCK << 2) |     /* the char block the image data is stored in */
+                   (0 << 6) |                   /* the mosaic flag */
+                   (0 << 7) |                   /* color mode, 0 is 16 colors, 1 is 256 colors */
+                   (TEXT_SCREEN_BLOCK << 8) |   /* the screen block the tile data is stored in */
+                   (0 << 13) |                  /* wrapping flag */
+                   (0 << 14);                   /* bg size, 0 is 256x256 */
+
+    *display_control |= BG2_ENABLE;
+}
+
+/* put a tile into one cell of the text map if it is not there already */
+void text_put(int index, unsigned short tile)
+{
+    if (text_shadow[index] == tile)
+    {
+        return;
+    }
+    text_shadow[index] = tile;
+
+    if (!(text_dirty_bits[index >> 5] & (1 << (index & 31))))
+    {
+        text_dirty_bits[index >> 5] |= 1 << (index & 31);
+        text_dirty[text_num_dirty++] = index;
+    }
+}
+
+/* function to set text on the screen at a given location */
+void set_text(char *str, int row, int col)
+{
+    /* find the index in the texmap to draw to */
+    int index = row * 32 + col;
+
+    /* the first 32 characters are missing from the map (controls etc.) */
+    int missing = 32;
+
+    /* for each character */
+    while (*str)
+    {
+        /* place this character in the map */
+        text_put(index, (*str - missing) | (TEXT_PALETTE_BANK << 12));
+
+        /* move onto the next character */
+        index++;
+        str++;
+    }
+}
+
+/* blank out some characters of a row */
+void text_clear(int row, int col, int count)
+{
+    int index = row * 32 + col;
+    for (int i = 0; i < count; i++)
+    {
+        text_put(index + i, TEXT_PALETTE_BANK << 12);
+    }
+}
+
+/* write a number into a string, right aligned in a width padded with the
+ * pad character (or as wide as it needs if width is 0), returns the length */
+int text_format_int(char *str, int value, int width, char pad)
+{
+    char digits[12];
+    int count = 0;
+    unsigned int n = value < 0 ? -value : value;
+
+    /* pull off digits from the right, dividing by 10 with a multiply */
+    do
+    {
+        unsigned int q = ((unsigned long long)n * 0xcccccccdULL) >> 35;
+        digits[count++] = '0' + (n - q * 10);
+        n = q;
+    } while (n);
+
+    if (value < 0)
+    {
+        digits[count++] = '-';
+    }
+
+    /* pad on the left then copy the digits in order */
+    int length = 0;
+    while (length + count < width)
+    {
+        str[length++] = pad;
+    }
+    while (count)
+    {
+        str[length++] = digits[--count];
+    }
+    str[length] = 0;
+    return length;
+}
+
+/* write a number on the screen right aligned in a width */
+void text_int(int value, int row, int col, int width)
+{
+    char str[16];
+    text_format_int(str, value, width, ' ');
+    set_text(str, row, col);
+}
+
+/* copy only the changed cells into the text map, call this during vblank */
+void text_update()
+{
+    volatile unsigned short *map = screen_block(TEXT_SCREEN_BLOCK);
+    for (int i = 0; i < text_num_dirty; i++)
+    {
+        int index = text_dirty[i];
+        map[index] = text_shadow[index];
+        text_dirty_bits[index >> 5] &= ~(1 << (index & 31));
+    }
+    text_num_dirty = 0;
+}
+
+/* PROPORTIONAL TEXT */
+
+/* ors a glyph into a strip of tiles at a pixel position, this is arm code in
+ * iwram which is too far away for a normal call */
+LONG_CALL void vwf_blit(unsigned int *strip, const unsigned int *glyph, int x);
+
+/* the tile pool starts after the font in the text char block, it is split into
+ * slots which each hold one rendered line */
+#define VWF_FIRST_TILE 128
+#define VWF_SLOTS 12
+#define VWF_SLOT_TILES 32
+
+/* a line is at most one tile less than a slot, the last tile catches the
+ * part of a glyph which spills over the end */
+#define VWF_MAX_TILES (VWF_SLOT_TILES - 1)
+#define VWF_MAX_CHARS 48
+
+/* each slot remembers the line it holds so drawing it again costs nothing */
+struct VwfSlot
+{
+    unsigned int hash;
+    int tiles;
+    unsigned int last_used;
+    char text[VWF_MAX_CHARS + 1];
+};
+
+struct VwfSlot vwf_slots[VWF_SLOTS];
+
+/* the slots' tiles are drawn here and then copied to video memory */
+unsigned int vwf_tiles[VWF_SLOTS][VWF_SLOT_TILES * 8] EWRAM_BSS;
+
+/* the font expanded to 4 bits per pixel, shifted so each glyph starts at its first pixel */
+unsigned int vwf_glyphs[font_glyphs * 8];
+
+/* expand the font for proportional text, call after text_init */
+void vwf_init()
+{
+    for (int g = 0; g < font_glyphs; g++)
+    {
+        for (int y = 0; y < 8; y++)
+        {
+            unsigned int bits = (font[g * 8 + y] << font_lefts[g]) & 0xff;
+            unsigned int row = 0;
+            for (int x = 0; x < 8; x++)
+            {
+                if (bits & (0x80 >> x))
+                {
+                    row |= 1 << (x * 4);
+                }
+            }
+            vwf_glyphs[g * 8 + y] = row;
+        }
+    }
+
+    for (int i = 0; i < VWF_SLOTS; i++)
+    {
+        vwf_slots[i].tiles = 0;
+        vwf_slots[i].text[0] = 0;
+        vwf_slots[i].last_used = 0;
+    }
+}
+
+/* returns how many pixels wide a string is */
+int vwf_width(const char *str)
+{
+    int width = 0;
+    while (*str)
+    {
+        width += font_widths[*str - font_first];
+        str++;
+    }
+    return width;
+}
+
+/* find the slot holding a string, or render it into the least recently used one */
+struct VwfSlot *vwf_render(const char *str)
+{
+    /* slots are stamped with the frame they were last used on */
+    struct FrameInfo info;
+    frame_info_read(&info);
+
+    /* hash the string to skip most slots without comparing */
+    unsigned int hash = 2166136261u;
+    int length = 0;
+    for (const char *c = str; *c && length < VWF_MAX_CHARS; c++, length++)
+    {
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    }
+
+    struct VwfSlot *oldest = &vwf_slots[0];
+    for (int i = 0; i < VWF_SLOTS; i++)
+    {
+        struct VwfSlot *slot = &vwf_slots[i];
+        if (slot->hash == hash && slot->tiles)
+        {
+            int same = 1;
+            for (int j = 0; j <= length && same; j++)
+            {
+                same = (j == length) ? slot->text[j] == 0 : slot->text[j] == str[j];
+            }
+            if (same)
+            {
+                slot->last_used = info.frame;
+                return slot;
+            }
+        }
+        if (slot->last_used < oldest->last_used)
+        {
+            oldest = slot;
+        }
+    }
+
+    /* not drawn yet, so render it into the oldest slot */
+    struct VwfSlot *slot = oldest;
+    int index = slot - vwf_slots;
+    unsigned int *strip = vwf_tiles[index];
+
+    int tiles = (vwf_width(str) + 7) >> 3;
+    if (tiles > VWF_MAX_TILES)
+    {
+        tiles = VWF_MAX_TILES;
+    }
+    if (tiles == 0)
+    {
+        tiles = 1;
+    }
+
+    /* clear just the tiles this line covers, plus the spill tile */
+    for (int i = 0; i < (tiles + 1) * 8; i++)
+    {
+        strip[i] = 0;
+    }
+
+    int x = 0;
+    for (int i = 0; i < length; i++)
+    {
+        int g = str[i] - font_first;
+        if (x + font_widths[g] > tiles * 8)
+        {
+            break;
+        }
+        if (str[i] != ' ')
+        {
+            vwf_blit(strip, &vwf_glyphs[g * 8], x);
+        }
+        slot->text[i] = str[i];
+        x += font_widths[g];
+    }
+    slot->text[length] = 0;
+    slot->hash = hash;
+    slot->tiles = tiles;
+    slot->last_used = info.frame;
+
+    /* copy only the tiles which were drawn */
+    volatile unsigned int *dest = (volatile unsigned int *)char_block(TEXT_CHAR_BLOCK) +
+                                  (VWF_FIRST_TILE + index * VWF_SLOT_TILES) * 8;
+    if (!vblank_queue_push(dest, strip, tiles * 8))
+    {
+        /* no room to copy it this frame, so render it again next time */
+        slot->tiles = 0;
+    }
+    return slot;
+}
+
+/* draw a string in proportional text starting at a cell of the text map,
+ * returns how many cells it covers */
+int vwf_draw(const char *str, int row, int col)
+{
+    struct VwfSlot *slot = vwf_render(str);
+    int first = VWF_FIRST_TILE + (slot - vwf_slots) * VWF_SLOT_TILES;
+
+    /* point the cells at the slot's tiles, unchanged cells are not rewritten */
+    int index = row * 32 + col;
+    for (int i = 0; i < slot->tiles; i++)
+    {
+        text_put(index + i, (first + i) | (TEXT_PALETTE_BANK << 12));
+    }
+    return slot->tiles;
+}
+
+/* function to setup background 0 for this program */
+void setup_background()
+{
+
+    /* load the palette from the image into palette memory*/
+    memcpy16_dma((unsigned short *)bg_palette, (unsigned short *)background_palette, PALETTE_SIZE);
+
+    /* set all control the bits in this register */
+    *bg0_control = 2 |         /* priority, 0 is highest, 3 is lowest */
+                   (0 << 2) |  /* the char block the image data is stored in */
+                   (0 << 6) |  /* the mosaic flag */
+                   (1 << 7) |  /* color mode, 0 is 16 colors, 1 is 256 colors */
+                   (16 << 8) | /* the screen block the tile data is stored in */
+                   (1 << 13) | /* wrapping flag */
+                   (0 << 14);  /* bg size, 0 is 256x256 */
+
+    /* set all control the bits in this register */
+    *bg1_control = 1 |         /* priority, 0 is highest, 3 is lowest */
+                   (0 << 2) |  /* the char block the image data is stored in */
+                   (0 << 6) |  /* the mosaic flag */
+                   (1 << 7) |  /* color mode, 0 is 16 colors, 1 is 256 colors */
+                   (17 << 8) | /* the screen block the tile data is stored in */
+                   (1 << 13) | /* wrapping flag */
+                   (0 << 14);  /* bg size, 0 is 256x256 */
+
+    /* the tile images and maps are loaded by the scenes which use them */
+}
+
+/* TILE ANIMATION */
+
+/* a tile of the level which changes over time - each of its frames is
+ * another tile of the background image, which is copied over it in char
+ * block 0 at the vblank, so every place the maps use it changes at once */
+struct TileFrame
+{
+    unsigned char tile;
+    unsigned char steps;    /* how many game frames it shows for */
+};
+
+struct TileAnimation
+{
+    int tile;
+    const struct TileFrame *frames;
+    int count;
+};
+
+/* an 8bpp tile is 64 bytes */
+#define TILE_WORDS 16
+
+/* the four party lights on the wall chase each other's colors round, and
+ * the last one has a loose bulb */
+const struct TileFrame light_chase_a[] = {{4, 16}, {5, 16}, {6, 16}, {7, 16}};
+const struct TileFrame light_chase_b[] = {{5, 16}, {6, 16}, {7, 16}, {4, 16}};
+const struct TileFrame light_chase_c[] = {{6, 16}, {7, 16}, {4, 16}, {5, 16}};
+const struct TileFrame light_flicker[] = {{7, 50}, {6, 3}, {7, 4}, {6, 2}, {7, 30}, {6, 3}};
+
+const struct TileAnimation tile_animations[] = {
+    {4, light_chase_a, 4},
+    {5, light_chase_b, 4},
+    {6, light_chase_c, 4},
+    {7, light_flicker, 6},
+};
+
+#define NUM_TILE_ANIMATIONS (int)(sizeof(tile_animations) / sizeof(tile_animations[0]))
+
+/* which frame each animation is on and how long it has shown */
+int tile_animation_frame[NUM_TILE_ANIMATIONS];
+int tile_animation_counter[NUM_TILE_ANIMATIONS];
+
+/* copy a tile of the background image over a tile in char block 0 at the next vblank */
+void tile_upload(int dest, int source)
+{
+    vblank_queue_push(char_block(0) + dest * TILE_WORDS * 2, background_data + source * TILE_WORDS * 4,
+                      TILE_WORDS);
+}
+
+/* start every animation from its first frame, which is the tile as it is */
+void tile_animation_reset()
+{
+    for (int i = 0; i < NUM_TILE_ANIMATIONS; i++)
+    {
+        tile_animation_frame[i] = 0;
+        tile_animation_counter[i] = 0;
+    }
+}
+
+/* move the animations along a frame, only a tile whose frame changes is copied */
+void tile_animation_update()
+{
+    for (int i = 0; i < NUM_TILE_ANIMATIONS; i++)
+    {
+        const struct TileAnimation *animation = &tile_animations[i];
+        if (++tile_animation_counter[i] < animation->frames[tile_animation_frame[i]].steps)
+        {
+            continue;
+        }
+
+        tile_animation_counter[i] = 0;
+        if (++tile_animation_frame[i] >= animation->count)
+        {
+            tile_animation_frame[i] = 0;
+        }
+        tile_upload(animation->tile, animation->frames[tile_animation_frame[i]].tile);
+    }
+}
+
+/* put the animated tiles back as they are in the image, so char block 0
+ * matches what the asset lists think is loaded there */
+void tile_animation_stop()
+{
+    for (int i = 0; i < NUM_TILE_ANIMATIONS; i++)
+    {
+        tile_upload(tile_animations[i].tile, tile_animations[i].tile);
+    }
+    tile_animation_reset();
+}
+
+/* PARALLAX */
+
+/* a band of scanlines which scroll at their own rates, rates are in 1/256ths
+ * of the camera scroll so 256 moves with the camera */
+struct ParallaxBand
+{
+    int top;
+    int bg0_rate;
+    int bg1_rate;
+};
+
+/* the ceiling drifts slowest, then the walls, then the floor, the tiles afton
+ * walks on keep moving at the same rate everywhere */
+const struct ParallaxBand parallax_bands[] = {
+    {0, 128, 512},   /* ceiling */
+    {40, 256, 512},  /* walls */
+    {120, 384, 512}, /* floor */
+};
+
+#define NUM_PARALLAX_BANDS (int)(sizeof(parallax_bands) / sizeof(parallax_bands[0]))
+
+/* start streaming the x scroll of both tile layers per line */
+void parallax_init()
+{
+    scanline_claim(SCANLINE_BG0_X);
+    scanline_claim(SCANLINE_BG1_X);
+}
+
+/* go back to one unscrolled value for both tile layers */
+void parallax_disable()
+{
+    scanline_release(SCANLINE_BG0_X);
+    scanline_release(SCANLINE_BG1_X);
+    scanline_set_static(SCANLINE_BG0_X, 0);
+    scanline_set_static(SCANLINE_BG1_X, 0);
+}
+
+/* fill in the x scroll tables for a camera scroll, and add a wobble to them
+ * if the amplitude is not zero, this goes between scanline_begin and end */
+void parallax_build(int xscroll, int wobble_amplitude, int wobble_phase)
+{
+    unsigned short *bg0 = scanline_column(SCANLINE_BG0_X);
+    unsigned short *bg1 = scanline_column(SCANLINE_BG1_X);
+
+    /* each band is one value repeated down its lines */
+    for (int band = 0; band < NUM_PARALLAX_BANDS; band++)
+    {
+        int bottom = (band + 1 < NUM_PARALLAX_BANDS) ? parallax_bands[band + 1].top : SCREEN_HEIGHT + 1;
+        unsigned short x0 = (xscroll * parallax_bands[band].bg0_rate) >> 8;
+        unsigned short x1 = (xscroll * parallax_bands[band].bg1_rate) >> 8;
+
+        for (int line = parallax_bands[band].top; line < bottom; line++)
+        {
+            *bg0 = x0;
+            *bg1 = x1;
+            bg0 += scanline_stride;
+            bg1 += scanline_stride;
+        }
+    }
+
+    if (wobble_amplitude)
+    {
+        scanline_wobble(SCANLINE_BG0_X, wobble_amplitude, 6, wobble_phase);
+        scanline_wobble(SCANLINE_BG1_X, wobble_amplitude, 6, wobble_phase);
+    }
+}
+
+/* LIGHTING */
+
+/* this display control bit turns on window 0 */
+#define WINDOW0_ENABLE 0x2000
+
+/* the blending registers */
+volatile unsigned short *blend_control = (volatile unsigned short *)0x4000050;
+volatile unsigned short *blend_brightness = (volatile unsigned short *)0x4000054;
+
+/* bits for what is shown inside and outside of the windows */
+#define WINDOW_BG0 0x1
+#define WINDOW_BG1 0x2
+#define WINDOW_BG2 0x4
+#define WINDOW_BG3 0x8
+#define WINDOW_SPRITES 0x10
+#define WINDOW_BLEND 0x20
+
+/* bits for which layers are blended, and the effect used */
+#define BLEND_BG0 0x1
+#define BLEND_BG1 0x2
+#define BLEND_BG2 0x4
+#define BLEND_BG3 0x8
+#define BLEND_SPRITES 0x10
+#define BLEND_BACKDROP 0x20
+#define BLEND_DARKEN (3 << 6)
+
+/* how far the flashlight beam reaches, and the radius of the glow around afton */
+#define LIGHT_RANGE 112
+#define LIGHT_HALO 14
+
+/* for each line away from the flashlight, how far along the beam starts and
+ * ends - the beam spreads one line for every two pixels and its end is round */
+unsigned short light_near[SCREEN_HEIGHT + 1];
+unsigned char light_far[SCREEN_HEIGHT + 1];
+
+/* the half width of the glow for each line away from afton */
+unsigned char light_halo[SCREEN_HEIGHT + 1];
+
+/* the beam is cut short by walls with a fan of rays across it, its edges
+ * are atan(1/2) either side of straight ahead, about 19 256ths of a turn -
+ * the light goes a little way into what stops it so the wall itself is lit */
+#define LIGHT_SPREAD 18
+#define LIGHT_RAY_STEP 2
+#define LIGHT_RAYS (LIGHT_SPREAD * 2 / LIGHT_RAY_STEP + 1)
+#define LIGHT_INTO_WALL 6
+#define LIGHT_UNREACHED 0xff
+
+/* how far each ray of the fan got, and for each line of the screen how far
+ * from the flashlight the rays reach along it */
+unsigned short light_lengths[LIGHT_RAYS];
+unsigned char light_clip[SCREEN_HEIGHT + 1];
+
+/* casts a fan of rays and stores how far they get, the fan is in LINE OF SIGHT */
+void ray_fan(int x0, int y0, int angle, int angle_step, int count, int max_distance,
+             unsigned short *lengths);
+
+/* integer square root */
+int isqrt(int n)
+{
+    int root = 0;
+    int bit = 1 << 30;
+
+    while (bit > n)
+    {
+        bit >>= 2;
+    }
+
+    while (bit != 0)
+    {
+        if (n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/* set how dark everything outside of the light is, from 0 to 16 */
+void lighting_set_darkness(int level)
+{
+    *blend_brightness = level;
+}
+
+/* darken everything outside of window 0, whose shape is streamed per line */
+void lighting_init()
+{
+    /* work out the shape of the beam and glow once */
+    for (int dy = 0; dy <= SCREEN_HEIGHT; dy++)
+    {
+        light_near[dy] = dy * 2;
+        light_far[dy] = (dy < LIGHT_RANGE) ? isqrt(LIGHT_RANGE * LIGHT_RANGE - dy * dy) : 0;
+        light_halo[dy] = (dy < LIGHT_HALO) ? isqrt(LIGHT_HALO * LIGHT_HALO - dy * dy) : 0;
+    }
+
+    /* window 0 covers every line, its left and right come from the table */
+    scanline_claim(SCANLINE_WIN0_H);
+    scanline_set_static(SCANLINE_WIN0_V, SCREEN_HEIGHT);
+
+    /* everything shows inside the light, outside it is darkened */
+    scanline_set_static(SCANLINE_WININ, WINDOW_BG0 | WINDOW_BG1 | WINDOW_BG2 | WINDOW_BG3 | WINDOW_SPRITES);
+    scanline_set_static(SCANLINE_WINOUT, WINDOW_BG0 | WINDOW_BG1 | WINDOW_BG2 | WINDOW_BG3 |
+                                             WINDOW_SPRITES | WINDOW_BLEND);
+
+    /* bg2 is left out so text on it stays readable */
+    scanline_write(blend_control, 0xffff,
+                   BLEND_BG0 | BLEND_BG1 | BLEND_SPRITES | BLEND_BACKDROP | BLEND_DARKEN);
+    lighting_set_darkness(12);
+
+    /* the window goes on with the first table of its edges */
+    scanline_write((volatile unsigned short *)display_control, WINDOW0_ENABLE, WINDOW0_ENABLE);
+}
+
+/* turn the darkness off */
+void lighting_disable()
+{
+    scanline_release(SCANLINE_WIN0_H);
+    scanline_write((volatile unsigned short *)display_control, WINDOW0_ENABLE, 0);
+    scanline_write(blend_control, 0xffff, 0);
+}
+
+/* cast the fan of rays from a flashlight at x, y in the level and fill in
+ * light_clip, the outline joining the ends of the rays is stepped down line
+ * by line, and where more than one part of it crosses a line the nearest
+ * counts - lines it does not cross are dark */
+void lighting_clip(int x, int y, int scroll_y, int facing_left)
+{
+    int angle = (facing_left ? 128 : 0) - LIGHT_SPREAD;
+    ray_fan(x, y, angle, LIGHT_RAY_STEP, LIGHT_RAYS, LIGHT_RANGE, light_lengths);
+
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        light_clip[line] = LIGHT_UNREACHED;
+    }
+
+    /* the end of each ray, across from and up or down from the flashlight */
+    int last_across = 0, last_line = 0;
+    for (int i = 0; i < LIGHT_RAYS; i++, angle += LIGHT_RAY_STEP)
+    {
+        int length = light_lengths[i];
+        if (length < LIGHT_RANGE)
+        {
+            length += LIGHT_INTO_WALL;
+        }
+        int across = (sin_lut[(angle + 64) & 255] * length) >> 12;
+        int line = y - scroll_y + ((sin_lut[angle & 255] * length) >> 12);
+        across = across < 0 ? -across : across;
+
+        if (i > 0)
+        {
+            /* step along the edge from the last ray's end to this one's */
+            int top = last_line < line ? last_line : line;
+            int bottom = last_line < line ? line : last_line;
+            int from = last_line < line ? last_across : across;
+            int to = last_line < line ? across : last_across;
+            int step = bottom > top ? ((to - from) << 8) / (bottom - top) : 0;
+            int at = from << 8;
+
+            for (int edge = top; edge <= bottom; edge++, at += step)
+            {
+                if (edge >= 0 && edge <= SCREEN_HEIGHT)
+                {
+                    int reach = at >> 8;
+                    if (light_clip[edge] == LIGHT_UNREACHED || reach < light_clip[edge])
+                    {
+                        light_clip[edge] = reach;
+                    }
+                }
+            }
+        }
+        last_across = across;
+        last_line = line;
+    }
+}
+
+/* fill in the window table for a flashlight held at x, y in the level facing
+ * left or right, with the screen scrolled to scroll_x, scroll_y - this goes
+ * between scanline_begin and end */
+void lighting_build(int x, int y, int scroll_x, int scroll_y, int facing_left)
+{
+    lighting_clip(x, y, scroll_y, facing_left);
+
+    unsigned short *entry = scanline_column(SCANLINE_WIN0_H);
+    x -= scroll_x;
+    y -= scroll_y;
+
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        int dy = (line > y) ? line - y : y - line;
+        if (dy > SCREEN_HEIGHT)
+        {
+            dy = SCREEN_HEIGHT;
+        }
+
+        /* start with the glow around afton */
+        int left = x - light_halo[dy];
+        int right = x + light_halo[dy];
+        int lit = light_halo[dy] != 0;
+
+        /* then join on the beam if it reaches this line before a wall */
+        int far = light_far[dy];
+        if (light_clip[line] == LIGHT_UNREACHED)
+        {
+            far = 0;
+        }
+        else if (light_clip[line] < far)
+        {
+            far = light_clip[line];
+        }
+
+        if (light_near[dy] < far)
+        {
+            int start, end;
+            if (facing_left)
+            {
+                start = x - far;
+                end = x - light_near[dy];
+            }
+            else
+            {
+                start = x + light_near[dy];
+                end = x + far;
+            }
+
+            if (!lit || start < left)
+            {
+                left = start;
+            }
+            if (!lit || end > right)
+            {
+                right = end;
+            }
+            lit = 1;
+        }
+
+        /* keep it on screen, an empty window has both edges at 0 */
+        if (left < 0)
+        {
+            left = 0;
+        }
+        if (right > SCREEN_WIDTH)
+        {
+            right = SCREEN_WIDTH;
+        }
+        if (!lit || left >= right)
+        {
+            left = 0;
+            right = 0;
+        }
+
+        *entry = (left << 8) | right;
+        entry += scanline_stride;
+    }
+}
+
+/* AFFINE BACKGROUNDS */
+
+/* in mode 1 layer 2, and in mode 2 layers 2 and 3, are affine - their maps
+ * are one byte per tile, their tiles are always 256 color, and they can be
+ * rotated and scaled by a matrix which may be changed on each line */
+
+/* where each affine register is from the layer's first one, the matrix is
+ * 8.8 fixed point and the x and y 20.8, split into two halves each */
+#define AFFINE_PA 0
+#define AFFINE_PB 1
+#define AFFINE_PC 2
+#define AFFINE_PD 3
+#define AFFINE_X 4
+#define AFFINE_Y 6
+
+/* the sizes of affine maps, in tiles across */
+#define AFFINE_SIZE_16 0
+#define AFFINE_SIZE_32 1
+#define AFFINE_SIZE_64 2
+#define AFFINE_SIZE_128 3
+
+/* the distance from the eye to the screen for perspective, in pixels */
+#define MODE7_FOCAL 128
+
+/* returns the scanline index of an affine layer's first register */
+int affine_bg_base(int bg)
+{
+    return bg == 3 ? SCANLINE_BG3_PA : SCANLINE_BG2_PA;
+}
+
+/* set up layer 2 or 3 as an affine layer, if wrap is 0 then nothing is
+ * drawn outside of its map */
+void affine_bg_init(int bg, int priority, int char_block, int screen_block, int size, int wrap)
+{
+    volatile unsigned short *control = bg == 3 ? bg3_control : bg2_control;
+    *control = priority | (char_block << 2) | (screen_block << 8) | (wrap << 13) | (size << 14);
+}
+
+/* write a value to one of the 32 bit x and y registers of an affine layer */
+void affine_bg_set_position(int reg, int value)
+{
+    scanline_set_static(reg, value & 0xffff);
+    scanline_set_static(reg + 1, (value >> 16) & 0xffff);
+}
+
+/* turn and zoom a whole affine layer, the point map_x, map_y of its map is
+ * shown at screen_x, screen_y, angle is in 256ths of a turn and zoom in 1/256 */
+void affine_bg_set(int bg, int angle, int zoom, int map_x, int map_y, int screen_x, int screen_y)
+{
+    int base = affine_bg_base(bg);
+
+    /* the matrix takes screen pixels back to map pixels, so it is the inverse */
+    int inverse = (256 * 256) / zoom;
+    int sine = (sin_lut[angle & 255] * inverse) >> 12;
+    int cosine = (sin_lut[(angle + 64) & 255] * inverse) >> 12;
+
+    scanline_set_static(base + AFFINE_PA, cosine);
+    scanline_set_static(base + AFFINE_PB, -sine);
+    scanline_set_static(base + AFFINE_PC, sine);
+    scanline_set_static(base + AFFINE_PD, cosine);
+    affine_bg_set_position(base + AFFINE_X, (map_x << 8) - cosine * screen_x + sine * screen_y);
+    affine_bg_set_position(base + AFFINE_Y, (map_y << 8) - sine * screen_x - cosine * screen_y);
+}
+
+/* a floor seen in perspective, like mode 7 on other consoles */
+struct Mode7
+{
+    /* where the eye is over the map and how high, in pixels, the height
+     * must be no more than 64 */
+    int x, y, height;
+
+    /* which way it looks, in 256ths of a turn */
+    int angle;
+
+    /* the line of the screen the floor starts below */
+    int horizon;
+};
+
+/* start giving an affine layer a matrix per line */
+void mode7_begin(int bg)
+{
+    int base = affine_bg_base(bg);
+    scanline_claim(base + AFFINE_PA);
+    scanline_claim(base + AFFINE_PC);
+    scanline_claim(base + AFFINE_X);
+    scanline_claim(base + AFFINE_X + 1);
+    scanline_claim(base + AFFINE_Y);
+    scanline_claim(base + AFFINE_Y + 1);
+
+    /* going down a line is done by setting x and y on each one */
+    scanline_set_static(base + AFFINE_PB, 0);
+    scanline_set_static(base + AFFINE_PD, 0);
+}
+
+/* go back to one matrix for the whole layer */
+void mode7_end(int bg)
+{
+    int base = affine_bg_base(bg);
+    scanline_release(base + AFFINE_PA);
+    scanline_release(base + AFFINE_PC);
+    scanline_release(base + AFFINE_X);
+    scanline_release(base + AFFINE_X + 1);
+    scanline_release(base + AFFINE_Y);
+    scanline_release(base + AFFINE_Y + 1);
+    affine_bg_set(bg, 0, 256, 0, 0, 0, 0);
+}
+
+/* fill in the per line tables for a floor, this goes between scanline_begin
+ * and end - each line below the horizon is a row of the floor further away
+ * the nearer it is to the horizon, found with a multiply by the reciprocal
+ * table rather than a divide, and lines above it are moved off the map */
+void mode7_build(int bg, const struct Mode7 *view)
+{
+    int base = affine_bg_base(bg);
+    unsigned short *pa = scanline_column(base + AFFINE_PA);
+    unsigned short *pc = scanline_column(base + AFFINE_PC);
+    unsigned short *x = scanline_column(base + AFFINE_X);
+    unsigned short *y = scanline_column(base + AFFINE_Y);
+
+    /* 8.8 fixed point so the products below fit */
+    int sine = sin_lut[view->angle & 255] >> 4;
+    int cosine = sin_lut[(view->angle + 64) & 255] >> 4;
+
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        int offset = line * scanline_stride;
+        int distance = line - view->horizon;
+        int map_x, map_y;
+
+        if (distance <= 0)
+        {
+            pa[offset] = 0;
+            pc[offset] = 0;
+            map_x = -(1024 << 8);
+            map_y = -(1024 << 8);
+        }
+        else
+        {
+            /* how many map pixels one screen pixel covers on this line, 20.12 */
+            int scale = (view->height * reciprocal_lut[distance]) >> 4;
+
+            /* and how far away the line is, 20.8 */
+            int depth = (scale * MODE7_FOCAL) >> 4;
+
+            int step_x = (cosine * scale) >> 12;
+            int step_y = (sine * scale) >> 12;
+            pa[offset] = step_x;
+            pc[offset] = step_y;
+
+            /* start from the left of the screen, out along the way the eye looks */
+            map_x = (view->x << 8) - (SCREEN_WIDTH / 2) * step_x - ((sine * depth) >> 8);
+            map_y = (view->y << 8) - (SCREEN_WIDTH / 2) * step_y + ((cosine * depth) >> 8);
+        }
+
+        x[offset] = map_x & 0xffff;
+        x[offset + 1] = (map_x >> 16) & 0xffff;
+        y[offset] = map_y & 0xffff;
+        y[offset + 1] = (map_y >> 16) & 0xffff;
+    }
+}
+
+/* turn a regular map into an affine one, which has a byte per tile, two to a
+ * halfword since video memory cannot be written a byte at a time */
+void affine_map_from_tiles(unsigned short *dest, const unsigned short *tiles, int count)
+{
+    for (int i = 0; i < count; i += 2)
+    {
+        dest[i >> 1] = (tiles[i] & 0xff) | ((tiles[i + 1] & 0xff) << 8);
+    }
+}
+
+/* PALETTE EFFECTS */
+
+/* the two palettes as they would be without any effect, bg then sprites */
+unsigned short palette_source[PALETTE_SIZE * 2] __attribute__((aligned(4)));
+
+/* the colors after the effects, which get copied into palette memory */
+unsigned short palette_output[PALETTE_SIZE * 2] __attribute__((aligned(4)));
+
+/* the color being faded towards and how far, 0 is none and 32 is all the way */
+unsigned short palette_fade_color = 0;
+int palette_fade_level = 0;
+
+/* where the fade level is heading and how much it moves each frame in 1/256ths */
+int palette_fade_target = 0;
+int palette_fade_speed = 0;
+int palette_fade_fraction = 0;
+
+/* frames left of flickering */
+int palette_flicker_frames = 0;
+
+/* a range of palette entries which rotates every so many frames */
+struct PaletteCycle
+{
+    int first;
+    int count;
+    int delay;
+    int counter;
+};
+
+#define MAX_PALETTE_CYCLES 4
+struct PaletteCycle palette_cycles[MAX_PALETTE_CYCLES];
+int num_palette_cycles = 0;
+
+/* set when the output needs working out again */
+int palette_dirty = 1;
+
+/* the frame the last copy to palette memory was queued on */
+unsigned int palette_queued_frame = -1;
+
+/* blend two colors at a time from source towards color by level 32nds,
+ * each channel of both colors is multiplied in one go by keeping the
+ * channels spread out so their products never run into each other */
+void palette_blend(unsigned int *dest, const unsigned int *source, int words,
+                   unsigned short color, int level)
+{
+    /* red and blue of the low color and green of the high one */
+    const unsigned int mask_a = 0x03e07c1f;
+
+    /* green of the low color and red and blue of the high one, shifted down 5 */
+    const unsigned int mask_b = 0x03e0f81f;
+
+    unsigned int target = color | (color << 16);
+    unsigned int target_a = (target & mask_a) * level;
+    unsigned int target_b = ((target >> 5) & mask_b) * level;
+    int keep = 32 - level;
+
+    for (int i = 0; i < words; i++)
+    {
+        unsigned int c = source[i];
+        unsigned int a = (((c & mask_a) * keep + target_a) >> 5) & mask_a;
+        unsigned int b = (((c >> 5) & mask_b) * keep + target_b) & (mask_b << 5);
+        dest[i] = a | b;
+    }
+}
+
+/* take a copy of both palettes as they are loaded now */
+void palette_init()
+{
+    for (int i = 0; i < PALETTE_SIZE * 2; i++)
+    {
+        palette_source[i] = bg_palette[i];
+    }
+    palette_dirty = 1;
+}
+
+/* start fading towards a color, reaching it after a number of frames */
+void palette_fade_to(unsigned short color, int frames)
+{
+    palette_fade_color = color;
+    palette_fade_target = 32;
+    palette_fade_speed = (32 * 256) / (frames > 0 ? frames : 1);
+    palette_fade_fraction = palette_fade_level << 8;
+}
+
+/* start fading back to the normal colors */
+void palette_fade_in(int frames)
+{
+    palette_fade_target = 0;
+    palette_fade_speed = (32 * 256) / (frames > 0 ? frames : 1);
+    palette_fade_fraction = palette_fade_level << 8;
+}
+
+/* tint the colors part of the way towards a color right away, 0 to 32 */
+void palette_tint(unsigned short color, int level)
+{
+    palette_fade_color = color;
+    palette_fade_level = level;
+    palette_fade_target = level;
+    palette_dirty = 1;
+}
+
+/* returns whether a fade is still going */
+int palette_fading()
+{
+    return palette_fade_level != palette_fade_target;
+}
+
+/* make the lights flicker for some frames */
+void palette_flicker(int frames)
+{
+    palette_flicker_frames = frames;
+}
+
+/* rotate a range of palette entries by one every so many frames */
+void palette_cycle_add(int first, int count, int delay)
+{
+    if (num_palette_cycles < MAX_PALETTE_CYCLES)
+    {
+        struct PaletteCycle *cycle = &palette_cycles[num_palette_cycles++];
+        cycle->first = first;
+        cycle->count = count;
+        cycle->delay = delay;
+        cycle->counter = 0;
+    }
+}
+
+/* stop a range of palette entries rotating, they stay where they got to */
+void palette_cycle_remove(int first)
+{
+    for (int i = 0; i < num_palette_cycles; i++)
+    {
+        if (palette_cycles[i].first == first)
+        {
+            palette_cycles[i--] = palette_cycles[--num_palette_cycles];
+        }
+    }
+}
+
+/* move the effects along a frame and queue the new colors if they changed */
+void palette_update()
+{
+    /* rotate the cycling ranges */
+    for (int i = 0; i < num_palette_cycles; i++)
+    {
+        struct PaletteCycle *cycle = &palette_cycles[i];
+        if (++cycle->counter >= cycle->delay)
+        {
+            cycle->counter = 0;
+            unsigned short last = palette_source[cycle->first + cycle->count - 1];
+            for (int j = cycle->count - 1; j > 0; j--)
+            {
+                palette_source[cycle->first + j] = palette_source[cycle->first + j - 1];
+            }
+            palette_source[cycle->first] = last;
+            palette_dirty = 1;
+        }
+    }
+
+    /* step the fade */
+    if (palette_fading())
+    {
+        if (palette_fade_target > palette_fade_level)
+        {
+            palette_fade_fraction += palette_fade_speed;
+        }
+        else
+        {
+            palette_fade_fraction -= palette_fade_speed;
+        }
+
+        palette_fade_level = palette_fade_fraction >> 8;
+        if ((palette_fade_target > 0 && palette_fade_level >= palette_fade_target) ||
+            (palette_fade_target == 0 && palette_fade_fraction <= 0))
+        {
+            palette_fade_level = palette_fade_target;
+        }
+        palette_dirty = 1;
+    }
+
+    /* a flicker drops the lights by a random amount for the frame */
+    int level = palette_fade_level;
+    unsigned short color = palette_fade_color;
+    int flickering = palette_flicker_frames > 0;
+    if (flickering)
+    {
+        palette_flicker_frames--;
+        if (random_next() & 1)
+        {
+            level += random_next() & 15;
+            color = 0;
+            if (level > 32)
+            {
+                level = 32;
+            }
+        }
+        palette_dirty = 1;
+    }
+
+    if (!palette_dirty)
+    {
+        return;
+    }
+
+    /* a flickered frame always needs putting back the next frame */
+    palette_dirty = flickering;
+
+    /* work out the new colors and copy both palettes over next vblank, if the
+     * copy is already queued this frame it picks up the new colors anyway */
+    palette_blend((unsigned int *)palette_output, (unsigned int *)palette_source,
+                  PALETTE_SIZE, color, level);
+    struct FrameInfo info;
+    frame_info_read(&info);
+    if (palette_queued_frame != info.frame)
+    {
+        palette_queued_frame = info.frame;
+        vblank_queue_push(bg_palette, palette_output, PALETTE_SIZE);
+    }
+}
+
+/* run the palette effects a frame at a time until the fade is done */
+void palette_wait()
+{
+    while (palette_fading())
+    {
+        palette_update();
+        wait_next_frame();
+    }
+}
+
+/* GLITCH */
+
+/* static is a layer of noise tiles over the picture, its pixels all come
+ * from a small range of grays which is rotated each frame so it moves
+ * without anything being drawn - the tiles go at the end of char block 0,
+ * past the level's, and their map in a spare screen block */
+#define NOISE_FIRST_TILE 248
+#define NOISE_TILES 8
+#define NOISE_SCREEN_BLOCK 29
+#define NOISE_FIRST_COLOR 224
+#define NOISE_COLORS 8
+
+/* the mosaic bit of a tile layer's control register, the sizes come from
+ * the mosaic register, in 4 bit fields of one less than the size */
+#define BG_MOSAIC 0x40
+#define MOSAIC_SIZE(bg, sprite) (((bg) - 1) * 0x11 | ((sprite) - 1) * 0x1100)
+
+/* blending with weights, and the register the weights go in, the layers
+ * blended onto are in the high byte of the control */
+volatile unsigned short *blend_alpha = (volatile unsigned short *)0x4000052;
+#define BLEND_ALPHA (1 << 6)
+#define BLEND_ONTO(layers) ((layers) << 8)
+
+/* the most static there can be, when only the noise shows */
+#define GLITCH_MAX 16
+
+/* the noise tiles and a map of them chosen and flipped at random */
+unsigned int noise_tiles[NOISE_TILES * 16] EWRAM_BSS;
+unsigned short noise_map[32 * 32] EWRAM_BSS;
+
+/* the grays the noise rotates through, bright and dark mixed up */
+const unsigned char noise_levels[NOISE_COLORS] = {2, 20, 8, 28, 4, 14, 31, 10};
+
+/* the static has its own xorshift generator, apart from the game's, so it
+ * never changes what the animatronics do and replays stay the same */
+unsigned int glitch_state = 0x9e3779b9;
+
+/* the layer 1 settings to put back when the static goes */
+unsigned short glitch_saved_control;
+unsigned long glitch_saved_display;
+
+/* make the noise tiles, their map and their colors, call after palette_init -
+ * the tiles and map are loaded along with the level */
+void glitch_init()
+{
+    unsigned char *pixels = (unsigned char *)noise_tiles;
+    for (int i = 0; i < NOISE_TILES * 64; i++)
+    {
+        pixels[i] = NOISE_FIRST_COLOR + (xorshift(&glitch_state) & (NOISE_COLORS - 1));
+    }
+
+    for (int i = 0; i < 32 * 32; i++)
+    {
+        unsigned int r = xorshift(&glitch_state);
+        noise_map[i] = (NOISE_FIRST_TILE + (r & (NOISE_TILES - 1))) | ((r >> 8) & 0xc00);
+    }
+
+    for (int i = 0; i < NOISE_COLORS; i++)
+    {
+        unsigned short level = noise_levels[i];
+        palette_source[NOISE_FIRST_COLOR + i] = level | (level << 5) | (level << 10);
+    }
+    palette_dirty = 1;
+}
+
+/* put static over layer 0 and the sprites, using layer 1 for the noise -
+ * the noise goes between the text and layer 0, so a sprite under it has to
+ * be dropped behind it with sprite_set_priority - this takes over the mosaic
+ * register, and the blend registers so it can't go with the lighting */
+void glitch_begin()
+{
+    glitch_saved_control = *bg1_control;
+    glitch_saved_display = *display_control & BG1_ENABLE;
+
+    /* the layers change at the vblank which starts the first frame of static */
+    volatile unsigned short *display = (volatile unsigned short *)display_control;
+    scanline_write(bg1_control, 0xffff,
+                   1 | (0 << 2) | BG_MOSAIC | (1 << 7) | (NOISE_SCREEN_BLOCK << 8) | (1 << 13));
+    scanline_write(bg0_control, BG_MOSAIC, BG_MOSAIC);
+    scanline_write(display, BG1_ENABLE, BG1_ENABLE);
+
+    scanline_write(blend_control, 0xffff,
+                   BLEND_BG1 | BLEND_ALPHA | BLEND_ONTO(BLEND_BG0 | BLEND_SPRITES | BLEND_BACKDROP));
+    scanline_write(blend_alpha, 0xffff, 0);
+
+    palette_cycle_add(NOISE_FIRST_COLOR, NOISE_COLORS, 1);
+    scanline_claim(SCANLINE_MOSAIC);
+    scanline_claim(SCANLINE_BG1_Y);
+}
+
+/* take the static away and put layer 1 back */
+void glitch_end()
+{
+    scanline_release(SCANLINE_MOSAIC);
+    scanline_release(SCANLINE_BG1_Y);
+    scanline_set_static(SCANLINE_MOSAIC, 0);
+    scanline_set_static(SCANLINE_BG1_Y, 0);
+    palette_cycle_remove(NOISE_FIRST_COLOR);
+
+    scanline_write(blend_control, 0xffff, 0);
+    scanline_write(bg0_control, BG_MOSAIC, 0);
+    scanline_write(bg1_control, 0xffff, glitch_saved_control);
+    scanline_write((volatile unsigned short *)display_control, BG1_ENABLE, glitch_saved_display);
+}
+
+/* shake some lines of an x scroll column sideways by up to amplitude pixels,
+ * the more the level the more lines, this goes after the column is filled */
+void glitch_jitter(int reg, int amplitude, int level)
+{
+    unsigned short *entry = scanline_column(reg);
+    for (int line = 0; line <= SCREEN_HEIGHT; line++)
+    {
+        unsigned int r = xorshift(&glitch_state);
+        if ((int)(r & (GLITCH_MAX * 4 - 1)) < level)
+        {
+            *entry += (int)((r >> 8) % (amplitude * 2 + 1)) - amplitude;
+        }
+        entry += scanline_stride;
+    }
+}
+
+/* fill in a frame of static between scanline_begin and end, level goes from
+ * 0 for none up to GLITCH_MAX - the noise fades in over the picture, layer 0
+ * and the layer 1 noise are shaken sideways on random lines, and the picture
+ * breaks into bands of blocks, which are bigger the more static there is */
+void glitch_build(int level)
+{
+    scanline_write(blend_alpha, 0xffff, level | ((GLITCH_MAX - level) << 8));
+
+    /* the noise jumps to a new place each frame */
+    scanline_fill(SCANLINE_BG1_Y, xorshift(&glitch_state) & 255);
+
+    if (level)
+    {
+        glitch_jitter(SCANLINE_BG0_X, level / 2 + 1, level);
+        glitch_jitter(SCANLINE_BG1_X, 8, GLITCH_MAX);
+    }
+
+    unsigned short *entry = scanline_column(SCANLINE_MOSAIC);
+    int line = 0;
+    while (line <= SCREEN_HEIGHT)
+    {
+        unsigned int r = xorshift(&glitch_state);
+        int band = 2 + (r & 15);
+        int size = 1 + ((r >> 4) % (level / 4 + 1));
+        unsigned short mosaic = MOSAIC_SIZE(size, size);
+
+        for (int i = 0; i < band && line <= SCREEN_HEIGHT; i++, line++)
+        {
+            *entry = mosaic;
+            entry += scanline_stride;
+        }
+    }
+}
+
+/* a sprite is a moveable image on the screen */
+struct Sprite
+{
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short attribute2;
+    unsigned short attribute3;
+};
+
+/* array of all the sprites available on the GBA */
+struct Sprite sprites[NUM_SPRITES];
+int next_sprite_index = 0;
+
+/* attribute 0 bit 9 turns off a sprite which is not an affine one */
+#define SPRITE_DISABLE 0x200
+
+/* attribute 0 bit 12 draws a sprite in blocks of the mosaic register's size */
+#define SPRITE_MOSAIC 0x1000
+
+/* a bit for each sprite which has changed since it was last copied to OAM,
+ * so sprites which are still, or hidden, are not copied again */
+unsigned int sprite_dirty[NUM_SPRITES / 32];
+
+/* note that a sprite needs copying at the next vblank */
+void sprite_mark_dirty(struct Sprite *sprite)
+{
+    int index = sprite - sprites;
+    sprite_dirty[index >> 5] |= 1 << (index & 31);
+}
+
+/* the different sizes of sprites which are possible */
+enum SpriteSize
+{
+    SIZE_8_8,
+    SIZE_16_16,
+    SIZE_32_32,
+    SIZE_64_64,
+    SIZE_16_8,
+    SIZE_32_8,
+    SIZE_32_16,
+    SIZE_64_32,
+    SIZE_8_16,
+    SIZE_8_32,
+    SIZE_16_32,
+    SIZE_32_64
+};
+
+/* SPRITE */
+
+/* function to initialize a sprite with its properties, and return a pointer */
+struct Sprite *sprite_init(int x, int y, enum SpriteSize size,
+                           int horizontal_flip, int vertical_flip, int tile_index, int priority)
+{
+
+    /* grab the next index */
+    int index = next_sprite_index++;
+
+    /* setup the bits used for each shape/size possible */
     int size_bits, shape_bits;
     switch (size)
     {
-    case SIZE_8_8:
-        size_bits = 0;
-        shape_bits = 0;
+    case SIZE_8_8:
+        size_bits = 0;
+        shape_bits = 0;
+        break;
+    case SIZE_16_16:
+        size_bits = 1;
+        shape_bits = 0;
+        break;
+    case SIZE_32_32:
+        size_bits = 2;
+        shape_bits = 0;
+        break;
+    case SIZE_64_64:
+        size_bits = 3;
+        shape_bits = 0;
+        break;
+    case SIZE_16_8:
+        size_bits = 0;
+        shape_bits = 1;
+        break;
+    case SIZE_32_8:
+        size_bits = 1;
+        shape_bits = 1;
+        break;
+    case SIZE_32_16:
+        size_bits = 2;
+        shape_bits = 1;
+        break;
+    case SIZE_64_32:
+        size_bits = 3;
+        shape_bits = 1;
+        break;
+    case SIZE_8_16:
+        size_bits = 0;
+        shape_bits = 2;
+        break;
+    case SIZE_8_32:
+        size_bits = 1;
+        shape_bits = 2;
+        break;
+    case SIZE_16_32:
+        size_bits = 2;
+        shape_bits = 2;
+        break;
+    case SIZE_32_64:
+        size_bits = 3;
+        shape_bits = 2;
+        break;
+    }
+
+    int h = horizontal_flip ? 1 : 0;
+    int v = vertical_flip ? 1 : 0;
+
+    /* set up the first attribute */
+    sprites[index].attribute0 = y |                 /* y coordinate */
+                                (0 << 8) |          /* rendering mode */
+                                (0 << 10) |         /* gfx mode */
+                                (0 << 12) |         /* mosaic */
+                                (1 << 13) |         /* color mode, 0:16, 1:256 */
+                                (shape_bits << 14); /* shape */
+
+    /* set up the second attribute */
+    sprites[index].attribute1 = x |                /* x coordinate */
+                                (0 << 9) |         /* affine flag */
+                                (h << 12) |        /* horizontal flip flag */
+                                (v << 13) |        /* vertical flip flag */
+                                (size_bits << 14); /* size */
+
+    /* setup the second attribute */
+    sprites[index].attribute2 = tile_index |       // tile index */
+                                (priority << 10) | // priority */
+                                (0 << 12);         // palette bank (only 16 color)*/
+
+    sprite_mark_dirty(&sprites[index]);
+
+    /* return pointer to this sprite */
+    return &sprites[index];
+}
+
+/* ALL SPRITES */
+
+/* update all of the sprites on the screen */
+void sprite_update_all()
+{
+    /* copy over the ones which changed, a run of them at a time */
+    int i = 0;
+    while (i < NUM_SPRITES)
+    {
+        if (!sprite_dirty[i >> 5])
+        {
+            i += 32;
+            continue;
+        }
+        if (!((sprite_dirty[i >> 5] >> (i & 31)) & 1))
+        {
+            i++;
+            continue;
+        }
+
+        int first = i;
+        while (i < NUM_SPRITES && ((sprite_dirty[i >> 5] >> (i & 31)) & 1))
+        {
+            i++;
+        }
+        memcpy16_dma((unsigned short *)sprite_attribute_memory + first * 4,
+                     (unsigned short *)&sprites[first], (i - first) * 4);
+    }
+
+    for (i = 0; i < NUM_SPRITES / 32; i++)
+    {
+        sprite_dirty[i] = 0;
+    }
+}
+
+/* ALL SPRITES */
+
+/* setup all sprites */
+void sprite_clear()
+{
+    /* clear the index counter */
+    next_sprite_index = 0;
+
+    /* move all sprites offscreen and turn them off to hide them */
+    for (int i = 0; i < NUM_SPRITES; i++)
+    {
+        sprites[i].attribute0 = SCREEN_HEIGHT | SPRITE_DISABLE;
+        sprites[i].attribute1 = SCREEN_WIDTH;
+    }
+    for (int i = 0; i < NUM_SPRITES / 32; i++)
+    {
+        sprite_dirty[i] = 0xffffffff;
+    }
+}
+
+/* ALL SPRITES */
+
+/* set a sprite postion */
+void sprite_position(struct Sprite *sprite, int x, int y)
+{
+    /* clear out the y coordinate and set the new one */
+    unsigned short attribute0 = (sprite->attribute0 & 0xff00) | (y & 0xff);
+
+    /* clear out the x coordinate and set the new one */
+    unsigned short attribute1 = (sprite->attribute1 & 0xfe00) | (x & 0x1ff);
+
+    /* it only needs copying again if it moved */
+    if (attribute0 != sprite->attribute0 || attribute1 != sprite->attribute1)
+    {
+        sprite->attribute0 = attribute0;
+        sprite->attribute1 = attribute1;
+        sprite_mark_dirty(sprite);
+    }
+}
+
+/* ALL SPRITES */
+
+/* move a sprite in a direction */
+void sprite_move(struct Sprite *sprite, int dx, int dy)
+{
+    /* get the current y coordinate */
+    int y = sprite->attribute0 & 0xff;
+
+    /* get the current x coordinate */
+    int x = sprite->attribute1 & 0x1ff;
+
+    /* move to the new location */
+    sprite_position(sprite, x + dx, y + dy);
+}
+
+/* ALL SPRITES */
+
+/* change the vertical flip flag */
+void sprite_set_vertical_flip(struct Sprite *sprite, int vertical_flip)
+{
+    if (vertical_flip)
+    {
+        /* set the bit */
+        sprite->attribute1 |= 0x2000;
+    }
+    else
+    {
+        /* clear the bit */
+        sprite->attribute1 &= 0xdfff;
+    }
+    sprite_mark_dirty(sprite);
+}
+
+/* ALL SPRITES */
+
+/* change the vertical flip flag */
+void sprite_set_horizontal_flip(struct Sprite *sprite, int horizontal_flip)
+{
+    if (horizontal_flip)
+    {
+        /* set the bit */
+        sprite->attribute1 |= 0x1000;
+    }
+    else
+    {
+        /* clear the bit */
+        sprite->attribute1 &= 0xefff;
+    }
+    sprite_mark_dirty(sprite);
+}
+
+/* ALL SPRITES */
+
+/* change the tile offset of a sprite */
+void sprite_set_offset(struct Sprite *sprite, int offset)
+{
+    /* clear the old offset */
+    sprite->attribute2 &= 0xfc00;
+
+    /* apply the new one */
+    sprite->attribute2 |= (offset & 0x03ff);
+
+    sprite_mark_dirty(sprite);
+}
+
+/* ALL SPRITES */
+
+/* turn a sprite off or back on, affine sprites use the bit for something
+ * else so they are left alone */
+void sprite_set_hidden(struct Sprite *sprite, int hidden)
+{
+    if (sprite->attribute0 & 0x100)
+    {
+        return;
+    }
+
+    unsigned short attribute0 = hidden ? (sprite->attribute0 | SPRITE_DISABLE)
+                                       : (sprite->attribute0 & ~SPRITE_DISABLE);
+    if (attribute0 != sprite->attribute0)
+    {
+        sprite->attribute0 = attribute0;
+        sprite_mark_dirty(sprite);
+    }
+}
+
+/* ALL SPRITES */
+
+/* turn the mosaic effect on or off for a sprite */
+void sprite_set_mosaic(struct Sprite *sprite, int mosaic)
+{
+    unsigned short attribute0 = mosaic ? (sprite->attribute0 | SPRITE_MOSAIC)
+                                       : (sprite->attribute0 & ~SPRITE_MOSAIC);
+    if (attribute0 != sprite->attribute0)
+    {
+        sprite->attribute0 = attribute0;
+        sprite_mark_dirty(sprite);
+    }
+}
+
+/* ALL SPRITES */
+
+/* move a sprite in front of or behind the tile layers, a sprite goes in
+ * front of a layer of the same priority */
+void sprite_set_priority(struct Sprite *sprite, int priority)
+{
+    unsigned short attribute2 = (sprite->attribute2 & ~(3 << 10)) | (priority << 10);
+    if (attribute2 != sprite->attribute2)
+    {
+        sprite->attribute2 = attribute2;
+        sprite_mark_dirty(sprite);
+    }
+}
+
+/* ALL SPRITES */
+
+/* setup the sprite image and palette */
+void setup_sprite_image()
+{
+    /* load the palette from the image into palette memory*/
+    memcpy16_dma((unsigned short *)sprite_palette, (unsigned short *)all_sprites_palette, PALETTE_SIZE);
+
+    /* the image is loaded by the scenes which use it */
+}
+
+/* METASPRITES */
+
+/* a metasprite is a picture bigger than one sprite, made of several pieces
+ * laid out around an anchor point, which all move and flip together */
+struct MetaPiece
+{
+    /* where the piece's top left is from the anchor, and where it is when
+     * the metasprite is flipped so the pieces swap sides */
+    signed char x, y, flip_x;
+
+    /* the shape, size and tile of the piece */
+    unsigned short attribute0, attribute1, attribute2;
+};
+
+/* a piece of some width, with the shape and size bits of sprite_init, in
+ * 256 color mode */
+#define METAPIECE(x, y, width, shape, size, tile)                                                  \
+    {                                                                                              \
+        (x), (y), -(x) - (width), ((shape) << 14) | (1 << 13), (size) << 14, (tile)                \
+    }
+
+struct Metasprite
+{
+    const struct MetaPiece *pieces;
+    int count;
+};
+
+/* the four animatronics in a row, anchored at the middle of their feet */
+const struct MetaPiece animatronic_crew_pieces[] = {
+    METAPIECE(-32, -32, 16, 2, 2, 48),
+    METAPIECE(-16, -32, 16, 2, 2, 80),
+    METAPIECE(0, -32, 16, 2, 2, 112),
+    METAPIECE(16, -32, 16, 2, 2, 144),
+};
+const struct Metasprite animatronic_crew = {animatronic_crew_pieces, 4};
+
+/* grab some sprites in a row for a metasprite, they start off hidden */
+struct Sprite *sprite_alloc(int count)
+{
+    if (next_sprite_index + count > NUM_SPRITES)
+    {
+        return 0;
+    }
+
+    struct Sprite *first = &sprites[next_sprite_index];
+    for (int i = 0; i < count; i++)
+    {
+        first[i].attribute0 = SCREEN_HEIGHT | SPRITE_DISABLE;
+        first[i].attribute1 = SCREEN_WIDTH;
+        first[i].attribute2 = 0;
+        sprite_mark_dirty(&first[i]);
+    }
+    next_sprite_index += count;
+    return first;
+}
+
+/* place one piece, or turn it off if it would wrap around onto the screen */
+#define METASPRITE_PIECE()                                                                         \
+    do                                                                                             \
+    {                                                                                              \
+        int px = x + (flip ? piece->flip_x : piece->x);                                            \
+        int py = y + piece->y;                                                                     \
+        if (px > -64 && px < SCREEN_WIDTH && py > -64 && py < SCREEN_HEIGHT)                       \
+        {                                                                                          \
+            sprite->attribute0 = piece->attribute0 | (py & 0xff);                                  \
+            sprite->attribute1 = (piece->attribute1 ^ flip) | (px & 0x1ff);                        \
+        }                                                                                          \
+        else                                                                                       \
+        {                                                                                          \
+            sprite->attribute0 = SCREEN_HEIGHT | SPRITE_DISABLE;                                   \
+        }                                                                                          \
+        sprite->attribute2 = piece->attribute2 + tile_offset;                                      \
+        piece++;                                                                                   \
+        sprite++;                                                                                  \
+    } while (0)
+
+/* put all of a metasprite's pieces on the screen with its anchor at x, y,
+ * mirrored if it is flipped, into the sprites from sprite_alloc - tile_offset
+ * is added to every piece's tile, for animating - the loop does four pieces
+ * at a time so a big metasprite costs little more than one sprite */
+void metasprite_draw(const struct Metasprite *meta, struct Sprite *sprites_out, int x, int y,
+                     int horizontal_flip, int tile_offset)
+{
+    const struct MetaPiece *piece = meta->pieces;
+    struct Sprite *sprite = sprites_out;
+    unsigned short flip = horizontal_flip ? 0x1000 : 0;
+    int count = meta->count;
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    /* jump into the middle of the loop for the pieces left over from a multiple of four */
+    int rounds = (count + 3) >> 2;
+    switch (count & 3)
+    {
+    case 0:
+        do
+        {
+            METASPRITE_PIECE();
+        case 3:
+            METASPRITE_PIECE();
+        case 2:
+            METASPRITE_PIECE();
+        case 1:
+            METASPRITE_PIECE();
+        } while (--rounds > 0);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        sprite_mark_dirty(&sprites_out[i]);
+    }
+}
+
+/* AFFINE SPRITES */
+
+/* an affine sprite is rotated and scaled by one of 32 matrices, kept in the
+ * unused fourth attribute of OAM four entries at a time */
+#define NUM_AFFINE_MATRICES 32
+
+/* attribute 0 bits for affine sprites, bit 9 doubles the area they are drawn
+ * into rather than turning them off, so they can grow without clipping */
+#define SPRITE_AFFINE 0x100
+#define SPRITE_DOUBLE_SIZE 0x200
+
+/* what each matrix in the pool is for and how many sprites use it */
+struct AffineMatrix
+{
+    /* the angle in 256ths of a turn, and the zoom in 1/256, 256 is normal size */
+    int angle;
+    int zoom;
+    int refs;
+};
+
+struct AffineMatrix affine_matrices[NUM_AFFINE_MATRICES];
+
+/* returns a matrix which turns sprites by an angle and zooms them, sharing
+ * one which is already in use for the same thing if there is one, or -1 if
+ * all of them are taken */
+int affine_acquire(int angle, int zoom)
+{
+    int free_index = -1;
+    angle &= 255;
+
+    for (int i = 0; i < NUM_AFFINE_MATRICES; i++)
+    {
+        struct AffineMatrix *matrix = &affine_matrices[i];
+        if (matrix->refs && matrix->angle == angle && matrix->zoom == zoom)
+        {
+            matrix->refs++;
+            return i;
+        }
+        if (!matrix->refs && free_index < 0)
+        {
+            free_index = i;
+        }
+    }
+    if (free_index < 0 || zoom <= 0)
+    {
+        return -1;
+    }
+
+    struct AffineMatrix *matrix = &affine_matrices[free_index];
+    matrix->angle = angle;
+    matrix->zoom = zoom;
+    matrix->refs = 1;
+
+    /* the hardware maps screen pixels back to the sprite's own, so this is
+     * the inverse of the turn and zoom, in 8.8 fixed point from the 4.12 table */
+    int inverse = (256 * 256) / zoom;
+    int sine = (sin_lut[angle] * inverse) >> 12;
+    int cosine = (sin_lut[(angle + 64) & 255] * inverse) >> 12;
+
+    struct Sprite *entries = &sprites[free_index * 4];
+    entries[0].attribute3 = cosine;
+    entries[1].attribute3 = -sine;
+    entries[2].attribute3 = sine;
+    entries[3].attribute3 = cosine;
+    for (int i = 0; i < 4; i++)
+    {
+        sprite_mark_dirty(&entries[i]);
+    }
+    return free_index;
+}
+
+/* stop using a matrix, it is free for something else once nothing does */
+void affine_release(int index)
+{
+    if (index >= 0 && index < NUM_AFFINE_MATRICES && affine_matrices[index].refs)
+    {
+        affine_matrices[index].refs--;
+    }
+}
+
+/* swap a matrix for one with a new angle and zoom, returns the new one, or
+ * the old one if the pool is full */
+int affine_update(int index, int angle, int zoom)
+{
+    int changed = affine_acquire(angle, zoom);
+    if (changed < 0)
+    {
+        return index;
+    }
+    affine_release(index);
+    return changed;
+}
+
+/* turn a sprite with a matrix, or back to a normal sprite if matrix is -1 -
+ * an affine sprite has no flip bits, the matrix can mirror it instead */
+void sprite_set_affine(struct Sprite *sprite, int matrix, int double_size)
+{
+    if (matrix < 0)
+    {
+        sprite->attribute0 &= ~(SPRITE_AFFINE | SPRITE_DOUBLE_SIZE);
+        sprite->attribute1 &= ~(31 << 9);
+    }
+    else
+    {
+        sprite->attribute0 = (sprite->attribute0 & ~SPRITE_DOUBLE_SIZE) | SPRITE_AFFINE |
+                             (double_size ? SPRITE_DOUBLE_SIZE : 0);
+        sprite->attribute1 = (sprite->attribute1 & ~(31 << 9)) | (matrix << 9);
+    }
+    sprite_mark_dirty(sprite);
+}
+
+/* AFTON SPRITE */
+
+/* a struct for afton's logic and behavior */
+struct Afton
+{
+    /* the actual sprite attribute info */
+    struct Sprite *sprite;
+
+    /* the x and y postion in the level in pixels */
+    int x, y;
+
+    /* afton's y velocity in 1/256 pixels/second */
+    int yvel;
+
+    /* afton's y acceleration in 1/256 pixels/second^2 */
+    int gravity;
+
+    /* which frame of the animation he is on */
+    int frame;
+
+    /* the number of frames to wait before flipping */
+    int animation_delay;
+
+    /* the animation counter counts how many frames until we flip */
+    int counter;
+
+    /* whether afton is moving right now or not */
+    int move;
+
+    /* if afton is currently falling */
+    int falling;
+};
+
+/* AFTON SPRITE */
+
+/* the level is as wide as the screen can scroll, afton stays inside it */
+#define LEVEL_WIDTH 720
+#define LEVEL_HEIGHT SCREEN_HEIGHT
+
+/* move afton right */
+void afton_right(struct Afton *afton)
+{
+    /* face right */
+    sprite_set_horizontal_flip(afton->sprite, 0);
+    afton->move = 1;
+
+    /* move right, unless at the end of the level */
+    if (afton->x < LEVEL_WIDTH - 16)
+    {
+        afton->x++;
+    }
+}
+
+/* AFTON SPRITE */
+
+/* stop afton from walking left/right */
+void afton_stop(struct Afton *afton)
+{
+    afton->move = 0;
+    afton->frame = 0;
+    afton->counter = 7;
+    sprite_set_offset(afton->sprite, afton->frame);
+}
+
+/* AFTON SPRITE */
+
+/* start afton jumping, unless already fgalling */
+void afton_jump(struct Afton *afton)
+{
+    if (!afton->falling)
+    {
+        afton->yvel = -500;
+        afton->falling = 1;
+    }
+}
+
+/* GENERAL USE */
+
+/* finds which tile a screen coordinate maps to, taking scroll into acco  unt */
+unsigned short tile_lookup(int x, int y, int xscroll, int yscroll,
+                           const unsigned short *tilemap, int tilemap_w, int tilemap_h)
+{
+
+    /* adjust for the scroll */
+    x += xscroll;
+    y += yscroll;
+
+    /* convert from screen coordinates to tile coordinates */
+    x >>= 3;
+    y >>= 3;
+
+    /* account for wraparound */
+    while (x >= tilemap_w)
+    {
+        x -= tilemap_w;
+    }
+    while (y >= tilemap_h)
+    {
+        y -= tilemap_h;
+    }
+    while (x < 0)
+    {
+        x += tilemap_w;
+    }
+    while (y < 0)
+    {
+        y += tilemap_h;
+    }
+
+    /* the larger screen maps (bigger than 32x32) are made of multiple stitched
+       together - the offset is used for finding which screen block we are in
+       for these cases */
+    int offset = 0;
+
+    /* if the width is 64, add 0x400 offset to get to tile maps on right   */
+    if (tilemap_w == 64 && x >= 32)
+    {
+        x -= 32;
+        offset += 0x400;
+    }
+
+    /* if height is 64 and were down there */
+    if (tilemap_h == 64 && y >= 32)
+    {
+        y -= 32;
+
+        /* if width is also 64 add 0x800, else just 0x400 */
+        if (tilemap_w == 64)
+        {
+            offset += 0x800;
+        }
+        else
+        {
+            offset += 0x400;
+        }
+    }
+
+    /* find the index in this tile map */
+    int index = y * 32 + x;
+
+    /* return the tile */
+    return tilemap[index + offset];
+}
+
+/* AFTON SPRITE */
+
+/* update afton */
+void afton_update(struct Afton *afton)
+{
+    /* update y position and speed if falling */
+    if (afton->falling)
+    {
+        afton->y += (afton->yvel >> 8);
+        afton->yvel += afton->gravity;
+    }
+
+    /* check which tile afton's feet are over */
+    unsigned short tile = tile_lookup(afton->x + 8, afton->y + 32, 0, 0, map2,
+                                      map2_width, map2_height);
+
+    /* if it's block tile
+     * these numbers refer to the tile indices of the blocks afton can walk on */
+    if ((tile == 1) || (tile == 12))
+    {
+        /* stop the fall! */
+        afton->falling = 0;
+        afton->yvel = 0;
+
+        /* make him line up with the top of a block works by clearing out the lower bits to 0 */
+        afton->y &= ~0x3;
+
+        /* move him down one because there is a one pixel gap in the image */
+        afton->y++;
+    }
+    else
+    {
+        /* he is falling now */
+        afton->falling = 1;
+    }
+
+    /* update animation if moving */
+    if (afton->move)
+    {
+        afton->counter++;
+        if (afton->counter >= afton->animation_delay)
+        {
+            afton->frame = next_frame(afton->frame, 16);
+            if (afton->frame > 16)
+            {
+                afton->frame = 0;
+            }
+            sprite_set_offset(afton->sprite, afton->frame);
+            afton->counter = 0;
+        }
+    }
+}
+
+/* CULLING */
+
+/* things further than this outside the screen are put to sleep */
+#define CULL_SLEEP_MARGIN 64
+
+/* how much attention something gets, from how far it is from the screen */
+#define CULL_VISIBLE 0
+#define CULL_OFFSCREEN 1
+#define CULL_ASLEEP 2
+
+/* compare a box in level pixels with the screen's place in the level -
+ * visible things are drawn and run every frame, ones just off the screen are
+ * hidden and think less often, and ones further away are left alone */
+int cull_test(int x, int y, int width, int height, int camera_x, int camera_y)
+{
+    int left = x - camera_x;
+    int top = y - camera_y;
+
+    if (left + width > 0 && left < SCREEN_WIDTH && top + height > 0 && top < SCREEN_HEIGHT)
+    {
+        return CULL_VISIBLE;
+    }
+    if (left + width > -CULL_SLEEP_MARGIN && left < SCREEN_WIDTH + CULL_SLEEP_MARGIN &&
+        top + height > -CULL_SLEEP_MARGIN && top < SCREEN_HEIGHT + CULL_SLEEP_MARGIN)
+    {
+        return CULL_OFFSCREEN;
+    }
+    return CULL_ASLEEP;
+}
+
+/* a struct for a guest's logic and behavior */
+struct Guest
+{
+    /* the actual sprite attribute info */
+    struct Sprite *sprite;
+
+    /* the x and y postion in the level in pixels */
+    int x, y;
+
+    /* guest's y velocity in 1/256 pixels/second */
+    int yvel;
+
+    /* guest's y acceleration in 1/256 pixels/second^2 */
+    int gravity;
+
+    /* which frame of the animation he is on */
+    int frame;
+
+    /* the number of frames to wait before flipping */
+    int animation_delay;
+
+    /* the animation counter counts how many frames until we flip */
+    int counter;
+
+    /* whether guest is an animatronic */
+    int ani;
+
+    /* whether afton is touching the guest this frame */
+    int touching;
+
+    /* whether the guest is on the screen, just off it or asleep */
+    int cull;
+
+    /* if guest is currently falling */
+    int falling;
+};
+
+/* initialize afton */
+void afton_init(struct Afton *afton)
+{
+    afton->x = 16;
+    afton->y = 113;
+    afton->yvel = 0;
+    afton->gravity = 50;
+    afton->frame = 0;
+    afton->move = 0;
+    afton->counter = 0;
+    afton->falling = 0;
+    afton->animation_delay = 8;
+    afton->sprite = sprite_init(afton->x, afton->y, SIZE_16_32, 0, 0, afton->frame, 0);
+}
+
+/* initialize guest */
+void guest_init(struct Guest *guest, int x, int y, int f)
+{
+    guest->x = x;
+    guest->y = y;
+    guest->yvel = 0;
+    guest->gravity = 50;
+    guest->frame = f;
+    guest->ani = 0;
+    guest->touching = 0;
+    guest->cull = CULL_VISIBLE;
+    guest->counter = 0;
+    guest->falling = 0;
+    guest->animation_delay = 8;
+    guest->sprite = sprite_init(guest->x, guest->y, SIZE_16_32, 0, 0, guest->frame, 0);
+}
+
+/* update guest */
+void guest_update(struct Guest *guest)
+{
+    /* check which tile guest's feet are over */
+    unsigned short tile = tile_lookup(guest->x + 8, guest->y + 32, 0, 0, map2,
+                                      map2_width, map2_height);
+
+    /* if it's block tile
+     * these numbers refer to the tile indices of the blocks guest can walk on */
+    if ((tile == 1) || (tile == 12))
+    {
+        /* stop the fall! */
+        guest->falling = 0;
+        guest->yvel = 0;
+
+        /* make him line up with the top of a block works by clearing out the lower bits to 0 */
+        guest->y &= ~0x3;
+
+        /* move him down one because there is a one pixel gap in the image */
+        guest->y++;
+    }
+    else
+    {
+        /* he is falling now */
+        guest->falling = 1;
+    }
+}
+
+/* AFTON SPRITE */
+
+/* move afton left */
+void afton_left(struct Afton *afton)
+{
+    /* face left */
+    sprite_set_horizontal_flip(afton->sprite, 1);
+    afton->move = 1;
+
+    /* move left, unless at the start of the level */
+    if (afton->x > 0)
+    {
+        afton->x--;
+    }
+}
+
+/* LINE OF SIGHT */
+
+/* a bit for each tile of map2, set for the tiles which block sight, so a ray
+ * can test a tile with a shift and a mask instead of going through the map */
+#define SOLID_WORDS ((map2_width + 31) / 32)
+unsigned int solid_map[map2_height][SOLID_WORDS];
+
+/* where a ray was stopped */
+struct RayHit
+{
+    /* the tile which blocked it */
+    int tile_x, tile_y;
+
+    /* how far it got, in pixels */
+    int distance;
+};
+
+/* returns whether a tile of map2 is one of the blocks afton can stand on */
+int tile_solid(unsigned short tile)
+{
+    return (tile == 1) || (tile == 12);
+}
+
+/* build the bitmap from map2, once at the start */
+void solid_map_init()
+{
+    for (int ty = 0; ty < map2_height; ty++)
+    {
+        for (int i = 0; i < SOLID_WORDS; i++)
+        {
+            solid_map[ty][i] = 0;
+        }
+        for (int tx = 0; tx < map2_width; tx++)
+        {
+            if (tile_solid(tile_lookup(tx * 8, ty * 8, 0, 0, map2, map2_width, map2_height)))
+            {
+                solid_map[ty][tx >> 5] |= 1 << (tx & 31);
+            }
+        }
+    }
+}
+
+/* returns whether a tile blocks sight, the map wraps around like the level */
+int tile_blocks(int tx, int ty)
+{
+    tx &= map2_width - 1;
+    ty &= map2_height - 1;
+    return (solid_map[ty][tx >> 5] >> (tx & 31)) & 1;
+}
+
+/* walk the tiles a line crosses from one point to another, in level pixels,
+ * and stop at the first solid one - returns 1 if the line was blocked, and
+ * fills in where if hit is not 0, the tile the line starts in is skipped */
+int ray_cast(int x0, int y0, int x1, int y1, struct RayHit *hit)
+{
+    int tx = x0 >> 3;
+    int ty = y0 >> 3;
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int step_x = dx < 0 ? -1 : 1;
+    int step_y = dy < 0 ? -1 : 1;
+    dx = dx < 0 ? -dx : dx;
+    dy = dy < 0 ? -dy : dy;
+
+    /* how many tile edges the line crosses in all */
+    int steps = (tx > (x1 >> 3) ? tx - (x1 >> 3) : (x1 >> 3) - tx) +
+                (ty > (y1 >> 3) ? ty - (y1 >> 3) : (y1 >> 3) - ty);
+
+    /* how far along each axis until the line crosses into the next tile */
+    int next_x = step_x > 0 ? ((tx + 1) << 3) - x0 : x0 - (tx << 3) + 1;
+    int next_y = step_y > 0 ? ((ty + 1) << 3) - y0 : y0 - (ty << 3) + 1;
+
+    while (steps-- > 0)
+    {
+        /* step whichever edge the line reaches first, comparing next_x / dx
+         * with next_y / dy by cross multiplying so there is no division */
+        int edge, span;
+        if (next_x * dy < next_y * dx)
+        {
+            tx += step_x;
+            edge = next_x;
+            span = dx;
+            next_x += 8;
+        }
+        else
+        {
+            ty += step_y;
+            edge = next_y;
+            span = dy;
+            next_y += 8;
+        }
+
+        if (tile_blocks(tx, ty))
+        {
+            if (hit)
+            {
+                hit->tile_x = tx;
+                hit->tile_y = ty;
+                hit->distance = isqrt(dx * dx + dy * dy) * edge / span;
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* returns whether one point can see another no more than max_distance away,
+ * the AI calls this from fast memory so calls to it go the long way */
+LONG_CALL int line_of_sight(int x0, int y0, int x1, int y1, int max_distance)
+{
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    if (dx * dx + dy * dy > max_distance * max_distance)
+    {
+        return 0;
+    }
+    return !ray_cast(x0, y0, x1, y1, 0);
+}
+
+/* check up to 32 points, given as x, y pairs, from one place at once, bit i
+ * of the result is set if point i can be seen - the AI calls this too */
+LONG_CALL unsigned int line_of_sight_batch(int x0, int y0, const short *points, int count,
+                                           int max_distance)
+{
+    unsigned int visible = 0;
+    for (int i = 0; i < count && i < 32; i++)
+    {
+        if (line_of_sight(x0, y0, points[i * 2], points[i * 2 + 1], max_distance))
+        {
+            visible |= 1 << i;
+        }
+    }
+    return visible;
+}
+
+/* cast a fan of rays out to max_distance, starting at an angle and turning
+ * by angle_step each time in 256ths of a turn, and store how far each gets
+ * - for working out which parts of a light's cone are blocked */
+void ray_fan(int x0, int y0, int angle, int angle_step, int count, int max_distance,
+             unsigned short *lengths)
+{
+    struct RayHit hit;
+    for (int i = 0; i < count; i++)
+    {
+        int x1 = x0 + ((sin_lut[(angle + 64) & 255] * max_distance) >> 12);
+        int y1 = y0 + ((sin_lut[angle & 255] * max_distance) >> 12);
+
+        lengths[i] = ray_cast(x0, y0, x1, y1, &hit) ? hit.distance : max_distance;
+        angle += angle_step;
+    }
+}
+
+/* COLLISION */
+
+/* a hit box, in pixels from a sprite's top left corner */
+struct Hitbox
+{
+    signed char x, y, w, h;
+};
+
+/* the hit box of each 16x32 frame of the sprite image facing right, a little
+ * narrower than what is drawn so arms and hair do not count */
+#define FRAME_TILES 16
+#define FRAME_WIDTH 16
+#define FRAME_HEIGHT 32
+const struct Hitbox frame_hitboxes[] = {
+    {2, 5, 12, 27}, {2, 5, 12, 27},                  /* afton standing and walking */
+    {3, 14, 10, 18}, {2, 3, 12, 29}, {3, 14, 10, 18}, /* a guest, then as an animatronic */
+    {2, 1, 12, 31}, {3, 14, 10, 18}, {2, 7, 12, 25}, {3, 14, 10, 18}, {2, 6, 12, 26},
+};
+#define NUM_FRAME_HITBOXES (sizeof(frame_hitboxes) / sizeof(frame_hitboxes[0]))
+
+/* what a collider is, so the callbacks know what they ran into */
+#define COLLIDER_PLAYER 0
+#define COLLIDER_GUEST 1
+
+#define MAX_COLLIDERS 32
+
+/* something which can touch other things, following a sprite's position,
+ * frame and flip */
+struct Collider
+{
+    int *x, *y;
+    struct Sprite *sprite;
+    int kind;
+
+    /* set to 0 to leave this out, for things which are asleep */
+    int enabled;
+
+    /* called for each thing this touches, every frame they touch */
+    void (*on_overlap)(struct Collider *self, struct Collider *other);
+    void *data;
+
+    /* this frame's box, right and bottom are one past the edge */
+    int left, top, right, bottom;
+};
+
+struct Collider colliders[MAX_COLLIDERS];
+int num_colliders = 0;
+
+/* the colliders in order of their left edges, kept from one frame to the
+ * next so they are nearly in order already and sorting is quick */
+unsigned char collider_order[MAX_COLLIDERS];
+
+/* remove every collider */
+void collision_clear()
+{
+    num_colliders = 0;
+}
+
+/* add a collider for something with a sprite, the position is read from x
+ * and y each frame, on_overlap may be 0 for things which only get touched */
+struct Collider *collider_add(int *x, int *y, struct Sprite *sprite, int kind,
+                              void (*on_overlap)(struct Collider *, struct Collider *), void *data)
+{
+    if (num_colliders >= MAX_COLLIDERS)
+    {
+        return 0;
+    }
+
+    struct Collider *collider = &colliders[num_colliders];
+    collider->x = x;
+    collider->y = y;
+    collider->sprite = sprite;
+    collider->kind = kind;
+    collider->on_overlap = on_overlap;
+    collider->data = data;
+    collider->enabled = 1;
+    collider_order[num_colliders] = num_colliders;
+    num_colliders++;
+    return collider;
+}
+
+/* work out a collider's box from its sprite's frame, mirrored if it is flipped */
+void collider_box(struct Collider *collider)
+{
+    unsigned int frame = (collider->sprite->attribute2 & 0x3ff) / FRAME_TILES;
+    struct Hitbox box = {0, 0, FRAME_WIDTH, FRAME_HEIGHT};
+    if (frame < NUM_FRAME_HITBOXES)
+    {
+        box = frame_hitboxes[frame];
+    }
+
+    int left = box.x;
+    if (collider->sprite->attribute1 & 0x1000)
+    {
+        left = FRAME_WIDTH - box.x - box.w;
+    }
+
+    collider->left = *collider->x + left;
+    collider->right = collider->left + box.w;
+    collider->top = *collider->y + box.y;
+    collider->bottom = collider->top + box.h;
+}
+
+/* find every pair of colliders which touch and tell them - the colliders are
+ * sorted by their left edges, then each one is only checked against those
+ * which start before it ends, so far apart things are never compared */
+void collision_update()
+{
+    for (int i = 0; i < num_colliders; i++)
+    {
+        collider_box(&colliders[i]);
+    }
+
+    /* insertion sort, which is close to linear on a nearly sorted list */
+    for (int i = 1; i < num_colliders; i++)
+    {
+        unsigned char index = collider_order[i];
+        int left = colliders[index].left;
+        int j = i - 1;
+        while (j >= 0 && colliders[collider_order[j]].left > left)
+        {
+            collider_order[j + 1] = collider_order[j];
+            j--;
+        }
+        collider_order[j + 1] = index;
+    }
+
+    /* sweep along */
+    for (int i = 0; i < num_colliders; i++)
+    {
+        struct Collider *a = &colliders[collider_order[i]];
+        if (!a->enabled)
+        {
+            continue;
+        }
+        for (int j = i + 1; j < num_colliders; j++)
+        {
+            struct Collider *b = &colliders[collider_order[j]];
+            if (b->left >= a->right)
+            {
+                break;
+            }
+            if (b->enabled && a->top < b->bottom && b->top < a->bottom)
+            {
+                if (a->on_overlap)
+                {
+                    a->on_overlap(a, b);
+                }
+                if (b->on_overlap)
+                {
+                    b->on_overlap(b, a);
+                }
+            }
+        }
+    }
+}
+
+/* CAMERA */
+
+/* the camera's position is kept in 1/256 pixels so it can ease along */
+#define CAMERA_SHIFT 8
+
+/* afton can move this far either side of the middle of the screen before the
+ * camera follows, across and down */
+#define CAMERA_DEAD_ZONE_X 72
+#define CAMERA_DEAD_ZONE_Y 40
+
+/* how far ahead of afton the camera looks in the way he faces */
+#define CAMERA_LOOK_AHEAD 24
+
+/* the camera closes 1/8 of the gap to where it should be each frame */
+#define CAMERA_SMOOTHING 3
+
+/* the part of the level on the screen */
+struct Camera
+{
+    /* the top left corner, in 1/256 pixels */
+    int x, y;
+
+    /* where it is heading, in pixels */
+    int target_x, target_y;
+
+    /* how far it looks ahead now, this eases over when afton turns */
+    int look;
+
+    /* the top left corner in pixels, for scrolling and drawing */
+    int scroll_x, scroll_y;
+};
+
+/* something the camera draws, with its position in the level */
+struct CameraEntity
+{
+    int *x, *y;
+    struct Sprite *sprite;
+
+    /* where to keep whether it is on screen, may be 0 */
+    int *cull;
+};
+
+#define MAX_CAMERA_ENTITIES 32
+struct CameraEntity camera_entities[MAX_CAMERA_ENTITIES];
+int num_camera_entities = 0;
+
+/* put the camera at a place in the level straight away */
+void camera_reset(struct Camera *camera, int x, int y)
+{
+    camera->target_x = x;
+    camera->target_y = y;
+    camera->x = x << CAMERA_SHIFT;
+    camera->y = y << CAMERA_SHIFT;
+    camera->look = 0;
+    camera->scroll_x = x;
+    camera->scroll_y = y;
+}
+
+/* move one axis of the camera - the target moves only as far as it takes to
+ * keep the focus inside the dead zone, and the camera eases toward it */
+int camera_follow(int *position, int *target, int focus, int half_screen, int dead_zone, int limit)
+{
+    int middle = *target + half_screen;
+    if (focus > middle + dead_zone)
+    {
+        *target = focus - dead_zone - half_screen;
+    }
+    else if (focus < middle - dead_zone)
+    {
+        *target = focus + dead_zone - half_screen;
+    }
+
+    /* stay inside the level */
+    if (*target < 0)
+    {
+        *target = 0;
+    }
+    if (*target > limit)
+    {
+        *target = limit;
+    }
+
+    /* close some of the gap, or all of it once it is small */
+    int gap = (*target << CAMERA_SHIFT) - *position;
+    if (gap < (1 << CAMERA_SHIFT) && gap > -(1 << CAMERA_SHIFT))
+    {
+        *position = *target << CAMERA_SHIFT;
+    }
+    else
+    {
+        *position += gap >> CAMERA_SMOOTHING;
+    }
+    return *position >> CAMERA_SHIFT;
+}
+
+/* move the camera along after afton, looking ahead of him */
+void camera_update(struct Camera *camera, int focus_x, int focus_y, int facing_left)
+{
+    int look = facing_left ? -CAMERA_LOOK_AHEAD : CAMERA_LOOK_AHEAD;
+    if (camera->look < look)
+    {
+        camera->look++;
+    }
+    else if (camera->look > look)
+    {
+        camera->look--;
+    }
+
+    camera->scroll_x = camera_follow(&camera->x, &camera->target_x, focus_x + camera->look,
+                                     SCREEN_WIDTH / 2, CAMERA_DEAD_ZONE_X, LEVEL_WIDTH - SCREEN_WIDTH);
+    camera->scroll_y = camera_follow(&camera->y, &camera->target_y, focus_y, SCREEN_HEIGHT / 2,
+                                     CAMERA_DEAD_ZONE_Y, LEVEL_HEIGHT - SCREEN_HEIGHT);
+}
+
+/* forget everything the camera draws */
+void camera_clear()
+{
+    num_camera_entities = 0;
+}
+
+/* have the camera draw a sprite at a position in the level */
+void camera_add(int *x, int *y, struct Sprite *sprite, int *cull)
+{
+    if (num_camera_entities < MAX_CAMERA_ENTITIES)
+    {
+        struct CameraEntity *entity = &camera_entities[num_camera_entities++];
+        entity->x = x;
+        entity->y = y;
+        entity->sprite = sprite;
+        entity->cull = cull;
+    }
+}
+
+/* put every sprite where it is on the screen in one go, hiding the ones
+ * which are off it */
+void camera_project(struct Camera *camera)
+{
+    for (int i = 0; i < num_camera_entities; i++)
+    {
+        struct CameraEntity *entity = &camera_entities[i];
+        int x = *entity->x - camera->scroll_x;
+        int y = *entity->y - camera->scroll_y;
+        int cull = cull_test(x, y, FRAME_WIDTH, FRAME_HEIGHT, 0, 0);
+
+        if (entity->cull)
+        {
+            *entity->cull = cull;
+        }
+        sprite_set_hidden(entity->sprite, cull != CULL_VISIBLE);
+        if (cull == CULL_VISIBLE)
+        {
+            sprite_position(entity->sprite, x, y);
+        }
+    }
+}
+
+/* TIMERS */
+
+/* a timer wheel has a ring of 64 slots for each level, the first level's
+ * slots are one frame apart, the next 64 frames apart and the last 4096, so
+ * a timer can be up to about an hour away */
+#define WHEEL_BITS 6
+#define WHEEL_SIZE (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SIZE - 1)
+#define WHEEL_LEVELS 3
+#define WHEEL_MAX_DELAY ((1 << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+
+/* the states a timer can be in */
+#define TIMER_FREE 0
+#define TIMER_PENDING 1
+#define TIMER_RUNNING 2
+
+/* a callback to run after some frames, and again every period frames if the
+ * period is not 0 */
+struct Timer
+{
+    /* the next timer in the slot, and the pointer which points at this one */
+    struct Timer *next;
+    struct Timer **pprev;
+
+    unsigned int expires;
+    unsigned int period;
+    void (*callback)(void *data);
+    void *data;
+    int state;
+};
+
+/* every timer comes from here, the free ones are linked through next */
+#define MAX_TIMERS 32
+struct Timer timer_pool[MAX_TIMERS];
+struct Timer *timer_free_list = 0;
+int timer_pool_ready = 0;
+
+/* a set of timers which move along together */
+struct TimerWheel
+{
+    unsigned int now;
+    struct Timer *slots[WHEEL_LEVELS][WHEEL_SIZE];
+};
+
+/* put a timer at the front of a slot's list */
+void timer_link(struct Timer **slot, struct Timer *timer)
+{
+    timer->next = *slot;
+    if (timer->next)
+    {
+        timer->next->pprev = &timer->next;
+    }
+    *slot = timer;
+    timer->pprev = slot;
+}
+
+/* take a timer out of whatever list it is in */
+void timer_unlink(struct Timer *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = 0;
+    timer->pprev = 0;
+}
+
+/* put a timer in the slot for when it expires, the nearer it is the finer the level */
+void timer_place(struct TimerWheel *wheel, struct Timer *timer)
+{
+    unsigned int delay = timer->expires - wheel->now;
+    if (delay > WHEEL_MAX_DELAY)
+    {
+        delay = WHEEL_MAX_DELAY;
+    }
+    unsigned int when = wheel->now + delay;
+
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delay >= (1u << (WHEEL_BITS * (level + 1))))
+    {
+        level++;
+    }
+    timer_link(&wheel->slots[level][(when >> (WHEEL_BITS * level)) & WHEEL_MASK], timer);
+    timer->state = TIMER_PENDING;
+}
+
+/* give a timer back to the pool */
+void timer_release(struct Timer *timer)
+{
+    timer->state = TIMER_FREE;
+    timer->next = timer_free_list;
+    timer_free_list = timer;
+}
+
+/* empty a wheel and start its clock from 0, any timers in it are freed */
+void timer_wheel_init(struct TimerWheel *wheel)
+{
+    if (!timer_pool_ready)
+    {
+        for (int i = 0; i < MAX_TIMERS; i++)
+        {
+            timer_release(&timer_pool[i]);
+        }
+        timer_pool_ready = 1;
+    }
+
+    for (int level = 0; level < WHEEL_LEVELS; level++)
+    {
+        for (int i = 0; i < WHEEL_SIZE; i++)
+        {
+            while (wheel->slots[level][i])
+            {
+                struct Timer *timer = wheel->slots[level][i];
+                timer_unlink(timer);
+                timer_release(timer);
+            }
+        }
+    }
+    wheel->now = 0;
+}
+
+/* start a timer which runs a callback in some frames, and then every period
+ * frames if period is not 0, returns 0 if there are no timers left */
+struct Timer *timer_start(struct TimerWheel *wheel, unsigned int frames, unsigned int period,
+                          void (*callback)(void *data), void *data)
+{
+    struct Timer *timer = timer_free_list;
+    if (!timer)
+    {
+        return 0;
+    }
+    timer_free_list = timer->next;
+
+    timer->expires = wheel->now + (frames ? frames : 1);
+    timer->period = period;
+    timer->callback = callback;
+    timer->data = data;
+    timer_place(wheel, timer);
+    return timer;
+}
+
+/* stop a timer, it is fine to stop one from inside its own callback */
+void timer_cancel(struct Timer *timer)
+{
+    if (timer->state == TIMER_PENDING)
+    {
+        timer_unlink(timer);
+        timer_release(timer);
+    }
+    else if (timer->state == TIMER_RUNNING)
+    {
+        /* it is given back once its callback returns */
+        timer->period = 0;
+    }
+}
+
+/* move the timers in one slot down to the finer levels */
+void timer_cascade(struct TimerWheel *wheel, int level, int index)
+{
+    struct Timer *list = wheel->slots[level][index];
+    wheel->slots[level][index] = 0;
+    if (list)
+    {
+        list->pprev = &list;
+    }
+
+    while (list)
+    {
+        struct Timer *timer = list;
+        timer_unlink(timer);
+        timer_place(wheel, timer);
+    }
+}
+
+/* move the wheel on one frame and run every timer which is due */
+void timer_wheel_step(struct TimerWheel *wheel)
+{
+    wheel->now++;
+
+    /* when a level goes round, the next level's slot comes down */
+    for (int level = 1; level < WHEEL_LEVELS; level++)
+    {
+        if (wheel->now & ((1u << (WHEEL_BITS * level)) - 1))
+        {
+            break;
+        }
+        timer_cascade(wheel, level, (wheel->now >> (WHEEL_BITS * level)) & WHEEL_MASK);
+    }
+
+    /* take the whole slot off at once, then run it */
+    struct Timer *list = wheel->slots[0][wheel->now & WHEEL_MASK];
+    wheel->slots[0][wheel->now & WHEEL_MASK] = 0;
+    if (list)
+    {
+        list->pprev = &list;
+    }
+
+    while (list)
+    {
+        struct Timer *timer = list;
+        timer_unlink(timer);
+
+        timer->state = TIMER_RUNNING;
+        timer->callback(timer->data);
+
+        if (timer->period)
+        {
+            timer->expires += timer->period;
+            timer_place(wheel, timer);
+        }
+        else
+        {
+            timer_release(timer);
+        }
+    }
+}
+
+/* SCRIPTS */
+
+/* cutscenes are written as straight line functions which are called once a
+ * frame and pick up where they left off, like protothreads - the function's
+ * place is kept as a line number in a small struct instead of on a stack, so
+ * local variables do not last across a wait, anything which must goes in the
+ * struct or a global */
+struct Script
+{
+    /* the line to carry on from, 0 to start over and -1 when finished */
+    int line;
+
+    /* how many frames the script has been running */
+    int frames;
+
+    /* the frame a wait is up on */
+    int until;
+};
+
+/* what a script function returns */
+#define SCRIPT_DONE 0
+#define SCRIPT_RUNNING 1
+#define SCRIPT_FINISHED -1
+
+/* these go around the body of a script function, only one wait can go on a
+ * line since the line number marks the place */
+#define SCRIPT_BEGIN(script) switch ((script)->line) { case 0:
+#define SCRIPT_END(script) } (script)->line = SCRIPT_FINISHED; return SCRIPT_DONE
+
+/* give up the rest of this frame */
+#define SCRIPT_YIELD(script)                                                                       \
+    do                                                                                             \
+    {                                                                                              \
+        (script)->line = __LINE__;                                                                 \
+        return SCRIPT_RUNNING;                                                                     \
+    case __LINE__:;                                                                                \
+    } while (0)
+
+/* come back each frame until something is true */
+#define SCRIPT_WAIT_UNTIL(script, condition)                                                       \
+    do                                                                                             \
+    {                                                                                              \
+        (script)->line = __LINE__;                                                                 \
+    case __LINE__:                                                                                 \
+        if (!(condition))                                                                          \
+        {                                                                                          \
+            return SCRIPT_RUNNING;                                                                 \
+        }                                                                                          \
+    } while (0)
+
+/* wait until the script has been running some number of frames */
+#define SCRIPT_WAIT_FRAME(script, frame) SCRIPT_WAIT_UNTIL(script, (script)->frames >= (frame))
+
+/* wait some number of frames from now */
+#define SCRIPT_SLEEP(script, count)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        (script)->until = (script)->frames + (count);                                              \
+        (script)->line = __LINE__;                                                                 \
+    case __LINE__:                                                                                 \
+        if ((script)->frames < (script)->until)                                                    \
+        {                                                                                          \
+            return SCRIPT_RUNNING;                                                                 \
+        }                                                                                          \
+    } while (0)
+
+/* wait for a palette fade or an animation to finish */
+#define SCRIPT_WAIT_FADE(script) SCRIPT_WAIT_UNTIL(script, !palette_fading())
+#define SCRIPT_WAIT_ANIMATION(script, animation) SCRIPT_WAIT_UNTIL(script, animation_done(animation))
+
+/* an animation steps a sprite through some frames of its image, each shown
+ * for a number of frames, and stops on the last one */
+struct Animation
+{
+    struct Sprite *sprite;
+
+    /* the tile offset shown now and how far apart the frames are */
+    int frame;
+    int step;
+
+    /* how many frames are left to show after this one */
+    int remaining;
+
+    /* how long each frame shows, and how long this one has left */
+    int delay;
+    int counter;
+};
+
+/* start showing count frames from first, delay frames each */
+void animation_start(struct Animation *animation, struct Sprite *sprite, int first, int step,
+                     int count, int delay)
+{
+    animation->sprite = sprite;
+    animation->frame = first;
+    animation->step = step;
+    animation->remaining = count - 1;
+    animation->delay = delay;
+    animation->counter = delay;
+    sprite_set_offset(sprite, first);
+}
+
+/* returns whether the last frame has been shown for its time */
+int animation_done(struct Animation *animation)
+{
+    return animation->remaining <= 0 && animation->counter <= 0;
+}
+
+/* move an animation on a frame */
+void animation_update(struct Animation *animation)
+{
+    if (animation->counter > 0)
+    {
+        animation->counter--;
+    }
+    if (animation->counter <= 0 && animation->remaining > 0)
+    {
+        animation->frame = next_frame(animation->frame, animation->step);
+        animation->remaining--;
+        animation->counter = animation->delay;
+        sprite_set_offset(animation->sprite, animation->frame);
+    }
+}
+
+/* start a script over from the top */
+void script_start(struct Script *script)
+{
+    script->line = 0;
+    script->frames = 0;
+    script->until = 0;
+}
+
+/* run a script for one frame, returns whether it is still going */
+int script_run(struct Script *script, int (*body)(struct Script *))
+{
+    if (script->line == SCRIPT_FINISHED)
+    {
+        return SCRIPT_DONE;
+    }
+
+    int running = body(script);
+    script->frames++;
+    return running;
+}
+
+/* NIGHT */
+
+/* the night goes from 12 AM to 6 AM, an hour is a minute of frames */
+#define FRAMES_PER_HOUR 3600
+#define LAST_HOUR 6
+
+/* power goes down by one percent this often */
+#define FRAMES_PER_POWER 360
+
+/* the clock and power meter */
+struct Night
+{
+    /* the hour, 0 is 12 AM */
+    int hour;
+
+    /* the power left in percent */
+    int power;
+};
+
+/* the night's timers, these only move while the game is being played so a
+ * pause or a cutscene does not move the clock */
+struct TimerWheel game_timers;
+
+/* move the clock on an hour */
+void night_hour(void *data)
+{
+    struct Night *night = data;
+    if (night->hour < LAST_HOUR)
+    {
+        night->hour++;
+    }
+}
+
+/* use up some power */
+void night_power(void *data)
+{
+    struct Night *night = data;
+    if (night->power > 0)
+    {
+        night->power--;
+    }
+}
+
+/* start a new night, this clears any timers from the last one */
+void night_init(struct Night *night)
+{
+    night->hour = 0;
+    night->power = 100;
+
+    timer_wheel_init(&game_timers);
+    timer_start(&game_timers, FRAMES_PER_HOUR, FRAMES_PER_HOUR, night_hour, night);
+    timer_start(&game_timers, FRAMES_PER_POWER, FRAMES_PER_POWER, night_power, night);
+}
+
+/* draw the clock in the top right and the power in the bottom left, only the
+ * characters which change get written to the map */
+void night_draw(struct Night *night)
+{
+    text_int(night->hour == 0 ? 12 : night->hour, 0, 24, 2);
+    set_text(" AM", 0, 26);
+    set_text("POWER", 19, 1);
+    text_int(night->power, 19, 7, 3);
+    set_text("%", 19, 10);
+}
+
+/* ROOMS */
+
+/* the animatronics walk between the rooms in rooms.graph, the shortest path
+ * between every pair is worked out by tools/roomgraph.py so finding the way
+ * is just looking up the next room to head for */
+
+/* returns the room to go to next on the way from one room to another, or
+ * ROOM_NONE if there is no way there - these are called from the AI in fast
+ * memory, which is too far away from the rom for a normal call */
+LONG_CALL int room_next_hop(int from, int to)
+{
+    if ((unsigned int)from >= rooms_count || (unsigned int)to >= rooms_count)
+    {
+        return ROOM_NONE;
+    }
+    return room_next[from * rooms_count + to];
+}
+
+/* returns how far it is from one room to another, or ROOM_NO_PATH */
+LONG_CALL int room_distance(int from, int to)
+{
+    if ((unsigned int)from >= rooms_count || (unsigned int)to >= rooms_count)
+    {
+        return ROOM_NO_PATH;
+    }
+    return room_distances[from * rooms_count + to];
+}
+
+/* ANIMATRONIC AI */
+
+/* animatronics are driven by little bytecode programs in ROM, made from .ai
+ * scripts by tools/aiasm.py - each one has its own place in its program and
+ * its own registers, and runs a limited number of instructions a frame */
+#define AI_REGISTERS 8
+#define AI_INSTRUCTIONS_PER_RUN 32
+
+/* the instructions, these numbers must match tools/aiasm.py */
+#define AI_HALT 0
+#define AI_YIELD 1
+#define AI_WAIT 2
+#define AI_SET 3
+#define AI_MOV 4
+#define AI_ADD 5
+#define AI_ADDR 6
+#define AI_SUB 7
+#define AI_GET 8
+#define AI_PUT 9
+#define AI_JMP 10
+#define AI_JLT 11
+#define AI_JGE 12
+#define AI_JEQ 13
+#define AI_JNE 14
+#define AI_RAND 15
+#define AI_PATH 16
+#define AI_DIST 17
+#define AI_ROOMX 18
+#define AI_NUM_OPS 19
+
+/* what a program can read with get and write with put */
+#define AI_SELF_X 0
+#define AI_SELF_Y 1
+#define AI_SELF_FRAME 2
+#define AI_SELF_TURNED 3
+#define AI_PLAYER_X 4
+#define AI_PLAYER_Y 5
+#define AI_HOUR 6
+#define AI_POWER 7
+#define AI_SELF_TOUCHING 8
+#define AI_SELF_SEES_PLAYER 9
+
+/* how far an animatronic can see, in pixels, it looks from the middle of
+ * its head to afton's head, middle and feet, and sees him if any of them
+ * are not blocked */
+#define AI_SIGHT_RANGE 160
+#define AI_EYE_X 8
+#define AI_EYE_Y 8
+#define AI_SIGHT_POINTS 3
+const short ai_sight_points[AI_SIGHT_POINTS * 2] = {8, 8, 8, 18, 8, 28};
+
+/* one animatronic's program and where it is in it */
+struct AiActor
+{
+    /* the program and the offset of the next instruction in it */
+    const unsigned char *program;
+    unsigned short pc;
+
+    /* set once the program halts */
+    unsigned char halted;
+
+    /* frames left to wait before carrying on */
+    unsigned char sleep;
+
+    int regs[AI_REGISTERS];
+
+    /* the guest this program moves */
+    struct Guest *body;
+};
+
+/* start an actor's program from the beginning */
+void ai_start(struct AiActor *actor, const unsigned char *program, struct Guest *body)
+{
+    actor->program = program;
+    actor->pc = 0;
+    actor->halted = 0;
+    actor->sleep = 0;
+    actor->body = body;
+    for (int i = 0; i < AI_REGISTERS; i++)
+    {
+        actor->regs[i] = 0;
+    }
+}
+
+/* run an actor until it yields, waits, halts or uses up its instructions for
+ * the frame - this is in internal work ram as ARM code, and jumps straight
+ * from each instruction to the next through a table of labels rather than
+ * going back around a switch - the common instructions are done inline, only
+ * rand, path, dist and the sight sensor call back out to ROM, which they do
+ * with long calls */
+IWRAM_CODE void ai_run(struct AiActor *actor, struct Afton *player, struct Night *night)
+{
+    static const void *const dispatch[AI_NUM_OPS] = {
+        &&op_halt, &&op_yield, &&op_wait, &&op_set, &&op_mov, &&op_add, &&op_addr, &&op_sub,
+        &&op_get,  &&op_put,   &&op_jmp,  &&op_jlt, &&op_jge, &&op_jeq, &&op_jne,  &&op_rand,
+        &&op_path, &&op_dist,  &&op_roomx,
+    };
+
+    if (actor->halted)
+    {
+        return;
+    }
+    if (actor->sleep)
+    {
+        actor->sleep--;
+        return;
+    }
+
+    const unsigned char *code = actor->program;
+    const unsigned char *ip = code + actor->pc;
+    int *regs = actor->regs;
+    struct Guest *body = actor->body;
+    int budget = AI_INSTRUCTIONS_PER_RUN;
+    int value;
+
+/* instruction operands, immediates and jump targets are little endian */
+#define AI_IMMEDIATE(at) ((short)(ip[at] | (ip[(at) + 1] << 8)))
+#define AI_TARGET(at) (code + (ip[at] | (ip[(at) + 1] << 8)))
+#define AI_NEXT()                                                                                  \
+    do                                                                                             \
+    {                                                                                              \
+        if (--budget < 0)                                                                          \
+        {                                                                                          \
+            goto suspend;                                                                          \
+        }                                                                                          \
+        goto *dispatch[*ip];                                                                       \
+    } while (0)
+
+    AI_NEXT();
+
+op_halt:
+    actor->halted = 1;
+    goto suspend;
+
+op_yield:
+    ip += 1;
+    goto suspend;
+
+op_wait:
+    actor->sleep = ip[1];
+    ip += 2;
+    goto suspend;
+
+op_set:
+    regs[ip[1]] = AI_IMMEDIATE(2);
+    ip += 4;
+    AI_NEXT();
+
+op_mov:
+    regs[ip[1]] = regs[ip[2]];
+    ip += 3;
+    AI_NEXT();
+
+op_add:
+    regs[ip[1]] += AI_IMMEDIATE(2);
+    ip += 4;
+    AI_NEXT();
+
+op_addr:
+    regs[ip[1]] += regs[ip[2]];
+    ip += 3;
+    AI_NEXT();
+
+op_sub:
+    regs[ip[1]] -= regs[ip[2]];
+    ip += 3;
+    AI_NEXT();
+
+op_get:
+    switch (ip[2])
+    {
+    case AI_SELF_X:
+        value = body->x;
         break;
-    case SIZE_16_16:
-        size_bits = 1;
-        shape_bits = 0;
+    case AI_SELF_Y:
+        value = body->y;
         break;
-    case SIZE_32_32:
-        size_bits = 2;
-        shape_bits = 0;
+    case AI_SELF_FRAME:
+        value = body->frame;
         break;
-    case SIZE_64_64:
-        size_bits = 3;
-        shape_bits = 0;
+    case AI_SELF_TURNED:
+        value = body->ani;
         break;
-    case SIZE_16_8:
-        size_bits = 0;
-        shape_bits = 1;
+    case AI_PLAYER_X:
+        value = player->x;
         break;
-    case SIZE_32_8:
-        size_bits = 1;
-        shape_bits = 1;
+    case AI_PLAYER_Y:
+        value = player->y;
         break;
-    case SIZE_32_16:
-        size_bits = 2;
-        shape_bits = 1;
+    case AI_HOUR:
+        value = night->hour;
         break;
-    case SIZE_64_32:
-        size_bits = 3;
-        shape_bits = 1;
+    case AI_POWER:
+        value = night->power;
         break;
-    case SIZE_8_16:
-        size_bits = 0;
-        shape_bits = 2;
+    case AI_SELF_TOUCHING:
+        value = body->touching;
         break;
-    case SIZE_8_32:
-        size_bits = 1;
-        shape_bits = 2;
+    case AI_SELF_SEES_PLAYER:
+    {
+        short points[AI_SIGHT_POINTS * 2];
+        for (int i = 0; i < AI_SIGHT_POINTS; i++)
+        {
+            points[i * 2] = player->x + ai_sight_points[i * 2];
+            points[i * 2 + 1] = player->y + ai_sight_points[i * 2 + 1];
+        }
+        value = line_of_sight_batch(body->x + AI_EYE_X, body->y + AI_EYE_Y, points,
+                                    AI_SIGHT_POINTS, AI_SIGHT_RANGE) != 0;
         break;
-    case SIZE_16_32:
-        size_bits = 2;
-        shape_bits = 2;
+    }
+    default:
+        value = 0;
         break;
-    case SIZE_32_64:
-        size_bits = 3;
-        shape_bits = 2;
+    }
+    regs[ip[1]] = value;
+    ip += 3;
+    AI_NEXT();
+
+op_put:
+    value = regs[ip[2]];
+    switch (ip[1])
+    {
+    case AI_SELF_X:
+        body->x = value;
         break;
+    case AI_SELF_Y:
+        body->y = value;
+        break;
+    case AI_SELF_FRAME:
+        body->frame = value;
+        body->sprite->attribute2 = (body->sprite->attribute2 & 0xfc00) | (value & 0x03ff);
+        value = body->sprite - sprites;
+        sprite_dirty[value >> 5] |= 1 << (value & 31);
+        break;
+    case AI_SELF_TURNED:
+        body->ani = value;
+        break;
+    }
+    ip += 3;
+    AI_NEXT();
+
+op_jmp:
+    ip = AI_TARGET(1);
+    AI_NEXT();
+
+op_jlt:
+    ip = regs[ip[1]] < regs[ip[2]] ? AI_TARGET(3) : ip + 5;
+    AI_NEXT();
+
+op_jge:
+    ip = regs[ip[1]] >= regs[ip[2]] ? AI_TARGET(3) : ip + 5;
+    AI_NEXT();
+
+op_jeq:
+    ip = regs[ip[1]] == regs[ip[2]] ? AI_TARGET(3) : ip + 5;
+    AI_NEXT();
+
+op_jne:
+    ip = regs[ip[1]] != regs[ip[2]] ? AI_TARGET(3) : ip + 5;
+    AI_NEXT();
+
+op_rand:
+    /* the game's generator, so replays still match */
+    regs[ip[1]] = xorshift(&random_state) & ip[2];
+    ip += 3;
+    AI_NEXT();
+
+op_path:
+    /* the next room on the way between two rooms, straight from the table */
+    regs[ip[1]] = room_next_hop(regs[ip[2]], regs[ip[3]]);
+    ip += 4;
+    AI_NEXT();
+
+op_dist:
+    regs[ip[1]] = room_distance(regs[ip[2]], regs[ip[3]]);
+    ip += 4;
+    AI_NEXT();
+
+op_roomx:
+    regs[ip[1]] = (unsigned int)regs[ip[2]] < rooms_count ? room_x[regs[ip[2]]] : 0;
+    ip += 3;
+    AI_NEXT();
+
+suspend:
+    actor->pc = ip - code;
+
+#undef AI_IMMEDIATE
+#undef AI_TARGET
+#undef AI_NEXT
+}
+
+/* AI SCHEDULER */
+
+/* timers 2 and 3 are chained into one 32 bit count of CPU cycles for timing
+ * the AI, timer 0 belongs to the sound */
+volatile unsigned short *timer2_data = (volatile unsigned short *)0x4000108;
+volatile unsigned short *timer2_control = (volatile unsigned short *)0x400010a;
+volatile unsigned short *timer3_data = (volatile unsigned short *)0x400010c;
+volatile unsigned short *timer3_control = (volatile unsigned short *)0x400010e;
+
+/* a timer with this set counts when the one before it overflows */
+#define TIMER_CASCADE 0x4
+
+/* the AI gets an eighth of the cycles in a frame */
+#define AI_BUDGET_CYCLES (CYCLES_PER_FRAME / 8)
+
+/* actors off the screen only think this often, in frames */
+#define AI_OFFSCREEN_INTERVAL 4
+
+#define AI_MAX_AGENTS 32
+
+/* an actor with the frame it is due to run on again */
+struct AiAgent
+{
+    struct AiActor *actor;
+    unsigned int due;
+};
+
+struct AiAgent ai_agents[AI_MAX_AGENTS];
+int ai_num_agents = 0;
+
+/* which agent goes first next frame, so ones left over when the budget ran
+ * out get their turn before the rest */
+int ai_cursor = 0;
+
+/* the scheduler's own frame count, and how it did last frame */
+unsigned int ai_frame = 0;
+unsigned int ai_last_cycles = 0;
+int ai_overruns = 0;
+
+/* returns the cycle count from the chained timers */
+unsigned int ai_cycles()
+{
+    unsigned short high, low;
+
+    /* read the high half again if the low half overflowed in between */
+    do
+    {
+        high = *timer3_data;
+        low = *timer2_data;
+    } while (high != *timer3_data);
+
+    return (high << 16) | low;
+}
+
+/* start the cycle counter, it runs freely from then on */
+void ai_scheduler_init()
+{
+    *timer2_control = 0;
+    *timer3_control = 0;
+    *timer2_data = 0;
+    *timer3_data = 0;
+    *timer3_control = TIMER_ENABLE | TIMER_CASCADE;
+    *timer2_control = TIMER_ENABLE | TIMER_FREQ_1;
+}
+
+/* take every actor off the schedule */
+void ai_scheduler_clear()
+{
+    ai_num_agents = 0;
+    ai_cursor = 0;
+}
+
+/* put an actor on the schedule, off screen ones are spread across the frames
+ * between their turns so they do not all land on the same one */
+int ai_scheduler_add(struct AiActor *actor)
+{
+    if (ai_num_agents >= AI_MAX_AGENTS)
+    {
+        return -1;
+    }
+
+    ai_agents[ai_num_agents].actor = actor;
+    ai_agents[ai_num_agents].due = ai_frame + (ai_num_agents & (AI_OFFSCREEN_INTERVAL - 1));
+    return ai_num_agents++;
+}
+
+/* run the actors which are due, going round from where the last frame
+ * stopped, until they have all had a turn or the budget is used up - actors
+ * which are asleep are passed over, and wake up due */
+void ai_scheduler_run(struct Afton *player, struct Night *night)
+{
+    unsigned int start = ai_cycles();
+    unsigned int elapsed = 0;
+    int index = ai_cursor;
+
+    for (int i = 0; i < ai_num_agents; i++)
+    {
+        struct AiAgent *agent = &ai_agents[index];
+
+        int cull = agent->actor->body->cull;
+        if (cull != CULL_ASLEEP && (int)(ai_frame - agent->due) >= 0)
+        {
+            /* stop once the time is up, the rest go first next frame */
+            elapsed = ai_cycles() - start;
+            if (elapsed >= AI_BUDGET_CYCLES)
+            {
+                ai_overruns++;
+                break;
+            }
+
+            ai_run(agent->actor, player, night);
+            agent->due = ai_frame + (cull == CULL_VISIBLE ? 1 : AI_OFFSCREEN_INTERVAL);
+        }
+
+        if (++index >= ai_num_agents)
+        {
+            index = 0;
+        }
+    }
+
+    ai_cursor = index;
+    ai_last_cycles = ai_cycles() - start;
+    ai_frame++;
+}
+
+/* VIDEO */
+
+/* in mode 4 the screen is a 240x160 bitmap of palette indices, there are
+ * two pages of it and one is shown while the next frame is drawn in the other */
+#define VIDEO_PAGE_ADDRESS(page) (0x6000000 + (page) * 0xa000)
+#define VIDEO_PAGE_WORDS (SCREEN_WIDTH * SCREEN_HEIGHT / 4)
+
+/* frames are coded in 4x4 blocks, across and then down, one 32 bit word
+ * of a page holds a row of a block */
+#define VIDEO_BLOCKS_WIDE (SCREEN_WIDTH / 4)
+#define VIDEO_BLOCKS (VIDEO_BLOCKS_WIDE * SCREEN_HEIGHT / 4)
+
+/* each op of a frame is a byte, the top two bits say what it does and the
+ * low six are one less than how many blocks it covers - see tools/videnc.py */
+#define VIDEO_SKIP 0
+#define VIDEO_VECTOR 1
+#define VIDEO_FILL 2
+#define VIDEO_RAW 3
+
+/* this causes the DMA source to be the same each time rather than increment */
+#define DMA_SOURCE_FIXED 0x1000000
+
+/* a video made by tools/videnc.py */
+struct Video
+{
+    const unsigned char *data;
+    const unsigned int *codebook;
+    const unsigned short *palette;
+    int frames;
+    int fps;
+    const signed char *sound;
+    int sound_bytes;
+    int sound_rate;
+};
+
+const struct Video scream_video = {scream_data, scream_codebook, scream_palette, scream_frames,
+                                   scream_fps, scream_sound, scream_sound_bytes, scream_sound_rate};
+
+/* a video being played, how many of its frames have been decoded and shown,
+ * and the vblank it started on which it is kept in time with */
+struct VideoPlayer
+{
+    const struct Video *video;
+    const unsigned char *stream;
+    int decoded;
+    int shown;
+    unsigned int start;
+};
+
+/* decode one frame into a page, returns where the next frame starts - this
+ * is run from fast memory in arm code as it writes the whole screen */
+IWRAM_CODE const unsigned char *video_decode(const unsigned char *stream, unsigned int *page,
+                                            const unsigned int *codebook)
+{
+    /* the top row of the next block, and how far across the screen it is */
+    unsigned int *dest = page;
+    int column = 0;
+    int blocks = VIDEO_BLOCKS;
+
+    while (blocks > 0)
+    {
+        unsigned int op = *stream++;
+        int count = (op & 63) + 1;
+        blocks -= count;
+
+        switch (op >> 6)
+        {
+        case VIDEO_SKIP:
+            dest += count;
+            column += count;
+            while (column >= VIDEO_BLOCKS_WIDE)
+            {
+                column -= VIDEO_BLOCKS_WIDE;
+                dest += VIDEO_BLOCKS_WIDE * 3;
+            }
+            continue;
+
+        case VIDEO_VECTOR:
+            while (count--)
+            {
+                const unsigned int *entry = codebook + (*stream++ << 2);
+                dest[0] = entry[0];
+                dest[VIDEO_BLOCKS_WIDE] = entry[1];
+                dest[VIDEO_BLOCKS_WIDE * 2] = entry[2];
+                dest[VIDEO_BLOCKS_WIDE * 3] = entry[3];
+                dest++;
+                if (++column == VIDEO_BLOCKS_WIDE)
+                {
+                    column = 0;
+                    dest += VIDEO_BLOCKS_WIDE * 3;
+                }
+            }
+            continue;
+
+        case VIDEO_FILL:
+        {
+            unsigned int color = *stream++ * 0x01010101;
+            while (count--)
+            {
+                dest[0] = color;
+                dest[VIDEO_BLOCKS_WIDE] = color;
+                dest[VIDEO_BLOCKS_WIDE * 2] = color;
+                dest[VIDEO_BLOCKS_WIDE * 3] = color;
+                dest++;
+                if (++column == VIDEO_BLOCKS_WIDE)
+                {
+                    column = 0;
+                    dest += VIDEO_BLOCKS_WIDE * 3;
+                }
+            }
+            continue;
+        }
+
+        default:
+            /* raw blocks are not word aligned in the stream, so go a byte at a time */
+            while (count--)
+            {
+                for (int row = 0; row < 4; row++)
+                {
+                    dest[row * VIDEO_BLOCKS_WIDE] = stream[0] | (stream[1] << 8) |
+                                                    (stream[2] << 16) | (stream[3] << 24);
+                    stream += 4;
+                }
+                dest++;
+                if (++column == VIDEO_BLOCKS_WIDE)
+                {
+                    column = 0;
+                    dest += VIDEO_BLOCKS_WIDE * 3;
+                }
+            }
+            continue;
+        }
     }
 
-    int h = horizontal_flip ? 1 : 0;
-    int v = vertical_flip ? 1 : 0;
+    return stream;
+}
 
-    /* set up the first attribute */
-    sprites[index].attribute0 = y |                 /* y coordinate */
-                                (0 << 8) |          /* rendering mode */
-                                (0 << 10) |         /* gfx mode */
-                                (0 << 12) |         /* mosaic */
-                                (1 << 13) |         /* color mode, 0:16, 1:256 */
-                                (shape_bits << 14); /* shape */
+/* clear both pages to color 0, which is what the encoder expects them to start as */
+void video_clear_pages()
+{
+    static const unsigned int zero = 0;
+    for (int page = 0; page < 2; page++)
+    {
+        unsigned short enabled = critical_begin();
+        *dma3_source = (unsigned int)&zero;
+        *dma3_destination = VIDEO_PAGE_ADDRESS(page);
+        *dma3_control = VIDEO_PAGE_WORDS | DMA_SOURCE_FIXED | DMA_32 | DMA_ENABLE;
+        critical_end(enabled);
+    }
+}
 
-    /* set up the second attribute */
-    sprites[index].attribute1 = x |                /* x coordinate */
-                                (0 << 9) |         /* affine flag */
-                                (h << 12) |        /* horizontal flip flag */
-                                (v << 13) |        /* vertical flip flag */
-                                (size_bits << 14); /* size */
+/* start playing a video from its first frame, showing layer 2 in mode 4 - its
+ * sound goes on channel B and starts at the next vblank, with the frames
+ * counted from then */
+void video_start(struct VideoPlayer *player, const struct Video *video)
+{
+    player->video = video;
+    player->stream = video->data;
+    player->decoded = 0;
+    player->shown = 0;
+    struct FrameInfo info;
+    frame_info_read(&info);
+    player->start = info.frame + 1;
+
+    video_clear_pages();
+    *display_control = MODE4 | BG2_ENABLE;
+    sound_play(video->sound, video->sound_bytes, video->sound_rate, 'B');
+}
 
-    /* setup the second attribute */
-    sprites[index].attribute2 = tile_index |       // tile index */
-                                (priority << 10) | // priority */
-                                (0 << 12);         // palette bank (only 16 color)*/
+/* returns how many frames of the video should have been shown by now */
+int video_elapsed(struct VideoPlayer *player)
+{
+    struct FrameInfo info;
+    frame_info_read(&info);
+    return ((int)(info.frame - player->start) * player->video->fps) / 60;
+}
 
-    /* return pointer to this sprite */
-    return &sprites[index];
+/* run the player once a frame, straight after the vblank - a frame which was
+ * decoded is shown once its time comes, then the next is decoded into the page
+ * which is now hidden, so the decoder has a whole frame of the video to do it
+ * in, returns whether the video is still going */
+int video_update(struct VideoPlayer *player)
+{
+    const struct Video *video = player->video;
+    int elapsed = video_elapsed(player);
+
+    /* frame n is decoded into page n + 1 so the first lands on the hidden page */
+    if (player->decoded > player->shown && elapsed >= player->shown)
+    {
+        if ((player->shown + 1) & 1)
+        {
+            *display_control |= PAGE_SELECT;
+        }
+        else
+        {
+            *display_control &= ~PAGE_SELECT;
+        }
+        player->shown++;
+    }
+
+    if (player->decoded == player->shown && player->decoded < video->frames)
+    {
+        unsigned int *page = (unsigned int *)VIDEO_PAGE_ADDRESS((player->decoded + 1) & 1);
+        player->stream = video_decode(player->stream, page, video->codebook);
+        player->decoded++;
+    }
+
+    return elapsed < video->frames;
 }
 
-/* ALL SPRITES */
+/* CAMERA FEEDS */
 
-/* update all of the sprites on the screen */
-void sprite_update_all()
+/* each security camera looks at a room, and has its own copy of the level's
+ * map in a spare screen block, made before the game starts - so changing
+ * which one is watched only points the back layer at another screen block,
+ * and the tiles are the level's own which are in char block 0 already */
+#define NUM_FEEDS 4
+#define FEED_SCREEN_BLOCK 25
+
+/* frames of heavy static shown after changing feeds, and how much there
+ * always is on the monitor */
+#define FEED_STATIC_FRAMES 6
+#define FEED_STATIC_LEVEL 3
+
+struct CameraFeed
 {
-    /* copy them all over */
-    memcpy16_dma((unsigned short *)sprite_attribute_memory, (unsigned short *)sprites, NUM_SPRITES * 4);
-}
+    const char *name;
+    int room;
+};
 
-/* ALL SPRITES */
+const struct CameraFeed camera_feeds[NUM_FEEDS] = {
+    {"CAM 1A", ROOM_STAGE},
+    {"CAM 1B", ROOM_DINING},
+    {"CAM 2A", ROOM_WEST_HALL},
+    {"CAM 4A", ROOM_EAST_HALL},
+};
 
-/* setup all sprites */
-void sprite_clear()
+unsigned short feed_maps[NUM_FEEDS][map_width * map_height] EWRAM_BSS;
+
+/* returns the column of the level at the left of a feed, its room is in the middle */
+int feed_column(int feed)
 {
-    /* clear the index counter */
-    next_sprite_index = 0;
+    return room_x[camera_feeds[feed].room] / 8 - SCREEN_WIDTH / 16;
+}
 
-    /* move all sprites offscreen to hide them */
-    for (int i = 0; i < NUM_SPRITES; i++)
+/* make each camera's map, which is the level's turned round so the camera's
+ * room is in the middle of the screen with no scrolling */
+void feed_init()
+{
+    for (int feed = 0; feed < NUM_FEEDS; feed++)
     {
-        sprites[i].attribute0 = SCREEN_HEIGHT;
-        sprites[i].attribute1 = SCREEN_WIDTH;
+        int column = feed_column(feed);
+        for (int y = 0; y < map_height; y++)
+        {
+            for (int x = 0; x < map_width; x++)
+            {
+                feed_maps[feed][y * map_width + x] = map[y * map_width + ((x + column) & (map_width - 1))];
+            }
+        }
     }
 }
 
-/* ALL SPRITES */
+/* SCENES */
 
-/* set a sprite postion */
-void sprite_position(struct Sprite *sprite, int x, int y)
+/* addresses in video memory, for the asset lists which are made before the program runs */
+#define CHAR_BLOCK_ADDRESS(block) (0x6000000 + (block) * 0x4000)
+#define SCREEN_BLOCK_ADDRESS(block) (0x6000000 + (block) * 0x800)
+#define SPRITE_IMAGE_ADDRESS 0x6010000
+
+/* the title map goes in its own screen block, out of the way of the level maps */
+#define TITLE_SCREEN_BLOCK 18
+#define LEVEL_SCREEN_BLOCK 16
+
+/* one piece of data a scene needs copied into video memory */
+struct Asset
 {
-    /* clear out the y coordinate */
-    sprite->attribute0 &= 0xff00;
+    unsigned int dest;
+    const void *source;
+    int words;
+};
 
-    /* set the new y coordinate */
-    sprite->attribute0 |= (y & 0xff);
+/* a scene's assets may go anywhere except over what the scene before it is
+ * showing, since they are copied in while that scene is still running */
+const struct Asset title_assets[] = {
+    {CHAR_BLOCK_ADDRESS(0), background_data, (background_width * background_height) / 4},
+    {SCREEN_BLOCK_ADDRESS(TITLE_SCREEN_BLOCK), title, (title_width * title_height) / 2},
+};
 
-    /* clear out the x coordinate */
-    sprite->attribute1 &= 0xfe00;
+const struct Asset gameplay_assets[] = {
+    {CHAR_BLOCK_ADDRESS(0), background_data, (background_width * background_height) / 4},
+    {SCREEN_BLOCK_ADDRESS(LEVEL_SCREEN_BLOCK), map, (map_width * map_height) / 2},
+    {SCREEN_BLOCK_ADDRESS(LEVEL_SCREEN_BLOCK + 1), map2, (map2_width * map2_height) / 2},
+    {SPRITE_IMAGE_ADDRESS, all_sprites_data, (all_sprites_width * all_sprites_height) / 4},
+    {SCREEN_BLOCK_ADDRESS(FEED_SCREEN_BLOCK), feed_maps[0], (map_width * map_height) / 2},
+    {SCREEN_BLOCK_ADDRESS(FEED_SCREEN_BLOCK + 1), feed_maps[1], (map_width * map_height) / 2},
+    {SCREEN_BLOCK_ADDRESS(FEED_SCREEN_BLOCK + 2), feed_maps[2], (map_width * map_height) / 2},
+    {SCREEN_BLOCK_ADDRESS(FEED_SCREEN_BLOCK + 3), feed_maps[3], (map_width * map_height) / 2},
+    {CHAR_BLOCK_ADDRESS(0) + NOISE_FIRST_TILE * 64, noise_tiles, NOISE_TILES * 16},
+    {SCREEN_BLOCK_ADDRESS(NOISE_SCREEN_BLOCK), noise_map, (32 * 32) / 2},
+};
 
-    /* set the new x coordinate */
-    sprite->attribute1 |= (x & 0x1ff);
-}
+#define NUM_ASSETS(list) (sizeof(list) / sizeof(list[0]))
 
-/* ALL SPRITES */
+/* a part of the game with its own assets, and functions called when it
+ * starts, each frame while it runs, and when it ends */
+struct Scene
+{
+    const struct Asset *assets;
+    int num_assets;
+    void (*enter)();
+    void (*update)();
+    void (*exit)();
+};
 
-/* move a sprite in a direction */
-void sprite_move(struct Sprite *sprite, int dx, int dy)
+enum SceneId
 {
-    /* get the current y coordinate */
-    int y = sprite->attribute0 & 0xff;
+    SCENE_TITLE,
+    SCENE_NIGHT_INTRO,
+    SCENE_GAMEPLAY,
+    SCENE_JUMPSCARE,
+    SCENE_SCREAM,
+    SCENE_GAME_OVER,
+    SCENE_NONE
+};
 
-    /* get the current x coordinate */
-    int x = sprite->attribute1 & 0x1ff;
+/* the table of scenes comes after their functions */
+extern const struct Scene scenes[];
 
-    /* move to the new location */
-    sprite_position(sprite, x + dx, y + dy);
-}
+/* the scene running, the one to switch to and the fade between them */
+int scene_current = SCENE_NONE;
+int scene_next = SCENE_NONE;
+int scene_fade_frames = 0;
 
-/* ALL SPRITES */
+/* how many frames the current scene has been running */
+int scene_frames = 0;
 
-/* change the vertical flip flag */
-void sprite_set_vertical_flip(struct Sprite *sprite, int vertical_flip)
+/* no more than this much gets copied in each vblank, in 32 bit words */
+#define STREAM_WORDS_PER_FRAME 1024
+
+/* the assets being copied in and how far along */
+const struct Asset *stream_assets = 0;
+int stream_count = 0;
+int stream_index = 0;
+int stream_offset = 0;
+
+/* what is loaded where in video memory, so shared assets are not copied twice */
+#define MAX_RESIDENT 16
+struct Asset vram_resident[MAX_RESIDENT];
+int num_resident = 0;
+
+/* returns whether an asset is already in video memory */
+int asset_resident(const struct Asset *asset)
 {
-    if (vertical_flip)
+    for (int i = 0; i < num_resident; i++)
     {
-        /* set the bit */
-        sprite->attribute1 |= 0x2000;
+        if (vram_resident[i].dest == asset->dest && vram_resident[i].source == asset->source &&
+            vram_resident[i].words >= asset->words)
+        {
+            return 1;
+        }
     }
-    else
+    return 0;
+}
+
+/* forget anything which overlaps a range of video memory which is being written */
+void asset_invalidate(unsigned int dest, int words)
+{
+    unsigned int end = dest + words * 4;
+    for (int i = 0; i < num_resident; i++)
     {
-        /* clear the bit */
-        sprite->attribute1 &= 0xdfff;
+        unsigned int other_end = vram_resident[i].dest + vram_resident[i].words * 4;
+        if (vram_resident[i].dest < end && dest < other_end)
+        {
+            vram_resident[i--] = vram_resident[--num_resident];
+        }
     }
 }
 
-/* ALL SPRITES */
-
-/* change the vertical flip flag */
-void sprite_set_horizontal_flip(struct Sprite *sprite, int horizontal_flip)
+/* remember that an asset has been loaded */
+void asset_mark_resident(const struct Asset *asset)
 {
-    if (horizontal_flip)
+    asset_invalidate(asset->dest, asset->words);
+    if (num_resident < MAX_RESIDENT)
     {
-        /* set the bit */
-        sprite->attribute1 |= 0x1000;
+        vram_resident[num_resident++] = *asset;
     }
-    else
+}
+
+/* start copying in a scene's assets, a little each vblank */
+void scene_preload(int id)
+{
+    /* keep going if these are already on the way */
+    if (stream_assets == scenes[id].assets && stream_index < stream_count)
     {
-        /* clear the bit */
-        sprite->attribute1 &= 0xefff;
+        return;
     }
+
+    stream_assets = scenes[id].assets;
+    stream_count = scenes[id].num_assets;
+    stream_index = 0;
+    stream_offset = 0;
 }
 
-/* ALL SPRITES */
+/* returns whether everything being copied in has arrived */
+int scene_loaded()
+{
+    return stream_index >= stream_count;
+}
 
-/* change the tile offset of a sprite */
-void sprite_set_offset(struct Sprite *sprite, int offset)
+/* queue up this frame's share of the copying */
+void scene_stream()
 {
-    /* clear the old offset */
-    sprite->attribute2 &= 0xfc00;
+    int budget = STREAM_WORDS_PER_FRAME;
 
-    /* apply the new one */
-    sprite->attribute2 |= (offset & 0x03ff);
-}
+    while (budget > 0 && stream_index < stream_count)
+    {
+        const struct Asset *asset = &stream_assets[stream_index];
 
-/* ALL SPRITES */
+        /* skip it if it is already there */
+        if (stream_offset == 0 && asset_resident(asset))
+        {
+            stream_index++;
+            continue;
+        }
+        if (stream_offset == 0)
+        {
+            asset_invalidate(asset->dest, asset->words);
+        }
 
-/* setup the sprite image and palette */
-void setup_sprite_image()
-{
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short *)sprite_palette, (unsigned short *)all_sprites_palette, PALETTE_SIZE);
+        int words = asset->words - stream_offset;
+        if (words > budget)
+        {
+            words = budget;
+        }
+        if (!vblank_queue_push((volatile void *)(asset->dest + stream_offset * 4),
+                               (const unsigned int *)asset->source + stream_offset, words))
+        {
+            /* the queue is full, try again next frame */
+            return;
+        }
+        budget -= words;
+        stream_offset += words;
 
-    /* load the image into sprite image memory */
-    memcpy16_dma((unsigned short *)sprite_image_memory, (unsigned short *)all_sprites_data, (all_sprites_width * all_sprites_height) / 2);
+        if (stream_offset >= asset->words)
+        {
+            asset_mark_resident(asset);
+            stream_index++;
+            stream_offset = 0;
+        }
+    }
 }
 
-/* AFTON SPRITE */
+/* switch to another scene once its assets are in, fading through black over
+ * some frames, or cutting straight to it if frames is 0 */
+void scene_switch(int id, int frames)
+{
+    scene_next = id;
+    scene_fade_frames = frames;
+    scene_preload(id);
 
-/* a struct for afton's logic and behavior */
-struct Afton
+    if (frames)
+    {
+        palette_fade_to(0, frames);
+    }
+}
+
+/* load a scene's assets straight away and start it, for the first scene */
+void scene_start(int id)
 {
-    /* the actual sprite attribute info */
-    struct Sprite *sprite;
+    for (int i = 0; i < scenes[id].num_assets; i++)
+    {
+        const struct Asset *asset = &scenes[id].assets[i];
+        unsigned short enabled = critical_begin();
+        *dma3_source = (unsigned int)asset->source;
+        *dma3_destination = asset->dest;
+        *dma3_control = asset->words | DMA_32 | DMA_ENABLE;
+        critical_end(enabled);
+        asset_mark_resident(asset);
+    }
 
-    /* the x and y postion in pixels */
-    int x, y;
+    scene_current = id;
+    scene_frames = 0;
+    scenes[id].enter();
+}
 
-    /* afton's y velocity in 1/256 pixels/second */
-    int yvel;
+/* run the scene manager for one frame */
+void scene_run()
+{
+    scene_stream();
 
-    /* afton's y acceleration in 1/256 pixels/second^2 */
-    int gravity;
+    /* change scenes once the fade is done and the next one's assets are in */
+    if (scene_next != SCENE_NONE && !palette_fading() && scene_loaded())
+    {
+        scenes[scene_current].exit();
+        scene_current = scene_next;
+        scene_next = SCENE_NONE;
+        scene_frames = 0;
+        scenes[scene_current].enter();
 
-    /* which frame of the animation he is on */
-    int frame;
+        if (scene_fade_frames)
+        {
+            palette_fade_in(scene_fade_frames);
+        }
+    }
 
-    /* the number of frames to wait before flipping */
-    int animation_delay;
+    /* the scene fills in the per line tables as it updates */
+    scanline_begin();
+    scenes[scene_current].update();
+    scanline_end();
+    scene_frames++;
+}
 
-    /* the animation counter counts how many frames until we flip */
-    int counter;
+/* point a tile layer's control register at another screen block */
+void bg_set_screen_block(volatile unsigned short *control, int block)
+{
+    *control = (*control & ~(31 << 8)) | (block << 8);
+}
 
-    /* whether afton is moving right now or not */
-    int move;
+/* the same, but at the vblank which starts the scanline tables being built,
+ * so the new map shows with the scroll worked out for it */
+void bg_queue_screen_block(volatile unsigned short *control, int block)
+{
+    scanline_write(control, 31 << 8, block << 8);
+}
 
-    /* the number of pixels away from the edge of the screen afton stays */
-    int border;
+/* the player, the guest, the camera and the night */
+struct Afton afton;
+struct Guest guest;
+struct Camera camera;
+struct Night night;
 
-    /* if afton is currently falling */
-    int falling;
-};
+/* the program running the guest, and what it bumps into */
+struct AiActor guest_actor;
+struct Collider *guest_collider;
 
-/* AFTON SPRITE */
+/* TITLE SCENE */
 
-int afton_right(struct Afton *afton)
+void title_enter()
 {
-    /* face right */
-    sprite_set_horizontal_flip(afton->sprite, 0);
-    afton->move = 1;
+    *display_control = MODE0 | BG0_ENABLE | BG2_ENABLE | SPRITE_MAP_1D;
+    bg_set_screen_block(bg0_control, TITLE_SCREEN_BLOCK);
+    parallax_disable();
+    lighting_disable();
+}
 
-    /* if we are at the right end, just scroll the screen */
-    if (afton->x > (SCREEN_WIDTH - 16 - afton->border))
+void title_update()
+{
+    /* blink the prompt */
+    if (scene_frames & 32)
     {
-        return 1;
+        set_text("PRESS START", 17, 9);
     }
     else
     {
-        /* else move right */
-        afton->x++;
-        return 0;
+        text_clear(17, 9, 11);
     }
-}
 
-/* AFTON SPRITE */
+    if (scene_next == SCENE_NONE && button_hit(BUTTON_START))
+    {
+        /* holding L records the game, holding R plays back the last recording */
+        if (button_pressed(BUTTON_L))
+        {
+            record_start();
+        }
+        else if (button_pressed(BUTTON_R))
+        {
+            replay_start();
+        }
+        scene_switch(SCENE_NIGHT_INTRO, 30);
+    }
+}
 
-/* stop afton from walking left/right */
-void afton_stop(struct Afton *afton)
+void title_exit()
 {
-    afton->move = 0;
-    afton->frame = 0;
-    afton->counter = 7;
-    sprite_set_offset(afton->sprite, afton->frame);
+    text_clear(17, 9, 11);
 }
 
-/* AFTON SPRITE */
+/* NIGHT INTRO SCENE */
 
-/* start afton jumping, unless already fgalling */
-void afton_jump(struct Afton *afton)
+/* how many cells the intro text covers */
+int intro_cells_time = 0;
+int intro_cells_night = 0;
+
+void night_intro_enter()
 {
-    if (!afton->falling)
+    /* a new game starts here */
+    sprite_clear();
+    afton_init(&afton);
+    guest_init(&guest, 456, 113, 32);
+    night_init(&night);
+
+    /* only the text layer shows */
+    *display_control = MODE0 | BG2_ENABLE | SPRITE_MAP_1D;
+    intro_cells_time = vwf_draw("12:00 AM", 8, 12);
+    intro_cells_night = vwf_draw("1st Night", 10, 12);
+
+    /* the level is copied in while this shows */
+    scene_preload(SCENE_GAMEPLAY);
+}
+
+void night_intro_update()
+{
+    if (scene_next == SCENE_NONE && scene_frames >= 120)
     {
-        afton->yvel = -500;
-        afton->falling = 1;
+        scene_switch(SCENE_GAMEPLAY, 30);
     }
 }
 
-/* GENERAL USE */
+void night_intro_exit()
+{
+    text_clear(8, 12, intro_cells_time);
+    text_clear(10, 12, intro_cells_night);
+}
 
-/* finds which tile a screen coordinate maps to, taking scroll into acco  unt */
-unsigned short tile_lookup(int x, int y, int xscroll, int yscroll,
-                           const unsigned short *tilemap, int tilemap_w, int tilemap_h)
+/* GAMEPLAY SCENE */
+
+/* how many frames a jump press is kept for when afton is in the air */
+#define JUMP_BUFFER_FRAMES 4
+
+/* the camera monitor, which feed it shows, how many frames of static are
+ * left, and how many cells the feed's name covers */
+struct Monitor
 {
+    int open;
+    int feed;
+    int static_frames;
+    int label_cells;
+};
 
-    /* adjust for the scroll */
-    x += xscroll;
-    y += yscroll;
+struct Monitor monitor;
 
-    /* convert from screen coordinates to tile coordinates */
-    x >>= 3;
-    y >>= 3;
+/* change to a feed, which shows from the next frame drawn */
+void monitor_show(int feed)
+{
+    text_clear(1, 1, monitor.label_cells);
+    monitor.feed = feed;
+    bg_queue_screen_block(bg0_control, FEED_SCREEN_BLOCK + feed);
+    monitor.label_cells = vwf_draw(camera_feeds[feed].name, 1, 1);
+    monitor.static_frames = FEED_STATIC_FRAMES;
+}
 
-    /* account for wraparound */
-    while (x >= tilemap_w)
+/* bring the monitor up, only the back layer shows, with static over it
+ * in place of the flashlight */
+void monitor_open()
+{
+    monitor.open = 1;
+    lighting_disable();
+    glitch_begin();
+    sprite_set_mosaic(guest.sprite, 1);
+    sprite_set_priority(guest.sprite, 2);
+    monitor_show(monitor.feed);
+}
+
+/* put the monitor down and go back to the room afton is in */
+void monitor_close()
+{
+    monitor.open = 0;
+    text_clear(1, 1, monitor.label_cells);
+    monitor.label_cells = 0;
+    glitch_end();
+    sprite_set_mosaic(guest.sprite, 0);
+    sprite_set_priority(guest.sprite, 0);
+    bg_queue_screen_block(bg0_control, LEVEL_SCREEN_BLOCK);
+    lighting_init();
+}
+
+/* the arrow keys change feeds, and the guest shows if it is in view of the
+ * camera, this goes after the camera has placed the sprites */
+void monitor_update()
+{
+    if (button_hit(BUTTON_RIGHT))
+    {
+        monitor_show((monitor.feed + 1) % NUM_FEEDS);
+    }
+    else if (button_hit(BUTTON_LEFT))
     {
-        x -= tilemap_w;
+        monitor_show((monitor.feed + NUM_FEEDS - 1) % NUM_FEEDS);
     }
-    while (y >= tilemap_h)
+
+    int x = guest.x - feed_column(monitor.feed) * 8;
+    int seen = x > -FRAME_WIDTH && x < SCREEN_WIDTH;
+    sprite_set_hidden(afton.sprite, 1);
+    sprite_set_hidden(guest.sprite, !seen);
+    if (seen)
     {
-        y -= tilemap_h;
+        sprite_position(guest.sprite, x, guest.y);
     }
-    while (x < 0)
+}
+
+/* fill in the monitor's static, which is heavy for a few frames after
+ * changing, this goes after the scroll tables are built */
+void monitor_build()
+{
+    int level = FEED_STATIC_LEVEL;
+    if (monitor.static_frames > 0)
     {
-        x += tilemap_w;
+        level += (monitor.static_frames-- * (GLITCH_MAX - FEED_STATIC_LEVEL)) / FEED_STATIC_FRAMES;
     }
-    while (y < 0)
+    glitch_build(level);
+}
+
+/* the guest notices afton walking into it */
+void guest_touched(struct Collider *self, struct Collider *other)
+{
+    if (other->kind == COLLIDER_PLAYER)
     {
-        y += tilemap_h;
+        ((struct Guest *)self->data)->touching = 1;
     }
+}
 
-    /* the larger screen maps (bigger than 32x32) are made of multiple stitched
-       together - the offset is used for finding which screen block we are in
-       for these cases */
-    int offset = 0;
+void gameplay_enter()
+{
+    *display_control = MODE0 | BG0_ENABLE | BG1_ENABLE | BG2_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;
+    bg_set_screen_block(bg0_control, LEVEL_SCREEN_BLOCK);
+
+    /* scroll the tile layers per line for parallax */
+    parallax_init();
+
+    /* darken everything outside of afton's flashlight */
+    lighting_init();
+
+    /* start the level from the beginning */
+    camera_reset(&camera, 0, 0);
+    afton.x = 16;
+    guest.x = 456;
+    guest.ani = 0;
+    ai_scheduler_clear();
+    ai_start(&guest_actor, guest_ai, &guest);
+    ai_scheduler_add(&guest_actor);
+    collision_clear();
+    collider_add(&afton.x, &afton.y, afton.sprite, COLLIDER_PLAYER, 0, &afton);
+    guest_collider = collider_add(&guest.x, &guest.y, guest.sprite, COLLIDER_GUEST, guest_touched, &guest);
+    camera_clear();
+    camera_add(&afton.x, &afton.y, afton.sprite, 0);
+    camera_add(&guest.x, &guest.y, guest.sprite, &guest.cull);
+    camera_project(&camera);
+
+    /* the lights start where the image has them */
+    tile_animation_reset();
+
+    /* the monitor starts down, on the first camera */
+    monitor.open = 0;
+    monitor.feed = 0;
+    monitor.label_cells = 0;
+}
 
-    /* if the width is 64, add 0x400 offset to get to tile maps on right   */
-    if (tilemap_w == 64 && x >= 32)
+void gameplay_update()
+{
+    /* update sprites */
+    afton_update(&afton);
+
+    /* the guest only moves while it is on the screen, and does nothing at
+     * all while it is far away - the camera worked out which last frame */
+    guest_collider->enabled = guest.cull != CULL_ASLEEP;
+    if (guest.cull == CULL_VISIBLE)
     {
-        x -= 32;
-        offset += 0x400;
+        guest_update(&guest);
     }
 
-    /* if height is 64 and were down there */
-    if (tilemap_h == 64 && y >= 32)
-    {
-        y -= 32;
+    /* find out who is touching who, then the guest's program decides when it turns */
+    guest.touching = 0;
+    collision_update();
+    ai_scheduler_run(&afton, &night);
 
-        /* if width is also 64 add 0x800, else just 0x400 */
-        if (tilemap_w == 64)
+    /* select brings the monitor up or puts it down */
+    if (button_hit(BUTTON_SELECT))
+    {
+        if (monitor.open)
         {
-            offset += 0x800;
+            monitor_close();
         }
         else
         {
-            offset += 0x400;
+            monitor_open();
         }
-    }
 
-    /* find the index in this tile map */
-    int index = y * 32 + x;
+        /* the registers given per line have changed, so start this frame's tables again */
+        scanline_begin();
+    }
 
-    /* return the tile */
-    return tilemap[index + offset];
-}
+    /* now the arrow keys move afton, unless they are changing feeds */
+    if (monitor.open)
+    {
+        afton_stop(&afton);
+    }
+    else if (button_pressed(BUTTON_RIGHT))
+    {
+        afton_right(&afton);
+    }
+    else if (button_pressed(BUTTON_LEFT))
+    {
+        afton_left(&afton);
+    }
+    else
+    {
+        afton_stop(&afton);
+    }
 
-/* AFTON SPRITE */
+    /* check for jumping, a press just before landing still counts */
+    if (!monitor.open && button_buffered(BUTTON_A, JUMP_BUFFER_FRAMES) && !afton.falling)
+    {
+        afton_jump(&afton);
+        button_consume(BUTTON_A);
+    }
 
-/* update afton */
-void afton_update(struct Afton *afton, int xscroll)
-{
-    /* update y position and speed if falling */
-    if (afton->falling)
+    /* start pauses the game with the system asleep until it is pressed again */
+    if (button_hit(BUTTON_START))
     {
-        afton->y += (afton->yvel >> 8);
-        afton->yvel += afton->gravity;
+        input_sleep(BUTTON_START);
     }
 
-    /* check which tile afton's feet are over */
-    unsigned short tile = tile_lookup(afton->x + 8, afton->y + 32, xscroll, 0, map2,
-                                      map2_width, map2_height);
+    /* run the night's timers and draw the clock and power meter */
+    timer_wheel_step(&game_timers);
+    night_draw(&night);
 
-    /* if it's block tile
-     * these numbers refer to the tile indices of the blocks afton can walk on */
-    if ((tile == 1) || (tile == 12))
-    {
-        /* stop the fall! */
-        afton->falling = 0;
-        afton->yvel = 0;
+    /* the lights on the wall change, here and on the camera feeds */
+    tile_animation_update();
 
-        /* make him line up with the top of a block works by clearing out the lower bits to 0 */
-        afton->y &= ~0x3;
+    /* follow afton, and put everything where it is on the screen */
+    camera_update(&camera, afton.x + 8, afton.y + 16, afton.sprite->attribute1 & 0x1000);
+    camera_project(&camera);
 
-        /* move him down one because there is a one pixel gap in the image */
-        afton->y++;
+    /* build the scroll and light tables, the vblank handler starts them
+     * streaming - the feeds are not scrolled and have no flashlight */
+    if (monitor.open)
+    {
+        monitor_update();
+        parallax_build(0, 0, 0);
+        monitor_build();
     }
     else
     {
-        /* he is falling now */
-        afton->falling = 1;
+        parallax_build(camera.scroll_x, 0, 0);
+        lighting_build(afton.x + 8, afton.y + 10, camera.scroll_x, camera.scroll_y,
+                       afton.sprite->attribute1 & 0x1000);
     }
 
-    /* update animation if moving */
-    if (afton->move)
+    /* the guest has turned */
+    if (guest.ani && scene_next == SCENE_NONE)
     {
-        afton->counter++;
-        if (afton->counter >= afton->animation_delay)
-        {
-            afton->frame = next_frame(afton->frame, 16);
-            if (afton->frame > 16)
-            {
-                afton->frame = 0;
-            }
-            sprite_set_offset(afton->sprite, afton->frame);
-            afton->counter = 0;
-        }
+        scene_switch(SCENE_JUMPSCARE, 0);
     }
-
-    /* set on screen position */
-    sprite_position(afton->sprite, afton->x, afton->y);
 }
 
-/* a struct for a guest's logic and behavior */
-struct Guest
+void gameplay_exit()
 {
-    /* the actual sprite attribute info */
-    struct Sprite *sprite;
+    if (monitor.open)
+    {
+        monitor_close();
+    }
+    tile_animation_stop();
+}
 
-    /* the x and y postion in pixels */
-    int x, y;
+/* JUMPSCARE SCENE */
 
-    /* guest's y velocity in 1/256 pixels/second */
-    int yvel;
+/* how many cells the guest's line covers */
+int jumpscare_cells = 0;
 
-    /* guest's y acceleration in 1/256 pixels/second^2 */
-    int gravity;
+/* the guest turning around */
+struct Animation guest_animation;
+struct Script jumpscare_script_state;
 
-    /* which frame of the animation he is on */
-    int frame;
+/* the matrix the guest grows with, and how big it is in 1/256 */
+#define JUMPSCARE_MAX_ZOOM 512
+int jumpscare_matrix = -1;
+int jumpscare_zoom = 256;
 
-    /* the number of frames to wait before flipping */
-    int animation_delay;
+/* the guest turns, speaks up, and the lights flicker as the room fades out */
+int jumpscare_script(struct Script *script)
+{
+    SCRIPT_BEGIN(script);
 
-    /* the animation counter counts how many frames until we flip */
-    int counter;
+    animation_start(&guest_animation, guest.sprite, next_frame(guest.frame, 16), 16, 1, 8);
+    SCRIPT_WAIT_ANIMATION(script, &guest_animation);
+    guest.frame = guest_animation.frame;
 
-    /* whether guest is an animatronic */
-    int ani;
+    /* the guest looms up as the room fades, drawn into twice its area and
+     * moved up and left by half its size to keep it in the same place */
+    jumpscare_zoom = 256;
+    jumpscare_matrix = affine_acquire(0, jumpscare_zoom);
+    if (jumpscare_matrix >= 0)
+    {
+        sprite_set_affine(guest.sprite, jumpscare_matrix, 1);
+        sprite_move(guest.sprite, -FRAME_WIDTH / 2, -FRAME_HEIGHT / 2);
+    }
 
-    /* the number of pixels away from the edge of the screen guest stays */
-    int border;
+    jumpscare_cells = vwf_draw("It's me.", 9, 12);
+    palette_flicker(24);
+    palette_fade_to(0, 32);
+    SCRIPT_WAIT_FADE(script);
 
-    /* if guest is currently falling */
-    int falling;
-};
+    guest.frame = next_frame(guest.frame, 16);
+    sprite_set_offset(guest.sprite, guest.frame);
 
-/* initialize afton */
-void afton_init(struct Afton *afton)
+    if (guest.frame < 150)
+    {
+        /* fade the room back in for the next go */
+        scene_switch(SCENE_GAMEPLAY, 32);
+    }
+    else
+    {
+        /* the last one plays the video, cutting in quickly from black */
+        scene_switch(SCENE_SCREAM, 4);
+    }
+
+    SCRIPT_END(script);
+}
+
+void jumpscare_enter()
 {
-    afton->x = 16;
-    afton->y = 113;
-    afton->yvel = 0;
-    afton->gravity = 50;
-    afton->border = 40;
-    afton->frame = 0;
-    afton->move = 0;
-    afton->counter = 0;
-    afton->falling = 0;
-    afton->animation_delay = 8;
-    afton->sprite = sprite_init(afton->x, afton->y, SIZE_16_32, 0, 0, afton->frame, 0);
+    jumpscare_cells = 0;
+    script_start(&jumpscare_script_state);
 }
 
-/* initialize guest */
-void guest_init(struct Guest *guest, int x, int y, int f)
+void jumpscare_update()
 {
-    guest->x = x;
-    guest->y = y;
-    guest->yvel = 0;
-    guest->gravity = 50;
-    guest->border = 40;
-    guest->frame = f;
-    guest->ani = 0;
-    guest->counter = 0;
-    guest->falling = 0;
-    guest->animation_delay = 8;
-    guest->sprite = sprite_init(guest->x, guest->y, SIZE_16_32, 0, 0, guest->frame, 0);
+    /* the room wobbles as the guest turns */
+    parallax_build(camera.scroll_x, 4, scene_frames * 8);
+    lighting_build(afton.x + 8, afton.y + 10, camera.scroll_x, camera.scroll_y,
+                   afton.sprite->attribute1 & 0x1000);
+
+    animation_update(&guest_animation);
+    script_run(&jumpscare_script_state, jumpscare_script);
+
+    if (jumpscare_matrix >= 0 && jumpscare_zoom < JUMPSCARE_MAX_ZOOM)
+    {
+        jumpscare_zoom += 8;
+        jumpscare_matrix = affine_update(jumpscare_matrix, 0, jumpscare_zoom);
+        sprite_set_affine(guest.sprite, jumpscare_matrix, 1);
+    }
 }
 
-/* update guest */
-void guest_update(struct Guest *guest, int *xscroll, struct Afton *afton)
+void jumpscare_exit()
 {
-    /* check which tile guest's feet are over */
-    unsigned short tile = tile_lookup(guest->x + 8, guest->y + 32, *xscroll, 0, map2,
-                                      map2_width, map2_height);
+    text_clear(9, 12, jumpscare_cells);
 
-    /* if it's block tile
-     * these numbers refer to the tile indices of the blocks guest can walk on */
-    if ((tile == 1) || (tile == 12))
+    /* back to a normal sprite for the next go */
+    if (jumpscare_matrix >= 0)
     {
-        /* stop the fall! */
-        guest->falling = 0;
-        guest->yvel = 0;
+        affine_release(jumpscare_matrix);
+        jumpscare_matrix = -1;
+        sprite_set_affine(guest.sprite, -1, 0);
+        sprite_move(guest.sprite, FRAME_WIDTH / 2, FRAME_HEIGHT / 2);
+    }
+}
 
-        /* make him line up with the top of a block works by clearing out the lower bits to 0 */
-        guest->y &= ~0x3;
+/* SCREAM SCENE */
 
-        /* move him down one because there is a one pixel gap in the image */
-        guest->y++;
+/* the video fills both bitmap pages, which cover the tiles, maps and sprite
+ * images, so those are copied back in for the game over and the palette and
+ * text layer are put back when it ends */
+struct VideoPlayer video_player;
+unsigned short video_saved_palette[PALETTE_SIZE];
+
+void scream_enter()
+{
+    sprite_clear();
+    parallax_disable();
+    lighting_disable();
+
+    /* write out the text layer's last changes before the pages go over it */
+    text_update();
+
+    /* layer 2 shows the page at its normal size in mode 4 */
+    affine_bg_set(2, 0, 256, 0, 0, 0, 0);
+
+    for (int i = 0; i < PALETTE_SIZE; i++)
+    {
+        video_saved_palette[i] = palette_source[i];
+        palette_source[i] = scream_video.palette[i];
     }
-    else
+    palette_dirty = 1;
+
+    asset_invalidate(VIDEO_PAGE_ADDRESS(0),
+                     (VIDEO_PAGE_ADDRESS(1) - VIDEO_PAGE_ADDRESS(0)) / 4 + VIDEO_PAGE_WORDS);
+    video_start(&video_player, &scream_video);
+}
+
+void scream_update()
+{
+    if (!video_update(&video_player) && scene_next == SCENE_NONE)
     {
-        /* he is falling now */
-        guest->falling = 1;
+        /* keep the screen blank while the level is copied back over the pages */
+        *display_control |= FORCED_BLANK;
+        palette_tint(0, 32);
+        scene_switch(SCENE_GAME_OVER, 0);
     }
+}
 
-    if (afton->x + 8 >= guest->x)
+void scream_exit()
+{
+    for (int i = 0; i < PALETTE_SIZE; i++)
     {
-        guest->ani = 1;
+        palette_source[i] = video_saved_palette[i];
     }
+    palette_dirty = 1;
 
-    /* set on screen position */
-    sprite_position(guest->sprite, guest->x, guest->y);
+    /* the font and the text map were under the pages as well */
+    text_init();
+    vwf_init();
 }
 
-/* AFTON SPRITE */
+/* GAME OVER SCENE */
+
+/* the floor is an affine copy of the level's back layer in a spare screen block */
+#define FLOOR_SCREEN_BLOCK 20
+unsigned short floor_map[(map_width * map_height) / 2] EWRAM_BSS;
+
+/* the eye looking over the floor, and the text layer's settings to put back */
+struct Mode7 floor_view;
+unsigned short game_over_text_control;
+
+struct Script game_over_script_state;
 
-/* move afton left or right returns if it is at edge of the screen */
-int afton_left(struct Afton *afton)
+/* the room fades back in, then away to white */
+int game_over_script(struct Script *script)
 {
-    /* face left */
-    sprite_set_horizontal_flip(afton->sprite, 1);
-    afton->move = 1;
+    SCRIPT_BEGIN(script);
+
+    palette_fade_in(32);
+    SCRIPT_WAIT_FRAME(script, 40);
 
-    /* if we are at the left end, just scroll the screen */
-    if (afton->x < afton->border)
+    palette_fade_to(0x7fff, 60);
+    SCRIPT_WAIT_FADE(script);
+
+    SCRIPT_END(script);
+}
+
+void game_over_enter()
+{
+    record_stop();
+
+    sprite_clear();
+    camera_reset(&camera, 0, 0);
+    parallax_disable();
+    lighting_disable();
+
+    /* the room's floor turns slowly in perspective below the back wall, on
+     * layer 2 which is affine in mode 1, so the text layer is put aside */
+    game_over_text_control = *bg2_control;
+    affine_map_from_tiles(floor_map, map, map_width * map_height);
+    vblank_queue_push((volatile void *)SCREEN_BLOCK_ADDRESS(FLOOR_SCREEN_BLOCK), floor_map,
+                      (map_width * map_height) / 4);
+    affine_bg_init(2, 1, 0, FLOOR_SCREEN_BLOCK, AFFINE_SIZE_32, 0);
+    floor_view.x = map_width * 4;
+    floor_view.y = map_height * 4;
+    floor_view.height = 24;
+    floor_view.angle = 0;
+    floor_view.horizon = 96;
+    mode7_begin(2);
+    *display_control = MODE1 | BG0_ENABLE | BG2_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;
+
+    /* the animatronics are all waiting in the room, standing on the floor */
+    struct Sprite *crew = sprite_alloc(animatronic_crew.count);
+    if (crew)
     {
-        return 1;
+        metasprite_draw(&animatronic_crew, crew, SCREEN_WIDTH / 2, 145, 0, 0);
     }
-    else
+
+    script_start(&game_over_script_state);
+}
+
+void game_over_update()
+{
+    if ((scene_frames & 3) == 0)
     {
-        /* else move left */
-        afton->x--;
-        return 0;
+        floor_view.angle++;
     }
+    mode7_build(2, &floor_view);
+
+    script_run(&game_over_script_state, game_over_script);
+}
+
+void game_over_exit()
+{
+    mode7_end(2);
+    *bg2_control = game_over_text_control;
 }
 
+/* every scene, in the same order as SceneId */
+const struct Scene scenes[] = {
+    {title_assets, NUM_ASSETS(title_assets), title_enter, title_update, title_exit},
+    {0, 0, night_intro_enter, night_intro_update, night_intro_exit},
+    {gameplay_assets, NUM_ASSETS(gameplay_assets), gameplay_enter, gameplay_update, gameplay_exit},
+    {0, 0, jumpscare_enter, jumpscare_update, jumpscare_exit},
+    {0, 0, scream_enter, scream_update, scream_exit},
+    {gameplay_assets, NUM_ASSETS(gameplay_assets), game_over_enter, game_over_update, game_over_exit},
+};
+
 /* the main function */
 int main()
 {
-    /* we set the mode to mode 0 with bg0 on */
-    *display_control = MODE0 | BG0_ENABLE | BG1_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;
+    /* we set the mode to mode 0, the scenes turn on the layers they use */
+    *display_control = MODE0 | SPRITE_MAP_1D;
 
     /* setup the background 0 */
     setup_background();
@@ -1011,125 +5917,56 @@ int main()
     *display_interrupts |= 0x08;
     *interrupt_enable = 1;
 
+    /* keep the save type string in the rom */
+    __asm__ volatile("" : : "r"(save_type));
+
     /* clear the sound control initially */
     *sound_control = 0;
 
-    /* set the music to play on channel A */
-    play_sound(music, music_bytes, 44100, 'A');
+    /* set the music to play on channel A, it starts at the first vblank */
+    sound_play(music, music_bytes, 44100, 'A');
 
     /* setup the sprite image data */
     setup_sprite_image();
 
-    /* clear all the sprites on screen now */
-    sprite_clear();
-
-    /* create afton */
-    struct Afton afton;
-    afton_init(&afton);
-
-    /* create the guest */
-    struct Guest guest;
-    guest_init(&guest, 456, 113, 32);
-
-    /* set initial scroll to 0 */
-    int xscroll = 0;
-
-    /* loop forever */
-    while (1)
-    {
-        /* level repeat */
-        while (!guest.ani)
-        {
-
-            /* update sprites */
-            afton_update(&afton, xscroll);
+    /* set up the text layer for the clock and power */
+    text_init();
+    vwf_init();
 
-            guest_update(&guest, &xscroll, &afton);
+    /* keep a copy of the palettes for fades */
+    palette_init();
 
-            /* now the arrow keys move afton */
-            if (button_pressed(BUTTON_RIGHT))
-            {
-                if (afton_right(&afton))
-                {
-                    if (xscroll < 480)
-                    {
-                        xscroll++;
-                        guest.x--;
-                    }
-                }
-            }
-            else if (button_pressed(BUTTON_LEFT))
-            {
-                if (afton_left(&afton))
-                {
-                    if (xscroll > 0)
-                    {
-                        xscroll--;
-                        guest.x++;
-                    }
-                }
-            }
-            else
-            {
-                afton_stop(&afton);
-            }
-
-            /* check for jumping */
-            if (button_pressed(BUTTON_A))
-            {
-                afton_jump(&afton);
-            }
+    /* make the noise tiles for static, which needs the palette copy */
+    glitch_init();
 
-            /* wait for vblank before scrolling and moving sprites */
-            wait_vblank();
-            *bg0_x_scroll = xscroll;
-            *bg1_x_scroll = times_two(xscroll);
-            sprite_update_all();
+    /* start the cycle counter the AI is timed with */
+    ai_scheduler_init();
 
-            /* delay some */
-            delay(300);
-        }
-        guest.frame = next_frame(guest.frame, 16);
-        sprite_set_offset(guest.sprite, guest.frame);
+    /* mark which tiles block sight */
+    solid_map_init();
 
-        /* wait for vblank before scrolling and moving sprites */
-        wait_vblank();
-        *bg0_x_scroll = xscroll;
-        *bg1_x_scroll = times_two(xscroll);
-        sprite_update_all();
+    /* make the security cameras' maps, which go in with the level */
+    feed_init();
 
-        xscroll = 0;
+    /* clear all the sprites on screen now */
+    sprite_clear();
 
-        guest.frame = next_frame(guest.frame, 16);
-        sprite_set_offset(guest.sprite, guest.frame);
-        afton.x = 16;
-        guest.x = 456;
+    /* start at the title */
+    scene_start(SCENE_TITLE);
 
-        sprite_position(afton.sprite, afton.x, afton.y);
-        sprite_position(guest.sprite, guest.x, guest.y);
+    /* run the current scene one step each frame, the buttons are read once
+     * at the start so every part of the frame sees the same input */
+    while (1)
+    {
+        input_latch();
+        scene_run();
 
-        delay(100000);
+        /* move the palette effects along */
+        palette_update();
 
-        /* wait for vblank before scrolling and moving sprites */
-        wait_vblank();
-        *bg0_x_scroll = xscroll;
-        *bg1_x_scroll = times_two(xscroll);
+        /* wait for vblank before moving sprites and text */
+        wait_next_frame();
         sprite_update_all();
-
-        if (guest.frame < 150)
-        {
-            guest.ani = 0;
-        }
-        else
-        {
-            sprite_clear();
-            wait_vblank();
-            *bg0_x_scroll = xscroll;
-            *bg1_x_scroll = times_two(xscroll);
-            sprite_update_all();
-            while (1)
-            {
-            }
-        }
+        text_update();
     }
 }
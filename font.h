@@ -0,0 +1,125 @@
+/* font.h
+ * 8x8 font for ascii 32 to 127, one byte per row with the leftmost
+ * pixel in the top bit */
+
+#define font_first 32
+#define font_glyphs 96
+
+const unsigned char font [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00,
+    0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x28, 0x7c, 0x28, 0x7c, 0x28, 0x28, 0x00,
+    0x10, 0x3c, 0x50, 0x38, 0x14, 0x78, 0x10, 0x00,
+    0x60, 0x64, 0x08, 0x10, 0x20, 0x4c, 0x0c, 0x00,
+    0x30, 0x48, 0x50, 0x20, 0x54, 0x48, 0x34, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x10, 0x20, 0x20, 0x20, 0x10, 0x08, 0x00,
+    0x20, 0x10, 0x08, 0x08, 0x08, 0x10, 0x20, 0x00,
+    0x00, 0x10, 0x54, 0x38, 0x54, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00,
+    0x38, 0x44, 0x4c, 0x54, 0x64, 0x44, 0x38, 0x00,
+    0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,
+    0x38, 0x44, 0x04, 0x08, 0x10, 0x20, 0x7c, 0x00,
+    0x7c, 0x08, 0x10, 0x08, 0x04, 0x44, 0x38, 0x00,
+    0x08, 0x18, 0x28, 0x48, 0x7c, 0x08, 0x08, 0x00,
+    0x7c, 0x40, 0x78, 0x04, 0x04, 0x44, 0x38, 0x00,
+    0x18, 0x20, 0x40, 0x78, 0x44, 0x44, 0x38, 0x00,
+    0x7c, 0x04, 0x08, 0x10, 0x20, 0x20, 0x20, 0x00,
+    0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00,
+    0x38, 0x44, 0x44, 0x3c, 0x04, 0x08, 0x30, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10, 0x20,
+    0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,
+    0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0x00,
+    0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x00,
+    0x38, 0x44, 0x04, 0x08, 0x10, 0x00, 0x10, 0x00,
+    0x38, 0x44, 0x04, 0x34, 0x54, 0x54, 0x38, 0x00,
+    0x38, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x00,
+    0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00,
+    0x38, 0x44, 0x40, 0x40, 0x40, 0x44, 0x38, 0x00,
+    0x70, 0x48, 0x44, 0x44, 0x44, 0x48, 0x70, 0x00,
+    0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x00,
+    0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x00,
+    0x38, 0x44, 0x40, 0x5c, 0x44, 0x44, 0x3c, 0x00,
+    0x44, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x00,
+    0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,
+    0x1c, 0x08, 0x08, 0x08, 0x08, 0x48, 0x30, 0x00,
+    0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0x00,
+    0x44, 0x6c, 0x54, 0x54, 0x44, 0x44, 0x44, 0x00,
+    0x44, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x44, 0x00,
+    0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+    0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x00,
+    0x38, 0x44, 0x44, 0x44, 0x54, 0x48, 0x34, 0x00,
+    0x78, 0x44, 0x44, 0x78, 0x50, 0x48, 0x44, 0x00,
+    0x3c, 0x40, 0x40, 0x38, 0x04, 0x04, 0x78, 0x00,
+    0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00,
+    0x44, 0x44, 0x44, 0x54, 0x54, 0x54, 0x28, 0x00,
+    0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x00,
+    0x44, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00,
+    0x7c, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7c, 0x00,
+    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x00,
+    0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00,
+    0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00,
+    0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00,
+    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00,
+    0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x78, 0x00,
+    0x00, 0x00, 0x38, 0x40, 0x40, 0x44, 0x38, 0x00,
+    0x04, 0x04, 0x34, 0x4c, 0x44, 0x44, 0x3c, 0x00,
+    0x00, 0x00, 0x38, 0x44, 0x7c, 0x40, 0x38, 0x00,
+    0x18, 0x24, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x3c, 0x44, 0x44, 0x3c, 0x04, 0x38,
+    0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0x00,
+    0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,
+    0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x48, 0x30,
+    0x40, 0x40, 0x48, 0x50, 0x60, 0x50, 0x48, 0x00,
+    0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,
+    0x00, 0x00, 0x68, 0x54, 0x54, 0x44, 0x44, 0x00,
+    0x00, 0x00, 0x58, 0x64, 0x44, 0x44, 0x44, 0x00,
+    0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+    0x00, 0x00, 0x78, 0x44, 0x44, 0x78, 0x40, 0x40,
+    0x00, 0x00, 0x3c, 0x44, 0x44, 0x3c, 0x04, 0x04,
+    0x00, 0x00, 0x58, 0x64, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x00, 0x38, 0x40, 0x38, 0x04, 0x78, 0x00,
+    0x20, 0x20, 0x70, 0x20, 0x20, 0x24, 0x18, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x44, 0x4c, 0x34, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x54, 0x54, 0x28, 0x00,
+    0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x38,
+    0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00,
+    0x08, 0x10, 0x10, 0x20, 0x10, 0x10, 0x08, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
+    0x20, 0x10, 0x10, 0x08, 0x10, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0x54, 0x08, 0x00, 0x00, 0x00,
+    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00
+};
+
+/* for proportional text, the first column used by each glyph and how many
+ * pixels along the next glyph starts */
+const unsigned char font_lefts [] = {
+    0, 3, 2, 1, 1, 1, 1, 3, 2, 2, 1, 1, 2, 1, 3, 1,
+    1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 1, 1
+};
+
+const unsigned char font_widths [] = {
+    3, 2, 4, 6, 6, 6, 6, 2, 4, 4, 6, 6, 3, 6, 2, 6,
+    6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 2, 3, 5, 6, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 4, 6, 6,
+    3, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 5, 4, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 2, 4, 6, 6
+};
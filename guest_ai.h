@@ -0,0 +1,12 @@
+/* guest_ai.h
+ * AI bytecode made by tools/aiasm.py from guest.ai, do not edit */
+
+#define guest_ai_size 47
+
+const unsigned char guest_ai [] = {
+    0x03, 0x03, 0x00, 0x00, 0x08, 0x00, 0x08, 0x0e, 0x00, 0x03, 0x27, 0x00,
+    0x08, 0x00, 0x04, 0x08, 0x01, 0x00, 0x05, 0x01, 0x10, 0x00, 0x0b, 0x00,
+    0x01, 0x23, 0x00, 0x08, 0x00, 0x09, 0x0e, 0x00, 0x03, 0x27, 0x00, 0x01,
+    0x0a, 0x04, 0x00, 0x03, 0x02, 0x01, 0x00, 0x09, 0x03, 0x02, 0x00,
+};
+
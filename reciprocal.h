@@ -0,0 +1,29 @@
+/* reciprocal.h
+ * 1/n in 16.16 fixed point for n up to the height of the screen, so
+ * per line perspective needs a multiply instead of a divide, entry 0 is 0 */
+
+#define reciprocal_lut_size 161
+
+const unsigned int reciprocal_lut [] = {
+    0, 65536, 32768, 21845, 16384, 13107, 10922, 9362,
+    8192, 7281, 6553, 5957, 5461, 5041, 4681, 4369,
+    4096, 3855, 3640, 3449, 3276, 3120, 2978, 2849,
+    2730, 2621, 2520, 2427, 2340, 2259, 2184, 2114,
+    2048, 1985, 1927, 1872, 1820, 1771, 1724, 1680,
+    1638, 1598, 1560, 1524, 1489, 1456, 1424, 1394,
+    1365, 1337, 1310, 1285, 1260, 1236, 1213, 1191,
+    1170, 1149, 1129, 1110, 1092, 1074, 1057, 1040,
+    1024, 1008, 992, 978, 963, 949, 936, 923,
+    910, 897, 885, 873, 862, 851, 840, 829,
+    819, 809, 799, 789, 780, 771, 762, 753,
+    744, 736, 728, 720, 712, 704, 697, 689,
+    682, 675, 668, 661, 655, 648, 642, 636,
+    630, 624, 618, 612, 606, 601, 595, 590,
+    585, 579, 574, 569, 564, 560, 555, 550,
+    546, 541, 537, 532, 528, 524, 520, 516,
+    512, 508, 504, 500, 496, 492, 489, 485,
+    481, 478, 474, 471, 468, 464, 461, 458,
+    455, 451, 448, 445, 442, 439, 436, 434,
+    431, 428, 425, 422, 420, 417, 414, 412,
+    409,
+};
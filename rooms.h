@@ -0,0 +1,50 @@
+/* rooms.h
+ * room tables made by tools/roomgraph.py from rooms.graph, do not edit
+ * room_next[from * rooms_count + to] is the room to head for next and
+ * room_distances[from * rooms_count + to] how far it is altogether */
+
+#define rooms_count 10
+#define ROOM_NONE 255
+#define ROOM_NO_PATH 65535
+
+#define ROOM_STAGE 0
+#define ROOM_BACKSTAGE 1
+#define ROOM_DINING 2
+#define ROOM_PIRATE_COVE 3
+#define ROOM_RESTROOMS 4
+#define ROOM_KITCHEN 5
+#define ROOM_WEST_HALL 6
+#define ROOM_SUPPLY_CLOSET 7
+#define ROOM_EAST_HALL 8
+#define ROOM_OFFICE 9
+
+const short room_x [] = {
+    40, 16, 180, 120, 300, 360, 440, 420, 560, 680,
+};
+
+const unsigned char room_next [] = {
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 3, 4, 5, 6, 6, 8, 8,
+    2, 2, 2, 3, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 5, 2, 2, 8, 8,
+    2, 2, 2, 2, 2, 2, 6, 7, 9, 9,
+    6, 6, 6, 6, 6, 6, 6, 7, 6, 6,
+    2, 2, 2, 2, 2, 5, 9, 9, 8, 9,
+    8, 8, 8, 8, 8, 8, 6, 6, 8, 9,
+};
+
+const unsigned short room_distances [] = {
+    0, 24, 140, 200, 260, 320, 400, 420, 520, 640,
+    24, 0, 164, 224, 284, 344, 424, 444, 544, 664,
+    140, 164, 0, 60, 120, 180, 260, 280, 380, 500,
+    200, 224, 60, 0, 180, 240, 320, 340, 440, 560,
+    260, 284, 120, 180, 0, 300, 380, 400, 500, 620,
+    320, 344, 180, 240, 300, 0, 440, 460, 260, 380,
+    400, 424, 260, 320, 380, 440, 0, 20, 380, 260,
+    420, 444, 280, 340, 400, 460, 20, 0, 400, 280,
+    520, 544, 380, 440, 500, 260, 380, 400, 0, 120,
+    640, 664, 500, 560, 620, 380, 260, 280, 120, 0,
+};
+
@@ -0,0 +1,5963 @@
+/* scream.h
+ * video made by tools/videnc.py from scream.png and scream.raw, do not edit
+ * 24 frames at 30 a second, 32558 bytes of blocks */
+
+#define scream_frames 24
+#define scream_fps 30
+#define scream_sound_bytes 35280
+#define scream_sound_rate 44100
+
+const unsigned short scream_palette[] __attribute__((aligned(4))) = {
+    0x0000, 0x0190, 0x012d, 0x2108, 0x2529, 0x6b5a, 0x4631, 0x0c63,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const unsigned int scream_codebook[] __attribute__((aligned(4))) = {
+    0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x02020000, 0x02020000, 0x02020000, 0x02020000,
+    0x01010101, 0x00000000, 0x00000000, 0x00000000,
+    0x02020200, 0x02020200, 0x02020200, 0x02020200,
+    0x00000202, 0x00000202, 0x00000202, 0x00000202,
+    0x02000000, 0x02000000, 0x02000000, 0x02000000,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00020202, 0x00020202, 0x00020202, 0x00020202,
+    0x01010100, 0x01010100, 0x01010100, 0x01010100,
+    0x00000000, 0x00000000, 0x00000000, 0x01010101,
+    0x00000101, 0x00000101, 0x00000101, 0x00000101,
+    0x01010000, 0x01010000, 0x01010000, 0x01010000,
+    0x00000000, 0x00000000, 0x01010101, 0x01010101,
+    0x01000000, 0x01000000, 0x01000000, 0x01000000,
+    0x03030303, 0x03030303, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x00000000, 0x00000000,
+    0x00000000, 0x01010101, 0x01010101, 0x01010101,
+    0x03030303, 0x03030303, 0x03030303, 0x01010101,
+    0x03030303, 0x02020202, 0x02020202, 0x02020202,
+    0x03030303, 0x03030303, 0x02020202, 0x02020202,
+    0x01010101, 0x03030303, 0x03030303, 0x03030303,
+    0x00000000, 0x02020202, 0x02020202, 0x02020202,
+    0x01010101, 0x01010101, 0x03030303, 0x03030303,
+    0x01010101, 0x01010101, 0x01010101, 0x00000000,
+    0x00010101, 0x00010101, 0x00010101, 0x00010101,
+    0x00030303, 0x00030303, 0x00030303, 0x00030303,
+    0x00000000, 0x03030303, 0x03030303, 0x03030303,
+    0x02030303, 0x02030303, 0x02030303, 0x02030303,
+    0x03030303, 0x01010101, 0x01010101, 0x01010101,
+    0x00000000, 0x00000000, 0x02020202, 0x02020202,
+    0x02020202, 0x02020202, 0x02020202, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x02020202,
+    0x03030303, 0x03030303, 0x03030303, 0x02020202,
+    0x02020202, 0x00000000, 0x00000000, 0x00000000,
+    0x02020202, 0x02020202, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x03030303, 0x03030303,
+    0x03030202, 0x03030202, 0x03030202, 0x03030202,
+    0x03030000, 0x03030000, 0x03030000, 0x03030000,
+    0x00000000, 0x00000000, 0x00000000, 0x03030303,
+    0x03020202, 0x03020202, 0x03020202, 0x03020202,
+    0x02020203, 0x02020203, 0x02020203, 0x02020203,
+    0x02020303, 0x02020303, 0x02020303, 0x02020303,
+    0x03030302, 0x03030302, 0x03030302, 0x03030302,
+    0x03030300, 0x03030300, 0x03030300, 0x03030300,
+    0x01010101, 0x01010101, 0x01010101, 0x03030303,
+    0x00000303, 0x00000303, 0x00000303, 0x00000303,
+    0x03000000, 0x03000000, 0x03000000, 0x03000000,
+    0x02020202, 0x03030303, 0x03030303, 0x03030303,
+    0x01010101, 0x02020202, 0x02020202, 0x02020202,
+    0x02020202, 0x02020202, 0x03030303, 0x03030303,
+    0x02010101, 0x02010101, 0x02010101, 0x02010101,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x02020202, 0x02020202, 0x02020202, 0x03030303,
+    0x01010101, 0x01010101, 0x01010101, 0x02020202,
+    0x01010101, 0x00000001, 0x00000001, 0x00000001,
+    0x02020202, 0x02020000, 0x02020000, 0x02020000,
+    0x01010101, 0x00010101, 0x00010101, 0x00010101,
+    0x01010101, 0x01010100, 0x01010100, 0x01010100,
+    0x01010101, 0x01000000, 0x01000000, 0x01000000,
+    0x01010103, 0x01010103, 0x01010103, 0x01010103,
+    0x03020202, 0x03020202, 0x02020202, 0x02020202,
+    0x00000000, 0x02020200, 0x02020200, 0x02020200,
+    0x02020202, 0x00000202, 0x00000202, 0x00000202,
+    0x01010101, 0x01010000, 0x01010000, 0x01010000,
+    0x03030301, 0x03030301, 0x03030301, 0x03030301,
+    0x00000000, 0x02020000, 0x02020000, 0x02020000,
+    0x00000000, 0x00000202, 0x00000202, 0x00000202,
+    0x02020202, 0x02020202, 0x00000002, 0x00000002,
+    0x02020203, 0x02020203, 0x02020202, 0x02020202,
+    0x02020202, 0x02020202, 0x02000000, 0x02000000,
+    0x03030302, 0x03030302, 0x03030302, 0x02020202,
+    0x00000000, 0x00000000, 0x00000002, 0x00000002,
+    0x03030202, 0x02020202, 0x02020202, 0x02020202,
+    0x02030303, 0x02020202, 0x02020202, 0x02020202,
+    0x02020202, 0x00000002, 0x00000002, 0x00000002,
+    0x00000000, 0x00000000, 0x00000202, 0x00000202,
+    0x01000000, 0x01000000, 0x01000000, 0x01010101,
+    0x00000000, 0x00000000, 0x02000000, 0x02000000,
+    0x01010202, 0x01010202, 0x01010202, 0x01010202,
+    0x01020202, 0x01020202, 0x01020202, 0x01020202,
+    0x03030101, 0x03030101, 0x03030101, 0x03030101,
+    0x02030303, 0x02030303, 0x02030303, 0x02020202,
+    0x01010101, 0x00000101, 0x00000101, 0x00000101,
+    0x00000002, 0x00000002, 0x02020202, 0x02020202,
+    0x02020202, 0x00020202, 0x00020202, 0x00020202,
+    0x02020203, 0x02020202, 0x02020202, 0x02020202,
+    0x01010102, 0x01010102, 0x01010102, 0x01010102,
+    0x00000002, 0x00000002, 0x00000002, 0x00000000,
+    0x00000000, 0x00000000, 0x02020000, 0x02020000,
+    0x02020101, 0x02020101, 0x02020101, 0x02020101,
+    0x02000000, 0x02020202, 0x02020202, 0x02020202,
+    0x00000000, 0x00000002, 0x00000002, 0x00000002,
+    0x00000202, 0x00000202, 0x02020202, 0x02020202,
+    0x03030302, 0x02020202, 0x02020202, 0x02020202,
+    0x02020202, 0x02020200, 0x02020200, 0x02020200,
+    0x01010101, 0x01010101, 0x00000101, 0x00000101,
+    0x01010303, 0x01010303, 0x01010303, 0x01010303,
+    0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x01000000, 0x01000000, 0x01010101, 0x01010101,
+    0x00000000, 0x00000000, 0x00000000, 0x02020200,
+    0x00000000, 0x00000000, 0x00000000, 0x00020202,
+    0x00000002, 0x02020202, 0x02020202, 0x02020202,
+    0x00000000, 0x00000000, 0x00000000, 0x02000000,
+    0x01010100, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x03030101, 0x03030101,
+    0x03030000, 0x03030000, 0x03030303, 0x03030303,
+    0x01010202, 0x03030202, 0x03030202, 0x03030202,
+    0x00000202, 0x02020202, 0x02020202, 0x02020202,
+    0x02020000, 0x02020000, 0x02020202, 0x02020202,
+    0x03020202, 0x02020202, 0x02020202, 0x02020202,
+    0x00030303, 0x00030303, 0x03030303, 0x03030303,
+    0x02020202, 0x02020203, 0x02020203, 0x02020203,
+    0x01010101, 0x01010101, 0x02020202, 0x02020202,
+    0x03030303, 0x03030303, 0x03020202, 0x03020202,
+    0x00000000, 0x00000000, 0x00020202, 0x00020202,
+    0x02020200, 0x02020200, 0x02020202, 0x02020202,
+    0x02000000, 0x02000000, 0x02020202, 0x02020202,
+    0x02020303, 0x02020303, 0x02020202, 0x02020202,
+    0x02020303, 0x02020202, 0x02020202, 0x02020202,
+    0x01010101, 0x01010101, 0x01010000, 0x01010000,
+    0x01010101, 0x01010101, 0x00000001, 0x00000001,
+    0x00000101, 0x01010101, 0x01010101, 0x01010101,
+    0x02020202, 0x02020202, 0x02020202, 0x02020200,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00010101, 0x00010101, 0x00010101, 0x01010101,
+    0x00010101, 0x00010101, 0x00010101, 0x01000000,
+    0x01010100, 0x01010100, 0x01010100, 0x01010101,
+    0x00000001, 0x00000001, 0x01010101, 0x01010101,
+    0x01010101, 0x02020201, 0x02020201, 0x02020201,
+    0x02020202, 0x02030303, 0x02030303, 0x02030303,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x01010101,
+    0x02020202, 0x02000000, 0x02000000, 0x02000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000202,
+    0x02000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000202, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x03030301, 0x03030301, 0x03030301,
+    0x02020200, 0x02020200, 0x02020200, 0x00000000,
+    0x02020202, 0x02020202, 0x02020202, 0x00000002,
+    0x00000000, 0x00000000, 0x01010100, 0x01010100,
+    0x00000000, 0x00000000, 0x01010103, 0x01010103,
+    0x00000000, 0x00000000, 0x00000101, 0x00000101,
+    0x01010103, 0x01010103, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010000,
+    0x01010101, 0x01010101, 0x01010101, 0x01010100,
+    0x01010101, 0x01010101, 0x01010101, 0x00000001,
+    0x01010000, 0x02020202, 0x02020202, 0x02020202,
+    0x00000001, 0x02020202, 0x02020202, 0x02020202,
+    0x02020202, 0x02020202, 0x00000202, 0x00000202,
+    0x02020202, 0x02020202, 0x02020200, 0x02020200,
+    0x02020000, 0x02020000, 0x02020000, 0x00000000,
+    0x00020202, 0x00020202, 0x00020202, 0x00000000,
+    0x01010000, 0x01010000, 0x01010000, 0x01010101,
+    0x00000000, 0x00000000, 0x02020200, 0x02020200,
+    0x02020303, 0x02020303, 0x02020303, 0x02020202,
+    0x03030101, 0x03030101, 0x03030101, 0x01010101,
+    0x01000000, 0x01010101, 0x01010101, 0x01010101,
+    0x02020202, 0x03030202, 0x03030202, 0x03030202,
+    0x03030202, 0x03030202, 0x03030202, 0x02020202,
+    0x00030303, 0x03030303, 0x03030303, 0x03030303,
+    0x03030303, 0x03030303, 0x02020303, 0x02020303,
+    0x00000000, 0x00000000, 0x00000000, 0x01010103,
+    0x01010100, 0x01010101, 0x01010101, 0x01010101,
+    0x03030303, 0x03030302, 0x03030302, 0x03030302,
+    0x00000000, 0x00020202, 0x00020202, 0x00020202,
+    0x02020202, 0x02020202, 0x02020203, 0x02020203,
+    0x03030301, 0x03030301, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010100, 0x01010100,
+    0x02020000, 0x02020202, 0x02020202, 0x02020202,
+    0x03010101, 0x03010101, 0x03010101, 0x03010101,
+    0x01010101, 0x01010101, 0x01000000, 0x01000000,
+    0x00000001, 0x00000001, 0x00000001, 0x01010100,
+    0x00000101, 0x00000000, 0x00000000, 0x00000000,
+    0x00000101, 0x00000101, 0x00000101, 0x01010101,
+    0x02010101, 0x02030303, 0x02030303, 0x02030303,
+    0x01010101, 0x02010101, 0x02010101, 0x02010101,
+    0x01010100, 0x02020202, 0x02020202, 0x02020202,
+    0x00000000, 0x00000003, 0x00000003, 0x00000003,
+    0x00000000, 0x01000000, 0x01000000, 0x01000000,
+    0x03000000, 0x03030303, 0x03030303, 0x03030303,
+    0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x01010100, 0x01010100, 0x01010100, 0x00000001,
+    0x02000000, 0x02000000, 0x02000000, 0x02020202,
+    0x03030303, 0x03030303, 0x03030303, 0x03020202,
+    0x00000002, 0x00000002, 0x00000002, 0x02020202,
+    0x00000000, 0x03030000, 0x03030000, 0x03030000,
+    0x00000000, 0x00030303, 0x00030303, 0x00030303,
+    0x00000000, 0x00000000, 0x00000000, 0x03010101,
+    0x00030303, 0x00030303, 0x00030303, 0x03030303,
+    0x03010101, 0x03010101, 0x01010101, 0x01010101,
+    0x01010303, 0x01010303, 0x01010101, 0x01010101,
+    0x01000000, 0x01000000, 0x01000000, 0x02020202,
+    0x01010101, 0x01010101, 0x01010101, 0x01010202,
+    0x01010101, 0x01010101, 0x01010101, 0x02010101,
+    0x02010101, 0x02010101, 0x02030303, 0x02030303,
+    0x02020200, 0x02020200, 0x00000000, 0x00000000,
+    0x00020202, 0x00020202, 0x00000000, 0x00000000,
+    0x02020000, 0x02020000, 0x00000000, 0x00000000,
+    0x00000202, 0x00000202, 0x00000202, 0x02020202,
+    0x00000000, 0x03030300, 0x03030300, 0x03030300,
+    0x00000000, 0x01010100, 0x01010100, 0x01010100,
+    0x03030300, 0x03030303, 0x03030303, 0x03030303,
+    0x02020200, 0x02020200, 0x02020200, 0x02020202,
+    0x00000002, 0x00000002, 0x00000000, 0x00000000,
+    0x00000003, 0x00000003, 0x03030303, 0x03030303,
+    0x03030101, 0x03030101, 0x01010101, 0x01010101,
+    0x01010100, 0x01010100, 0x01010100, 0x00000000,
+    0x01010101, 0x01010101, 0x01010101, 0x01000000,
+    0x00000101, 0x00000101, 0x00000101, 0x00000000,
+    0x01010101, 0x01010202, 0x01010202, 0x01010202,
+    0x02020200, 0x02020202, 0x02020202, 0x02020202,
+    0x02020201, 0x02020203, 0x02020203, 0x02020203,
+    0x02020202, 0x02020202, 0x02020000, 0x02020000,
+    0x03030202, 0x03030202, 0x02020202, 0x02020202,
+    0x02030303, 0x02030303, 0x02020202, 0x02020202,
+    0x03020202, 0x03020202, 0x03020202, 0x02020202,
+    0x00000000, 0x00000000, 0x00000000, 0x00000303,
+    0x00000000, 0x00000000, 0x01010000, 0x01010000,
+    0x00000000, 0x00000000, 0x00000001, 0x00000001,
+    0x01030303, 0x01030303, 0x01030303, 0x01010101,
+    0x03030303, 0x03030303, 0x02030303, 0x02030303,
+    0x02020202, 0x02020202, 0x02020202, 0x00020202,
+    0x02020202, 0x02020202, 0x02020202, 0x02000000,
+    0x02000000, 0x02000000, 0x02000000, 0x00000000,
+    0x00020202, 0x00020202, 0x00020202, 0x02020202,
+    0x00000000, 0x00000000, 0x01000000, 0x01000000,
+    0x01010000, 0x00000101, 0x00000101, 0x00000101,
+    0x00000001, 0x01010100, 0x01010100, 0x01010100,
+    0x02020203, 0x02020203, 0x02020203, 0x02020202,
+    0x00000000, 0x01010000, 0x01010000, 0x01010000,
+    0x00000000, 0x03010101, 0x03010101, 0x03010101,
+    0x01010101, 0x01010101, 0x02010101, 0x02010101,
+    0x00000101, 0x00000101, 0x01010101, 0x01010101,
+    0x01010000, 0x01010000, 0x00000101, 0x00000101,
+    0x02020202, 0x02020202, 0x02020202, 0x02030303,
+    0x03000000, 0x03000000, 0x03000000, 0x03030303,
+    0x00000303, 0x00000303, 0x00000303, 0x03030303,
+    0x01010103, 0x01010101, 0x01010101, 0x01010101,
+    0x00010101, 0x00010101, 0x01010101, 0x01010101,
+    0x00000001, 0x00000001, 0x01010100, 0x01010100,
+    0x01010000, 0x01010000, 0x01010101, 0x01010101,
+    0x01020202, 0x01020202, 0x03020202, 0x03020202,
+    0x02020101, 0x02020101, 0x02020303, 0x02020303,
+    0x03030303, 0x03030303, 0x03030202, 0x03030202,
+    0x00000001, 0x00000001, 0x00000001, 0x02020202,
+    0x01010102, 0x01010102, 0x03030302, 0x03030302,
+    0x01010000, 0x01010000, 0x00000000, 0x00000000,
+    0x00000000, 0x01010303, 0x01010303, 0x01010303,
+    0x00000000, 0x00010101, 0x00010101, 0x00010101,
+    0x01010101, 0x01010101, 0x00010101, 0x00010101,
+    0x00020202, 0x02020202, 0x02020202, 0x02020202,
+    0x00000000, 0x02000000, 0x02000000, 0x02000000,
+    0x03030303, 0x03030303, 0x03030302, 0x03030302,
+    0x00020202, 0x00020202, 0x02020202, 0x02020202,
+    0x02020202, 0x02020202, 0x03030202, 0x03030202,
+    0x01010100, 0x01010100, 0x00000000, 0x00000000,
+};
+
+const unsigned char scream_data[] __attribute__((aligned(4))) = {
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2e, 0x45,
+    0x2e, 0x1a, 0x1a, 0x1a, 0x1a, 0xb1, 0x35, 0x40, 0x2e, 0x83, 0x03, 0x40,
+    0x33, 0x35, 0x40, 0x2e, 0x83, 0x03, 0x40, 0x33, 0x32, 0x43, 0xb2, 0x10,
+    0x10, 0xb3, 0x83, 0x03, 0x43, 0x1a, 0x10, 0x10, 0xb4, 0x2f, 0x40, 0x0d,
+    0x89, 0x01, 0x40, 0x06, 0x2f, 0x40, 0x0d, 0x89, 0x01, 0x40, 0x06, 0x30,
+    0x49, 0x02, 0x02, 0x38, 0x02, 0x39, 0x38, 0x02, 0x39, 0x02, 0x02, 0x33,
+    0x45, 0x7c, 0x09, 0xb5, 0x7d, 0x09, 0x7e, 0x35, 0x81, 0x01, 0x41, 0x7f,
+    0x62, 0x81, 0x01, 0x33, 0x41, 0x41, 0x15, 0xc0, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01,
+    0x83, 0x01, 0x42, 0x80, 0x15, 0x42, 0x30, 0x40, 0xb6, 0x81, 0x02, 0x40,
+    0x27, 0x80, 0x03, 0x41, 0x20, 0xb7, 0x80, 0x03, 0x40, 0x28, 0x81, 0x02,
+    0x40, 0xb8, 0x2f, 0x81, 0x02, 0x47, 0x43, 0x3c, 0x13, 0x44, 0x3c, 0x13,
+    0x44, 0x45, 0x81, 0x02, 0x2f, 0x81, 0x02, 0x40, 0x00, 0x81, 0x02, 0xc0,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03,
+    0x02, 0x03, 0x03, 0x03, 0x40, 0x81, 0x81, 0x02, 0x40, 0x05, 0x81, 0x02,
+    0x2f, 0x81, 0x02, 0x40, 0x00, 0x81, 0x02, 0x41, 0x46, 0x51, 0x81, 0x02,
+    0x40, 0x05, 0x81, 0x02, 0x2f, 0x81, 0x02, 0x40, 0x00, 0x85, 0x02, 0x40,
+    0x05, 0x81, 0x02, 0x2f, 0x81, 0x02, 0x40, 0x00, 0x85, 0x02, 0x40, 0x05,
+    0x81, 0x02, 0x32, 0x85, 0x02, 0x35, 0x81, 0x02, 0x41, 0x43, 0x45, 0x81,
+    0x02, 0x35, 0x81, 0x02, 0x41, 0x00, 0x05, 0x81, 0x02, 0x34, 0x40, 0x63,
+    0x81, 0x02, 0x41, 0x00, 0x05, 0x81, 0x02, 0x40, 0x64, 0x33, 0x40, 0x03,
+    0x81, 0x02, 0x41, 0x00, 0x05, 0x81, 0x02, 0x40, 0x07, 0x33, 0x40, 0x03,
+    0x81, 0x02, 0x41, 0x00, 0x05, 0x81, 0x02, 0x40, 0x07, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3d, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x32, 0x45, 0xb9, 0x1a, 0x1a, 0x1a, 0x1a, 0xba, 0x35, 0x40, 0x25,
+    0x83, 0x03, 0x40, 0x19, 0x35, 0x40, 0x25, 0x83, 0x03, 0x40, 0x19, 0x32,
+    0x43, 0x09, 0x09, 0xbb, 0x25, 0x83, 0x03, 0x43, 0xbc, 0xa1, 0x09, 0x09,
+    0x2f, 0x81, 0x01, 0x47, 0xbd, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xbe,
+    0x81, 0x01, 0x40, 0x06, 0x2e, 0x8b, 0x01, 0x40, 0x06, 0x2e, 0x8b, 0x01,
+    0x40, 0x06, 0x2e, 0x45, 0x02, 0x02, 0x3a, 0x52, 0x02, 0x39, 0x80, 0x01,
+    0x44, 0x02, 0x3a, 0x52, 0x02, 0x02, 0x31, 0x41, 0x0d, 0x0a, 0x00, 0x40,
+    0x08, 0x80, 0x01, 0x00, 0x41, 0x0d, 0x0a, 0x33, 0x40, 0x0d, 0x81, 0x01,
+    0x41, 0x83, 0x09, 0x81, 0x01, 0x40, 0x0a, 0x32, 0x42, 0x1f, 0xbf, 0xc0,
+    0x83, 0x01, 0x40, 0xc1, 0xc0, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x40, 0x1f, 0x30,
+    0x40, 0x1d, 0x81, 0x02, 0x45, 0x6a, 0x16, 0x16, 0x16, 0x16, 0xc2, 0x81,
+    0x02, 0x40, 0x53, 0x2e, 0x40, 0x3d, 0x82, 0x02, 0x40, 0x24, 0x80, 0x03,
+    0xc0, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x02, 0x02, 0x40, 0x12, 0x80, 0x03, 0x40, 0x1b, 0x82,
+    0x02, 0x40, 0x65, 0x2d, 0x40, 0x03, 0x80, 0x02, 0x44, 0x54, 0x84, 0x48,
+    0x12, 0x55, 0x80, 0x02, 0x43, 0x12, 0x49, 0x3e, 0x37, 0x81, 0x02, 0x2d,
+    0x40, 0x03, 0x80, 0x02, 0x41, 0x07, 0x05, 0x81, 0x02, 0x40, 0x2a, 0x80,
+    0x03, 0x81, 0x02, 0x41, 0x04, 0x01, 0x81, 0x02, 0x2d, 0x40, 0x03, 0x80,
+    0x02, 0x41, 0x07, 0x05, 0x81, 0x02, 0x41, 0x46, 0x20, 0x81, 0x02, 0x41,
+    0x04, 0x01, 0x81, 0x02, 0x2d, 0x40, 0x03, 0x80, 0x02, 0x41, 0x07, 0x05,
+    0x85, 0x02, 0x41, 0x04, 0x01, 0x81, 0x02, 0x2d, 0x40, 0x03, 0x80, 0x02,
+    0x41, 0x07, 0x05, 0x85, 0x02, 0x41, 0x04, 0x01, 0x81, 0x02, 0x2d, 0x43,
+    0xc3, 0x22, 0xc4, 0x05, 0x85, 0x02, 0x43, 0x04, 0xc5, 0x22, 0x22, 0x30,
+    0x40, 0x05, 0x85, 0x02, 0x40, 0x04, 0x33, 0x40, 0x05, 0x81, 0x02, 0x41,
+    0x4a, 0x21, 0x81, 0x02, 0x40, 0x04, 0x33, 0x40, 0x05, 0x81, 0x02, 0x40,
+    0x00, 0x00, 0x81, 0x02, 0x40, 0x04, 0x33, 0x40, 0xb6, 0x81, 0x02, 0x40,
+    0x00, 0x00, 0x81, 0x02, 0x40, 0xc6, 0x32, 0x40, 0x05, 0x82, 0x02, 0x40,
+    0x00, 0x00, 0x82, 0x02, 0x40, 0x04, 0x31, 0x40, 0x05, 0x82, 0x02, 0x40,
+    0x00, 0x00, 0x82, 0x02, 0x40, 0x04, 0x32, 0x42, 0x21, 0x21, 0x21, 0x01,
+    0x42, 0x21, 0x21, 0x21, 0x3f, 0x3f, 0x3f, 0x3f, 0x09, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x36, 0x45, 0xc7, 0x1a, 0x1a, 0x1a, 0x1a,
+    0x1a, 0x35, 0x40, 0x2b, 0x84, 0x03, 0x35, 0x40, 0x2b, 0x84, 0x03, 0x35,
+    0x40, 0x2b, 0x03, 0x80, 0x03, 0x31, 0x44, 0xc8, 0x10, 0x10, 0x88, 0xc9,
+    0x03, 0x80, 0x03, 0x43, 0x1a, 0x10, 0x10, 0x10, 0x2d, 0x40, 0x08, 0x81,
+    0x01, 0x47, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x82, 0x01,
+    0x2d, 0x40, 0x08, 0x80, 0x01, 0x09, 0x81, 0x01, 0x2d, 0x40, 0x08, 0x80,
+    0x01, 0x09, 0x81, 0x01, 0x2d, 0x41, 0x67, 0x02, 0x00, 0x41, 0x39, 0x36,
+    0x01, 0x80, 0x01, 0x00, 0x40, 0x02, 0x80, 0x01, 0x00, 0x41, 0x02, 0x02,
+    0x30, 0x41, 0x08, 0x06, 0x80, 0x00, 0x40, 0x08, 0x80, 0x01, 0x81, 0x00,
+    0x80, 0x01, 0x33, 0x40, 0x08, 0x01, 0x40, 0x06, 0x80, 0x00, 0x01, 0x80,
+    0x01, 0x32, 0x80, 0x00, 0x40, 0x08, 0x80, 0x01, 0x03, 0x81, 0x01, 0x80,
+    0x00, 0x30, 0x40, 0x03, 0x01, 0x40, 0x56, 0x84, 0x01, 0x01, 0x80, 0x02,
+    0x2e, 0x40, 0x03, 0x01, 0x80, 0x02, 0x40, 0x2a, 0x84, 0x03, 0x80, 0x02,
+    0x01, 0x80, 0x02, 0x2c, 0x40, 0x03, 0x80, 0x02, 0x01, 0x80, 0x02, 0x40,
+    0x2a, 0x80, 0x03, 0x40, 0x28, 0x80, 0x02, 0x81, 0x03, 0x80, 0x02, 0x01,
+    0x81, 0x02, 0x2b, 0x40, 0x03, 0x80, 0x02, 0x00, 0x41, 0x00, 0x03, 0x01,
+    0x81, 0x02, 0x01, 0x80, 0x02, 0x80, 0x00, 0x00, 0x81, 0x02, 0x2b, 0x40,
+    0x03, 0x80, 0x02, 0x00, 0x41, 0x00, 0x03, 0x01, 0x40, 0x2a, 0x80, 0x03,
+    0x01, 0x80, 0x02, 0x80, 0x00, 0x00, 0x81, 0x02, 0x2b, 0x40, 0x03, 0x80,
+    0x02, 0x00, 0x41, 0x00, 0x03, 0x01, 0x40, 0x2a, 0x80, 0x03, 0x01, 0x80,
+    0x02, 0x80, 0x00, 0x00, 0x81, 0x02, 0x2b, 0x40, 0x03, 0x81, 0x02, 0x41,
+    0x00, 0x03, 0x05, 0x80, 0x02, 0x00, 0x82, 0x02, 0x2b, 0x40, 0x03, 0x81,
+    0x02, 0x41, 0x00, 0x03, 0x01, 0x81, 0x02, 0x01, 0x80, 0x02, 0x00, 0x82,
+    0x02, 0x2b, 0x44, 0x89, 0x1e, 0x1e, 0x57, 0x03, 0x01, 0x81, 0x02, 0x01,
+    0x80, 0x02, 0x00, 0x42, 0x1e, 0x1e, 0x1e, 0x2f, 0x40, 0x03, 0x01, 0x81,
+    0x02, 0x01, 0x80, 0x02, 0x36, 0x41, 0x8a, 0x1e, 0x01, 0x80, 0x02, 0x37,
+    0x80, 0x00, 0x01, 0x80, 0x02, 0x33, 0x40, 0x03, 0x81, 0x02, 0x40, 0x00,
+    0x00, 0x82, 0x02, 0x32, 0x41, 0x63, 0xca, 0x81, 0x02, 0x40, 0x00, 0x00,
+    0x82, 0x02, 0x40, 0x1f, 0x31, 0x40, 0x03, 0x82, 0x02, 0x40, 0x00, 0x00,
+    0x83, 0x02, 0x31, 0x40, 0x03, 0x82, 0x02, 0x40, 0x00, 0x00, 0x83, 0x02,
+    0x31, 0x43, 0xc3, 0x22, 0x22, 0x22, 0x01, 0x43, 0x22, 0x22, 0x22, 0x22,
+    0x3f, 0x3f, 0x10, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x39, 0x47,
+    0xb9, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xb1, 0x33, 0x40, 0x25, 0x85,
+    0x03, 0x40, 0x33, 0x33, 0x40, 0x25, 0x85, 0x03, 0x40, 0x33, 0x33, 0x40,
+    0x25, 0x80, 0x03, 0x03, 0x80, 0x03, 0x40, 0x33, 0x2f, 0x44, 0x8b, 0x0c,
+    0x0c, 0x68, 0x69, 0x80, 0x03, 0x03, 0x80, 0x03, 0x44, 0xcc, 0x8c, 0x0c,
+    0x0c, 0x8d, 0x2b, 0x40, 0x08, 0x81, 0x01, 0x49, 0xcd, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x81, 0x01, 0x40, 0x0a, 0x2b, 0x40,
+    0x08, 0x80, 0x01, 0x02, 0x86, 0x01, 0x01, 0x80, 0x01, 0x40, 0x0a, 0x2b,
+    0x40, 0x08, 0x80, 0x01, 0x0b, 0x80, 0x01, 0x40, 0x0a, 0x2b, 0x42, 0xce,
+    0x17, 0x17, 0x01, 0x41, 0x17, 0xcf, 0x01, 0x41, 0x17, 0x17, 0x00, 0x43,
+    0x91, 0x17, 0x17, 0xd0, 0x2d, 0x80, 0x00, 0x41, 0x0b, 0x0a, 0x80, 0x00,
+    0x40, 0x0d, 0x80, 0x01, 0x00, 0x81, 0x00, 0x41, 0x08, 0x06, 0x80, 0x00,
+    0x30, 0x41, 0x0b, 0x0a, 0x80, 0x00, 0x40, 0x0d, 0x80, 0x01, 0x01, 0x80,
+    0x00, 0x41, 0x08, 0x06, 0x31, 0x40, 0x0b, 0x80, 0x01, 0x00, 0x40, 0x18,
+    0x81, 0x00, 0x01, 0x80, 0x01, 0x40, 0x06, 0x31, 0x40, 0x0b, 0x80, 0x01,
+    0x05, 0x80, 0x01, 0x40, 0x06, 0x2f, 0x43, 0x3d, 0x15, 0x92, 0xd1, 0x85,
+    0x01, 0x43, 0x80, 0x93, 0x15, 0x42, 0x2c, 0x41, 0x3d, 0xd2, 0x01, 0x47,
+    0x6a, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xd3, 0x02, 0x40, 0x42, 0x2a,
+    0x41, 0x3d, 0xd2, 0x80, 0x02, 0x00, 0x80, 0x02, 0x40, 0x24, 0x80, 0x03,
+    0x42, 0x1b, 0x12, 0x12, 0x81, 0x03, 0x40, 0x28, 0x80, 0x02, 0x01, 0x41,
+    0x6b, 0x42, 0x29, 0x40, 0x03, 0x81, 0x02, 0x44, 0x94, 0xd4, 0xd5, 0x13,
+    0xd6, 0x81, 0x02, 0x43, 0x13, 0x13, 0x44, 0x43, 0x01, 0x80, 0x02, 0x40,
+    0x04, 0x29, 0x40, 0x03, 0x81, 0x02, 0x41, 0x04, 0x01, 0x80, 0x02, 0x01,
+    0x41, 0x31, 0x31, 0x01, 0x80, 0x02, 0x41, 0x00, 0x03, 0x00, 0x80, 0x02,
+    0x40, 0x04, 0x29, 0x40, 0x03, 0x81, 0x02, 0x41, 0x04, 0x01, 0x80, 0x02,
+    0x00, 0x40, 0x27, 0x81, 0x03, 0x01, 0x80, 0x02, 0x41, 0x00, 0x03, 0x00,
+    0x80, 0x02, 0x40, 0x04, 0x29, 0x40, 0x03, 0x81, 0x02, 0x41, 0x04, 0x01,
+    0x80, 0x02, 0x00, 0x42, 0xd7, 0x20, 0x20, 0x01, 0x80, 0x02, 0x41, 0x00,
+    0x03, 0x00, 0x80, 0x02, 0x40, 0x04, 0x29, 0x40, 0x03, 0x81, 0x02, 0x41,
+    0x04, 0x01, 0x80, 0x02, 0x05, 0x80, 0x02, 0x41, 0x00, 0x03, 0x81, 0x02,
+    0x40, 0x04, 0x29, 0x40, 0x03, 0x81, 0x02, 0x41, 0x04, 0x01, 0x80, 0x02,
+    0x05, 0x80, 0x02, 0x41, 0x00, 0x03, 0x81, 0x02, 0x40, 0x04, 0x29, 0x40,
+    0x03, 0x81, 0x02, 0x41, 0x04, 0x01, 0x80, 0x02, 0x01, 0x81, 0x02, 0x01,
+    0x80, 0x02, 0x41, 0x00, 0x03, 0x81, 0x02, 0x40, 0x04, 0x2d, 0x40, 0x01,
+    0x80, 0x02, 0x01, 0x81, 0x02, 0x01, 0x80, 0x02, 0x40, 0x00, 0x31, 0x40,
+    0x01, 0x80, 0x02, 0x01, 0x81, 0x02, 0x01, 0x80, 0x02, 0x40, 0x00, 0x31,
+    0x40, 0x01, 0x01, 0x42, 0x54, 0x21, 0x21, 0x02, 0x40, 0x00, 0x31, 0x40,
+    0x01, 0x01, 0x40, 0x07, 0x80, 0x00, 0x03, 0x40, 0x00, 0x31, 0x40, 0x01,
+    0x81, 0x02, 0x40, 0x07, 0x01, 0x82, 0x02, 0x40, 0x00, 0x30, 0x41, 0x58,
+    0x6c, 0x81, 0x02, 0x40, 0x07, 0x01, 0x82, 0x02, 0x40, 0x53, 0x30, 0x40,
+    0x01, 0x82, 0x02, 0x40, 0x07, 0x01, 0x83, 0x02, 0x40, 0x00, 0x2f, 0x40,
+    0x01, 0x82, 0x02, 0x40, 0x07, 0x01, 0x83, 0x02, 0x40, 0x00, 0x2f, 0x44,
+    0x96, 0x1e, 0x1e, 0x1e, 0x97, 0x01, 0x44, 0x1e, 0x1e, 0x1e, 0x1e, 0x57,
+    0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3d, 0x46, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x34, 0x40, 0x2b, 0x85, 0x03, 0x40, 0x2d, 0x33,
+    0x40, 0x2b, 0x85, 0x03, 0x40, 0x2d, 0x33, 0x40, 0x2b, 0x80, 0x03, 0x04,
+    0x40, 0x2d, 0x33, 0x40, 0x2b, 0x80, 0x03, 0x04, 0x40, 0x2d, 0x2e, 0x45,
+    0xd9, 0x0c, 0x0c, 0x0c, 0x23, 0xc9, 0x80, 0x03, 0x04, 0x44, 0x6e, 0x23,
+    0x0c, 0x0c, 0x0c, 0x2a, 0x40, 0x0b, 0x82, 0x01, 0x49, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xdb, 0x82, 0x01, 0x40, 0x06, 0x29,
+    0x40, 0x0b, 0x81, 0x01, 0x01, 0x87, 0x01, 0x02, 0x80, 0x01, 0x40, 0x06,
+    0x29, 0x40, 0x0b, 0x81, 0x01, 0x0c, 0x80, 0x01, 0x40, 0x06, 0x29, 0x40,
+    0x0b, 0x81, 0x01, 0x0c, 0x80, 0x01, 0x40, 0x06, 0x2a, 0x40, 0x02, 0x01,
+    0x80, 0x01, 0x42, 0x36, 0x02, 0x3a, 0x80, 0x01, 0x02, 0x41, 0x3f, 0x38,
+    0x01, 0x40, 0x02, 0x2e, 0x80, 0x01, 0x40, 0x06, 0x80, 0x00, 0x40, 0x0d,
+    0x80, 0x01, 0x02, 0x41, 0x0b, 0x18, 0x31, 0x80, 0x01, 0x48, 0x83, 0x09,
+    0x4c, 0x17, 0x17, 0x09, 0x09, 0x98, 0x18, 0x31, 0x81, 0x01, 0x00, 0x42,
+    0x7c, 0x09, 0x09, 0x02, 0x40, 0x18, 0x30, 0x80, 0x00, 0x82, 0x01, 0x04,
+    0x80, 0x01, 0x40, 0x18, 0x80, 0x00, 0x2d, 0x40, 0x05, 0x80, 0x02, 0x01,
+    0x40, 0x56, 0x85, 0x01, 0x40, 0x59, 0x2e, 0x41, 0x41, 0x5a, 0x02, 0xc0,
+    0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03,
+    0x02, 0x03, 0x03, 0x03, 0x46, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29,
+    0x02, 0x41, 0x15, 0x5b, 0x28, 0x41, 0x99, 0x6c, 0x80, 0x02, 0x01, 0x80,
+    0x02, 0x40, 0x2a, 0x80, 0x03, 0x42, 0xdc, 0x13, 0x13, 0x81, 0x03, 0x40,
+    0x29, 0x80, 0x02, 0x02, 0x41, 0x53, 0x4b, 0x27, 0x40, 0x03, 0x81, 0x02,
+    0x00, 0x40, 0x1e, 0x80, 0x02, 0x42, 0x46, 0x20, 0x51, 0x81, 0x02, 0x44,
+    0x20, 0x20, 0x9a, 0xdd, 0xde, 0x01, 0x80, 0x02, 0x40, 0x04, 0x27, 0x40,
+    0x03, 0x81, 0x02, 0x40, 0x07, 0x80, 0x00, 0x81, 0x02, 0x01, 0x41, 0x34,
+    0x34, 0x02, 0x41, 0x07, 0x05, 0x01, 0x80, 0x02, 0x40, 0x04, 0x27, 0x40,
+    0x03, 0x81, 0x02, 0x40, 0x07, 0x80, 0x00, 0x81, 0x02, 0x00, 0x40, 0x27,
+    0x81, 0x03, 0x02, 0x41, 0x07, 0x05, 0x01, 0x80, 0x02, 0x40, 0x04, 0x27,
+    0x40, 0x03, 0x81, 0x02, 0x40, 0x07, 0x80, 0x00, 0x81, 0x02, 0x00, 0x40,
+    0x27, 0x81, 0x03, 0x02, 0x41, 0x07, 0x05, 0x01, 0x80, 0x02, 0x40, 0x04,
+    0x27, 0x40, 0x03, 0x81, 0x02, 0x40, 0x07, 0x80, 0x00, 0x81, 0x02, 0x01,
+    0x41, 0x12, 0x12, 0x02, 0x41, 0x07, 0x05, 0x82, 0x02, 0x40, 0x04, 0x27,
+    0x40, 0x03, 0x81, 0x02, 0x40, 0x07, 0x00, 0x81, 0x02, 0x06, 0x41, 0x07,
+    0x05, 0x82, 0x02, 0x40, 0x04, 0x27, 0x40, 0x03, 0x81, 0x02, 0x40, 0x07,
+    0x00, 0x81, 0x02, 0x01, 0x81, 0x02, 0x02, 0x41, 0x07, 0x05, 0x82, 0x02,
+    0x40, 0x04, 0x27, 0x43, 0x89, 0x1e, 0x1e, 0x97, 0x00, 0x81, 0x02, 0x01,
+    0x81, 0x02, 0x02, 0x45, 0x07, 0xdf, 0x1e, 0x1e, 0x1e, 0x04, 0x2c, 0x81,
+    0x02, 0x01, 0x81, 0x02, 0x02, 0x40, 0x07, 0x31, 0x81, 0x02, 0x01, 0x81,
+    0x02, 0x02, 0x40, 0x07, 0x31, 0x80, 0x02, 0x01, 0x42, 0x54, 0x21, 0x21,
+    0x02, 0x40, 0x07, 0x31, 0x80, 0x02, 0x01, 0x40, 0x07, 0x80, 0x00, 0x03,
+    0x40, 0x07, 0x31, 0x82, 0x02, 0x40, 0x07, 0x01, 0x82, 0x02, 0x40, 0x07,
+    0x30, 0x40, 0x1f, 0x82, 0x02, 0x40, 0x07, 0x01, 0x82, 0x02, 0x41, 0xe0,
+    0x64, 0x2e, 0x40, 0x05, 0x83, 0x02, 0x40, 0x07, 0x01, 0x83, 0x02, 0x40,
+    0x07, 0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x01, 0x47, 0x1a, 0x1a,
+    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xba, 0x33, 0x86, 0x03, 0x40, 0x19, 0x33,
+    0x86, 0x03, 0x40, 0x19, 0x33, 0x80, 0x03, 0x05, 0x40, 0x19, 0x33, 0x80,
+    0x03, 0x05, 0x40, 0x19, 0x2e, 0x44, 0x0c, 0x0c, 0x0c, 0x68, 0x23, 0x80,
+    0x03, 0x05, 0x45, 0x6e, 0x23, 0x0c, 0x0c, 0x0c, 0x0c, 0x28, 0x40, 0x0d,
+    0x82, 0x01, 0x4a, 0x9b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x83, 0x01, 0x28, 0x40, 0x0d, 0x81, 0x01, 0x01, 0x88, 0x01,
+    0x02, 0x81, 0x01, 0x28, 0x40, 0x0d, 0x81, 0x01, 0x0d, 0x81, 0x01, 0x28,
+    0x40, 0x0d, 0x81, 0x01, 0x0d, 0x81, 0x01, 0x28, 0x42, 0x0d, 0x17, 0x17,
+    0x02, 0x40, 0x17, 0x05, 0x40, 0xcf, 0x80, 0x01, 0x01, 0x41, 0x17, 0x17,
+    0x2c, 0x40, 0x0b, 0x80, 0x01, 0x80, 0x00, 0x00, 0x40, 0x0b, 0x01, 0x40,
+    0x06, 0x00, 0x40, 0x0d, 0x80, 0x01, 0x30, 0x40, 0x0b, 0x80, 0x01, 0x80,
+    0x00, 0x00, 0x40, 0x0b, 0x01, 0x40, 0x06, 0x00, 0x40, 0x0d, 0x80, 0x01,
+    0x30, 0x40, 0x0b, 0x80, 0x01, 0x47, 0x10, 0x10, 0xe2, 0x02, 0x02, 0xe3,
+    0x10, 0x9c, 0x80, 0x01, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x06, 0x05, 0x06, 0x04, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x04, 0x05, 0x05, 0x07,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07,
+    0x05, 0x07, 0x07, 0x07, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x06, 0x04, 0x04, 0x07, 0x04, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x06, 0x05, 0x07, 0x06,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05,
+    0x06, 0x04, 0x05, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x04, 0x06, 0x07, 0x04, 0x04, 0x07, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04,
+    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x06, 0x05, 0x07, 0x04, 0x07, 0x07, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x07, 0x07, 0x04, 0x04,
+    0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x05, 0x07, 0x05, 0x07, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x07, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x04, 0x07, 0x05,
+    0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x06, 0x04, 0x07, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x06, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x05, 0x06, 0x04,
+    0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x04, 0x05, 0x04, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x07, 0x04, 0x06, 0x05, 0x04, 0x07, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x05, 0x07, 0x06,
+    0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,
+    0x05, 0x07, 0x07, 0x05, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x07, 0x05, 0x06,
+    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07,
+    0x04, 0x07, 0x06, 0x04, 0x06, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x06, 0x07, 0x04, 0x07, 0x06, 0x06, 0x04, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x07, 0x06, 0x05,
+    0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x07,
+    0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x04, 0x04, 0x07, 0x04, 0x07, 0x06, 0x04, 0x07, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07,
+    0x05, 0x05, 0x06, 0x07, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x06, 0x07, 0x04,
+    0x05, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x06,
+    0x04, 0x04, 0x05, 0x06, 0x07, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x06, 0x05, 0x05, 0x04, 0x05, 0x07, 0x06, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x07, 0x06, 0x07, 0x05, 0x06,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x07, 0x05, 0x05, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x07, 0x04, 0x06, 0x07, 0x07, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x04, 0x07, 0x05, 0x04, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x06, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04,
+    0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07,
+    0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x06, 0x04, 0x04, 0x07,
+    0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04,
+    0x06, 0x06, 0x07, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x06, 0x07, 0x04, 0x04,
+    0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x05, 0x04, 0x04, 0x06, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x05, 0x05, 0x04, 0x06, 0x04, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x06, 0x07, 0x06, 0x04,
+    0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x07, 0x05, 0x07, 0x06, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x05, 0x04, 0x06, 0x07,
+    0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05,
+    0x04, 0x05, 0x07, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x06, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x07, 0x05,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x05, 0x04, 0x04, 0x07, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x07, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x04, 0x06, 0x07, 0x07,
+    0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x04, 0x06, 0x06, 0x07, 0x07, 0x05, 0x07, 0x04, 0x06, 0x05, 0x05, 0x05,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x05, 0x05, 0x06, 0x04, 0x07, 0x06, 0x04,
+    0x07, 0x04, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06,
+    0x07, 0x07, 0x05, 0x07, 0x07, 0x05, 0x07, 0x06, 0x07, 0x04, 0x05, 0x05,
+    0x05, 0x06, 0x06, 0x04, 0x05, 0x07, 0x06, 0x06, 0x05, 0x07, 0x05, 0x04,
+    0x04, 0x06, 0x04, 0x04, 0x07, 0x04, 0x04, 0x06, 0x04, 0x05, 0xff, 0x07,
+    0x04, 0x06, 0x06, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06,
+    0x04, 0x06, 0x07, 0x06, 0x06, 0x04, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06,
+    0x07, 0x06, 0x07, 0x05, 0x04, 0x06, 0x06, 0x05, 0x05, 0x07, 0x04, 0x04,
+    0x07, 0x06, 0x05, 0x07, 0x07, 0x06, 0x07, 0x05, 0x07, 0x04, 0x07, 0x07,
+    0x05, 0x07, 0x06, 0x04, 0x06, 0x07, 0x07, 0x07, 0x04, 0x07, 0x07, 0x06,
+    0x04, 0x04, 0x06, 0x04, 0x05, 0x05, 0x07, 0x06, 0x04, 0x07, 0x05, 0x04,
+    0x05, 0x04, 0x06, 0x06, 0x04, 0x06, 0x05, 0x07, 0x07, 0x04, 0x07, 0x04,
+    0x05, 0x07, 0x07, 0x05, 0x06, 0x05, 0x07, 0x07, 0x07, 0x05, 0x04, 0x07,
+    0x04, 0x07, 0x07, 0x04, 0x07, 0x07, 0x04, 0x07, 0x04, 0x07, 0x06, 0x04,
+    0x05, 0x05, 0x05, 0x06, 0x04, 0x07, 0x07, 0x05, 0x04, 0x07, 0x04, 0x07,
+    0x04, 0x05, 0x07, 0x07, 0x07, 0x04, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07,
+    0x06, 0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05,
+    0x05, 0x07, 0x07, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04,
+    0x05, 0x06, 0x06, 0x06, 0x06, 0x04, 0x07, 0x04, 0x05, 0x07, 0x07, 0x06,
+    0x06, 0x06, 0x04, 0x07, 0x04, 0x04, 0x06, 0x04, 0x05, 0x05, 0x07, 0x06,
+    0x07, 0x07, 0x07, 0x06, 0x06, 0x04, 0x07, 0x05, 0x05, 0x04, 0x07, 0x04,
+    0x05, 0x06, 0x05, 0x07, 0x07, 0x06, 0x04, 0x06, 0x06, 0x07, 0x06, 0x06,
+    0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06,
+    0x05, 0x04, 0x06, 0x04, 0x04, 0x05, 0x06, 0x04, 0x07, 0x05, 0x06, 0x07,
+    0x07, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04, 0x06, 0x05, 0x06, 0x06, 0x05,
+    0x06, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05, 0x04, 0x06, 0x04, 0x04, 0x04,
+    0x06, 0x06, 0x07, 0x04, 0x05, 0x07, 0x04, 0x06, 0x06, 0x06, 0x07, 0x04,
+    0x05, 0x05, 0x07, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x07, 0x05, 0x07,
+    0x06, 0x05, 0x06, 0x04, 0x04, 0x06, 0x05, 0x04, 0x07, 0x05, 0x06, 0x06,
+    0x05, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x04, 0x05, 0x04, 0x05, 0x07,
+    0x06, 0x06, 0x04, 0x05, 0x05, 0x06, 0x07, 0x06, 0x07, 0x06, 0x05, 0x06,
+    0x04, 0x05, 0x04, 0x04, 0x07, 0x07, 0x06, 0x05, 0x07, 0x06, 0x07, 0x04,
+    0x04, 0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x07, 0x06, 0x07, 0x07, 0x04,
+    0x04, 0x06, 0x05, 0x06, 0x07, 0x04, 0x05, 0x06, 0x05, 0x07, 0x04, 0x04,
+    0x05, 0x04, 0x06, 0x06, 0x05, 0x07, 0x07, 0x05, 0x05, 0x07, 0x04, 0x04,
+    0x04, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x05,
+    0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x07, 0x05, 0x07, 0x07, 0x05, 0x07,
+    0x04, 0x06, 0x07, 0x04, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x07, 0x04,
+    0x07, 0x05, 0x07, 0x07, 0x05, 0x07, 0x05, 0x05, 0x04, 0x07, 0x05, 0x07,
+    0x04, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x05, 0x07, 0x06, 0x04,
+    0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x05, 0x05, 0x07, 0x05,
+    0x07, 0x04, 0x07, 0x04, 0x06, 0x05, 0x04, 0x06, 0x05, 0x05, 0x06, 0x04,
+    0x06, 0x05, 0x07, 0x05, 0x06, 0x07, 0x07, 0x05, 0x04, 0x06, 0x07, 0x04,
+    0x04, 0x04, 0x06, 0x05, 0x06, 0x05, 0x07, 0x06, 0x05, 0x04, 0x07, 0x04,
+    0x04, 0x04, 0x07, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x04, 0x07, 0x05,
+    0x04, 0x04, 0x05, 0x04, 0x06, 0x05, 0x06, 0x06, 0x04, 0x06, 0x05, 0x06,
+    0x06, 0x06, 0x06, 0x05, 0x04, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07,
+    0x05, 0x07, 0x06, 0x07, 0x04, 0x07, 0x07, 0x07, 0x07, 0x06, 0x05, 0x05,
+    0x06, 0x05, 0x05, 0x06, 0x04, 0x04, 0x07, 0x05, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x05, 0x07, 0x05, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x07, 0x07,
+    0x07, 0x04, 0x07, 0x05, 0x07, 0x05, 0x04, 0x05, 0x06, 0x05, 0x04, 0x07,
+    0x07, 0x06, 0x05, 0x04, 0x06, 0x05, 0x05, 0x04, 0x07, 0x06, 0x06, 0x07,
+    0x06, 0x06, 0x05, 0x06, 0x04, 0x04, 0x07, 0x05, 0x05, 0x05, 0x06, 0x06,
+    0x05, 0x05, 0x05, 0x06, 0x04, 0x06, 0x07, 0x07, 0x04, 0x06, 0x06, 0x04,
+    0x07, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x06,
+    0x05, 0x07, 0x05, 0x05, 0x07, 0x06, 0x07, 0x06, 0x04, 0x04, 0x05, 0x07,
+    0x06, 0x06, 0x05, 0x04, 0x05, 0x07, 0x04, 0x06, 0x07, 0x04, 0x05, 0x05,
+    0x05, 0x04, 0x06, 0x07, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x07, 0x05,
+    0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x07, 0x04, 0x04,
+    0x05, 0x07, 0x07, 0x07, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x05, 0x06,
+    0x05, 0x04, 0x06, 0x06, 0x05, 0x05, 0x07, 0x04, 0x07, 0x07, 0x05, 0x04,
+    0x05, 0x05, 0x04, 0x05, 0x06, 0x07, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05,
+    0x04, 0x07, 0x04, 0x06, 0x07, 0x04, 0x07, 0x07, 0x05, 0x05, 0x07, 0x07,
+    0x04, 0x05, 0x07, 0x07, 0x04, 0x07, 0x05, 0x05, 0x06, 0x05, 0x05, 0x04,
+    0x06, 0x06, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x06,
+    0x05, 0x07, 0x04, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x04, 0x05, 0x06,
+    0x05, 0x07, 0x07, 0x04, 0x07, 0x04, 0x06, 0x04, 0x05, 0x07, 0x07, 0x04,
+    0x04, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x05,
+    0x05, 0x06, 0x06, 0x07, 0x04, 0x05, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06,
+    0x05, 0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x04, 0x07, 0x07,
+    0x04, 0x06, 0x05, 0x05, 0x07, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x04,
+    0x04, 0x05, 0x04, 0x04, 0x05, 0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x05,
+    0x05, 0x04, 0x07, 0x06, 0x05, 0x05, 0x07, 0x04, 0x07, 0x07, 0x07, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x07, 0x07, 0x04, 0x07, 0x05, 0x04, 0x06, 0x07, 0x06,
+    0x06, 0x04, 0x04, 0x04, 0x06, 0x07, 0x05, 0x04, 0x07, 0x06, 0x07, 0x05,
+    0x07, 0x07, 0x05, 0x06, 0x04, 0x04, 0x04, 0x04, 0x07, 0x06, 0x07, 0x06,
+    0x06, 0x04, 0x06, 0x06, 0x07, 0x07, 0x04, 0x07, 0x07, 0x05, 0x06, 0x04,
+    0x05, 0x04, 0x05, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x07, 0x05, 0x06,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x07, 0x04, 0x04, 0x04, 0x05, 0x04, 0x06,
+    0x07, 0x07, 0x07, 0x04, 0x05, 0x07, 0x05, 0x06, 0x06, 0x05, 0x07, 0x05,
+    0x07, 0x07, 0x04, 0x05, 0x04, 0x04, 0x04, 0x07, 0x06, 0x04, 0x05, 0x04,
+    0x06, 0x04, 0x04, 0x07, 0x07, 0x07, 0x04, 0x04, 0x06, 0x05, 0x07, 0x06,
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x04, 0x06,
+    0x04, 0x07, 0x04, 0x04, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07, 0x05, 0x07,
+    0x05, 0x04, 0x05, 0x06, 0x06, 0x07, 0x05, 0x07, 0x07, 0x07, 0x05, 0x06,
+    0x07, 0x07, 0x04, 0x04, 0x05, 0x05, 0x07, 0x04, 0x05, 0x06, 0x07, 0x05,
+    0x04, 0x07, 0x04, 0x06, 0x06, 0x04, 0x04, 0x06, 0x07, 0x07, 0x04, 0x07,
+    0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x07,
+    0x04, 0x06, 0x05, 0x05, 0x04, 0x04, 0x07, 0x07, 0x06, 0x05, 0x05, 0x04,
+    0x06, 0x06, 0x06, 0xff, 0x04, 0x05, 0x07, 0x05, 0x05, 0x06, 0x04, 0x07,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x06, 0x04, 0x07, 0x06, 0x04, 0x06, 0x04,
+    0x05, 0x07, 0x04, 0x07, 0x06, 0x05, 0x07, 0x04, 0x04, 0x07, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 0x07, 0x05, 0x05, 0x04, 0x06, 0x04,
+    0x06, 0x04, 0x04, 0x06, 0x07, 0x04, 0x04, 0x04, 0x07, 0x07, 0x05, 0x05,
+    0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x06, 0x07, 0x04, 0x05, 0x05, 0x05,
+    0x07, 0x05, 0x07, 0x05, 0x06, 0x06, 0x05, 0x07, 0x04, 0x07, 0x06, 0x07,
+    0x05, 0x05, 0x04, 0x06, 0x05, 0x06, 0x05, 0x07, 0x06, 0x05, 0x06, 0x04,
+    0x07, 0x06, 0x07, 0x05, 0x05, 0x04, 0x06, 0x07, 0x05, 0x06, 0x07, 0x04,
+    0x04, 0x06, 0x05, 0x05, 0x07, 0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x05,
+    0x06, 0x04, 0x05, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x06, 0x06, 0x07,
+    0x06, 0x07, 0x04, 0x04, 0x05, 0x04, 0x05, 0x06, 0x05, 0x05, 0x07, 0x04,
+    0x07, 0x05, 0x07, 0x05, 0x04, 0x06, 0x04, 0x05, 0x07, 0x05, 0x07, 0x07,
+    0x06, 0x05, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x05, 0x07, 0x06, 0x07,
+    0x05, 0x06, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x06,
+    0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x04, 0x06, 0x05, 0x05,
+    0x06, 0x04, 0x04, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x07,
+    0x05, 0x06, 0x05, 0x05, 0x07, 0x05, 0x05, 0x07, 0x06, 0x05, 0x07, 0x05,
+    0x04, 0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x06, 0x07, 0x04, 0x06,
+    0x07, 0x06, 0x04, 0x07, 0x06, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x05,
+    0x07, 0x06, 0x06, 0x04, 0x07, 0x04, 0x07, 0x07, 0x06, 0x04, 0x04, 0x05,
+    0x07, 0x07, 0x06, 0x05, 0x04, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07, 0x05,
+    0x04, 0x05, 0x04, 0x05, 0x06, 0x07, 0x06, 0x04, 0x06, 0x05, 0x05, 0x06,
+    0x06, 0x04, 0x05, 0x07, 0x04, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06,
+    0x06, 0x07, 0x05, 0x06, 0x07, 0x04, 0x05, 0x06, 0x04, 0x07, 0x06, 0x04,
+    0x06, 0x06, 0x07, 0x05, 0x06, 0x04, 0x06, 0x07, 0x07, 0x04, 0x05, 0x07,
+    0x04, 0x05, 0x07, 0x06, 0x04, 0x07, 0x07, 0x06, 0x05, 0x05, 0x07, 0x07,
+    0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x07,
+    0x07, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x06,
+    0x05, 0x06, 0x04, 0x05, 0x04, 0x04, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06,
+    0x05, 0x06, 0x07, 0x04, 0x07, 0x05, 0x04, 0x06, 0x06, 0x07, 0x05, 0x04,
+    0x04, 0x04, 0x04, 0x07, 0x06, 0x07, 0x06, 0x04, 0x04, 0x06, 0x04, 0x07,
+    0x05, 0x07, 0x05, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x05, 0x07, 0x04,
+    0x05, 0x07, 0x07, 0x06, 0x04, 0x04, 0x04, 0x07, 0x07, 0x06, 0x04, 0x04,
+    0x07, 0x04, 0x07, 0x04, 0x05, 0x05, 0x04, 0x07, 0x05, 0x06, 0x05, 0x04,
+    0x05, 0x05, 0x07, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x04, 0x07, 0x07,
+    0x05, 0x06, 0x07, 0x05, 0x06, 0x05, 0x07, 0x07, 0x07, 0x06, 0x04, 0x04,
+    0x07, 0x05, 0x05, 0x07, 0x06, 0x07, 0x04, 0x04, 0x06, 0x07, 0x05, 0x05,
+    0x04, 0x04, 0x05, 0x05, 0x07, 0x06, 0x07, 0x05, 0x05, 0x04, 0x06, 0x06,
+    0x06, 0x05, 0x04, 0x05, 0x05, 0x04, 0x06, 0x06, 0x04, 0x05, 0x04, 0x06,
+    0x07, 0x05, 0x06, 0x07, 0x05, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06,
+    0x04, 0x06, 0x06, 0x07, 0x05, 0x07, 0x07, 0x04, 0x05, 0x04, 0x07, 0x06,
+    0x07, 0x06, 0x04, 0x07, 0x06, 0x07, 0x07, 0x07, 0x04, 0x07, 0x06, 0x05,
+    0x07, 0x05, 0x06, 0x05, 0x07, 0x07, 0x07, 0x05, 0x07, 0x06, 0x06, 0x06,
+    0x05, 0x07, 0x07, 0x07, 0x04, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x05,
+    0x06, 0x07, 0x06, 0x06, 0x07, 0x04, 0x07, 0x04, 0x06, 0x04, 0x05, 0x06,
+    0x05, 0x04, 0x04, 0x07, 0x07, 0x07, 0x04, 0x06, 0x04, 0x07, 0x07, 0x04,
+    0x04, 0x07, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x07, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x04, 0x05, 0x04, 0x04, 0x06, 0x07,
+    0x05, 0x05, 0x07, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x06, 0x06, 0x05,
+    0x04, 0x04, 0x06, 0x06, 0x07, 0x04, 0x04, 0x07, 0x04, 0x06, 0x04, 0x07,
+    0x07, 0x07, 0x06, 0x04, 0x05, 0x06, 0x05, 0x07, 0x06, 0x04, 0x06, 0x05,
+    0x06, 0x04, 0x04, 0x06, 0x07, 0x04, 0x04, 0x04, 0x05, 0x05, 0x07, 0x06,
+    0x05, 0x04, 0x04, 0x05, 0x07, 0x04, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05,
+    0x05, 0x06, 0x07, 0x07, 0x05, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x04,
+    0x04, 0x04, 0x05, 0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x05, 0x07, 0x04,
+    0x05, 0x07, 0x07, 0x06, 0x04, 0x06, 0x05, 0x07, 0x05, 0x07, 0x05, 0x04,
+    0x04, 0x04, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07, 0x04, 0x04, 0x06, 0x07,
+    0x05, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x06, 0x07, 0x06, 0x04, 0x07, 0x06, 0x05, 0x06, 0x05, 0x04,
+    0x05, 0x04, 0x04, 0x07, 0x07, 0x05, 0x05, 0x06, 0x07, 0x07, 0x05, 0x04,
+    0x06, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07, 0x05, 0x05, 0x06, 0x06, 0x07,
+    0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x05, 0x07, 0x07, 0x04, 0x04, 0x06,
+    0x07, 0x07, 0x05, 0x07, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x06, 0x07,
+    0x04, 0x06, 0x04, 0x05, 0x07, 0x05, 0x07, 0x06, 0x07, 0x04, 0x05, 0x06,
+    0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x07,
+    0x06, 0x05, 0x04, 0x07, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x04, 0x07,
+    0x04, 0x07, 0x07, 0x07, 0x06, 0x04, 0x06, 0x06, 0x07, 0x05, 0x05, 0x05,
+    0x05, 0x06, 0x04, 0x05, 0x05, 0x05, 0x04, 0x06, 0x07, 0x07, 0x06, 0x05,
+    0x06, 0x05, 0x07, 0x06, 0x04, 0x05, 0x06, 0x04, 0x07, 0x06, 0x05, 0x04,
+    0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07,
+    0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 0x05, 0x06, 0x07, 0x05, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x06, 0x04, 0x06,
+    0x07, 0x07, 0x05, 0x04, 0x05, 0x04, 0x06, 0x04, 0x06, 0x06, 0x07, 0x07,
+    0x07, 0x05, 0x06, 0x07, 0x05, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07, 0x06,
+    0x04, 0x05, 0x06, 0x06, 0x05, 0x07, 0x05, 0x05, 0x05, 0x04, 0x04, 0x07,
+    0x07, 0x06, 0x07, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x05,
+    0x06, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x06, 0x06, 0x04, 0x05, 0x04,
+    0x05, 0x06, 0x06, 0x04, 0x06, 0x05, 0x07, 0x04, 0x05, 0x05, 0x07, 0x04,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x07, 0x05, 0x06, 0x07, 0x07, 0x04,
+    0x07, 0x06, 0x07, 0x07, 0x04, 0x07, 0x06, 0x04, 0x07, 0x04, 0x05, 0x07,
+    0x07, 0x06, 0x07, 0x04, 0x07, 0x05, 0x07, 0x04, 0x06, 0x07, 0x04, 0x07,
+    0x04, 0x05, 0x07, 0x06, 0x07, 0x05, 0x04, 0x07, 0x06, 0x04, 0x04, 0x05,
+    0x07, 0x06, 0x05, 0x07, 0x07, 0x07, 0x07, 0x06, 0x04, 0x07, 0x04, 0x07,
+    0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x07, 0x04,
+    0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0xff, 0x06, 0x04, 0x06,
+    0x07, 0x05, 0x04, 0x04, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0x05, 0x07, 0x06, 0x04, 0x06, 0x05, 0x06, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x04, 0x07, 0x05, 0x04, 0x07, 0x07, 0x04, 0x06, 0x06, 0x07,
+    0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x04,
+    0x04, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x07, 0x06, 0x05, 0x05, 0x06,
+    0x04, 0x05, 0x06, 0x04, 0x04, 0x04, 0x05, 0x07, 0x04, 0x06, 0x07, 0x04,
+    0x04, 0x04, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x07, 0x05, 0x07, 0x06,
+    0x06, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x04, 0x06, 0x05, 0x04, 0x05,
+    0x04, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x04, 0x04, 0x06,
+    0x05, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x07, 0x06, 0x05,
+    0x04, 0x04, 0x06, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x04, 0x05, 0x05,
+    0x06, 0x05, 0x07, 0x06, 0x06, 0x05, 0x04, 0x07, 0x05, 0x06, 0x06, 0x05,
+    0x07, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07, 0x04, 0x06, 0x06, 0x05, 0x06,
+    0x04, 0x05, 0x05, 0x07, 0x06, 0x06, 0x06, 0x05, 0x07, 0x07, 0x04, 0x06,
+    0x06, 0x04, 0x04, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07, 0x05, 0x05, 0x05,
+    0x06, 0x04, 0x06, 0x07, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x06,
+    0x06, 0x04, 0x07, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x04, 0x07, 0x07, 0x06, 0x05, 0x06, 0x04, 0x07, 0x06,
+    0x06, 0x04, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x05, 0x07, 0x04, 0x05,
+    0x06, 0x06, 0x06, 0x04, 0x07, 0x05, 0x07, 0x06, 0x04, 0x04, 0x04, 0x05,
+    0x04, 0x04, 0x06, 0x05, 0x07, 0x05, 0x04, 0x05, 0x05, 0x06, 0x04, 0x05,
+    0x04, 0x06, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x05, 0x07, 0x04, 0x07,
+    0x04, 0x07, 0x04, 0x06, 0x05, 0x04, 0x07, 0x07, 0x04, 0x07, 0x05, 0x05,
+    0x05, 0x04, 0x07, 0x06, 0x04, 0x07, 0x05, 0x06, 0x05, 0x05, 0x04, 0x04,
+    0x06, 0x04, 0x07, 0x04, 0x06, 0x07, 0x07, 0x06, 0x04, 0x06, 0x04, 0x05,
+    0x05, 0x05, 0x04, 0x05, 0x07, 0x05, 0x07, 0x06, 0x04, 0x04, 0x05, 0x05,
+    0x06, 0x07, 0x06, 0x06, 0x04, 0x05, 0x06, 0x06, 0x07, 0x04, 0x04, 0x04,
+    0x05, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x06,
+    0x05, 0x06, 0x06, 0x07, 0x06, 0x04, 0x07, 0x07, 0x06, 0x04, 0x04, 0x06,
+    0x04, 0x05, 0x07, 0x06, 0x04, 0x04, 0x07, 0x06, 0x04, 0x05, 0x06, 0x05,
+    0x07, 0x04, 0x05, 0x05, 0x04, 0x07, 0x05, 0x04, 0x06, 0x05, 0x05, 0x04,
+    0x06, 0x06, 0x07, 0x07, 0x05, 0x05, 0x07, 0x04, 0x05, 0x05, 0x07, 0x05,
+    0x06, 0x07, 0x06, 0x07, 0x04, 0x04, 0x06, 0x07, 0x04, 0x05, 0x05, 0x06,
+    0x04, 0x05, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 0x07,
+    0x04, 0x05, 0x06, 0x04, 0x04, 0x06, 0x05, 0x07, 0x06, 0x04, 0x05, 0x07,
+    0x05, 0x04, 0x04, 0x04, 0x05, 0x06, 0x05, 0x05, 0x06, 0x04, 0x06, 0x04,
+    0x04, 0x06, 0x05, 0x05, 0x06, 0x04, 0x04, 0x04, 0x07, 0x04, 0x06, 0x07,
+    0x07, 0x04, 0x04, 0x07, 0x05, 0x04, 0x06, 0x06, 0x06, 0x07, 0x04, 0x07,
+    0x04, 0x07, 0x07, 0x04, 0x07, 0x05, 0x04, 0x07, 0x06, 0x06, 0x06, 0x07,
+    0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x06, 0x05, 0x06, 0x06, 0x04,
+    0x05, 0x06, 0x05, 0x07, 0x05, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05,
+    0x04, 0x07, 0x04, 0x05, 0x04, 0x04, 0x06, 0x05, 0x04, 0x06, 0x04, 0x07,
+    0x06, 0x07, 0x07, 0x04, 0x06, 0x04, 0x07, 0x06, 0x07, 0x05, 0x07, 0x04,
+    0x05, 0x05, 0x06, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x07, 0x06, 0x04,
+    0x06, 0x04, 0x04, 0x07, 0x04, 0x07, 0x06, 0x05, 0x05, 0x04, 0x04, 0x06,
+    0x06, 0x07, 0x04, 0x05, 0x05, 0x04, 0x06, 0x05, 0x06, 0x04, 0x06, 0x07,
+    0x04, 0x05, 0x06, 0x05, 0x04, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x05,
+    0x07, 0x04, 0x06, 0x04, 0x07, 0x06, 0x07, 0x04, 0x06, 0x04, 0x04, 0x05,
+    0x04, 0x04, 0x07, 0x04, 0x06, 0x04, 0x07, 0x06, 0x05, 0x06, 0x05, 0x04,
+    0x06, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x07, 0x07,
+    0x04, 0x06, 0x06, 0x06, 0x04, 0x05, 0x07, 0x07, 0x05, 0x07, 0x05, 0x05,
+    0x07, 0x05, 0x07, 0x04, 0x07, 0x07, 0x07, 0x06, 0x07, 0x04, 0x07, 0x06,
+    0x06, 0x05, 0x06, 0x05, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x04,
+    0x05, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x07, 0x07, 0x06, 0x06,
+    0x05, 0x06, 0x06, 0x07, 0x05, 0x06, 0x04, 0x07, 0x07, 0x07, 0x06, 0x04,
+    0x05, 0x05, 0x07, 0x04, 0x06, 0x05, 0x07, 0x04, 0x06, 0x07, 0x06, 0x07,
+    0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07,
+    0x07, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x06, 0x07, 0x05, 0x04,
+    0x05, 0x05, 0x07, 0x07, 0x04, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07,
+    0x04, 0x07, 0x06, 0x04, 0x05, 0x06, 0x05, 0x06, 0x07, 0x06, 0x04, 0x07,
+    0x06, 0x05, 0x04, 0x06, 0x06, 0x04, 0x05, 0x05, 0x04, 0x07, 0x07, 0x04,
+    0x07, 0x05, 0x05, 0x04, 0x07, 0x04, 0x07, 0x06, 0x04, 0x05, 0x04, 0x07,
+    0x07, 0x04, 0x04, 0x06, 0x07, 0x06, 0x07, 0x06, 0x05, 0x07, 0x05, 0x04,
+    0x07, 0x04, 0x07, 0x04, 0x07, 0x07, 0x04, 0x07, 0x07, 0x07, 0x05, 0x04,
+    0x06, 0x07, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x04, 0x07, 0x06, 0x06, 0x06, 0x05, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x06, 0x05, 0x07, 0x04, 0x04,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x05,
+    0x07, 0x06, 0x04, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x06, 0x04, 0x07, 0x05, 0x07, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x04, 0x07, 0x05, 0x04,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x07,
+    0x07, 0x06, 0x06, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x05, 0x07, 0x04, 0x04, 0x05, 0x07, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x04, 0x06, 0x05, 0x04,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x06,
+    0x05, 0x05, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x05, 0x04, 0x05, 0x04, 0x06, 0x06, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x07, 0x05, 0x07,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x04, 0x06, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x05, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x04,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x05,
+    0x05, 0x07, 0x07, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xeb, 0x04, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04, 0x06, 0x07, 0x06,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x04, 0x05, 0x04, 0x06, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x04, 0x05, 0x07, 0x06, 0x04, 0x04, 0x00, 0x02,
+    0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06,
+    0x07, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x07, 0x04, 0x05, 0x06, 0x07, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x06, 0x07, 0x06, 0x04, 0x07, 0x07, 0x05, 0x05, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x06, 0x04, 0x04, 0x07, 0x05,
+    0x06, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x04,
+    0x07, 0x07, 0x06, 0x07, 0x04, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x07, 0x06, 0x07, 0x05, 0x07, 0x06, 0x06, 0x05, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x06, 0x04, 0x06, 0x07, 0x05,
+    0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x06, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x03, 0x03,
+    0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x07, 0x04, 0x06, 0x04, 0x06, 0x05,
+    0x07, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x06,
+    0x06, 0x05, 0x04, 0x04, 0x07, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x06, 0x07, 0x02, 0x03,
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x07, 0x05, 0x05, 0x04,
+    0x07, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x04,
+    0x07, 0x04, 0x04, 0x04, 0x04, 0x06, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03,
+    0x03, 0x02, 0x06, 0x04, 0x04, 0x07, 0x05, 0x07, 0x05, 0x04, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x07, 0x07, 0x04, 0x04, 0x05,
+    0x06, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x07,
+    0x04, 0x07, 0x06, 0x04, 0x04, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x07, 0x06, 0x07, 0x04, 0x05,
+    0x04, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x07,
+    0x05, 0x05, 0x07, 0x04, 0x05, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x04, 0x02, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 0x04, 0x06, 0x04, 0x04,
+    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x04, 0x05, 0x04, 0x06, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x04, 0x07, 0x04, 0x05,
+    0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x04, 0x04, 0x07, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x04, 0x04, 0x06, 0x05,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x05, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x07,
+    0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06,
+    0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x04, 0x07, 0x07, 0x06,
+    0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x05, 0x05, 0x07, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x04, 0x04, 0x06, 0x05, 0x07, 0x06, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x05, 0x06, 0x05,
+    0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07,
+    0x07, 0x07, 0x06, 0x07, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x05, 0x04, 0x04, 0x07, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x07, 0x07,
+    0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x40,
+    0x03, 0x81, 0x02, 0x01, 0x81, 0x02, 0x81, 0x03, 0x40, 0x29, 0x81, 0x02,
+    0x40, 0x2a, 0x80, 0x03, 0x40, 0x1b, 0x81, 0x02, 0x01, 0x81, 0x02, 0x40,
+    0x00, 0x25, 0x40, 0x03, 0x81, 0x02, 0x00, 0x41, 0x00, 0x01, 0x80, 0x02,
+    0x01, 0x82, 0x02, 0x02, 0x80, 0x02, 0x80, 0x00, 0x40, 0x01, 0x00, 0x81,
+    0x02, 0x40, 0x00, 0x25, 0x40, 0x03, 0x81, 0x02, 0x00, 0x41, 0x00, 0x01,
+    0x80, 0x02, 0x01, 0x43, 0x9d, 0x2f, 0x2f, 0x6f, 0x01, 0x80, 0x02, 0x80,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x00, 0x25, 0x40, 0x03, 0x81,
+    0x02, 0x00, 0x41, 0x00, 0x01, 0x80, 0x02, 0x01, 0x40, 0x24, 0x81, 0x03,
+    0x40, 0x28, 0x01, 0x80, 0x02, 0x80, 0x00, 0x40, 0x01, 0x00, 0x81, 0x02,
+    0x40, 0x00, 0x25, 0x40, 0x03, 0x81, 0x02, 0x00, 0x41, 0x00, 0x01, 0x80,
+    0x02, 0x01, 0x43, 0x9e, 0x20, 0x20, 0xe4, 0x01, 0x80, 0x02, 0x80, 0x00,
+    0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x00, 0x25, 0x40, 0x03, 0x81, 0x02,
+    0x00, 0x41, 0x00, 0x01, 0x80, 0x02, 0x07, 0x80, 0x02, 0x80, 0x00, 0x40,
+    0x01, 0x00, 0x81, 0x02, 0x40, 0x00, 0x25, 0x40, 0x03, 0x82, 0x02, 0x41,
+    0x00, 0x01, 0x80, 0x02, 0x07, 0x80, 0x02, 0x00, 0x40, 0x01, 0x82, 0x02,
+    0x40, 0x00, 0x25, 0x40, 0x03, 0x82, 0x02, 0x41, 0x00, 0x01, 0x80, 0x02,
+    0x07, 0x80, 0x02, 0x00, 0x40, 0x01, 0x82, 0x02, 0x40, 0x00, 0x25, 0x45,
+    0x89, 0x1e, 0x1e, 0x1e, 0x57, 0x01, 0x80, 0x02, 0x01, 0x82, 0x02, 0x02,
+    0x80, 0x02, 0x00, 0x44, 0x96, 0x1e, 0x1e, 0x1e, 0x57, 0x2a, 0x40, 0x01,
+    0x80, 0x02, 0x01, 0x82, 0x02, 0x02, 0x80, 0x02, 0x30, 0x40, 0x01, 0x80,
+    0x02, 0x01, 0x82, 0x02, 0x02, 0x80, 0x02, 0x30, 0x40, 0x01, 0x80, 0x02,
+    0x01, 0x42, 0x94, 0x22, 0x22, 0x02, 0x80, 0x02, 0x34, 0x40, 0x04, 0x01,
+    0x40, 0x03, 0x02, 0x80, 0x00, 0x33, 0x40, 0x04, 0x01, 0x40, 0x03, 0x02,
+    0x80, 0x00, 0x30, 0x82, 0x02, 0x40, 0x04, 0x01, 0x40, 0x03, 0x82, 0x02,
+    0x80, 0x00, 0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x05, 0x48, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x32, 0x87, 0x03, 0x40, 0x19,
+    0x32, 0x87, 0x03, 0x40, 0x19, 0x32, 0x80, 0x03, 0x05, 0x80, 0x03, 0x40,
+    0x19, 0x32, 0x80, 0x03, 0x05, 0x80, 0x03, 0x40, 0x19, 0x32, 0x80, 0x03,
+    0x05, 0x80, 0x03, 0x40, 0x19, 0x2c, 0x45, 0xe5, 0x10, 0x10, 0x10, 0xe6,
+    0x1a, 0x80, 0x03, 0x05, 0x80, 0x03, 0x46, 0x9f, 0x1a, 0x10, 0x10, 0x10,
+    0x10, 0xb4, 0x26, 0x40, 0x0b, 0x82, 0x01, 0x4b, 0xa9, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0x01, 0x40, 0x06,
+    0x26, 0x40, 0x0b, 0x80, 0x01, 0x02, 0x89, 0x01, 0x02, 0x81, 0x01, 0x40,
+    0x06, 0x26, 0x40, 0x0b, 0x80, 0x01, 0x0f, 0x81, 0x01, 0x40, 0x06, 0x26,
+    0x40, 0x0b, 0x80, 0x01, 0x0f, 0x81, 0x01, 0x40, 0x06, 0x26, 0x40, 0x0b,
+    0x80, 0x01, 0x0f, 0x81, 0x01, 0x40, 0x06, 0x28, 0x81, 0x00, 0x40, 0x0d,
+    0x00, 0x82, 0x00, 0x01, 0x40, 0x18, 0x81, 0x00, 0x40, 0x0d, 0x80, 0x01,
+    0x81, 0x00, 0x2d, 0x40, 0x0d, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01,
+    0x40, 0x18, 0x00, 0x80, 0x00, 0x40, 0x0d, 0x80, 0x01, 0x2f, 0x40, 0x0d,
+    0x00, 0x40, 0x09, 0x00, 0x40, 0x09, 0x01, 0x40, 0x7d, 0x00, 0x41, 0x09,
+    0x4c, 0x80, 0x01, 0x2f, 0x40, 0x0d, 0x02, 0x80, 0x01, 0x81, 0x00, 0x40,
+    0x0d, 0x01, 0x81, 0x01, 0x2f, 0x40, 0x0d, 0x03, 0x42, 0x10, 0x10, 0x9c,
+    0x01, 0x81, 0x01, 0x2d, 0x43, 0x1d, 0x1d, 0x1d, 0x70, 0x80, 0x01, 0x05,
+    0x80, 0x01, 0x44, 0xe7, 0x70, 0x1d, 0x1d, 0x1d, 0x29, 0x40, 0x05, 0x80,
+    0x02, 0x02, 0x87, 0x01, 0x40, 0x32, 0x01, 0x81, 0x02, 0x28, 0x40, 0x01,
+    0x80, 0x02, 0x03, 0x80, 0x03, 0x01, 0x81, 0x03, 0x01, 0x80, 0x03, 0x40,
+    0x1b, 0x02, 0x81, 0x02, 0x40, 0x00, 0x25, 0x41, 0x1d, 0x6c, 0x02, 0x80,
+    0x02, 0x00, 0x82, 0x03, 0x42, 0x13, 0x13, 0x71, 0x81, 0x03, 0x40, 0x1b,
+    0x80, 0x02, 0x02, 0x80, 0x02, 0x41, 0x53, 0x72, 0x24, 0x81, 0x02, 0x01,
+    0x81, 0x02, 0x00, 0x82, 0x03, 0x81, 0x02, 0x40, 0x27, 0x81, 0x03, 0x40,
+    0x1b, 0x80, 0x02, 0x02, 0x81, 0x02, 0x40, 0x07, 0x24, 0x81, 0x02, 0x01,
+    0x41, 0x00, 0x05, 0x02, 0x82, 0x02, 0x02, 0x81, 0x02, 0x80, 0x00, 0x40,
+    0x01, 0x00, 0x81, 0x02, 0x40, 0x07, 0x24, 0x81, 0x02, 0x01, 0x41, 0x00,
+    0x05, 0x02, 0x80, 0x02, 0x42, 0x2f, 0x2f, 0x81, 0x01, 0x81, 0x02, 0x80,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x07, 0x24, 0x81, 0x02, 0x01,
+    0x41, 0x00, 0x05, 0x03, 0x81, 0x03, 0x40, 0x1b, 0x01, 0x81, 0x02, 0x80,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x07, 0x24, 0x81, 0x02, 0x01,
+    0x41, 0x00, 0x05, 0x03, 0x81, 0x03, 0x40, 0x1b, 0x01, 0x81, 0x02, 0x80,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x07, 0x24, 0x81, 0x02, 0x01,
+    0x41, 0x00, 0x05, 0x03, 0x42, 0x12, 0x12, 0x49, 0x01, 0x81, 0x02, 0x80,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x02, 0x40, 0x07, 0x24, 0x83, 0x02, 0x41,
+    0x00, 0x05, 0x08, 0x81, 0x02, 0x80, 0x00, 0x40, 0x01, 0x82, 0x02, 0x40,
+    0x07, 0x24, 0x83, 0x02, 0x41, 0x00, 0x05, 0x08, 0x81, 0x02, 0x00, 0x40,
+    0x01, 0x82, 0x02, 0x40, 0x07, 0x24, 0x83, 0x02, 0x41, 0x00, 0x05, 0x08,
+    0x81, 0x02, 0x00, 0x40, 0x01, 0x82, 0x02, 0x40, 0x07, 0x24, 0x43, 0x22,
+    0x22, 0x22, 0x22, 0x00, 0x40, 0x05, 0x02, 0x82, 0x02, 0x02, 0x81, 0x02,
+    0x00, 0x44, 0xc5, 0x22, 0x22, 0x22, 0xc4, 0x29, 0x40, 0x05, 0x02, 0x82,
+    0x02, 0x02, 0x81, 0x02, 0x2f, 0x40, 0x05, 0x02, 0x82, 0x02, 0x02, 0x81,
+    0x02, 0x2f, 0x40, 0x05, 0x02, 0x80, 0x02, 0x42, 0x21, 0x21, 0x84, 0x01,
+    0x81, 0x02, 0x2e, 0x80, 0x00, 0x40, 0x05, 0x02, 0x80, 0x02, 0x01, 0x40,
+    0x05, 0x02, 0x80, 0x02, 0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x08, 0x40, 0x25,
+    0x87, 0x03, 0x40, 0x19, 0x31, 0x40, 0x25, 0x87, 0x03, 0x40, 0x19, 0x31,
+    0x40, 0x25, 0x87, 0x03, 0x40, 0x19, 0x31, 0x40, 0x25, 0x06, 0x80, 0x03,
+    0x40, 0x19, 0x31, 0x40, 0x25, 0x06, 0x80, 0x03, 0x40, 0x19, 0x31, 0x40,
+    0x25, 0x06, 0x80, 0x03, 0x40, 0x19, 0x2b, 0x46, 0xc8, 0x10, 0x10, 0x10,
+    0x10, 0x1a, 0xb3, 0x06, 0x80, 0x03, 0x41, 0x9f, 0x1a, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+    0x01, 0x01, 0x43, 0x10, 0x10, 0x10, 0x10, 0x25, 0x40, 0x08, 0x83, 0x01,
+    0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x3b, 0x83, 0x01, 0x25, 0x40, 0x08, 0x80, 0x01, 0x02, 0x8a, 0x01,
+    0x03, 0x81, 0x01, 0x25, 0x40, 0x08, 0x80, 0x01, 0x11, 0x81, 0x01, 0x25,
+    0x40, 0x08, 0x80, 0x01, 0x11, 0x81, 0x01, 0x25, 0x40, 0x08, 0x80, 0x01,
+    0x11, 0x81, 0x01, 0x25, 0x44, 0x67, 0x02, 0x02, 0x02, 0x02, 0x80, 0x01,
+    0x43, 0x52, 0x02, 0x02, 0x3f, 0x01, 0x43, 0x38, 0x02, 0x02, 0x3a, 0x80,
+    0x01, 0x44, 0x36, 0x02, 0x02, 0x02, 0x02, 0x2a, 0x80, 0x01, 0x40, 0x0a,
+    0x04, 0x40, 0x18, 0x00, 0x80, 0x00, 0x40, 0x0d, 0x80, 0x01, 0x40, 0x06,
+    0x2e, 0x80, 0x01, 0x40, 0x0a, 0x04, 0x40, 0x18, 0x00, 0x80, 0x00, 0x40,
+    0x0d, 0x80, 0x01, 0x40, 0x06, 0x2e, 0x80, 0x01, 0x49, 0xe8, 0x0c, 0x0c,
+    0xe9, 0x0f, 0x0f, 0xaa, 0x0c, 0x0c, 0x62, 0x80, 0x01, 0x40, 0x06, 0x16,
+    0x97, 0x00, 0x83, 0x01, 0x40, 0x0a, 0x81, 0x00, 0x40, 0x0d, 0x83, 0x01,
+    0x40, 0x06, 0xae, 0x00, 0x8b, 0x01, 0x40, 0x06, 0xab, 0x00, 0x44, 0x1d,
+    0x1d, 0x1d, 0x70, 0xc0, 0x87, 0x01, 0x45, 0xe7, 0x70, 0x1d, 0x1d, 0x1d,
+    0x47, 0xa8, 0x00, 0x83, 0x02, 0x40, 0x4e, 0x87, 0x01, 0x40, 0x32, 0x83,
+    0x02, 0x40, 0x00, 0xa6, 0x00, 0x40, 0x03, 0x84, 0x02, 0x40, 0x24, 0x87,
+    0x03, 0x40, 0x1b, 0x85, 0x02, 0x92, 0x00, 0x11, 0x40, 0x1d, 0x05, 0x40,
+    0x24, 0x01, 0x43, 0xa0, 0x13, 0x13, 0x71, 0x00, 0x80, 0x03, 0x40, 0x1b,
+    0x04, 0x80, 0x02, 0x41, 0x1d, 0x4b, 0x21, 0x40, 0x05, 0x81, 0x02, 0x02,
+    0x81, 0x02, 0x40, 0x24, 0x81, 0x03, 0x40, 0x29, 0x01, 0x40, 0x27, 0x81,
+    0x03, 0x40, 0x1b, 0x81, 0x02, 0x02, 0x81, 0x02, 0x40, 0x04, 0x21, 0x40,
+    0x05, 0x81, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x80, 0x02, 0x02, 0x83,
+    0x02, 0x02, 0x80, 0x02, 0x41, 0x00, 0x05, 0x01, 0x81, 0x02, 0x40, 0x04,
+    0x21, 0x40, 0x05, 0x81, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x80, 0x02,
+    0x02, 0x43, 0x34, 0x34, 0x34, 0xea, 0x02, 0x80, 0x02, 0x41, 0x00, 0x05,
+    0x01, 0x81, 0x02, 0x40, 0x04, 0x21, 0x40, 0x05, 0x81, 0x02, 0x01, 0x40,
+    0x04, 0x80, 0x00, 0x80, 0x02, 0x03, 0x81, 0x03, 0x40, 0x1b, 0x02, 0x80,
+    0x02, 0x41, 0x00, 0x05, 0x01, 0x81, 0x02, 0x40, 0x04, 0x21, 0x40, 0x05,
+    0x81, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x80, 0x02, 0x02, 0x40, 0x24,
+    0x81, 0x03, 0x40, 0x1b, 0x02, 0x80, 0x02, 0x41, 0x00, 0x05, 0x01, 0x81,
+    0x02, 0x40, 0x04, 0x21, 0x40, 0x05, 0x81, 0x02, 0x01, 0x40, 0x04, 0x80,
+    0x00, 0x80, 0x02, 0x02, 0x43, 0x9e, 0x20, 0x20, 0x51, 0x02, 0x80, 0x02,
+    0x41, 0x00, 0x05, 0x01, 0x81, 0x02, 0x40, 0x04, 0x21, 0x40, 0x05, 0x81,
+    0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x80, 0x02, 0x09, 0x80, 0x02, 0x41,
+    0x00, 0x05, 0x01, 0x81, 0x02, 0x40, 0x04, 0x21, 0x40, 0x05, 0x83, 0x02,
+    0x40, 0x04, 0x80, 0x00, 0x80, 0x02, 0x09, 0x80, 0x02, 0x41, 0x00, 0x05,
+    0x83, 0x02, 0x40, 0x04, 0x21, 0x40, 0x05, 0x83, 0x02, 0x40, 0x04, 0x00,
+    0x80, 0x02, 0x09, 0x80, 0x02, 0x41, 0x00, 0x05, 0x83, 0x02, 0x40, 0x04,
+    0x21, 0x40, 0x05, 0x83, 0x02, 0x40, 0x04, 0x00, 0x80, 0x02, 0x09, 0x80,
+    0x02, 0x41, 0x00, 0x05, 0x83, 0x02, 0x40, 0x04, 0x22, 0x43, 0x21, 0x21,
+    0x21, 0x21, 0x01, 0x80, 0x02, 0x02, 0x82, 0x02, 0x03, 0x80, 0x02, 0x40,
+    0x00, 0x00, 0x43, 0x21, 0x21, 0x21, 0x21, 0x29, 0x80, 0x02, 0x02, 0x83,
+    0x02, 0x02, 0x80, 0x02, 0x40, 0x00, 0x2e, 0x80, 0x02, 0x02, 0x83, 0x02,
+    0x02, 0x80, 0x02, 0x40, 0x00, 0x2e, 0x80, 0x02, 0x02, 0x43, 0x94, 0x22,
+    0x22, 0x45, 0x02, 0x80, 0x02, 0x40, 0x00, 0x16, 0x3f, 0x3f, 0x3f, 0x0b,
+    0x40, 0x2e, 0x88, 0x03, 0x40, 0x2d, 0x30, 0x40, 0x2e, 0x88, 0x03, 0x40,
+    0x2d, 0x30, 0x40, 0x2e, 0x88, 0x03, 0x40, 0x2d, 0x30, 0x40, 0x2e, 0x80,
+    0x03, 0x07, 0x40, 0x2d, 0x30, 0x40, 0x2e, 0x80, 0x03, 0x07, 0x40, 0x2d,
+    0x30, 0x40, 0x2e, 0x80, 0x03, 0x07, 0x40, 0x2d, 0x2a, 0x46, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x26, 0xeb, 0x80, 0x03, 0x07, 0x46, 0xec, 0x26, 0xa1,
+    0x09, 0x09, 0x09, 0x09, 0x24, 0x84, 0x01, 0x82, 0x03, 0x07, 0x81, 0x03,
+    0x40, 0x3b, 0x83, 0x01, 0x40, 0x06, 0x23, 0x84, 0x01, 0x4d, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xed,
+    0x83, 0x01, 0x40, 0x06, 0x23, 0x82, 0x01, 0x02, 0x8b, 0x01, 0x03, 0x80,
+    0x01, 0x40, 0x06, 0x23, 0x82, 0x01, 0x12, 0x80, 0x01, 0x40, 0x06, 0x23,
+    0x82, 0x01, 0x12, 0x80, 0x01, 0x40, 0x06, 0x23, 0x82, 0x01, 0x12, 0x80,
+    0x01, 0x40, 0x06, 0x23, 0x44, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x43,
+    0x38, 0x02, 0x02, 0x02, 0x02, 0x43, 0x36, 0x02, 0x02, 0x3f, 0x00, 0x44,
+    0x36, 0x02, 0x02, 0x02, 0x02, 0x29, 0x80, 0x01, 0x40, 0x18, 0x80, 0x00,
+    0x01, 0x80, 0x01, 0x01, 0x40, 0x06, 0x01, 0x40, 0x0b, 0x00, 0x40, 0x06,
+    0x2d, 0x80, 0x01, 0x40, 0x18, 0x80, 0x00, 0x01, 0x80, 0x01, 0x01, 0x40,
+    0x06, 0x01, 0x40, 0x0b, 0x00, 0x40, 0x06, 0x2d, 0x80, 0x01, 0x4a, 0xee,
+    0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0xef, 0x0c, 0x0c, 0xf0, 0x00, 0x40,
+    0x06, 0x2d, 0x81, 0x01, 0x02, 0x80, 0x00, 0x01, 0x40, 0x08, 0x03, 0x40,
+    0x06, 0x2d, 0x81, 0x01, 0x02, 0x40, 0x10, 0x06, 0x40, 0x06, 0x2c, 0x80,
+    0x00, 0x82, 0x01, 0x08, 0x80, 0x01, 0x40, 0x06, 0x81, 0x00, 0x27, 0x40,
+    0x05, 0x81, 0x02, 0x01, 0x40, 0x4f, 0x80, 0x01, 0x07, 0x40, 0x59, 0x03,
+    0x40, 0x04, 0x25, 0x41, 0x1d, 0x74, 0x80, 0x02, 0x02, 0x4a, 0xf1, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xf2, 0x03, 0x41, 0x5c,
+    0x1d, 0x24, 0x82, 0x02, 0x02, 0x40, 0x27, 0x80, 0x03, 0x02, 0x82, 0x03,
+    0x01, 0x40, 0x29, 0x04, 0x80, 0x02, 0x40, 0x00, 0x21, 0x41, 0x41, 0x15,
+    0x80, 0x02, 0x04, 0x40, 0x27, 0x80, 0x03, 0x01, 0x43, 0x12, 0x12, 0x12,
+    0xa3, 0x01, 0x40, 0x29, 0x05, 0x41, 0x65, 0xa4, 0x20, 0x40, 0x01, 0x81,
+    0x02, 0x01, 0x41, 0x8a, 0x1e, 0x80, 0x02, 0x43, 0xd7, 0x20, 0x20, 0x20,
+    0x02, 0x43, 0x46, 0x20, 0x20, 0x9a, 0x00, 0x41, 0x8a, 0xde, 0x02, 0x80,
+    0x02, 0x40, 0x07, 0x20, 0x40, 0x01, 0x81, 0x02, 0x01, 0x40, 0x00, 0x80,
+    0x00, 0x81, 0x02, 0x03, 0x82, 0x02, 0x03, 0x41, 0x00, 0x05, 0x02, 0x80,
+    0x02, 0x40, 0x07, 0x20, 0x40, 0x01, 0x81, 0x02, 0x01, 0x40, 0x00, 0x80,
+    0x00, 0x81, 0x02, 0x02, 0x43, 0x31, 0x31, 0x31, 0xa5, 0x03, 0x41, 0x00,
+    0x05, 0x02, 0x80, 0x02, 0x40, 0x07, 0x20, 0x40, 0x01, 0x81, 0x02, 0x01,
+    0x40, 0x00, 0x80, 0x00, 0x81, 0x02, 0x02, 0x80, 0x03, 0x01, 0x40, 0x28,
+    0x03, 0x41, 0x00, 0x05, 0x02, 0x80, 0x02, 0x40, 0x07, 0x20, 0x40, 0x01,
+    0x81, 0x02, 0x01, 0x40, 0x00, 0x80, 0x00, 0x81, 0x02, 0x02, 0x82, 0x03,
+    0x40, 0x28, 0x03, 0x41, 0x00, 0x05, 0x02, 0x80, 0x02, 0x40, 0x07, 0x20,
+    0x40, 0x01, 0x81, 0x02, 0x01, 0x40, 0x00, 0x80, 0x00, 0x81, 0x02, 0x02,
+    0x43, 0x20, 0x20, 0x20, 0xe4, 0x03, 0x41, 0x00, 0x05, 0x02, 0x80, 0x02,
+    0x40, 0x07, 0x20, 0x40, 0x01, 0x81, 0x02, 0x01, 0x40, 0x00, 0x80, 0x00,
+    0x81, 0x02, 0x0a, 0x41, 0x00, 0x05, 0x02, 0x80, 0x02, 0x40, 0x07, 0x20,
+    0x40, 0x01, 0x81, 0x02, 0x01, 0x40, 0x00, 0x80, 0x00, 0x81, 0x02, 0x0a,
+    0x41, 0x00, 0x05, 0x02, 0x80, 0x02, 0x40, 0x07, 0x20, 0x40, 0x01, 0x83,
+    0x02, 0x40, 0x00, 0x80, 0x00, 0x81, 0x02, 0x0a, 0x41, 0x00, 0x05, 0x83,
+    0x02, 0x40, 0x07, 0x20, 0x40, 0x01, 0x83, 0x02, 0x40, 0x00, 0x00, 0x81,
+    0x02, 0x0a, 0x41, 0x00, 0x05, 0x83, 0x02, 0x40, 0x07, 0x20, 0x45, 0x96,
+    0x1e, 0x1e, 0x1e, 0x1e, 0x57, 0x00, 0x81, 0x02, 0x0a, 0x46, 0x00, 0xdf,
+    0x1e, 0x1e, 0x1e, 0x1e, 0x97, 0x27, 0x81, 0x02, 0x03, 0x82, 0x02, 0x03,
+    0x40, 0x00, 0x2d, 0x81, 0x02, 0x03, 0x82, 0x02, 0x03, 0x40, 0x00, 0x16,
+    0x3f, 0x3f, 0x10, 0x40, 0x2b, 0x89, 0x03, 0x30, 0x40, 0x2b, 0x89, 0x03,
+    0x30, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x30, 0x40, 0x2b, 0x07, 0x81, 0x03,
+    0x30, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x30, 0x40, 0x2b, 0x07, 0x81, 0x03,
+    0x30, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x29, 0x40, 0x08, 0x83, 0x01, 0x40,
+    0x50, 0x81, 0x03, 0x07, 0x82, 0x03, 0xc0, 0x03, 0x03, 0x03, 0x01, 0x03,
+    0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x84,
+    0x01, 0x22, 0x40, 0x08, 0x83, 0x01, 0x4e, 0x9b, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xdb, 0x84, 0x01,
+    0x22, 0x40, 0x08, 0x80, 0x01, 0x03, 0x8c, 0x01, 0x03, 0x81, 0x01, 0x22,
+    0x40, 0x08, 0x80, 0x01, 0x14, 0x81, 0x01, 0x22, 0x40, 0x08, 0x80, 0x01,
+    0x14, 0x81, 0x01, 0x22, 0x40, 0x08, 0x80, 0x01, 0x14, 0x81, 0x01, 0x22,
+    0x40, 0x08, 0x80, 0x01, 0x14, 0x81, 0x01, 0x23, 0x83, 0x00, 0x40, 0x0b,
+    0x00, 0x40, 0x06, 0x81, 0x00, 0x40, 0x0d, 0x01, 0x80, 0x01, 0x40, 0x0a,
+    0x82, 0x00, 0x80, 0x01, 0x40, 0x18, 0x82, 0x00, 0x29, 0x40, 0x0b, 0x00,
+    0x40, 0x06, 0x01, 0x40, 0x0d, 0x01, 0x80, 0x01, 0x40, 0x0a, 0x00, 0x81,
+    0x00, 0x80, 0x01, 0x40, 0x18, 0x2c, 0x40, 0x0b, 0x00, 0x40, 0x06, 0x01,
+    0x40, 0x0d, 0x01, 0x80, 0x01, 0x40, 0x0a, 0x00, 0x81, 0x00, 0x80, 0x01,
+    0x40, 0x18, 0x2c, 0x40, 0x0b, 0x03, 0x40, 0x62, 0x02, 0xc0, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x40, 0x0c, 0x80, 0x01, 0x40, 0x18, 0x2c, 0x40, 0x0b,
+    0x03, 0x40, 0x18, 0x01, 0x80, 0x00, 0x40, 0x0b, 0x02, 0x80, 0x01, 0x40,
+    0x18, 0x2c, 0x40, 0x0b, 0x04, 0x42, 0x10, 0x10, 0x10, 0x03, 0x80, 0x01,
+    0x40, 0x18, 0x2a, 0x81, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x09, 0x81, 0x01,
+    0x40, 0x18, 0x80, 0x00, 0x28, 0x80, 0x02, 0x03, 0x40, 0x56, 0x07, 0x81,
+    0x01, 0x02, 0x81, 0x02, 0x40, 0x00, 0x23, 0x41, 0x63, 0x1f, 0x04, 0xc0,
+    0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x49, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x04, 0x41, 0xb8, 0x1f, 0x22, 0x40, 0x03, 0x80, 0x02,
+    0x04, 0x40, 0x2a, 0x01, 0x83, 0x03, 0x01, 0x81, 0x03, 0x04, 0x81, 0x02,
+    0x20, 0x41, 0x58, 0x1d, 0x06, 0x40, 0x2a, 0x01, 0x44, 0xdc, 0x13, 0x13,
+    0x13, 0xf3, 0x00, 0x81, 0x03, 0x05, 0x80, 0x02, 0x41, 0x1d, 0x72, 0x1e,
+    0x40, 0x01, 0x80, 0x02, 0x03, 0x81, 0x02, 0x00, 0x40, 0x2a, 0x81, 0x03,
+    0x40, 0x1b, 0x02, 0x40, 0x24, 0x82, 0x03, 0x81, 0x02, 0x03, 0x81, 0x02,
+    0x40, 0x07, 0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x42, 0x54, 0x21, 0x37,
+    0x00, 0x43, 0x5d, 0x12, 0x12, 0x49, 0x82, 0x02, 0x00, 0x42, 0x12, 0x12,
+    0x12, 0x80, 0x02, 0x42, 0x54, 0x21, 0x37, 0x01, 0x81, 0x02, 0x40, 0x07,
+    0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01,
+    0x03, 0x83, 0x02, 0x03, 0x80, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01,
+    0x01, 0x81, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x40,
+    0x07, 0x80, 0x00, 0x40, 0x01, 0x03, 0x40, 0x27, 0x01, 0x80, 0x03, 0x40,
+    0x29, 0x02, 0x80, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01, 0x01, 0x81,
+    0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x40, 0x07, 0x80,
+    0x00, 0x40, 0x01, 0x03, 0x40, 0x27, 0x82, 0x03, 0x40, 0x29, 0x02, 0x80,
+    0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01, 0x01, 0x81, 0x02, 0x40, 0x07,
+    0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01,
+    0x03, 0x40, 0x27, 0x82, 0x03, 0x40, 0x29, 0x02, 0x80, 0x02, 0x40, 0x07,
+    0x80, 0x00, 0x40, 0x01, 0x01, 0x81, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01,
+    0x80, 0x02, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01, 0x04, 0x43, 0x13,
+    0x13, 0x13, 0x75, 0x02, 0x80, 0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01,
+    0x01, 0x81, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x80, 0x02, 0x02, 0x40,
+    0x07, 0x80, 0x00, 0x40, 0x01, 0x0b, 0x80, 0x02, 0x40, 0x07, 0x80, 0x00,
+    0x40, 0x01, 0x01, 0x81, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x80, 0x02,
+    0x02, 0x40, 0x07, 0x80, 0x00, 0x40, 0x01, 0x0b, 0x80, 0x02, 0x40, 0x07,
+    0x80, 0x00, 0x40, 0x01, 0x01, 0x81, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01,
+    0x83, 0x02, 0x40, 0x07, 0x00, 0x40, 0x01, 0x0b, 0x80, 0x02, 0x40, 0x07,
+    0x80, 0x00, 0x40, 0x01, 0x83, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x83,
+    0x02, 0x40, 0x07, 0x00, 0x40, 0x01, 0x0b, 0x80, 0x02, 0x40, 0x07, 0x00,
+    0x40, 0x01, 0x83, 0x02, 0x40, 0x07, 0x1e, 0x40, 0x01, 0x83, 0x02, 0x40,
+    0x07, 0x00, 0x40, 0x01, 0x0b, 0x80, 0x02, 0x40, 0x07, 0x00, 0x40, 0x01,
+    0x83, 0x02, 0x40, 0x07, 0x25, 0x40, 0x01, 0x03, 0x83, 0x02, 0x03, 0x80,
+    0x02, 0x40, 0x07, 0x15, 0x3f, 0x14, 0x4b, 0xc7, 0x1a, 0x1a, 0x1a, 0x1a,
+    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x2d, 0x2f, 0x40, 0x2b, 0x89, 0x03,
+    0x40, 0x2d, 0x2e, 0x80, 0x00, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x40, 0x2d,
+    0x2e, 0x80, 0x00, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x40, 0x2d, 0x2e, 0x80,
+    0x00, 0x40, 0x2b, 0x07, 0x81, 0x03, 0x40, 0x2d, 0x2e, 0x80, 0x00, 0x40,
+    0x2b, 0x07, 0x81, 0x03, 0x40, 0x2d, 0x2e, 0x80, 0x00, 0x40, 0x2b, 0x07,
+    0x81, 0x03, 0x40, 0x2d, 0x28, 0x47, 0x09, 0x09, 0x09, 0x09, 0x09, 0x26,
+    0x26, 0x2b, 0x07, 0x81, 0x03, 0x47, 0xec, 0x26, 0xa1, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x20, 0x40, 0x0d, 0x84, 0x01, 0x40, 0x40, 0x80, 0x03, 0x08,
+    0x83, 0x03, 0x40, 0x3b, 0x84, 0x01, 0x20, 0x40, 0x0d, 0x04, 0x4e, 0xa6,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x02, 0x82, 0x01, 0x20, 0x40, 0x0d, 0x04, 0x8c, 0x01, 0x04,
+    0x82, 0x01, 0x20, 0x40, 0x0d, 0x16, 0x82, 0x01, 0x20, 0x40, 0x0d, 0x16,
+    0x82, 0x01, 0x20, 0x40, 0x0d, 0x16, 0x82, 0x01, 0x20, 0x40, 0x0d, 0x16,
+    0x82, 0x01, 0x26, 0x40, 0x39, 0x80, 0x01, 0x40, 0x36, 0x01, 0x40, 0x02,
+    0x01, 0x80, 0x01, 0x40, 0x38, 0x00, 0x42, 0x02, 0x02, 0x3f, 0x80, 0x01,
+    0x40, 0x36, 0x01, 0x42, 0x02, 0x02, 0x02, 0x26, 0x40, 0x08, 0x80, 0x01,
+    0x40, 0x06, 0x01, 0x80, 0x00, 0x01, 0x80, 0x01, 0x40, 0x18, 0x00, 0x81,
+    0x00, 0x40, 0x0b, 0x80, 0x01, 0x40, 0x06, 0x2b, 0x40, 0x08, 0x80, 0x01,
+    0x40, 0x06, 0x01, 0x80, 0x00, 0x01, 0x80, 0x01, 0x40, 0x18, 0x00, 0x81,
+    0x00, 0x40, 0x0b, 0x80, 0x01, 0x40, 0x06, 0x2b, 0x40, 0x08, 0x00, 0x40,
+    0x06, 0x82, 0x00, 0x82, 0x01, 0x40, 0x18, 0x82, 0x00, 0x40, 0x0b, 0x80,
+    0x01, 0x40, 0x06, 0x2b, 0x40, 0x08, 0x03, 0x80, 0x01, 0x01, 0x80, 0x00,
+    0x40, 0x0d, 0x02, 0x81, 0x01, 0x40, 0x06, 0x2b, 0x40, 0x08, 0x03, 0x80,
+    0x01, 0x43, 0x09, 0x09, 0x09, 0x4c, 0x02, 0x81, 0x01, 0x40, 0x06, 0x2b,
+    0x40, 0x08, 0x0b, 0x81, 0x01, 0x40, 0x06, 0x27, 0x43, 0x63, 0x1f, 0x1f,
+    0x1f, 0xc0, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x40, 0x35, 0x08, 0x81, 0x01, 0x45,
+    0xc1, 0x35, 0xf4, 0x1f, 0x1f, 0x1f, 0x23, 0x80, 0x00, 0x40, 0x01, 0x03,
+    0x80, 0x02, 0x40, 0x56, 0x89, 0x01, 0x40, 0x59, 0x01, 0x82, 0x02, 0x23,
+    0x41, 0x1d, 0x6c, 0x03, 0x80, 0x02, 0x4b, 0xf5, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xf2, 0x03, 0x80, 0x02, 0x41, 0x1d,
+    0x1d, 0x1f, 0x80, 0x00, 0x40, 0x05, 0x05, 0x80, 0x02, 0x40, 0x2a, 0x01,
+    0x83, 0x03, 0x01, 0x81, 0x03, 0x40, 0x29, 0x03, 0x82, 0x02, 0x1f, 0x41,
+    0x1d, 0x74, 0x02, 0x81, 0x02, 0x00, 0x80, 0x02, 0x40, 0x2a, 0x82, 0x03,
+    0x43, 0x13, 0x13, 0x13, 0x71, 0x82, 0x03, 0x40, 0x29, 0x80, 0x02, 0x03,
+    0x81, 0x02, 0x41, 0x1d, 0x72, 0x1c, 0x40, 0x05, 0x80, 0x02, 0x03, 0x81,
+    0x02, 0x01, 0x40, 0x2a, 0x82, 0x03, 0x02, 0x40, 0x27, 0x82, 0x03, 0x40,
+    0x29, 0x80, 0x02, 0x03, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80,
+    0x02, 0x03, 0x42, 0x3e, 0x21, 0x5e, 0x00, 0x43, 0x5d, 0x12, 0x12, 0x12,
+    0x81, 0x02, 0x01, 0x43, 0x12, 0x12, 0x12, 0x76, 0x80, 0x02, 0x42, 0x4a,
+    0x21, 0x5e, 0x00, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80, 0x02,
+    0x03, 0x40, 0x04, 0x00, 0x40, 0x03, 0x03, 0x83, 0x02, 0x03, 0x81, 0x02,
+    0x40, 0x00, 0x80, 0x00, 0x40, 0x03, 0x00, 0x82, 0x02, 0x40, 0x07, 0x1c,
+    0x40, 0x05, 0x80, 0x02, 0x03, 0x40, 0x04, 0x00, 0x40, 0x03, 0x03, 0x80,
+    0x02, 0x43, 0x2f, 0x2f, 0x2f, 0x81, 0x02, 0x81, 0x02, 0x40, 0x00, 0x80,
+    0x00, 0x40, 0x03, 0x00, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80,
+    0x02, 0x03, 0x40, 0x04, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x82, 0x03,
+    0x40, 0x1b, 0x02, 0x81, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40, 0x03, 0x00,
+    0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80, 0x02, 0x03, 0x40, 0x04,
+    0x00, 0x40, 0x03, 0x04, 0x82, 0x03, 0x40, 0x1b, 0x02, 0x81, 0x02, 0x40,
+    0x00, 0x80, 0x00, 0x40, 0x03, 0x00, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40,
+    0x05, 0x80, 0x02, 0x03, 0x40, 0x04, 0x00, 0x40, 0x03, 0x04, 0x82, 0x03,
+    0x40, 0x1b, 0x02, 0x81, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40, 0x03, 0x00,
+    0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80, 0x02, 0x03, 0x40, 0x04,
+    0x00, 0x40, 0x03, 0x0b, 0x81, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40, 0x03,
+    0x00, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x80, 0x02, 0x03, 0x40,
+    0x04, 0x00, 0x40, 0x03, 0x0b, 0x81, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40,
+    0x03, 0x00, 0x82, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x84, 0x02, 0x40,
+    0x04, 0x00, 0x40, 0x03, 0x0b, 0x81, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40,
+    0x03, 0x83, 0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x84, 0x02, 0x40, 0x04,
+    0x00, 0x40, 0x03, 0x0b, 0x81, 0x02, 0x40, 0x00, 0x00, 0x40, 0x03, 0x83,
+    0x02, 0x40, 0x07, 0x1c, 0x40, 0x05, 0x84, 0x02, 0x40, 0x04, 0x00, 0x40,
+    0x03, 0x0b, 0x81, 0x02, 0x40, 0x00, 0x00, 0x40, 0x03, 0x83, 0x02, 0x40,
+    0x07, 0x0d, 0x16, 0x4b, 0xb9, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x2f, 0x40, 0x25, 0x8a, 0x03, 0x40, 0x33, 0x2e,
+    0x40, 0x25, 0x81, 0x03, 0x08, 0x40, 0x33, 0x2e, 0x40, 0x25, 0x81, 0x03,
+    0x08, 0x40, 0x33, 0x2e, 0x40, 0x25, 0x81, 0x03, 0x08, 0x40, 0x33, 0x2e,
+    0x40, 0x25, 0x81, 0x03, 0x08, 0x40, 0x33, 0x2e, 0x40, 0x25, 0x81, 0x03,
+    0x08, 0x40, 0x33, 0x2e, 0x40, 0x25, 0x81, 0x03, 0x08, 0x40, 0x33, 0x26,
+    0x48, 0xd9, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x68, 0x23, 0x69, 0x81, 0x03,
+    0x08, 0x47, 0xcc, 0x23, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1f, 0x40,
+    0x0b, 0x82, 0x01, 0x01, 0x40, 0x50, 0x81, 0x03, 0x0c, 0x40, 0x3b, 0x04,
+    0x40, 0x06, 0x1e, 0x40, 0x0b, 0x82, 0x01, 0x01, 0x50, 0xcd, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x8e, 0x04, 0x40, 0x06, 0x1e, 0x40, 0x0b, 0x82, 0x01, 0x17, 0x40,
+    0x06, 0x1e, 0x40, 0x0b, 0x82, 0x01, 0x17, 0x40, 0x06, 0x1e, 0x40, 0x0b,
+    0x82, 0x01, 0x17, 0x40, 0x06, 0x1e, 0x40, 0x0b, 0x82, 0x01, 0x17, 0x40,
+    0x06, 0x1e, 0x40, 0x0b, 0x82, 0x01, 0x17, 0x40, 0x06, 0x1e, 0x46, 0xf6,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x77, 0x80, 0x01, 0x44, 0x5f, 0x0f, 0x0f,
+    0x0f, 0x77, 0x80, 0x01, 0x01, 0x44, 0x78, 0x0f, 0x0f, 0x0f, 0xa7, 0x00,
+    0x45, 0x78, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0xfb, 0x07, 0x05, 0x07,
+    0x06, 0x04, 0x05, 0x07, 0x06, 0x04, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06,
+    0x04, 0x05, 0x07, 0x04, 0x06, 0x07, 0x05, 0x05, 0x06, 0x07, 0x06, 0x07,
+    0x06, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06,
+    0x06, 0x07, 0x05, 0x05, 0x07, 0x07, 0x05, 0x07, 0x07, 0x07, 0x06, 0x05,
+    0x05, 0x06, 0x05, 0x04, 0x05, 0x07, 0x07, 0x07, 0x04, 0x04, 0x07, 0x06,
+    0x07, 0x06, 0x07, 0x05, 0x04, 0x05, 0x07, 0x04, 0x05, 0x05, 0x05, 0x04,
+    0x07, 0x04, 0x07, 0x04, 0x04, 0x06, 0x04, 0x05, 0x07, 0x04, 0x07, 0x04,
+    0x07, 0x06, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x04, 0x05, 0x04, 0x07,
+    0x04, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x06, 0x07, 0x05, 0x06, 0x05,
+    0x07, 0x05, 0x05, 0x07, 0x05, 0x07, 0x06, 0x06, 0x04, 0x06, 0x05, 0x05,
+    0x07, 0x04, 0x07, 0x07, 0x07, 0x06, 0x04, 0x06, 0x05, 0x04, 0x04, 0x06,
+    0x07, 0x07, 0x04, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x04, 0x04,
+    0x05, 0x05, 0x06, 0x06, 0x04, 0x07, 0x06, 0x07, 0x06, 0x04, 0x06, 0x07,
+    0x07, 0x04, 0x06, 0x04, 0x06, 0x05, 0x05, 0x04, 0x04, 0x06, 0x07, 0x05,
+    0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x05, 0x06,
+    0x06, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x07, 0x04, 0x06, 0x06, 0x05,
+    0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x07, 0x06, 0x04,
+    0x05, 0x05, 0x07, 0x07, 0x04, 0x04, 0x07, 0x05, 0x07, 0x04, 0x06, 0x05,
+    0x06, 0x06, 0x06, 0x04, 0x04, 0x07, 0x05, 0x07, 0x07, 0x06, 0x07, 0x05,
+    0x06, 0x05, 0x04, 0x06, 0x05, 0x06, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07,
+    0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x07, 0x04,
+    0x05, 0x04, 0x05, 0x04, 0x04, 0x07, 0x06, 0x07, 0x04, 0x06, 0x06, 0x05,
+    0x04, 0x04, 0x05, 0x07, 0x04, 0x04, 0x06, 0x05, 0x07, 0x05, 0x06, 0x05,
+    0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 0x07, 0x05, 0x07, 0x05, 0x07, 0x06,
+    0x05, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x04, 0x04, 0x04, 0x06, 0x07,
+    0x04, 0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x05, 0x06, 0x04, 0x04, 0x04,
+    0x06, 0x05, 0x05, 0x04, 0x06, 0x07, 0x06, 0x06, 0x06, 0x04, 0x07, 0x07,
+    0x07, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x05, 0x05, 0x04, 0x07, 0x06,
+    0x04, 0x04, 0x06, 0x07, 0x05, 0x06, 0x07, 0x04, 0x04, 0x04, 0x07, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 0x06, 0x04, 0x07, 0x07, 0x05,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x06, 0x07, 0x07, 0x04, 0x05, 0x07, 0x07,
+    0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04, 0x07,
+    0x06, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x06,
+    0x05, 0x06, 0x06, 0x07, 0x04, 0x07, 0x06, 0x07, 0x04, 0x05, 0x06, 0x07,
+    0x07, 0x04, 0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x07, 0x07, 0x04,
+    0x07, 0x07, 0x04, 0x07, 0x07, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05,
+    0x05, 0x07, 0x04, 0x05, 0x05, 0x04, 0x07, 0x06, 0x06, 0x07, 0x04, 0x05,
+    0x04, 0x07, 0x07, 0x07, 0x05, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x07,
+    0x05, 0x05, 0x07, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x05, 0x07, 0x07,
+    0x04, 0x07, 0x04, 0x06, 0x05, 0x06, 0x04, 0x04, 0x04, 0x06, 0x05, 0x04,
+    0x06, 0x07, 0x06, 0x07, 0x05, 0x05, 0x04, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x06, 0x05, 0x06, 0x06, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x05, 0x06,
+    0x04, 0x05, 0x07, 0x07, 0x07, 0x05, 0x07, 0x04, 0x04, 0x07, 0x06, 0x07,
+    0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x04, 0x04,
+    0x06, 0x04, 0x04, 0x05, 0x05, 0x04, 0x06, 0x04, 0x04, 0x06, 0x05, 0x05,
+    0x04, 0x04, 0x07, 0x04, 0x05, 0x07, 0x07, 0x05, 0x05, 0x06, 0x06, 0x05,
+    0x05, 0x05, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05,
+    0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x05, 0x05, 0x07, 0x04, 0x07, 0x07,
+    0x04, 0x07, 0x07, 0x07, 0x06, 0x04, 0x07, 0x05, 0x04, 0x06, 0x07, 0x04,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x04, 0x06, 0x07, 0x05, 0x04, 0x07, 0x06,
+    0x07, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x04, 0x06,
+    0x07, 0x06, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04, 0x07, 0x06, 0x07, 0x07,
+    0x07, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x07, 0x06, 0x05, 0x06, 0x07,
+    0x05, 0x04, 0x07, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06,
+    0x06, 0x05, 0x07, 0x05, 0x05, 0x06, 0x04, 0x07, 0x05, 0x07, 0x05, 0x06,
+    0x04, 0x04, 0x06, 0x04, 0x04, 0x05, 0x06, 0x07, 0x04, 0x04, 0x07, 0x06,
+    0x07, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x06, 0x05, 0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x06,
+    0x07, 0x05, 0x04, 0x07, 0x07, 0x06, 0x07, 0x04, 0x04, 0x06, 0x04, 0x06,
+    0x06, 0x06, 0x05, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x04, 0x05, 0x06,
+    0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x04, 0x06, 0x04, 0x05, 0x06, 0x04,
+    0x05, 0x06, 0x06, 0x04, 0x04, 0x07, 0x04, 0x05, 0x04, 0x04, 0x06, 0x05,
+    0x05, 0x04, 0x04, 0x05, 0x06, 0x04, 0x07, 0x04, 0x05, 0x06, 0x05, 0x05,
+    0x05, 0x04, 0x06, 0x06, 0x05, 0x05, 0x07, 0x05, 0x07, 0x06, 0x05, 0x05,
+    0x06, 0x04, 0x07, 0x05, 0x06, 0x06, 0x04, 0x06, 0x06, 0x05, 0x05, 0x07,
+    0x05, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04, 0x04, 0x06, 0x06, 0x05, 0x06,
+    0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x05, 0x07, 0x06, 0x06, 0x06, 0x05, 0x06, 0x07, 0x04, 0x05,
+    0x07, 0x07, 0x05, 0x04, 0x04, 0x07, 0x05, 0x06, 0x04, 0x07, 0x07, 0x04,
+    0x07, 0x04, 0x05, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x07, 0x05, 0x05,
+    0x06, 0x04, 0x07, 0x06, 0x04, 0x04, 0x05, 0x05, 0x04, 0x07, 0x07, 0x04,
+    0x04, 0x06, 0x05, 0x07, 0x07, 0x06, 0x04, 0x07, 0x07, 0x05, 0x04, 0x04,
+    0x04, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x06, 0x07, 0x04, 0x04,
+    0x05, 0x06, 0x05, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x05, 0x06, 0x04,
+    0x05, 0x07, 0x07, 0x05, 0x05, 0x04, 0x05, 0x04, 0x07, 0x04, 0x04, 0x07,
+    0x07, 0x05, 0x04, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x07, 0x04, 0x06,
+    0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x07, 0x04, 0x06, 0x05, 0x06,
+    0x07, 0x07, 0x05, 0x07, 0x07, 0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x04,
+    0x05, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x04, 0x07, 0x04, 0x04, 0x05,
+    0x04, 0x07, 0x05, 0x07, 0x06, 0x04, 0x07, 0x04, 0x06, 0x14, 0x40, 0x0b,
+    0x80, 0x01, 0x40, 0x0a, 0x81, 0x00, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x01,
+    0x40, 0x06, 0x80, 0x00, 0x01, 0x40, 0x08, 0x00, 0x40, 0x06, 0x2a, 0x40,
+    0x0b, 0x80, 0x01, 0x40, 0x0a, 0x82, 0x00, 0x40, 0x0b, 0x82, 0x01, 0x40,
+    0x06, 0x82, 0x00, 0x40, 0x08, 0x00, 0x40, 0x06, 0x2a, 0x40, 0x0b, 0x80,
+    0x01, 0x4b, 0x79, 0x10, 0x10, 0x10, 0xe2, 0x02, 0x02, 0x02, 0xe3, 0x10,
+    0x10, 0x10, 0x01, 0x40, 0x06, 0x2a, 0x40, 0x0b, 0x81, 0x01, 0x02, 0x40,
+    0x0a, 0x82, 0x00, 0x40, 0x08, 0x04, 0x40, 0x06, 0x2a, 0x40, 0x0b, 0x81,
+    0x01, 0x03, 0x42, 0x10, 0x10, 0x10, 0x05, 0x40, 0x06, 0x29, 0x80, 0x00,
+    0x40, 0x0b, 0x83, 0x01, 0x09, 0x80, 0x01, 0x40, 0x06, 0x83, 0x00, 0x22,
+    0x46, 0x41, 0x15, 0x15, 0x15, 0x92, 0x30, 0xd1, 0x8a, 0x01, 0x46, 0x80,
+    0x30, 0x93, 0x15, 0x15, 0x15, 0x5b, 0x80, 0x00, 0x21, 0x40, 0x01, 0x80,
+    0x02, 0x03, 0x40, 0x4e, 0x8a, 0x01, 0xc0, 0x01, 0x02, 0x02, 0x02, 0x01,
+    0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x04,
+    0x40, 0x00, 0x80, 0x00, 0x1f, 0x42, 0x41, 0x15, 0xa8, 0x04, 0x4c, 0x6a,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xd3,
+    0x04, 0x42, 0x65, 0x15, 0x5b, 0x80, 0x00, 0x1d, 0x40, 0x01, 0x80, 0x02,
+    0x05, 0x40, 0x24, 0x81, 0x03, 0x01, 0x84, 0x03, 0x01, 0x40, 0x28, 0x06,
+    0x40, 0x00, 0x80, 0x00, 0x1b, 0x42, 0x41, 0x15, 0xa8, 0x80, 0x02, 0x03,
+    0x81, 0x02, 0x40, 0x24, 0x82, 0x03, 0x40, 0x29, 0x00, 0x42, 0x12, 0x12,
+    0xa3, 0x82, 0x03, 0x40, 0x28, 0x00, 0x82, 0x02, 0x02, 0x42, 0x65, 0x15,
+    0x5b, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x03, 0x81, 0x02, 0x40, 0x24, 0x82,
+    0x03, 0x40, 0x29, 0x02, 0x40, 0x2a, 0x82, 0x03, 0x40, 0x28, 0x00, 0x82,
+    0x02, 0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01,
+    0x42, 0x3e, 0x21, 0x37, 0x80, 0x02, 0x43, 0x48, 0x12, 0x12, 0x12, 0x00,
+    0x82, 0x02, 0x43, 0x5d, 0x12, 0x12, 0x12, 0x01, 0x42, 0x4a, 0x21, 0x5e,
+    0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01, 0x40,
+    0x04, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x03, 0x84, 0x02, 0x03, 0x40,
+    0x00, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01,
+    0x82, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x02,
+    0x44, 0x9d, 0x2f, 0x2f, 0x2f, 0x6f, 0x80, 0x02, 0x03, 0x40, 0x00, 0x00,
+    0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02,
+    0x01, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x02, 0x40, 0x24,
+    0x82, 0x03, 0x40, 0x28, 0x80, 0x02, 0x03, 0x40, 0x00, 0x00, 0x40, 0x03,
+    0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01, 0x40,
+    0x04, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x02, 0x40, 0x24, 0x82, 0x03,
+    0x40, 0x28, 0x04, 0x40, 0x00, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40,
+    0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x40,
+    0x01, 0x81, 0x02, 0x02, 0x40, 0x24, 0x82, 0x03, 0x40, 0x28, 0x04, 0x40,
+    0x00, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01,
+    0x82, 0x02, 0x01, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x03,
+    0x42, 0x12, 0x12, 0x12, 0x05, 0x40, 0x00, 0x00, 0x40, 0x03, 0x03, 0x80,
+    0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01, 0x40, 0x04, 0x80,
+    0x00, 0x40, 0x01, 0x81, 0x02, 0x0c, 0x40, 0x00, 0x00, 0x40, 0x03, 0x03,
+    0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x82, 0x02, 0x01, 0x40, 0x04,
+    0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x0c, 0x40, 0x00, 0x00, 0x40, 0x03,
+    0x03, 0x80, 0x02, 0x40, 0x00, 0x1a, 0x40, 0x01, 0x84, 0x02, 0x40, 0x04,
+    0x00, 0x40, 0x01, 0x81, 0x02, 0x0c, 0x40, 0x00, 0x00, 0x40, 0x03, 0x84,
+    0x02, 0x40, 0x00, 0x0d, 0x18, 0x4b, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2e, 0x40, 0x2e, 0x8b, 0x03, 0x40,
+    0x2d, 0x2d, 0x40, 0x2e, 0x80, 0x03, 0x09, 0x80, 0x03, 0x40, 0x2d, 0x2d,
+    0x40, 0x2e, 0x80, 0x03, 0x09, 0x80, 0x03, 0x40, 0x2d, 0x2d, 0x40, 0x2e,
+    0x80, 0x03, 0x09, 0x80, 0x03, 0x40, 0x2d, 0x2d, 0x40, 0x2e, 0x80, 0x03,
+    0x09, 0x80, 0x03, 0x40, 0x2d, 0x2d, 0x40, 0x2e, 0x80, 0x03, 0x09, 0x80,
+    0x03, 0x40, 0x2d, 0x2d, 0x40, 0x2e, 0x80, 0x03, 0x09, 0x80, 0x03, 0x40,
+    0x2d, 0x27, 0x85, 0x00, 0x40, 0x2e, 0x80, 0x03, 0x09, 0x80, 0x03, 0x40,
+    0x2d, 0x85, 0x00, 0x1f, 0x48, 0xe5, 0x10, 0x10, 0x10, 0x10, 0x10, 0xe6,
+    0x1a, 0xb3, 0x0c, 0x47, 0x1a, 0xf7, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf8,
+    0x1d, 0x40, 0x0b, 0x80, 0x01, 0x03, 0x40, 0xa9, 0x8f, 0x03, 0x40, 0x60,
+    0x03, 0x80, 0x01, 0x40, 0x18, 0x1d, 0x40, 0x0b, 0x80, 0x01, 0x04, 0x4f,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x04, 0x80, 0x01, 0x40, 0x18, 0x1d, 0x40, 0x0b,
+    0x80, 0x01, 0x19, 0x80, 0x01, 0x40, 0x18, 0x1d, 0x40, 0x0b, 0x80, 0x01,
+    0x19, 0x80, 0x01, 0x40, 0x18, 0x1d, 0x40, 0x0b, 0x80, 0x01, 0x19, 0x80,
+    0x01, 0x40, 0x18, 0x1d, 0x40, 0x0b, 0x80, 0x01, 0x19, 0x80, 0x01, 0x40,
+    0x18, 0x1d, 0x40, 0x0b, 0x86, 0x01, 0x00, 0x83, 0x01, 0x02, 0x84, 0x01,
+    0x00, 0x86, 0x01, 0x40, 0x18, 0x1d, 0x46, 0xf6, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0xaa, 0x80, 0x01, 0x00, 0x43, 0x0f, 0x0f, 0x0f, 0x0f, 0x02, 0x80,
+    0x01, 0x44, 0x78, 0x0f, 0x0f, 0x0f, 0x77, 0x80, 0x01, 0x46, 0x5f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x23, 0x40, 0x0d, 0x80, 0x01, 0x40, 0x18,
+    0x80, 0x00, 0x05, 0x80, 0x01, 0x40, 0x06, 0x01, 0x80, 0x00, 0x40, 0x0b,
+    0x80, 0x01, 0x40, 0x0a, 0x29, 0x40, 0x0d, 0x80, 0x01, 0x00, 0x80, 0x00,
+    0x05, 0x80, 0x01, 0x40, 0x06, 0x01, 0x80, 0x00, 0x40, 0x0b, 0x80, 0x01,
+    0x40, 0x0a, 0x29, 0x40, 0x0d, 0x80, 0x01, 0x40, 0x18, 0x83, 0x00, 0x83,
+    0x01, 0x40, 0x06, 0x82, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x40, 0x0a, 0x29,
+    0x40, 0x0d, 0x80, 0x01, 0x4d, 0x7c, 0x09, 0x09, 0x09, 0x09, 0x17, 0x17,
+    0x17, 0x17, 0xab, 0x09, 0x09, 0x09, 0x98, 0x80, 0x01, 0x40, 0x0a, 0x29,
+    0x40, 0x0d, 0x80, 0x01, 0x04, 0x83, 0x00, 0x40, 0x08, 0x03, 0x80, 0x01,
+    0x40, 0x0a, 0x26, 0x82, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x03, 0x44, 0x09,
+    0x09, 0x09, 0x09, 0x7e, 0x02, 0x81, 0x01, 0x40, 0x0a, 0x81, 0x00, 0x24,
+    0x82, 0x00, 0x40, 0x0d, 0x82, 0x01, 0x09, 0x82, 0x01, 0x40, 0x0a, 0x81,
+    0x00, 0x23, 0x83, 0x00, 0x40, 0x0d, 0x8f, 0x01, 0x40, 0x0a, 0x83, 0x00,
+    0x20, 0x80, 0x00, 0x40, 0x01, 0x04, 0x40, 0x4f, 0x8b, 0x01, 0x40, 0x59,
+    0x04, 0x40, 0x07, 0x1f, 0x81, 0x00, 0x40, 0x01, 0x04, 0x40, 0x4f, 0x8b,
+    0x01, 0x40, 0x59, 0x04, 0x40, 0x07, 0x81, 0x00, 0x1c, 0x80, 0x00, 0x40,
+    0x01, 0x06, 0x40, 0x27, 0x80, 0x03, 0x02, 0x83, 0x03, 0x02, 0x80, 0x03,
+    0x40, 0x29, 0x24, 0x80, 0x00, 0x40, 0x01, 0x03, 0x82, 0x02, 0x40, 0x27,
+    0x8b, 0x03, 0x40, 0x29, 0x82, 0x02, 0x20, 0x41, 0x3d, 0x15, 0x04, 0x82,
+    0x02, 0x40, 0x27, 0x83, 0x03, 0x44, 0x12, 0x12, 0x12, 0x12, 0xa3, 0x82,
+    0x03, 0x40, 0x29, 0x82, 0x02, 0x03, 0x42, 0xfa, 0x15, 0x15, 0x19, 0x40,
+    0x03, 0x80, 0x02, 0x04, 0x82, 0x02, 0x40, 0x27, 0x83, 0x03, 0x83, 0x02,
+    0x40, 0x2a, 0x82, 0x03, 0x40, 0x29, 0x82, 0x02, 0x03, 0x82, 0x02, 0x19,
+    0x40, 0x03, 0x80, 0x02, 0x03, 0x42, 0x3e, 0x21, 0x84, 0x80, 0x02, 0x00,
+    0x43, 0x12, 0x12, 0x12, 0x12, 0x83, 0x02, 0x43, 0x5d, 0x12, 0x12, 0x12,
+    0x00, 0x80, 0x02, 0x42, 0x3e, 0x21, 0x37, 0x02, 0x82, 0x02, 0x19, 0x40,
+    0x03, 0x80, 0x02, 0x03, 0x40, 0x04, 0x80, 0x00, 0x40, 0x05, 0x80, 0x02,
+    0x04, 0x83, 0x02, 0x04, 0x80, 0x02, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01,
+    0x02, 0x82, 0x02, 0x19, 0x40, 0x03, 0x80, 0x02, 0x03, 0x40, 0x04, 0x80,
+    0x00, 0x40, 0x05, 0x80, 0x02, 0x04, 0x44, 0x2f, 0x2f, 0x2f, 0x2f, 0x6f,
+    0x03, 0x80, 0x02, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02,
+    0x19, 0x40, 0x03, 0x80, 0x02, 0x03, 0x40, 0x04, 0x80, 0x00, 0x40, 0x05,
+    0x80, 0x02, 0x04, 0x83, 0x03, 0x40, 0x28, 0x03, 0x80, 0x02, 0x40, 0x04,
+    0x80, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x19, 0x40, 0x03, 0x80, 0x02,
+    0x03, 0x40, 0x04, 0x80, 0x00, 0x40, 0x05, 0x80, 0x02, 0x04, 0x83, 0x03,
+    0x40, 0x28, 0x03, 0x80, 0x02, 0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x02,
+    0x82, 0x02, 0x19, 0x40, 0x03, 0x80, 0x02, 0x03, 0x40, 0x04, 0x80, 0x00,
+    0x40, 0x05, 0x80, 0x02, 0x04, 0x83, 0x03, 0x40, 0x28, 0x03, 0x80, 0x02,
+    0x40, 0x04, 0x80, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x19, 0x40, 0x03,
+    0x80, 0x02, 0x03, 0x40, 0x04, 0x80, 0x00, 0x40, 0x05, 0x80, 0x02, 0x04,
+    0x43, 0x13, 0x13, 0x13, 0x13, 0x04, 0x80, 0x02, 0x40, 0x04, 0x80, 0x00,
+    0x40, 0x01, 0x02, 0x82, 0x02, 0x19, 0x40, 0x03, 0x80, 0x02, 0x03, 0x40,
+    0x04, 0x80, 0x00, 0x40, 0x05, 0x80, 0x02, 0x0d, 0x80, 0x02, 0x40, 0x04,
+    0x80, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x0b, 0x15, 0x40, 0x25, 0x8b,
+    0x03, 0x40, 0x19, 0x2d, 0x40, 0x25, 0x80, 0x03, 0x0a, 0x40, 0x19, 0x2d,
+    0x40, 0x25, 0x80, 0x03, 0x0a, 0x40, 0x19, 0x2d, 0x40, 0x25, 0x80, 0x03,
+    0x0a, 0x40, 0x19, 0x2d, 0x40, 0x25, 0x80, 0x03, 0x0a, 0x40, 0x19, 0x2d,
+    0x40, 0x25, 0x80, 0x03, 0x0a, 0x40, 0x19, 0x2d, 0x40, 0x25, 0x80, 0x03,
+    0x0a, 0x40, 0x19, 0x2d, 0x40, 0x25, 0x80, 0x03, 0x0a, 0x40, 0x19, 0x25,
+    0x41, 0x0c, 0x0c, 0x03, 0x42, 0x23, 0x23, 0x69, 0x80, 0x03, 0x0a, 0x40,
+    0x6e, 0x00, 0x40, 0x23, 0x04, 0x41, 0x0c, 0x8d, 0x1b, 0x40, 0x0d, 0x81,
+    0x01, 0x03, 0x40, 0x40, 0x80, 0x03, 0x0e, 0x80, 0x03, 0x04, 0x80, 0x01,
+    0x40, 0x0a, 0x1b, 0x40, 0x0d, 0x81, 0x01, 0x03, 0xc0, 0x01, 0x03, 0x03,
+    0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01,
+    0x01, 0x50, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x04, 0x80, 0x01, 0x40, 0x0a,
+    0x1b, 0x40, 0x0d, 0x81, 0x01, 0x1a, 0x80, 0x01, 0x40, 0x0a, 0x1b, 0x40,
+    0x0d, 0x81, 0x01, 0x1a, 0x80, 0x01, 0x40, 0x0a, 0x1b, 0x40, 0x0d, 0x81,
+    0x01, 0x1a, 0x80, 0x01, 0x40, 0x0a, 0x1b, 0x40, 0x0d, 0x81, 0x01, 0x1a,
+    0x80, 0x01, 0x40, 0x0a, 0x1b, 0x40, 0x0d, 0x81, 0x01, 0x1a, 0x80, 0x01,
+    0x40, 0x0a, 0x1b, 0x40, 0x0d, 0x87, 0x01, 0x00, 0x84, 0x01, 0x02, 0x83,
+    0x01, 0x01, 0x86, 0x01, 0x40, 0x0a, 0x0e, 0x8c, 0x00, 0x47, 0x7b, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x39, 0x80, 0x01, 0x44, 0x52, 0x02, 0x02,
+    0x02, 0x02, 0x83, 0x01, 0x44, 0x36, 0x02, 0x02, 0x02, 0x3a, 0x81, 0x01,
+    0x46, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xac, 0x8e, 0x00, 0x13, 0x40,
+    0x08, 0x80, 0x01, 0x40, 0x0a, 0x80, 0x00, 0x02, 0x80, 0x01, 0x06, 0x40,
+    0x0d, 0x00, 0x80, 0x01, 0x29, 0x40, 0x08, 0x80, 0x01, 0x40, 0x0a, 0x80,
+    0x00, 0x02, 0x80, 0x01, 0x06, 0x40, 0x0d, 0x00, 0x80, 0x01, 0x29, 0x40,
+    0x08, 0x80, 0x01, 0x40, 0x0a, 0x83, 0x00, 0x83, 0x01, 0x40, 0x06, 0x82,
+    0x00, 0x40, 0x0d, 0x00, 0x80, 0x01, 0x29, 0x40, 0x08, 0x80, 0x01, 0x4d,
+    0xad, 0x09, 0x09, 0x09, 0x09, 0x17, 0x17, 0x17, 0x17, 0xab, 0x09, 0x09,
+    0x09, 0x4c, 0x00, 0x80, 0x01, 0x29, 0x40, 0x08, 0x80, 0x01, 0x04, 0x83,
+    0x00, 0x40, 0x08, 0x04, 0x80, 0x01, 0x29, 0x40, 0x08, 0x80, 0x01, 0x04,
+    0x83, 0x00, 0x40, 0x08, 0x04, 0x80, 0x01, 0x26, 0x82, 0x00, 0x40, 0x08,
+    0x82, 0x01, 0x0a, 0x82, 0x01, 0x83, 0x00, 0x22, 0x82, 0x00, 0x40, 0x08,
+    0x82, 0x01, 0x0a, 0x82, 0x01, 0x83, 0x00, 0x20, 0x40, 0x05, 0x80, 0x02,
+    0x04, 0x40, 0x4e, 0x8b, 0x01, 0x40, 0x32, 0x04, 0x80, 0x02, 0x40, 0x04,
+    0x80, 0x00, 0x1e, 0x40, 0x05, 0x05, 0x40, 0x4e, 0x8b, 0x01, 0x40, 0x32,
+    0x05, 0x40, 0x04, 0x80, 0x00, 0x1c, 0x40, 0xfb, 0x07, 0x4d, 0x6a, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xae,
+    0x07, 0x40, 0x42, 0x80, 0x00, 0x1a, 0x40, 0x05, 0x07, 0x40, 0x24, 0x80,
+    0x03, 0x02, 0x84, 0x03, 0x02, 0x40, 0x1b, 0x07, 0x40, 0x04, 0x80, 0x00,
+    0x18, 0x42, 0x58, 0x1d, 0x74, 0x04, 0x82, 0x02, 0x40, 0x24, 0x83, 0x03,
+    0x44, 0x13, 0x13, 0x13, 0x13, 0xfc, 0x82, 0x03, 0x40, 0x1b, 0x00, 0x82,
+    0x02, 0x03, 0x42, 0x5c, 0x1d, 0x72, 0x17, 0x40, 0x01, 0x81, 0x02, 0x04,
+    0x82, 0x02, 0x40, 0x24, 0x83, 0x03, 0x03, 0x40, 0x2a, 0x82, 0x03, 0x40,
+    0x1b, 0x00, 0x82, 0x02, 0x04, 0x80, 0x02, 0x40, 0x07, 0x17, 0x40, 0x01,
+    0x81, 0x02, 0x03, 0x42, 0x1e, 0x1e, 0x7a, 0x80, 0x02, 0x44, 0x9e, 0x20,
+    0x20, 0x20, 0x20, 0x83, 0x02, 0x44, 0x46, 0x20, 0x20, 0x20, 0x51, 0x00,
+    0x80, 0x02, 0x41, 0x1e, 0x1e, 0x04, 0x80, 0x02, 0x40, 0x07, 0x17, 0x40,
+    0x01, 0x81, 0x02, 0x03, 0x81, 0x00, 0x40, 0x03, 0x80, 0x02, 0x04, 0x84,
+    0x02, 0x04, 0x80, 0x02, 0x00, 0x80, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02,
+    0x40, 0x07, 0x17, 0x40, 0x01, 0x81, 0x02, 0x03, 0x81, 0x00, 0x40, 0x03,
+    0x80, 0x02, 0x04, 0x84, 0x02, 0x04, 0x80, 0x02, 0x00, 0x80, 0x00, 0x40,
+    0x03, 0x03, 0x80, 0x02, 0x40, 0x07, 0x17, 0x40, 0x01, 0x81, 0x02, 0x03,
+    0x81, 0x00, 0x40, 0x03, 0x80, 0x02, 0x04, 0x80, 0x03, 0x08, 0x80, 0x02,
+    0x00, 0x80, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x07, 0x17, 0x40,
+    0x01, 0x81, 0x02, 0x03, 0x81, 0x00, 0x40, 0x03, 0x80, 0x02, 0x04, 0x83,
+    0x03, 0x40, 0x28, 0x04, 0x80, 0x02, 0x00, 0x80, 0x00, 0x40, 0x03, 0x03,
+    0x80, 0x02, 0x40, 0x07, 0x17, 0x40, 0x01, 0x81, 0x02, 0x03, 0x81, 0x00,
+    0x40, 0x03, 0x80, 0x02, 0x04, 0x83, 0x03, 0x40, 0x28, 0x04, 0x80, 0x02,
+    0x00, 0x80, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x07, 0x17, 0x40,
+    0x01, 0x81, 0x02, 0x03, 0x81, 0x00, 0x40, 0x03, 0x80, 0x02, 0x04, 0x83,
+    0x03, 0x40, 0x28, 0x04, 0x80, 0x02, 0x00, 0x80, 0x00, 0x40, 0x03, 0x03,
+    0x80, 0x02, 0x40, 0x07, 0x17, 0x40, 0x01, 0x81, 0x02, 0x03, 0x81, 0x00,
+    0x40, 0x03, 0x80, 0x02, 0x04, 0x43, 0x13, 0x13, 0x13, 0x13, 0x05, 0x80,
+    0x02, 0x00, 0x80, 0x00, 0x40, 0x03, 0x03, 0x80, 0x02, 0x40, 0x07, 0x0c,
+    0x16, 0x8c, 0x03, 0x40, 0x19, 0x2d, 0x81, 0x03, 0x0a, 0x40, 0x19, 0x80,
+    0x00, 0x2c, 0x81, 0x03, 0x0a, 0x40, 0x19, 0x80, 0x00, 0x2c, 0x81, 0x03,
+    0x0a, 0x40, 0x19, 0x80, 0x00, 0x2c, 0x81, 0x03, 0x0a, 0x40, 0x19, 0x80,
+    0x00, 0x2c, 0x81, 0x03, 0x0a, 0x40, 0x19, 0x80, 0x00, 0x23, 0x48, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0xbb, 0x26, 0x26, 0x81, 0x03, 0x0a, 0x49,
+    0xbc, 0x26, 0x26, 0xa1, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x1a, 0x40,
+    0x0b, 0x85, 0x01, 0x40, 0x50, 0x83, 0x03, 0x0b, 0x81, 0x03, 0x40, 0x3b,
+    0x85, 0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x85, 0x01, 0x40, 0x50, 0x83,
+    0x03, 0x0b, 0x81, 0x03, 0x40, 0x3b, 0x85, 0x01, 0x40, 0x06, 0x19, 0x40,
+    0x0b, 0x9f, 0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x82, 0x01, 0x04, 0x91,
+    0x01, 0x04, 0x80, 0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x82, 0x01, 0x05,
+    0x8f, 0x01, 0x05, 0x80, 0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x82, 0x01,
+    0x1b, 0x80, 0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x82, 0x01, 0x1b, 0x80,
+    0x01, 0x40, 0x06, 0x19, 0x40, 0x0b, 0x82, 0x01, 0x1b, 0x80, 0x01, 0x40,
+    0x06, 0x19, 0x40, 0x0b, 0x82, 0x01, 0x1b, 0x80, 0x01, 0x40, 0x06, 0x1c,
+    0x83, 0x00, 0x40, 0x0b, 0x01, 0x83, 0x00, 0x40, 0x0b, 0x03, 0x40, 0x06,
+    0x82, 0x00, 0x40, 0x0d, 0x01, 0x40, 0x06, 0x85, 0x00, 0x1d, 0x83, 0x00,
+    0x40, 0x0b, 0x81, 0x01, 0x83, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x02, 0x40,
+    0x06, 0x82, 0x00, 0x40, 0x0d, 0x80, 0x01, 0x00, 0x40, 0x06, 0x85, 0x00,
+    0x21, 0x40, 0x0b, 0x81, 0x01, 0x81, 0x00, 0x01, 0x40, 0x0b, 0x80, 0x01,
+    0x02, 0x40, 0x06, 0x80, 0x00, 0x01, 0x40, 0x0d, 0x80, 0x01, 0x00, 0x40,
+    0x06, 0x27, 0x40, 0x0b, 0x81, 0x01, 0x81, 0x00, 0x01, 0x40, 0x0b, 0x80,
+    0x01, 0x02, 0x40, 0x06, 0x80, 0x00, 0x01, 0x40, 0x0d, 0x80, 0x01, 0x00,
+    0x40, 0x06, 0x27, 0x40, 0x0b, 0x81, 0x01, 0x4d, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xe9, 0x0f, 0x0f, 0x0f, 0x0f, 0xef, 0x0c, 0x0c, 0x0c, 0x62, 0x80, 0x01,
+    0x00, 0x40, 0x06, 0x27, 0x40, 0x0b, 0x81, 0x01, 0x00, 0x82, 0x01, 0x40,
+    0x0a, 0x83, 0x00, 0x40, 0x08, 0x84, 0x01, 0x00, 0x40, 0x06, 0x27, 0x40,
+    0x0b, 0x81, 0x01, 0x03, 0x40, 0x0a, 0x80, 0x00, 0x02, 0x40, 0x08, 0x80,
+    0x01, 0x04, 0x40, 0x06, 0x27, 0x40, 0x0b, 0x81, 0x01, 0x05, 0x84, 0x01,
+    0x04, 0x40, 0x06, 0x27, 0x40, 0x0b, 0x81, 0x01, 0x0f, 0x40, 0x06, 0x23,
+    0x46, 0x15, 0x15, 0x15, 0x15, 0x92, 0x30, 0x30, 0x0c, 0x47, 0xaf, 0x30,
+    0x30, 0x93, 0x15, 0x15, 0x15, 0xa4, 0x1f, 0x82, 0x02, 0x03, 0x81, 0x01,
+    0x0a, 0x40, 0x32, 0x80, 0x02, 0x22, 0x42, 0x58, 0x1d, 0x1d, 0x82, 0x02,
+    0x03, 0x4d, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0xc2, 0x80, 0x02, 0x05, 0x41, 0x1d, 0x1d, 0x1a, 0x40,
+    0x01, 0x82, 0x02, 0x05, 0x81, 0x03, 0x0a, 0x40, 0x1b, 0x80, 0x02, 0x06,
+    0x80, 0x02, 0x40, 0x00, 0x19, 0x40, 0x01, 0x82, 0x02, 0x05, 0x81, 0x03,
+    0x0a, 0x40, 0x1b, 0x80, 0x02, 0x06, 0x80, 0x02, 0x40, 0x00, 0x17, 0x40,
+    0x03, 0x83, 0x02, 0x06, 0x81, 0x03, 0x01, 0x40, 0x29, 0x83, 0x02, 0x40,
+    0x2a, 0x80, 0x03, 0x01, 0x40, 0x1b, 0x80, 0x02, 0x07, 0x81, 0x02, 0x40,
+    0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x07, 0x81, 0x03, 0x01, 0x40, 0x29,
+    0x80, 0x02, 0x02, 0x40, 0x2a, 0x80, 0x03, 0x01, 0x40, 0x1b, 0x80, 0x02,
+    0x09, 0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02, 0x42, 0x4a, 0x21,
+    0x37, 0x81, 0x02, 0x41, 0x12, 0x12, 0x02, 0x80, 0x02, 0x02, 0x40, 0x5d,
+    0x05, 0x40, 0x4a, 0x07, 0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02,
+    0x40, 0x00, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x0f, 0x40, 0x00, 0x07,
+    0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02, 0x40, 0x00, 0x80, 0x00,
+    0x40, 0x01, 0x81, 0x02, 0x03, 0x45, 0xfe, 0x31, 0x31, 0x31, 0x31, 0xa5,
+    0x80, 0x02, 0x04, 0x40, 0x00, 0x07, 0x40, 0x04, 0x15, 0x40, 0x03, 0x82,
+    0x02, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x03, 0x40,
+    0x24, 0x80, 0x03, 0x02, 0x40, 0x28, 0x80, 0x02, 0x04, 0x40, 0x00, 0x07,
+    0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02, 0x40, 0x00, 0x80, 0x00,
+    0x40, 0x01, 0x81, 0x02, 0x03, 0x40, 0x24, 0x80, 0x03, 0x02, 0x40, 0x28,
+    0x80, 0x02, 0x04, 0x40, 0x00, 0x07, 0x40, 0x04, 0x15, 0x40, 0x03, 0x82,
+    0x02, 0x02, 0x40, 0x00, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x03, 0x40,
+    0x24, 0x80, 0x03, 0x02, 0x40, 0x28, 0x80, 0x02, 0x04, 0x40, 0x00, 0x07,
+    0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02, 0x40, 0x00, 0x80, 0x00,
+    0x40, 0x01, 0x81, 0x02, 0x03, 0x40, 0x24, 0x83, 0x03, 0x40, 0x28, 0x05,
+    0x40, 0x00, 0x07, 0x40, 0x04, 0x15, 0x40, 0x03, 0x82, 0x02, 0x02, 0x40,
+    0x00, 0x80, 0x00, 0x40, 0x01, 0x81, 0x02, 0x04, 0x43, 0x12, 0x12, 0x12,
+    0x12, 0x06, 0x40, 0x00, 0x07, 0x40, 0x04, 0x0a, 0x15, 0x80, 0x00, 0x0b,
+    0x81, 0x03, 0x40, 0x19, 0x2b, 0x80, 0x00, 0x0b, 0x81, 0x03, 0x40, 0x19,
+    0x2b, 0x80, 0x00, 0x0b, 0x81, 0x03, 0x40, 0x19, 0x2b, 0x80, 0x00, 0x0b,
+    0x81, 0x03, 0x40, 0x19, 0x2b, 0x80, 0x00, 0x0b, 0x81, 0x03, 0x40, 0x19,
+    0x2b, 0x80, 0x00, 0x0b, 0x81, 0x03, 0x40, 0x19, 0x22, 0x49, 0x8b, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x68, 0x23, 0x23, 0x0b, 0x81, 0x03, 0x4a,
+    0x6e, 0x23, 0x23, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8d, 0x18,
+    0x40, 0x08, 0x85, 0x01, 0x40, 0x50, 0x81, 0x03, 0x0b, 0x84, 0x03, 0x86,
+    0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x85, 0x01, 0x53, 0x9b, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x86, 0x01, 0x40, 0x0a, 0x18, 0x40, 0x08,
+    0x05, 0x91, 0x01, 0x05, 0x82, 0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x05,
+    0x91, 0x01, 0x05, 0x82, 0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x1d, 0x82,
+    0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x1d, 0x82, 0x01, 0x40, 0x0a, 0x18,
+    0x40, 0x08, 0x1d, 0x82, 0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x1d, 0x82,
+    0x01, 0x40, 0x0a, 0x18, 0x40, 0x08, 0x1d, 0x82, 0x01, 0x40, 0x0a, 0x18,
+    0x47, 0x67, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3f, 0x01, 0x44, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x45, 0x38, 0x02, 0x02, 0x02, 0x02, 0x3a,
+    0x01, 0x46, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1a, 0x85, 0x00,
+    0x40, 0x0b, 0x00, 0x80, 0x01, 0x84, 0x00, 0x02, 0x80, 0x01, 0x40, 0x18,
+    0x83, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x83, 0x00, 0x23, 0x40, 0x0b, 0x00,
+    0x80, 0x01, 0x03, 0x80, 0x00, 0x02, 0x80, 0x01, 0x40, 0x18, 0x01, 0x81,
+    0x00, 0x40, 0x0d, 0x81, 0x01, 0x27, 0x40, 0x0b, 0x00, 0x80, 0x01, 0x03,
+    0x80, 0x00, 0x02, 0x80, 0x01, 0x40, 0x18, 0x01, 0x81, 0x00, 0x40, 0x0d,
+    0x81, 0x01, 0x27, 0x40, 0x0b, 0x00, 0x80, 0x01, 0x03, 0x80, 0x00, 0x02,
+    0x80, 0x01, 0x40, 0x18, 0x01, 0x81, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x27,
+    0x40, 0x0b, 0x00, 0x85, 0x01, 0x83, 0x00, 0x40, 0x0d, 0x82, 0x01, 0x01,
+    0x81, 0x01, 0x27, 0x40, 0x0b, 0x05, 0x80, 0x01, 0x02, 0x80, 0x00, 0x40,
+    0x0d, 0x04, 0x81, 0x01, 0x27, 0x40, 0x0b, 0x05, 0x80, 0x01, 0x44, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x62, 0x04, 0x81, 0x01, 0x27, 0x40, 0x0b, 0x10, 0x81,
+    0x01, 0x27, 0x40, 0x0b, 0x10, 0x81, 0x01, 0x29, 0x80, 0x02, 0x0b, 0x81,
+    0x01, 0x40, 0x32, 0x03, 0x82, 0x02, 0x24, 0x80, 0x02, 0x0b, 0x81, 0x01,
+    0x40, 0x32, 0x03, 0x82, 0x02, 0x1b, 0x40, 0x3d, 0x07, 0x80, 0x02, 0x0b,
+    0x42, 0x14, 0x14, 0xae, 0x04, 0x81, 0x02, 0x42, 0x15, 0x15, 0x42, 0x18,
+    0x40, 0x03, 0x07, 0x80, 0x02, 0x0b, 0x81, 0x03, 0x40, 0x1b, 0x05, 0x82,
+    0x02, 0x40, 0x04, 0x16, 0x42, 0x1f, 0x1f, 0xca, 0x07, 0x80, 0x02, 0x03,
+    0x80, 0x03, 0x44, 0x20, 0x20, 0x20, 0x20, 0xb7, 0x01, 0x81, 0x03, 0x40,
+    0x1b, 0x05, 0x82, 0x02, 0x42, 0xc6, 0x1f, 0x64, 0x13, 0x40, 0x05, 0x80,
+    0x02, 0x09, 0x80, 0x02, 0x03, 0x80, 0x03, 0x02, 0x80, 0x02, 0x40, 0x27,
+    0x01, 0x81, 0x03, 0x40, 0x1b, 0x07, 0x82, 0x02, 0x40, 0x07, 0x13, 0x40,
+    0x05, 0x80, 0x02, 0x05, 0x81, 0x02, 0x01, 0x80, 0x02, 0x84, 0x03, 0x02,
+    0x80, 0x02, 0x40, 0x27, 0x83, 0x03, 0x40, 0x1b, 0x81, 0x02, 0x05, 0x82,
+    0x02, 0x40, 0x07, 0x13, 0x40, 0x05, 0x80, 0x02, 0x05, 0x42, 0x4a, 0x21,
+    0x37, 0x01, 0x44, 0x12, 0x12, 0x12, 0x12, 0x12, 0x04, 0x44, 0x12, 0x12,
+    0x12, 0x12, 0x49, 0x81, 0x02, 0x42, 0x21, 0x21, 0x37, 0x02, 0x82, 0x02,
+    0x40, 0x07, 0x13, 0x40, 0x05, 0x80, 0x02, 0x05, 0x40, 0x00, 0x00, 0x40,
+    0x01, 0x10, 0x81, 0x02, 0x81, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x40,
+    0x07, 0x13, 0x40, 0x05, 0x80, 0x02, 0x05, 0x40, 0x00, 0x00, 0x40, 0x01,
+    0x05, 0x80, 0x02, 0x44, 0x34, 0x34, 0x34, 0x34, 0xea, 0x04, 0x81, 0x02,
+    0x81, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x40, 0x07, 0x13, 0x40, 0x05,
+    0x80, 0x02, 0x05, 0x40, 0x00, 0x00, 0x40, 0x01, 0x05, 0x80, 0x02, 0x02,
+    0x80, 0x03, 0x40, 0x1b, 0x04, 0x81, 0x02, 0x81, 0x00, 0x40, 0x01, 0x02,
+    0x82, 0x02, 0x40, 0x07, 0x13, 0x40, 0x05, 0x80, 0x02, 0x05, 0x40, 0x00,
+    0x00, 0x40, 0x01, 0x05, 0x80, 0x02, 0x02, 0x80, 0x03, 0x40, 0x1b, 0x04,
+    0x81, 0x02, 0x81, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x40, 0x07, 0x13,
+    0x40, 0x05, 0x80, 0x02, 0x05, 0x40, 0x00, 0x00, 0x40, 0x01, 0x05, 0x80,
+    0x02, 0x02, 0x80, 0x03, 0x40, 0x1b, 0x04, 0x81, 0x02, 0x81, 0x00, 0x40,
+    0x01, 0x02, 0x82, 0x02, 0x40, 0x07, 0x13, 0x40, 0x05, 0x80, 0x02, 0x05,
+    0x40, 0x00, 0x00, 0x40, 0x01, 0x05, 0x80, 0x02, 0x83, 0x03, 0x40, 0x1b,
+    0x04, 0x81, 0x02, 0x81, 0x00, 0x40, 0x01, 0x02, 0x82, 0x02, 0x40, 0x07,
+    0x09, 0x14, 0x40, 0x25, 0x80, 0x03, 0x39, 0x40, 0x25, 0x80, 0x03, 0x39,
+    0x40, 0x25, 0x80, 0x03, 0x39, 0x40, 0x25, 0x80, 0x03, 0x39, 0x40, 0x25,
+    0x80, 0x03, 0x39, 0x40, 0x25, 0x80, 0x03, 0x2f, 0x4a, 0x8b, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x23, 0x23, 0x69, 0x80, 0x03, 0x0d, 0x49,
+    0x23, 0x23, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x17, 0x40,
+    0x08, 0x81, 0x01, 0x04, 0x81, 0x03, 0x18, 0x80, 0x01, 0x17, 0x40, 0x08,
+    0x81, 0x01, 0x04, 0x81, 0x03, 0x18, 0x80, 0x01, 0x17, 0x40, 0x08, 0x81,
+    0x01, 0x1f, 0x80, 0x01, 0x17, 0x40, 0x08, 0x81, 0x01, 0x1f, 0x80, 0x01,
+    0x17, 0x40, 0x08, 0x81, 0x01, 0x1f, 0x80, 0x01, 0x17, 0x40, 0x08, 0x81,
+    0x01, 0x1f, 0x80, 0x01, 0x17, 0x40, 0x08, 0x81, 0x01, 0x1f, 0x80, 0x01,
+    0x17, 0x40, 0x08, 0x81, 0x01, 0x1f, 0x80, 0x01, 0x17, 0x40, 0x08, 0x81,
+    0x01, 0x1f, 0x80, 0x01, 0x17, 0x47, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x81, 0x01, 0x45, 0x5f, 0x0f, 0x0f, 0x0f, 0x0f, 0x77, 0x80,
+    0x01, 0x03, 0x44, 0x0f, 0x0f, 0x0f, 0x0f, 0xaa, 0x01, 0x47, 0x78, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x81, 0x01, 0x40, 0x0a, 0x80,
+    0x00, 0x02, 0x40, 0x0b, 0x80, 0x01, 0x02, 0x40, 0x18, 0x80, 0x00, 0x2d,
+    0x81, 0x01, 0x40, 0x0a, 0x80, 0x00, 0x02, 0x40, 0x0b, 0x80, 0x01, 0x02,
+    0x40, 0x18, 0x80, 0x00, 0x2d, 0x81, 0x01, 0x40, 0x0a, 0x80, 0x00, 0x02,
+    0x40, 0x0b, 0x80, 0x01, 0x02, 0x40, 0x18, 0x80, 0x00, 0x2d, 0x81, 0x01,
+    0x40, 0x0a, 0x83, 0x00, 0x40, 0x0b, 0x83, 0x01, 0x40, 0x18, 0x83, 0x00,
+    0x40, 0x0d, 0x29, 0x81, 0x01, 0x4f, 0xad, 0x09, 0x09, 0x09, 0x09, 0x98,
+    0x17, 0x17, 0x17, 0x17, 0x7d, 0x09, 0x09, 0x09, 0x09, 0x4c, 0x29, 0x81,
+    0x01, 0x04, 0x40, 0x0a, 0x80, 0x00, 0x02, 0x40, 0x0d, 0x80, 0x01, 0x2d,
+    0x81, 0x01, 0x04, 0x40, 0x0a, 0x83, 0x00, 0x40, 0x0d, 0x2e, 0x81, 0x01,
+    0x05, 0x44, 0x10, 0x10, 0x10, 0x10, 0x9c, 0x2b, 0x82, 0x00, 0x83, 0x01,
+    0x0c, 0x82, 0x01, 0x40, 0x06, 0x83, 0x00, 0x1d, 0x47, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x35, 0x35, 0xc0, 0x80, 0x01, 0x0c, 0x47, 0xc1, 0x35, 0x35,
+    0xf4, 0x1f, 0x1f, 0x1f, 0x1f, 0x1c, 0x40, 0x05, 0x81, 0x02, 0x04, 0x40,
+    0x4e, 0x8d, 0x01, 0x40, 0x32, 0x05, 0x80, 0x02, 0x40, 0x04, 0x80, 0x00,
+    0x1a, 0x40, 0x05, 0x06, 0x40, 0x4e, 0x8d, 0x01, 0x40, 0x32, 0x06, 0x40,
+    0x04, 0x81, 0x00, 0x17, 0x42, 0x3d, 0x15, 0x5a, 0x06, 0x4f, 0x6a, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0xae, 0x07, 0x41, 0x15, 0x15, 0x21, 0x40, 0x24, 0x80, 0x03, 0x03,
+    0x85, 0x03, 0x0d, 0x81, 0x00, 0x1f, 0x40, 0x24, 0x80, 0x03, 0x03, 0x85,
+    0x03, 0x0d, 0x81, 0x00, 0x12, 0x40, 0x05, 0x82, 0x02, 0x05, 0x82, 0x02,
+    0x40, 0x24, 0x83, 0x03, 0x40, 0x29, 0x80, 0x02, 0x02, 0x40, 0x27, 0x83,
+    0x03, 0x40, 0x1b, 0x01, 0x82, 0x02, 0x05, 0x80, 0x02, 0x40, 0x04, 0x11,
+    0x40, 0x05, 0x82, 0x02, 0x05, 0x82, 0x02, 0x40, 0x24, 0x83, 0x03, 0x40,
+    0x29, 0x03, 0x40, 0x27, 0x83, 0x03, 0x40, 0x1b, 0x01, 0x82, 0x02, 0x05,
+    0x80, 0x02, 0x40, 0x04, 0x11, 0x40, 0x05, 0x82, 0x02, 0x03, 0x42, 0x43,
+    0x22, 0x22, 0x81, 0x02, 0x45, 0xd5, 0x13, 0x13, 0x13, 0x13, 0x75, 0x83,
+    0x02, 0x45, 0x3c, 0x13, 0x13, 0x13, 0x13, 0xd6, 0x01, 0x42, 0x43, 0x22,
+    0x45, 0x05, 0x80, 0x02, 0x40, 0x04, 0x11, 0x40, 0x05, 0x82, 0x02, 0x03,
+    0x40, 0x00, 0x81, 0x00, 0x81, 0x02, 0x05, 0x85, 0x02, 0x07, 0x40, 0x05,
+    0x05, 0x80, 0x02, 0x40, 0x04, 0x11, 0x40, 0x05, 0x82, 0x02, 0x03, 0x40,
+    0x00, 0x81, 0x00, 0x81, 0x02, 0x05, 0x85, 0x02, 0x07, 0x40, 0x05, 0x05,
+    0x80, 0x02, 0x40, 0x04, 0x11, 0x40, 0x05, 0x82, 0x02, 0x03, 0x40, 0x00,
+    0x81, 0x00, 0x81, 0x02, 0x04, 0x40, 0x24, 0x80, 0x03, 0x02, 0x40, 0x1b,
+    0x80, 0x02, 0x07, 0x40, 0x05, 0x05, 0x80, 0x02, 0x40, 0x04, 0x11, 0x40,
+    0x05, 0x82, 0x02, 0x03, 0x40, 0x00, 0x81, 0x00, 0x81, 0x02, 0x04, 0x40,
+    0x24, 0x80, 0x03, 0x02, 0x40, 0x1b, 0x80, 0x02, 0x07, 0x40, 0x05, 0x05,
+    0x80, 0x02, 0x40, 0x04, 0x11, 0x40, 0x05, 0x82, 0x02, 0x03, 0x40, 0x00,
+    0x81, 0x00, 0x81, 0x02, 0x04, 0x40, 0x24, 0x83, 0x03, 0x40, 0x1b, 0x08,
+    0x40, 0x05, 0x05, 0x80, 0x02, 0x40, 0x04, 0x09, 0x24, 0x80, 0x03, 0x40,
+    0x19, 0x39, 0x80, 0x03, 0x40, 0x19, 0x14, 0xff, 0x05, 0x05, 0x04, 0x05,
+    0x07, 0x05, 0x05, 0x06, 0x07, 0x06, 0x05, 0x05, 0x06, 0x04, 0x07, 0x07,
+    0x05, 0x04, 0x04, 0x07, 0x04, 0x06, 0x07, 0x04, 0x06, 0x04, 0x05, 0x07,
+    0x06, 0x07, 0x04, 0x05, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x07, 0x07,
+    0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x05, 0x07, 0x06, 0x05, 0x05,
+    0x07, 0x05, 0x05, 0x05, 0x06, 0x06, 0x04, 0x07, 0x04, 0x07, 0x06, 0x07,
+    0x05, 0x06, 0x07, 0x04, 0x06, 0x04, 0x05, 0x07, 0x07, 0x04, 0x05, 0x07,
+    0x07, 0x05, 0x04, 0x05, 0x04, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x07,
+    0x07, 0x07, 0x05, 0x05, 0x07, 0x06, 0x04, 0x06, 0x07, 0x05, 0x06, 0x06,
+    0x05, 0x04, 0x05, 0x07, 0x04, 0x07, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06,
+    0x05, 0x05, 0x06, 0x04, 0x07, 0x04, 0x05, 0x04, 0x07, 0x05, 0x07, 0x07,
+    0x06, 0x05, 0x07, 0x07, 0x06, 0x06, 0x04, 0x05, 0x05, 0x04, 0x06, 0x07,
+    0x06, 0x07, 0x07, 0x05, 0x07, 0x04, 0x06, 0x07, 0x05, 0x04, 0x05, 0x05,
+    0x05, 0x04, 0x04, 0x04, 0x07, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x06,
+    0x04, 0x07, 0x04, 0x05, 0x06, 0x05, 0x04, 0x07, 0x05, 0x05, 0x06, 0x04,
+    0x04, 0x06, 0x05, 0x06, 0x04, 0x04, 0x07, 0x06, 0x07, 0x05, 0x06, 0x04,
+    0x07, 0x07, 0x04, 0x05, 0x07, 0x06, 0x04, 0x05, 0x04, 0x04, 0x04, 0x05,
+    0x04, 0x05, 0x04, 0x06, 0x06, 0x04, 0x07, 0x04, 0x06, 0x05, 0x07, 0x07,
+    0x07, 0x07, 0x06, 0x04, 0x07, 0x06, 0x04, 0x05, 0x07, 0x07, 0x04, 0x06,
+    0x05, 0x04, 0x07, 0x06, 0x05, 0x07, 0x06, 0x06, 0x04, 0x04, 0x06, 0x06,
+    0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x06, 0x07,
+    0x07, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x05, 0x05,
+    0x05, 0x07, 0x05, 0x07, 0x07, 0x06, 0x05, 0x06, 0x04, 0x04, 0x07, 0x07,
+    0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x04, 0x04, 0x07, 0x05, 0x07, 0x04,
+    0x07, 0x06, 0x06, 0x04, 0x06, 0x07, 0x06, 0x07, 0x04, 0x05, 0x04, 0x06,
+    0x06, 0x04, 0x07, 0x06, 0x04, 0x05, 0x05, 0x05, 0x07, 0x05, 0x06, 0x06,
+    0x06, 0x07, 0x05, 0x05, 0x05, 0x07, 0x05, 0x07, 0x05, 0x05, 0x06, 0x07,
+    0x04, 0x05, 0x04, 0x06, 0x06, 0x06, 0x04, 0x05, 0x07, 0x07, 0x06, 0x04,
+    0x07, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x05, 0x04, 0x05,
+    0x07, 0x05, 0x04, 0x07, 0x06, 0x05, 0x04, 0x07, 0x04, 0x04, 0x05, 0x07,
+    0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x06, 0x07, 0x04, 0x06, 0x04,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x04, 0x07, 0x07, 0x05, 0x05, 0x06, 0x05,
+    0x07, 0x07, 0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05,
+    0x07, 0x07, 0x04, 0x07, 0x05, 0x05, 0x04, 0x07, 0x06, 0x07, 0x05, 0x05,
+    0x06, 0x07, 0x04, 0x06, 0x07, 0x04, 0x06, 0x06, 0x06, 0x07, 0x04, 0x05,
+    0x05, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x04, 0x07,
+    0x07, 0x07, 0x05, 0x05, 0x06, 0x06, 0x04, 0x06, 0x04, 0x07, 0x05, 0x07,
+    0x07, 0x04, 0x05, 0x05, 0x06, 0x04, 0x07, 0x07, 0x06, 0x07, 0x06, 0x04,
+    0x06, 0x04, 0x07, 0x06, 0x04, 0x07, 0x05, 0x06, 0x06, 0x05, 0x07, 0x06,
+    0x05, 0x07, 0x06, 0x07, 0x07, 0x05, 0x07, 0x04, 0x05, 0x07, 0x04, 0x07,
+    0x05, 0x04, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06,
+    0x05, 0x07, 0x05, 0x05, 0x05, 0x06, 0x07, 0x04, 0x06, 0x07, 0x05, 0x07,
+    0x06, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x04, 0x06, 0x05,
+    0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x07, 0x06, 0x07, 0x07, 0x04, 0x04,
+    0x05, 0x05, 0x07, 0x05, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06, 0x04, 0x04,
+    0x04, 0x05, 0x04, 0x04, 0x07, 0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x04,
+    0x06, 0x07, 0x06, 0x04, 0x05, 0x05, 0x07, 0x04, 0x04, 0x07, 0x06, 0x06,
+    0x04, 0x07, 0x06, 0x06, 0x05, 0x04, 0x06, 0x04, 0x07, 0x04, 0x07, 0x06,
+    0x06, 0x06, 0x05, 0x06, 0x04, 0x05, 0x04, 0x04, 0x04, 0x07, 0x06, 0x06,
+    0x04, 0x07, 0x07, 0x06, 0x06, 0x05, 0x04, 0x05, 0x04, 0x07, 0x06, 0x05,
+    0x07, 0x07, 0x04, 0x07, 0x05, 0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06,
+    0x04, 0x04, 0x04, 0x07, 0x05, 0x07, 0x07, 0x07, 0x06, 0x06, 0x04, 0x05,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x05, 0x04, 0x05,
+    0x04, 0x06, 0x04, 0x06, 0x07, 0x06, 0x05, 0x07, 0x05, 0x05, 0x04, 0x06,
+    0x05, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05, 0x07, 0x07, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x07, 0x06, 0x07, 0x04, 0x06, 0x07, 0x04, 0x04, 0x05, 0x05,
+    0x06, 0x04, 0x04, 0x06, 0x05, 0x07, 0x07, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x05, 0x05, 0x07, 0x07, 0x05, 0x07, 0x04, 0x05, 0x07, 0x05, 0x05, 0x05,
+    0x04, 0x05, 0x07, 0x04, 0x04, 0x07, 0x05, 0x04, 0x05, 0x07, 0x04, 0x05,
+    0x05, 0x07, 0x04, 0x05, 0x04, 0x06, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05,
+    0x07, 0x05, 0x04, 0x06, 0x07, 0x07, 0x04, 0x06, 0x04, 0x07, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x07, 0x04, 0x05, 0x06, 0x06, 0x04, 0x07, 0x06,
+    0x04, 0x07, 0x07, 0x06, 0x04, 0x05, 0x07, 0x07, 0x05, 0x06, 0x04, 0x07,
+    0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06,
+    0x06, 0x07, 0x04, 0x05, 0x07, 0x07, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04,
+    0x05, 0x04, 0x07, 0x05, 0x04, 0x07, 0x06, 0x06, 0x04, 0x06, 0x06, 0x05,
+    0x07, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07,
+    0x05, 0x05, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x05, 0x04, 0x06, 0x07,
+    0x05, 0x04, 0x06, 0x07, 0x05, 0x06, 0x04, 0x05, 0x04, 0x07, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x07, 0x06, 0x07, 0x07, 0x05, 0x04, 0x07, 0x07, 0x04,
+    0x05, 0x07, 0x06, 0x05, 0x06, 0x06, 0x05, 0x07, 0x04, 0x06, 0x05, 0x05,
+    0x05, 0x07, 0x06, 0x05, 0x05, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05,
+    0x05, 0x04, 0x06, 0x04, 0x07, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06,
+    0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x05, 0x04, 0x04, 0x07, 0x07,
+    0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07, 0x05, 0x05,
+    0x07, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x06, 0x07, 0x04, 0x05, 0x04,
+    0x04, 0x07, 0x07, 0x05, 0x04, 0x05, 0x05, 0x07, 0x06, 0x07, 0x07, 0x04,
+    0x04, 0x07, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x06, 0x04, 0x04, 0x06,
+    0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x04, 0x05, 0x04, 0x04, 0x04, 0x06,
+    0x07, 0x07, 0x07, 0x04, 0x07, 0x07, 0x05, 0x04, 0x06, 0x06, 0x04, 0x06,
+    0x06, 0x05, 0x04, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x07, 0x04,
+    0x05, 0x05, 0x06, 0x06, 0x04, 0x07, 0x07, 0x04, 0x04, 0x06, 0x05, 0x07,
+    0x04, 0x05, 0x07, 0x06, 0x05, 0x04, 0x04, 0x07, 0x04, 0x07, 0x07, 0x05,
+    0x06, 0x06, 0x04, 0x07, 0x07, 0x05, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04,
+    0x04, 0x05, 0x04, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x04, 0x04, 0x04,
+    0x04, 0x07, 0x04, 0x05, 0x05, 0x06, 0x07, 0x05, 0x06, 0x04, 0x05, 0x04,
+    0xff, 0x04, 0x04, 0x06, 0x05, 0x07, 0x06, 0x06, 0x05, 0x04, 0x07, 0x07,
+    0x07, 0x04, 0x07, 0x06, 0x05, 0x07, 0x07, 0x05, 0x04, 0x06, 0x05, 0x05,
+    0x06, 0x04, 0x06, 0x07, 0x06, 0x06, 0x07, 0x04, 0x07, 0x07, 0x04, 0x07,
+    0x07, 0x06, 0x05, 0x05, 0x07, 0x04, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05,
+    0x04, 0x05, 0x04, 0x07, 0x06, 0x04, 0x07, 0x05, 0x05, 0x07, 0x07, 0x07,
+    0x04, 0x04, 0x05, 0x07, 0x05, 0x07, 0x07, 0x04, 0x07, 0x04, 0x04, 0x07,
+    0x05, 0x05, 0x04, 0x07, 0x05, 0x05, 0x05, 0x07, 0x04, 0x07, 0x06, 0x05,
+    0x05, 0x07, 0x07, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06,
+    0x04, 0x07, 0x04, 0x05, 0x04, 0x06, 0x07, 0x04, 0x04, 0x05, 0x05, 0x04,
+    0x07, 0x05, 0x05, 0x06, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x07,
+    0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x04, 0x07, 0x04, 0x04, 0x06, 0x06,
+    0x05, 0x06, 0x07, 0x07, 0x04, 0x07, 0x07, 0x07, 0x04, 0x05, 0x04, 0x04,
+    0x04, 0x07, 0x06, 0x05, 0x04, 0x06, 0x04, 0x06, 0x05, 0x05, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 0x07, 0x04, 0x06, 0x05, 0x05, 0x05,
+    0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x04, 0x06, 0x04, 0x06,
+    0x05, 0x04, 0x07, 0x06, 0x07, 0x06, 0x04, 0x05, 0x04, 0x04, 0x04, 0x05,
+    0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x05, 0x07, 0x05, 0x06, 0x07,
+    0x06, 0x06, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x05, 0x07, 0x06,
+    0x04, 0x04, 0x06, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x07, 0x05,
+    0x05, 0x04, 0x04, 0x06, 0x05, 0x05, 0x04, 0x06, 0x04, 0x06, 0x05, 0x07,
+    0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x06, 0x06, 0x05, 0x07, 0x04, 0x07,
+    0x05, 0x06, 0x05, 0x07, 0x04, 0x05, 0x07, 0x04, 0x05, 0x04, 0x05, 0x06,
+    0x04, 0x07, 0x04, 0x05, 0x07, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07, 0x07, 0x04, 0x06, 0x07, 0x05,
+    0x04, 0x07, 0x07, 0x05, 0x04, 0x07, 0x06, 0x05, 0x04, 0x04, 0x06, 0x07,
+    0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x05, 0x06,
+    0x05, 0x05, 0x05, 0x04, 0x06, 0x06, 0x04, 0x07, 0x06, 0x04, 0x05, 0x04,
+    0x07, 0x04, 0x04, 0x07, 0x07, 0x04, 0x07, 0x05, 0x06, 0x06, 0x05, 0x07,
+    0x06, 0x04, 0x07, 0x07, 0x07, 0x04, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x07,
+    0x05, 0x06, 0x06, 0x05, 0x06, 0x04, 0x05, 0x04, 0x04, 0x06, 0x07, 0x06,
+    0x07, 0x05, 0x07, 0x04, 0x06, 0x05, 0x05, 0x05, 0x07, 0x06, 0x05, 0x04,
+    0x07, 0x07, 0x06, 0x05, 0x05, 0x05, 0x07, 0x04, 0x04, 0x05, 0x07, 0x05,
+    0x05, 0x05, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x07, 0x06, 0x04, 0x04,
+    0x06, 0x05, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 0x07, 0x07, 0x04, 0x07, 0x06, 0x07,
+    0x04, 0x05, 0x07, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x05,
+    0x07, 0x05, 0x04, 0x04, 0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x07, 0x04,
+    0x04, 0x07, 0x06, 0x05, 0x07, 0x05, 0x07, 0x07, 0x04, 0x06, 0x06, 0x04,
+    0x06, 0x07, 0x05, 0x07, 0x07, 0x06, 0x04, 0x06, 0x05, 0x05, 0x04, 0x07,
+    0x06, 0x05, 0x06, 0x05, 0x04, 0x07, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06,
+    0x04, 0x05, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x04, 0x05, 0x04, 0x06,
+    0x06, 0x06, 0x05, 0x07, 0x06, 0x04, 0x05, 0x05, 0x06, 0x07, 0x04, 0x06,
+    0x07, 0x07, 0x06, 0x04, 0x05, 0x04, 0x06, 0x07, 0x07, 0x07, 0x05, 0x05,
+    0x05, 0x04, 0x04, 0x04, 0x07, 0x04, 0x05, 0x06, 0x05, 0x04, 0x05, 0x07,
+    0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x05,
+    0x05, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x05, 0x04, 0x05, 0x07, 0x06,
+    0x05, 0x04, 0x06, 0x05, 0x05, 0x07, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04,
+    0x07, 0x06, 0x07, 0x05, 0x04, 0x04, 0x07, 0x06, 0x05, 0x04, 0x04, 0x07,
+    0x04, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x06,
+    0x04, 0x04, 0x04, 0x06, 0x06, 0x05, 0x04, 0x04, 0x06, 0x07, 0x07, 0x07,
+    0x04, 0x04, 0x05, 0x07, 0x05, 0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 0x06,
+    0x04, 0x05, 0x04, 0x07, 0x04, 0x05, 0x07, 0x06, 0x04, 0x05, 0x06, 0x05,
+    0x05, 0x07, 0x07, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x07, 0x06, 0x07,
+    0x05, 0x06, 0x04, 0x04, 0x07, 0x06, 0x07, 0x05, 0x06, 0x04, 0x06, 0x04,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x07,
+    0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x04, 0x06, 0x07,
+    0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x07,
+    0x04, 0x06, 0x06, 0x04, 0x06, 0x06, 0x07, 0x06, 0x04, 0x06, 0x07, 0x05,
+    0x05, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06, 0x07, 0x04, 0x07, 0x06, 0x06,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x05, 0x07, 0x07, 0x06, 0x04, 0x07, 0x06,
+    0x05, 0x06, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x07, 0x05, 0x05, 0x07,
+    0x04, 0x05, 0x07, 0x04, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x07, 0x07,
+    0x04, 0x05, 0x04, 0x04, 0x06, 0x06, 0x07, 0x04, 0x06, 0x04, 0x07, 0x06,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x07, 0x05, 0x07, 0x07, 0x04, 0x04,
+    0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x05, 0x04, 0x06, 0x06, 0x07, 0x05,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x04, 0x06, 0x07, 0x05,
+    0x05, 0x06, 0x04, 0x07, 0x06, 0x05, 0x04, 0x05, 0x07, 0x06, 0x05, 0x04,
+    0x05, 0x04, 0x06, 0x07, 0x05, 0x04, 0x07, 0x04, 0x07, 0x05, 0x07, 0x05,
+    0x05, 0x06, 0x07, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x04, 0x04, 0x07,
+    0x07, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x07, 0x05, 0x06, 0x05, 0x05,
+    0x05, 0x07, 0x06, 0x04, 0x06, 0x06, 0x04, 0x06, 0x05, 0x05, 0x07, 0x04,
+    0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x05, 0x04, 0x04, 0x06, 0x07, 0x04,
+    0x04, 0x04, 0x07, 0x06, 0x04, 0x06, 0x05, 0x07, 0x06, 0x06, 0x07, 0x07,
+    0x04, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x06, 0x05, 0x05, 0x07, 0x07, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x04, 0x07, 0x07, 0x05, 0x05,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x07, 0x05, 0x06, 0x05, 0x06,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x05,
+    0x04, 0x06, 0x07, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x06, 0x04, 0x04, 0x06, 0x07, 0x07,
+    0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06,
+    0x05, 0x04, 0x04, 0x05, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x06, 0x07, 0x05, 0x06, 0x07, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x04, 0x06, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06,
+    0x06, 0x05, 0x07, 0x07, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x04, 0x06, 0x04, 0x07, 0x07, 0x05, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x05, 0x04,
+    0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06,
+    0x05, 0x04, 0x06, 0x07, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x07, 0x06, 0x04, 0x06, 0x05, 0x04, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x06, 0x07, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07,
+    0x04, 0x04, 0x06, 0x07, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x04, 0x04, 0x06, 0x04, 0x07, 0x04, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x04, 0x04, 0x06, 0x04,
+    0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04,
+    0x06, 0x06, 0x04, 0x07, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x04, 0x04, 0x07, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x05, 0x06, 0x04, 0x05,
+    0x04, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x04,
+    0x06, 0x04, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x06, 0x06, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x07, 0x04, 0x06, 0x05, 0x05,
+    0x04, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x04,
+    0x05, 0x06, 0x05, 0x05, 0x07, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x07, 0x04, 0x07, 0x04, 0x04, 0x07, 0x07, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07,
+    0x07, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x04,
+    0x04, 0x07, 0x07, 0x06, 0x07, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x05, 0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x06, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x07, 0x04, 0x05, 0x05,
+    0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x04,
+    0x04, 0x04, 0x07, 0x04, 0x07, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x04, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x07, 0x06, 0x05, 0x07, 0x04,
+    0x07, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x04,
+    0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x07, 0x05, 0x05, 0x04, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x06, 0x06, 0x04, 0x04,
+    0x07, 0x05, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x05, 0x07,
+    0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x07, 0x05, 0x04, 0x07, 0x04, 0x05, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x04, 0x07, 0x04, 0x04,
+    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04,
+    0x05, 0x07, 0x04, 0x07, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x06, 0x04, 0x05, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x07, 0x07, 0x05, 0x06,
+    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07,
+    0x05, 0x06, 0x07, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x04, 0x07, 0x07, 0x05, 0x05, 0x04, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x04, 0x06, 0x05, 0x05,
+    0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x04, 0x05, 0x07, 0x07, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x04, 0x06, 0x06, 0x07, 0x05, 0x04, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05,
+    0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x06, 0x04, 0x07, 0x04, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x06, 0x05, 0x07, 0x04, 0x06, 0x05, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x04,
+    0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x06, 0x05, 0x06, 0x04, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x04, 0x04, 0x07, 0x05, 0x05, 0x06, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x05, 0x05, 0x04, 0x06,
+    0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05,
+    0x07, 0x05, 0x05, 0x04, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x05, 0x05, 0x04, 0x06,
+    0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x80,
+    0x03, 0x40, 0x19, 0x21, 0x89, 0x00, 0x0e, 0x40, 0x19, 0x88, 0x00, 0x17,
+    0x40, 0x08, 0x80, 0x01, 0x05, 0x40, 0x40, 0x12, 0x80, 0x03, 0x40, 0x60,
+    0x04, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40, 0x08, 0x80, 0x01, 0x05, 0x40,
+    0x40, 0x93, 0x03, 0x40, 0x60, 0x04, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40,
+    0x08, 0x80, 0x01, 0x05, 0x55, 0xa6, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0xbe, 0x04, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40, 0x08, 0x80,
+    0x01, 0x20, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40, 0x08, 0x80, 0x01, 0x20,
+    0x81, 0x01, 0x40, 0x0a, 0x15, 0x40, 0x08, 0x80, 0x01, 0x20, 0x81, 0x01,
+    0x40, 0x0a, 0x15, 0x40, 0x08, 0x80, 0x01, 0x20, 0x81, 0x01, 0x40, 0x0a,
+    0x15, 0x40, 0x08, 0x80, 0x01, 0x20, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40,
+    0x08, 0x80, 0x01, 0x20, 0x81, 0x01, 0x40, 0x0a, 0x15, 0x40, 0x08, 0x87,
+    0x01, 0x01, 0x84, 0x01, 0x03, 0x85, 0x01, 0x01, 0x88, 0x01, 0x40, 0x0a,
+    0x15, 0x48, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xa7, 0x01,
+    0x44, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x80, 0x01, 0x45, 0x5f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0xaa, 0x00, 0x80, 0x01, 0x48, 0x5f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0xac, 0x1d, 0x40, 0x08, 0x06, 0x40, 0x08, 0x02,
+    0x80, 0x01, 0x40, 0x0a, 0x02, 0x80, 0x00, 0x40, 0x0d, 0x00, 0x80, 0x01,
+    0x40, 0x0a, 0x25, 0x40, 0x08, 0x06, 0x40, 0x08, 0x02, 0x80, 0x01, 0x40,
+    0x0a, 0x02, 0x80, 0x00, 0x40, 0x0d, 0x00, 0x80, 0x01, 0x40, 0x0a, 0x25,
+    0x40, 0x08, 0x06, 0x40, 0x08, 0x02, 0x80, 0x01, 0x40, 0x0a, 0x02, 0x80,
+    0x00, 0x40, 0x0d, 0x00, 0x80, 0x01, 0x40, 0x0a, 0x25, 0x40, 0x08, 0x01,
+    0x84, 0x00, 0x40, 0x08, 0x83, 0x01, 0x40, 0x0a, 0x83, 0x00, 0x40, 0x0d,
+    0x00, 0x80, 0x01, 0x40, 0x0a, 0x25, 0x40, 0x08, 0x01, 0x4f, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0xb5, 0x17, 0x17, 0x17, 0x17, 0xad, 0x09, 0x09, 0x09,
+    0x09, 0x4c, 0x00, 0x80, 0x01, 0x40, 0x0a, 0x25, 0x40, 0x08, 0x06, 0x40,
+    0x06, 0x83, 0x00, 0x40, 0x0b, 0x05, 0x80, 0x01, 0x40, 0x0a, 0x25, 0x40,
+    0x08, 0x06, 0x40, 0x06, 0x83, 0x00, 0x40, 0x0b, 0x05, 0x80, 0x01, 0x40,
+    0x0a, 0x25, 0x40, 0x08, 0x06, 0x45, 0x7f, 0x0c, 0x0c, 0x0c, 0x0c, 0xf0,
+    0x05, 0x80, 0x01, 0x40, 0x0a, 0x20, 0x84, 0x00, 0x40, 0x08, 0x81, 0x01,
+    0x0d, 0x83, 0x01, 0x40, 0x0a, 0x82, 0x00, 0x1d, 0x84, 0x00, 0x40, 0x08,
+    0x81, 0x01, 0x0d, 0x83, 0x01, 0x40, 0x0a, 0x82, 0x00, 0x1b, 0x81, 0x00,
+    0x00, 0x46, 0x15, 0x15, 0x15, 0x15, 0xb0, 0x30, 0x30, 0x8e, 0x01, 0x46,
+    0xaf, 0x30, 0x30, 0x93, 0x15, 0x15, 0x15, 0x00, 0x40, 0xa4, 0x80, 0x00,
+    0x18, 0x81, 0x00, 0x07, 0x8e, 0x01, 0x40, 0x32, 0x06, 0x40, 0x07, 0x80,
+    0x00, 0x16, 0x80, 0x00, 0x00, 0x41, 0x1f, 0x1f, 0x07, 0x4e, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0xc0, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x06, 0x41, 0xe0, 0x1f, 0x15, 0x81,
+    0x00, 0x40, 0x03, 0x0e, 0x84, 0x03, 0x03, 0x80, 0x03, 0x40, 0x1b, 0x09,
+    0x40, 0x04, 0x13, 0x81, 0x00, 0x40, 0x03, 0x0e, 0x84, 0x03, 0x03, 0x80,
+    0x03, 0x40, 0x1b, 0x09, 0x40, 0x04, 0x12, 0x42, 0x58, 0x1d, 0x1d, 0x05,
+    0x82, 0x02, 0x01, 0x84, 0x03, 0x45, 0x13, 0x13, 0x13, 0x13, 0x13, 0xf3,
+    0x83, 0x03, 0x40, 0x1b, 0x00, 0x82, 0x02, 0x05, 0x42, 0x5c, 0x1d, 0x1d,
+    0x10, 0x40, 0x01, 0x80, 0x02, 0x06, 0x82, 0x02, 0x01, 0x84, 0x03, 0x40,
+    0x28, 0x03, 0x40, 0x24, 0x83, 0x03, 0x40, 0x1b, 0x00, 0x82, 0x02, 0x05,
+    0x82, 0x02, 0x40, 0x00, 0x0f, 0x40, 0x01, 0x80, 0x02, 0x06, 0x82, 0x02,
+    0x01, 0x84, 0x03, 0x40, 0x28, 0x83, 0x02, 0x40, 0x24, 0x83, 0x03, 0x40,
+    0x1b, 0x00, 0x82, 0x02, 0x05, 0x82, 0x02, 0x40, 0x00, 0x0f, 0x40, 0x01,
+    0x80, 0x02, 0x05, 0x43, 0x3e, 0x21, 0x21, 0x5e, 0x01, 0x45, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x55, 0x83, 0x02, 0x00, 0x44, 0x12, 0x12, 0x12, 0x12,
+    0x49, 0x00, 0x80, 0x02, 0x43, 0x3e, 0x21, 0x21, 0x5e, 0x03, 0x82, 0x02,
+    0x40, 0x00, 0x0f, 0x40, 0x01, 0x80, 0x02, 0x05, 0x40, 0x04, 0x80, 0x00,
+    0x00, 0x40, 0x03, 0x06, 0x84, 0x02, 0x06, 0x80, 0x02, 0x40, 0x04, 0x81,
+    0x00, 0x40, 0x03, 0x03, 0x82, 0x02, 0x40, 0x00, 0x0f, 0x40, 0x01, 0x80,
+    0x02, 0x05, 0x40, 0x04, 0x80, 0x00, 0x00, 0x40, 0x03, 0x06, 0x44, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x06, 0x80, 0x02, 0x40, 0x04, 0x81, 0x00, 0x40,
+    0x03, 0x03, 0x82, 0x02, 0x40, 0x00, 0x0f, 0x40, 0x01, 0x80, 0x02, 0x05,
+    0x40, 0x04, 0x80, 0x00, 0x00, 0x40, 0x03, 0x06, 0x40, 0x2a, 0x02, 0x80,
+    0x03, 0x40, 0x29, 0x05, 0x80, 0x02, 0x40, 0x04, 0x81, 0x00, 0x40, 0x03,
+    0x03, 0x82, 0x02, 0x40, 0x00, 0x06, 0x14, 0x81, 0x00, 0x0c, 0x82, 0x03,
+    0x40, 0x19, 0x28, 0x81, 0x00, 0x0c, 0x82, 0x03, 0x40, 0x19, 0x28, 0x81,
+    0x00, 0x0c, 0x82, 0x03, 0x40, 0x19, 0x28, 0x81, 0x00, 0x0c, 0x82, 0x03,
+    0x40, 0x19, 0x28, 0x81, 0x00, 0x0c, 0x82, 0x03, 0x40, 0x19, 0x28, 0x81,
+    0x00, 0x0c, 0x82, 0x03, 0x40, 0x19, 0x1e, 0x80, 0x00, 0x4a, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x88, 0x1a, 0x1a, 0x0c, 0x82, 0x03,
+    0x4b, 0x9f, 0x1a, 0x1a, 0xf7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0xf8, 0x13, 0x80, 0x00, 0x06, 0x80, 0x01, 0x40, 0x40, 0x11, 0x82, 0x03,
+    0x40, 0x60, 0x03, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00, 0x06, 0x80,
+    0x01, 0x40, 0x40, 0x11, 0x82, 0x03, 0x40, 0x60, 0x03, 0x82, 0x01, 0x40,
+    0x18, 0x13, 0x80, 0x00, 0x22, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00,
+    0x22, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00, 0x22, 0x82, 0x01, 0x40,
+    0x18, 0x13, 0x80, 0x00, 0x22, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00,
+    0x22, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00, 0x22, 0x82, 0x01, 0x40,
+    0x18, 0x13, 0x80, 0x00, 0x22, 0x82, 0x01, 0x40, 0x18, 0x13, 0x80, 0x00,
+    0x86, 0x01, 0x01, 0x85, 0x01, 0x04, 0x84, 0x01, 0x01, 0x8a, 0x01, 0x40,
+    0x18, 0x14, 0x48, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x39,
+    0x81, 0x01, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3f, 0x01, 0x82, 0x01,
+    0x45, 0x36, 0x02, 0x02, 0x02, 0x02, 0x3a, 0x81, 0x01, 0x48, 0x52, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1b, 0x80, 0x00, 0x40, 0x08,
+    0x81, 0x01, 0x02, 0x81, 0x00, 0x40, 0x0b, 0x01, 0x82, 0x01, 0x40, 0x06,
+    0x00, 0x82, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x40, 0x0a, 0x23, 0x80, 0x00,
+    0x40, 0x08, 0x81, 0x01, 0x02, 0x81, 0x00, 0x40, 0x0b, 0x01, 0x82, 0x01,
+    0x40, 0x06, 0x00, 0x82, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x40, 0x0a, 0x23,
+    0x80, 0x00, 0x40, 0x08, 0x81, 0x01, 0x02, 0x81, 0x00, 0x40, 0x0b, 0x01,
+    0x82, 0x01, 0x40, 0x06, 0x00, 0x82, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x40,
+    0x0a, 0x23, 0x80, 0x00, 0x40, 0x08, 0x81, 0x01, 0x84, 0x00, 0x40, 0x0b,
+    0x84, 0x01, 0x40, 0x06, 0x83, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x40, 0x0a,
+    0x23, 0x80, 0x00, 0x40, 0x08, 0x01, 0x50, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x98, 0x17, 0x17, 0x17, 0x17, 0x17, 0xab, 0x09, 0x09, 0x09, 0x09, 0x4c,
+    0x81, 0x01, 0x40, 0x0a, 0x23, 0x80, 0x00, 0x40, 0x08, 0x04, 0x81, 0x01,
+    0x40, 0x0a, 0x01, 0x82, 0x00, 0x40, 0x08, 0x03, 0x82, 0x01, 0x40, 0x0a,
+    0x23, 0x80, 0x00, 0x40, 0x08, 0x05, 0x80, 0x01, 0x40, 0x0a, 0x84, 0x00,
+    0x40, 0x08, 0x03, 0x82, 0x01, 0x40, 0x0a, 0x23, 0x80, 0x00, 0x40, 0x08,
+    0x06, 0x45, 0xe8, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x82, 0x01, 0x40,
+    0x0a, 0x1e, 0x85, 0x00, 0x40, 0x08, 0x0f, 0x84, 0x01, 0x40, 0x0a, 0x80,
+    0x00, 0x1c, 0x86, 0x00, 0x40, 0x08, 0x80, 0x01, 0x0d, 0x85, 0x01, 0x40,
+    0x0a, 0x81, 0x00, 0x1b, 0x80, 0x00, 0x48, 0xfb, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0xb0, 0x30, 0x30, 0x0c, 0x82, 0x01, 0x48, 0xaf, 0x30, 0x30, 0x93,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x82, 0x00, 0x40, 0x05, 0x05, 0x81,
+    0x02, 0x8f, 0x01, 0x40, 0x32, 0x04, 0x82, 0x02, 0x16, 0x82, 0x00, 0x40,
+    0x05, 0x05, 0x81, 0x02, 0x8f, 0x01, 0x40, 0x32, 0x06, 0x80, 0x02, 0x16,
+    0x80, 0x00, 0x08, 0x81, 0x02, 0x0c, 0x82, 0x03, 0x40, 0x1b, 0x06, 0x82,
+    0x02, 0x40, 0x07, 0x10, 0x83, 0x00, 0x08, 0x81, 0x02, 0x02, 0x85, 0x03,
+    0x03, 0x82, 0x03, 0x40, 0x1b, 0x08, 0x80, 0x02, 0x40, 0x07, 0x10, 0x83,
+    0x00, 0x08, 0x81, 0x02, 0x02, 0x85, 0x03, 0x03, 0x82, 0x03, 0x40, 0x1b,
+    0x08, 0x80, 0x02, 0x40, 0x07, 0x10, 0x80, 0x00, 0x40, 0x03, 0x05, 0x82,
+    0x02, 0x01, 0x81, 0x02, 0x84, 0x03, 0x40, 0x29, 0x02, 0x81, 0x02, 0x40,
+    0x2a, 0x83, 0x03, 0x40, 0x1b, 0x81, 0x02, 0x06, 0x83, 0x02, 0x40, 0x04,
+    0x0d, 0x80, 0x00, 0x40, 0x03, 0x05, 0x82, 0x02, 0x03, 0x84, 0x03, 0x40,
+    0x29, 0x04, 0x40, 0x2a, 0x83, 0x03, 0x40, 0x1b, 0x81, 0x02, 0x06, 0x83,
+    0x02, 0x40, 0x04, 0x0d, 0x80, 0x00, 0x40, 0x03, 0x05, 0x80, 0x02, 0x42,
+    0x8a, 0x1e, 0x1e, 0x02, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x9a, 0x04,
+    0x45, 0x46, 0x20, 0x20, 0x20, 0x20, 0x51, 0x81, 0x02, 0x00, 0x41, 0x1e,
+    0x1e, 0x03, 0x83, 0x02, 0x40, 0x04, 0x0d, 0x80, 0x00, 0x40, 0x03, 0x05,
+    0x80, 0x02, 0x40, 0x04, 0x00, 0x80, 0x00, 0x40, 0x03, 0x04, 0x85, 0x02,
+    0x06, 0x82, 0x02, 0x40, 0x04, 0x81, 0x00, 0x40, 0x03, 0x02, 0x83, 0x02,
+    0x40, 0x04, 0x0d, 0x80, 0x00, 0x40, 0x03, 0x05, 0x80, 0x02, 0x40, 0x04,
+    0x00, 0x80, 0x00, 0x40, 0x03, 0x04, 0x85, 0x02, 0x06, 0x82, 0x02, 0x40,
+    0x04, 0x81, 0x00, 0x40, 0x03, 0x02, 0x83, 0x02, 0x40, 0x04, 0x0d, 0x80,
+    0x00, 0x40, 0x03, 0x05, 0x80, 0x02, 0x40, 0x04, 0x00, 0x80, 0x00, 0x40,
+    0x03, 0x04, 0x81, 0x02, 0x45, 0xfe, 0x31, 0x31, 0x31, 0x31, 0x31, 0x04,
+    0x82, 0x02, 0x40, 0x04, 0x81, 0x00, 0x40, 0x03, 0x02, 0x83, 0x02, 0x40,
+    0x04, 0x05, 0x13, 0x40, 0x2e, 0x81, 0x03, 0x0e, 0x80, 0x00, 0x28, 0x40,
+    0x2e, 0x81, 0x03, 0x0e, 0x80, 0x00, 0x14, 0x93, 0x00, 0x40, 0x2e, 0x90,
+    0x03, 0xa9, 0x00, 0x40, 0x2e, 0x90, 0x03, 0x9e, 0x00, 0x4b, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0xbb, 0x26, 0x26, 0xeb, 0x90, 0x03,
+    0x4b, 0x26, 0x26, 0x26, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x82, 0x89, 0x00, 0x08, 0x40, 0x08, 0x86, 0x01, 0x40, 0xa9, 0x84, 0x03,
+    0x0e, 0x82, 0x03, 0x87, 0x01, 0x40, 0x0a, 0x12, 0x40, 0x08, 0x86, 0x01,
+    0x40, 0xa9, 0x84, 0x03, 0x0e, 0x82, 0x03, 0x87, 0x01, 0x40, 0x0a, 0x12,
+    0x40, 0x08, 0x82, 0x01, 0x04, 0x56, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x80, 0x01, 0x1a, 0x40, 0x08, 0x82, 0x01,
+    0x06, 0x95, 0x01, 0x1a, 0x40, 0x08, 0x82, 0x01, 0x06, 0x95, 0x01, 0x1a,
+    0x40, 0x08, 0x82, 0x01, 0x37, 0x40, 0x08, 0x82, 0x01, 0x37, 0x40, 0x08,
+    0x82, 0x01, 0x37, 0x40, 0x08, 0x82, 0x01, 0x37, 0x40, 0x08, 0x82, 0x01,
+    0x37, 0x40, 0x08, 0x82, 0x01, 0x37, 0x48, 0x67, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x3a, 0x01, 0x46, 0x38, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x3f, 0x04, 0x45, 0x36, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x48, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xac, 0x15, 0x84, 0x00, 0x40,
+    0x0d, 0x81, 0x01, 0x40, 0x18, 0x84, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x03,
+    0x40, 0x06, 0x84, 0x00, 0x80, 0x01, 0x01, 0x87, 0x00, 0x1b, 0x40, 0x0d,
+    0x81, 0x01, 0x40, 0x18, 0x81, 0x00, 0x02, 0x40, 0x0b, 0x81, 0x01, 0x02,
+    0x40, 0x06, 0x80, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80, 0x00, 0x22, 0x40,
+    0x0d, 0x81, 0x01, 0x40, 0x18, 0x81, 0x00, 0x02, 0x40, 0x0b, 0x81, 0x01,
+    0x02, 0x40, 0x06, 0x80, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80, 0x00, 0x22,
+    0x40, 0x0d, 0x81, 0x01, 0x40, 0x18, 0x81, 0x00, 0x02, 0x40, 0x0b, 0x81,
+    0x01, 0x02, 0x40, 0x06, 0x80, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80, 0x00,
+    0x22, 0x40, 0x0d, 0x81, 0x01, 0x40, 0x18, 0x81, 0x00, 0x02, 0x40, 0x0b,
+    0x81, 0x01, 0x02, 0x40, 0x06, 0x80, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80,
+    0x00, 0x22, 0x40, 0x0d, 0x82, 0x01, 0x01, 0x82, 0x01, 0x40, 0x0a, 0x84,
+    0x00, 0x40, 0x08, 0x85, 0x01, 0x01, 0x80, 0x00, 0x22, 0x40, 0x0d, 0x82,
+    0x01, 0x04, 0x40, 0x0a, 0x81, 0x00, 0x02, 0x40, 0x08, 0x80, 0x01, 0x06,
+    0x80, 0x00, 0x22, 0x40, 0x0d, 0x82, 0x01, 0x04, 0x46, 0xad, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x7e, 0x80, 0x01, 0x06, 0x80, 0x00, 0x22, 0x40, 0x0d,
+    0x82, 0x01, 0x06, 0x85, 0x01, 0x06, 0x80, 0x00, 0x22, 0x40, 0x0d, 0x82,
+    0x01, 0x13, 0x80, 0x00, 0x1d, 0x48, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xbf,
+    0x35, 0x35, 0x35, 0x10, 0x48, 0x35, 0x35, 0x35, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x64, 0x18, 0x82, 0x02, 0x00, 0x83, 0x02, 0x40, 0x4f, 0x81, 0x01,
+    0x0e, 0x87, 0x02, 0x40, 0x07, 0x18, 0x82, 0x02, 0x04, 0x40, 0x4f, 0x81,
+    0x01, 0x0e, 0x80, 0x02, 0x1d, 0x42, 0x99, 0x1d, 0x1d, 0x82, 0x02, 0x04,
+    0x51, 0xf1, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x80, 0x02, 0x07, 0x42, 0x1d,
+    0x1d, 0x4b, 0x12, 0x40, 0x03, 0x82, 0x02, 0x06, 0x40, 0x27, 0x81, 0x03,
+    0x0e, 0x80, 0x02, 0x1d, 0x40, 0x03, 0x82, 0x02, 0x06, 0x40, 0x27, 0x81,
+    0x03, 0x0e, 0x80, 0x02, 0x1a, 0x43, 0x99, 0x1d, 0x1d, 0x73, 0x81, 0x02,
+    0x07, 0x40, 0x27, 0x81, 0x03, 0x02, 0x41, 0xa0, 0x13, 0x03, 0x40, 0xfc,
+    0x80, 0x03, 0x03, 0x80, 0x02, 0x0c, 0x40, 0x4b, 0x0c, 0x40, 0x03, 0x82,
+    0x02, 0x09, 0x40, 0x27, 0x81, 0x03, 0x02, 0x40, 0x29, 0x81, 0x02, 0x02,
+    0x40, 0x2a, 0x80, 0x03, 0x03, 0x80, 0x02, 0x0c, 0x40, 0x04, 0x0c, 0x40,
+    0x03, 0x82, 0x02, 0x09, 0x40, 0x27, 0x81, 0x03, 0x02, 0x40, 0x29, 0x81,
+    0x02, 0x02, 0x40, 0x2a, 0x80, 0x03, 0x03, 0x80, 0x02, 0x0c, 0x40, 0x04,
+    0x0c, 0x40, 0x03, 0x82, 0x02, 0x04, 0x42, 0x22, 0x22, 0x45, 0x81, 0x02,
+    0x46, 0x3c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x75, 0x80, 0x02, 0x03, 0x45,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x80, 0x02, 0x01, 0x42, 0x22, 0x22,
+    0x45, 0x80, 0x02, 0x06, 0x40, 0x04, 0x0c, 0x40, 0x03, 0x82, 0x02, 0x04,
+    0x81, 0x00, 0x40, 0x05, 0x82, 0x02, 0x13, 0x80, 0x00, 0x00, 0x40, 0x05,
+    0x80, 0x02, 0x06, 0x40, 0x04, 0x0c, 0x40, 0x03, 0x82, 0x02, 0x04, 0x81,
+    0x00, 0x40, 0x05, 0x82, 0x02, 0x06, 0x84, 0x02, 0x07, 0x80, 0x00, 0x00,
+    0x40, 0x05, 0x80, 0x02, 0x06, 0x40, 0x04, 0x0c, 0x40, 0x03, 0x82, 0x02,
+    0x04, 0x81, 0x00, 0x40, 0x05, 0x82, 0x02, 0x04, 0x46, 0x9d, 0x2f, 0x2f,
+    0x2f, 0x2f, 0x2f, 0x6f, 0x80, 0x02, 0x06, 0x80, 0x00, 0x00, 0x40, 0x05,
+    0x80, 0x02, 0x06, 0x40, 0x04, 0x06, 0x14, 0x81, 0x03, 0x0f, 0x80, 0x00,
+    0x28, 0x81, 0x03, 0x0f, 0x80, 0x00, 0x28, 0x81, 0x03, 0x0f, 0x80, 0x00,
+    0x28, 0x81, 0x03, 0x0f, 0x80, 0x00, 0x28, 0x81, 0x03, 0x0f, 0x80, 0x00,
+    0x1c, 0x88, 0x01, 0x84, 0x03, 0x0f, 0x82, 0x03, 0x88, 0x01, 0x11, 0x88,
+    0x01, 0x84, 0x03, 0x10, 0x81, 0x03, 0x88, 0x01, 0x11, 0x82, 0x01, 0x05,
+    0x82, 0x03, 0x14, 0x80, 0x01, 0x06, 0x80, 0x01, 0x11, 0x82, 0x01, 0x07,
+    0x96, 0x01, 0x06, 0x80, 0x01, 0x11, 0x82, 0x01, 0x25, 0x80, 0x01, 0x11,
+    0x82, 0x01, 0x25, 0x80, 0x01, 0x11, 0x82, 0x01, 0x25, 0x80, 0x01, 0x11,
+    0x82, 0x01, 0x25, 0x80, 0x01, 0x11, 0x82, 0x01, 0x25, 0x80, 0x01, 0x11,
+    0x82, 0x01, 0x25, 0x80, 0x01, 0x11, 0x82, 0x01, 0x25, 0x80, 0x01, 0x11,
+    0x82, 0x01, 0x25, 0x80, 0x01, 0x14, 0x85, 0x00, 0x82, 0x01, 0x85, 0x00,
+    0x81, 0x01, 0x03, 0x85, 0x00, 0x80, 0x01, 0x01, 0x88, 0x00, 0x1a, 0x82,
+    0x01, 0x81, 0x00, 0x03, 0x81, 0x01, 0x03, 0x81, 0x00, 0x03, 0x80, 0x01,
+    0x01, 0x80, 0x00, 0x22, 0x82, 0x01, 0x81, 0x00, 0x03, 0x81, 0x01, 0x03,
+    0x81, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80, 0x00, 0x22, 0x82, 0x01, 0x81,
+    0x00, 0x03, 0x81, 0x01, 0x03, 0x81, 0x00, 0x03, 0x80, 0x01, 0x01, 0x80,
+    0x00, 0x22, 0x82, 0x01, 0x81, 0x00, 0x03, 0x81, 0x01, 0x03, 0x81, 0x00,
+    0x03, 0x80, 0x01, 0x01, 0x80, 0x00, 0x22, 0x82, 0x01, 0x85, 0x00, 0x85,
+    0x01, 0x85, 0x00, 0x80, 0x01, 0x01, 0x80, 0x00, 0x22, 0x82, 0x01, 0x05,
+    0x81, 0x00, 0x03, 0x81, 0x01, 0x06, 0x80, 0x00, 0x22, 0x82, 0x01, 0x05,
+    0x81, 0x00, 0x03, 0x81, 0x01, 0x06, 0x80, 0x00, 0x22, 0x82, 0x01, 0x05,
+    0x85, 0x00, 0x80, 0x01, 0x07, 0x80, 0x00, 0x22, 0x82, 0x01, 0x14, 0x80,
+    0x00, 0x22, 0x82, 0x01, 0x14, 0x80, 0x00, 0x1e, 0x83, 0x00, 0x84, 0x01,
+    0x0f, 0x82, 0x01, 0x85, 0x00, 0x17, 0x82, 0x02, 0x05, 0x81, 0x01, 0x0f,
+    0x80, 0x02, 0x1f, 0x82, 0x02, 0x05, 0x81, 0x01, 0x0f, 0x80, 0x02, 0x28,
+    0x91, 0x01, 0x80, 0x02, 0x07, 0x82, 0x00, 0x11, 0x82, 0x02, 0x08, 0x81,
+    0x03, 0x0f, 0x80, 0x02, 0x09, 0x80, 0x02, 0x11, 0x82, 0x02, 0x08, 0x81,
+    0x03, 0x0f, 0x80, 0x02, 0x09, 0x80, 0x02, 0x11, 0x80, 0x02, 0x0a, 0x81,
+    0x03, 0x04, 0x86, 0x03, 0x03, 0x80, 0x02, 0x0a, 0x82, 0x00, 0x0b, 0x83,
+    0x02, 0x0a, 0x81, 0x03, 0x03, 0x81, 0x02, 0x03, 0x81, 0x03, 0x03, 0x80,
+    0x02, 0x0c, 0x80, 0x02, 0x0b, 0x83, 0x02, 0x06, 0x82, 0x02, 0x00, 0x85,
+    0x03, 0x81, 0x02, 0x03, 0x85, 0x03, 0x80, 0x02, 0x02, 0x81, 0x02, 0x07,
+    0x80, 0x02, 0x0b, 0x83, 0x02, 0x06, 0x83, 0x02, 0x85, 0x03, 0x05, 0x85,
+    0x03, 0x02, 0x83, 0x02, 0x06, 0x80, 0x02, 0x0b, 0x83, 0x02, 0x04, 0x82,
+    0x00, 0x82, 0x02, 0x14, 0x80, 0x00, 0x01, 0x80, 0x02, 0x06, 0x80, 0x02,
+    0x0b, 0x83, 0x02, 0x04, 0x82, 0x00, 0x82, 0x02, 0x06, 0x85, 0x02, 0x07,
+    0x80, 0x00, 0x01, 0x80, 0x02, 0x06, 0x80, 0x02, 0x05, 0x03, 0x80, 0x06,
+    0x04, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x05, 0x02, 0x80,
+    0x07, 0x40, 0x2b, 0x80, 0x03, 0x0a, 0x80, 0x05, 0x80, 0x06, 0x03, 0x80,
+    0x04, 0x03, 0x80, 0x06, 0x01, 0x80, 0x06, 0x08, 0x80, 0x07, 0x00, 0x80,
+    0x07, 0x00, 0x81, 0x05, 0x00, 0x80, 0x05, 0x80, 0x07, 0x04, 0x80, 0x04,
+    0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x06, 0x03, 0x40, 0x2b, 0x80, 0x04,
+    0x04, 0x80, 0x07, 0x80, 0x05, 0x00, 0x80, 0x06, 0x09, 0x80, 0x07, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x01, 0x81, 0x04, 0x03, 0x80, 0x06, 0x80, 0x07,
+    0x01, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x07, 0x01, 0x80, 0x07, 0x00,
+    0x80, 0x06, 0x00, 0x80, 0x06, 0x04, 0x80, 0x06, 0x04, 0x40, 0x2b, 0x80,
+    0x03, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x05, 0x80, 0x07, 0x03,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x04, 0x02, 0x80, 0x07, 0x02, 0x80,
+    0x06, 0x80, 0x07, 0x07, 0x80, 0x07, 0x04, 0x80, 0x06, 0x09, 0x81, 0x05,
+    0x00, 0x80, 0x07, 0x00, 0x40, 0x2b, 0x80, 0x03, 0x80, 0x06, 0x02, 0x80,
+    0x05, 0x01, 0x80, 0x05, 0x03, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x07,
+    0x00, 0x80, 0x04, 0x05, 0x80, 0x04, 0x00, 0x80, 0x04, 0x02, 0x80, 0x04,
+    0x01, 0x80, 0x04, 0x01, 0x80, 0x04, 0x80, 0x05, 0x02, 0x80, 0x04, 0x00,
+    0x80, 0x05, 0x03, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x84, 0x00, 0x80,
+    0x04, 0x80, 0x00, 0x40, 0x2b, 0x80, 0x06, 0x02, 0x80, 0x05, 0x01, 0x80,
+    0x07, 0x07, 0x80, 0x05, 0x80, 0x04, 0x81, 0x05, 0x80, 0x00, 0x80, 0x04,
+    0x80, 0x06, 0x81, 0x00, 0x80, 0x05, 0x82, 0x00, 0x03, 0x80, 0x05, 0x00,
+    0x80, 0x04, 0x03, 0x80, 0x07, 0x01, 0x80, 0x06, 0x80, 0x07, 0x00, 0x42,
+    0xb2, 0x10, 0x10, 0x80, 0x04, 0x41, 0x10, 0x10, 0x80, 0x07, 0x43, 0x10,
+    0x10, 0x10, 0x88, 0x80, 0x05, 0x80, 0x06, 0x03, 0x81, 0x05, 0x00, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x03, 0x80, 0x04, 0x02, 0x80,
+    0x07, 0x80, 0x05, 0x41, 0x1a, 0x10, 0x80, 0x05, 0x40, 0x10, 0x80, 0x05,
+    0x42, 0x10, 0x10, 0x10, 0x80, 0x05, 0x41, 0x10, 0x0a, 0x08, 0x80, 0x04,
+    0x02, 0x80, 0x07, 0x80, 0x04, 0x40, 0x0d, 0x82, 0x01, 0x03, 0x80, 0x05,
+    0x00, 0x40, 0x40, 0x80, 0x04, 0x01, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00,
+    0x80, 0x06, 0x03, 0x80, 0x07, 0x03, 0x81, 0x06, 0x05, 0x80, 0x04, 0x00,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x01, 0x40, 0x0a,
+    0x80, 0x05, 0x02, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x00,
+    0x80, 0x06, 0x00, 0x80, 0x05, 0x01, 0x80, 0x05, 0x40, 0x0d, 0x81, 0x01,
+    0x80, 0x06, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x04, 0x81, 0x03, 0x80, 0x05, 0x86, 0x03, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x03, 0x80, 0x07, 0x81, 0x03, 0x80, 0x07, 0x80, 0x04, 0x82,
+    0x03, 0x81, 0x06, 0x07, 0x80, 0x05, 0x80, 0x07, 0x81, 0x04, 0x80, 0x07,
+    0x80, 0x06, 0x01, 0x80, 0x07, 0x80, 0x05, 0x05, 0x80, 0x06, 0x80, 0x04,
+    0x80, 0x01, 0x80, 0x04, 0x80, 0x01, 0x04, 0x80, 0x05, 0x44, 0xa6, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x40, 0x0e, 0x80,
+    0x05, 0x80, 0x04, 0x42, 0x0e, 0x0e, 0x0e, 0x80, 0x06, 0x80, 0x04, 0x42,
+    0x0e, 0x0e, 0x0e, 0x80, 0x05, 0x80, 0x06, 0x40, 0x0e, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x00, 0x80, 0x06, 0x02, 0x80, 0x05, 0x01, 0x80, 0x07,
+    0x40, 0x0a, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x07, 0x00, 0x80,
+    0x06, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x40, 0x0d, 0x81, 0x04, 0x80, 0x01, 0x80, 0x06, 0x01, 0x80,
+    0x06, 0x0a, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80,
+    0x07, 0x06, 0x80, 0x04, 0x02, 0x80, 0x07, 0x02, 0x80, 0x05, 0x01, 0x80,
+    0x01, 0x40, 0x0a, 0x80, 0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80,
+    0x04, 0x04, 0x80, 0x07, 0x01, 0x40, 0x0d, 0x82, 0x01, 0x00, 0x80, 0x04,
+    0x01, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x01, 0x81, 0x04, 0x03, 0x80,
+    0x06, 0x01, 0x80, 0x05, 0x01, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x04,
+    0x80, 0x07, 0x00, 0x80, 0x07, 0x01, 0x80, 0x07, 0x01, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x05, 0x40, 0x0a, 0x01, 0x80, 0x07, 0x01, 0x80, 0x06, 0x80,
+    0x05, 0x00, 0x80, 0x05, 0x00, 0x80, 0x05, 0x00, 0x80, 0x05, 0x01, 0x40,
+    0x0d, 0x80, 0x04, 0x81, 0x01, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80, 0x05,
+    0x00, 0x80, 0x04, 0x06, 0x80, 0x04, 0x80, 0x05, 0x01, 0x80, 0x07, 0x00,
+    0x80, 0x06, 0x80, 0x07, 0x01, 0x80, 0x05, 0x04, 0x80, 0x04, 0x05, 0x80,
+    0x06, 0x80, 0x07, 0x80, 0x01, 0x40, 0x0a, 0x80, 0x05, 0x04, 0x80, 0x05,
+    0x03, 0x80, 0x06, 0x01, 0x80, 0x05, 0x40, 0x0d, 0x80, 0x01, 0x80, 0x04,
+    0x80, 0x01, 0x01, 0x80, 0x04, 0x01, 0x80, 0x05, 0x02, 0x80, 0x04, 0x02,
+    0x80, 0x06, 0x03, 0x80, 0x06, 0x00, 0x80, 0x05, 0x02, 0x80, 0x04, 0x01,
+    0x80, 0x06, 0x02, 0x80, 0x07, 0x00, 0x80, 0x04, 0x01, 0x80, 0x04, 0x01,
+    0x80, 0x01, 0x80, 0x04, 0x80, 0x07, 0x06, 0x80, 0x04, 0x03, 0x80, 0x04,
+    0x80, 0x05, 0x40, 0x0d, 0x80, 0x06, 0x80, 0x01, 0x80, 0x05, 0x00, 0x80,
+    0x05, 0x00, 0x80, 0x07, 0x00, 0x80, 0x04, 0x03, 0x80, 0x04, 0x00, 0x80,
+    0x06, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x07, 0x03, 0x80, 0x07, 0x80,
+    0x05, 0x80, 0x06, 0x00, 0x80, 0x05, 0x00, 0x80, 0x04, 0x03, 0x80, 0x07,
+    0x03, 0x80, 0x04, 0x80, 0x06, 0x80, 0x01, 0x40, 0x0a, 0x09, 0x80, 0x05,
+    0x01, 0x80, 0x05, 0x80, 0x04, 0x40, 0x0d, 0x81, 0x01, 0x80, 0x07, 0x08,
+    0x82, 0x05, 0x00, 0x81, 0x06, 0x01, 0x80, 0x07, 0x05, 0x80, 0x05, 0x00,
+    0x80, 0x04, 0x01, 0x80, 0x04, 0x03, 0x80, 0x04, 0x03, 0x80, 0x01, 0x40,
+    0x0a, 0x04, 0x80, 0x06, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x01, 0x80,
+    0x06, 0x00, 0x40, 0x0d, 0x81, 0x01, 0x80, 0x07, 0x02, 0x80, 0x05, 0x01,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x04, 0x80, 0x07, 0x00, 0x80, 0x05, 0x00,
+    0x80, 0x05, 0x01, 0x80, 0x05, 0x80, 0x07, 0x0c, 0x80, 0x05, 0x00, 0x80,
+    0x05, 0x80, 0x01, 0x40, 0x0a, 0x03, 0x80, 0x04, 0x00, 0x80, 0x07, 0x01,
+    0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x01, 0x80, 0x05, 0x40, 0x0d, 0x80,
+    0x07, 0x81, 0x01, 0x80, 0x07, 0x80, 0x01, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x07, 0x00, 0x83, 0x01,
+    0x80, 0x04, 0x80, 0x01, 0x80, 0x07, 0x80, 0x05, 0x03, 0x80, 0x07, 0x84,
+    0x01, 0x02, 0x82, 0x01, 0x80, 0x07, 0x80, 0x05, 0x81, 0x01, 0x80, 0x05,
+    0x80, 0x04, 0x40, 0x0a, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x00, 0x80,
+    0x05, 0x00, 0x80, 0x06, 0x04, 0x80, 0x05, 0x80, 0x06, 0x41, 0x17, 0x17,
+    0x80, 0x04, 0x45, 0x17, 0x17, 0x17, 0x17, 0x17, 0x90, 0x80, 0x05, 0x00,
+    0x45, 0x91, 0x17, 0x17, 0x17, 0x17, 0x17, 0x80, 0x06, 0x80, 0x01, 0x01,
+    0x80, 0x04, 0x01, 0x41, 0x17, 0x17, 0x80, 0x06, 0x42, 0x17, 0x17, 0x17,
+    0x02, 0x80, 0x05, 0x42, 0x17, 0x17, 0x17, 0x80, 0x06, 0x40, 0x17, 0x80,
+    0x04, 0x42, 0x17, 0x17, 0xd0, 0x01, 0x80, 0x07, 0x00, 0x81, 0x07, 0x80,
+    0x05, 0x02, 0x80, 0x07, 0x01, 0x80, 0x05, 0x00, 0x80, 0x04, 0x01, 0x80,
+    0x05, 0x80, 0x07, 0x00, 0x80, 0x07, 0x02, 0x40, 0x08, 0x80, 0x01, 0x80,
+    0x05, 0x40, 0x06, 0x80, 0x00, 0x03, 0x80, 0x04, 0x80, 0x01, 0x00, 0x80,
+    0x05, 0x01, 0x40, 0x18, 0x80, 0x00, 0x01, 0x80, 0x05, 0x03, 0x80, 0x06,
+    0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x01, 0x80,
+    0x07, 0x07, 0x81, 0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04,
+    0x03, 0x80, 0x07, 0x02, 0x80, 0x06, 0x40, 0x08, 0x80, 0x01, 0x00, 0x80,
+    0x04, 0x80, 0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x01, 0x00, 0x80, 0x06, 0x01, 0x80, 0x05, 0x80, 0x06, 0x01, 0x80, 0x05,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x05,
+    0x80, 0x05, 0x02, 0x80, 0x04, 0x0c, 0x80, 0x04, 0x80, 0x06, 0x04, 0x80,
+    0x06, 0x00, 0x80, 0x05, 0x40, 0x08, 0x80, 0x01, 0x00, 0x40, 0x06, 0x80,
+    0x07, 0x03, 0x40, 0x0b, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x05, 0x00,
+    0x40, 0x18, 0x80, 0x04, 0x80, 0x06, 0x04, 0x80, 0x04, 0x0b, 0x80, 0x05,
+    0x02, 0x80, 0x06, 0x03, 0x81, 0x04, 0x09, 0x80, 0x07, 0x01, 0x40, 0x08,
+    0x80, 0x01, 0x00, 0x40, 0x06, 0x80, 0x04, 0x03, 0x40, 0x0b, 0x80, 0x01,
+    0x80, 0x05, 0x02, 0x40, 0x18, 0x80, 0x05, 0x00, 0x80, 0x07, 0x00, 0x81,
+    0x05, 0x02, 0x80, 0x06, 0x81, 0x07, 0x02, 0x80, 0x05, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x04, 0x05, 0x80, 0x04, 0x03, 0x80, 0x07, 0x02, 0x81, 0x04,
+    0x05, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x00, 0x40, 0x06, 0x81, 0x00,
+    0x80, 0x06, 0x81, 0x00, 0x40, 0x0b, 0x80, 0x01, 0x80, 0x06, 0x80, 0x05,
+    0x81, 0x01, 0x40, 0x18, 0x80, 0x05, 0x82, 0x00, 0x80, 0x07, 0x80, 0x00,
+    0x03, 0x80, 0x06, 0x80, 0x05, 0x05, 0x80, 0x04, 0x02, 0x80, 0x07, 0x80,
+    0x04, 0x00, 0x81, 0x04, 0x05, 0x80, 0x06, 0x80, 0x04, 0x81, 0x07, 0x00,
+    0x80, 0x04, 0x00, 0x80, 0x06, 0x02, 0x40, 0x08, 0x80, 0x01, 0x80, 0x05,
+    0x40, 0x06, 0x84, 0x00, 0x80, 0x05, 0x80, 0x01, 0x80, 0x06, 0x82, 0x01,
+    0x40, 0x18, 0x80, 0x04, 0x82, 0x00, 0x80, 0x05, 0x80, 0x00, 0x02, 0x80,
+    0x07, 0x08, 0x80, 0x06, 0x01, 0x81, 0x06, 0x0b, 0x80, 0x06, 0x04, 0x80,
+    0x04, 0x00, 0x40, 0x08, 0x80, 0x01, 0x05, 0x80, 0x07, 0x40, 0x0a, 0x80,
+    0x00, 0x80, 0x05, 0x81, 0x00, 0x80, 0x06, 0x40, 0x0d, 0x80, 0x05, 0x00,
+    0x81, 0x07, 0x80, 0x06, 0x80, 0x04, 0x03, 0x80, 0x06, 0x0c, 0x80, 0x05,
+    0x09, 0x80, 0x04, 0x00, 0x80, 0x05, 0x05, 0x40, 0x08, 0x80, 0x01, 0x02,
+    0x80, 0x07, 0x02, 0x80, 0x06, 0x80, 0x00, 0x80, 0x04, 0x81, 0x07, 0x80,
+    0x00, 0x40, 0x0d, 0x80, 0x06, 0x01, 0x80, 0x05, 0x00, 0x80, 0x06, 0x02,
+    0x80, 0x06, 0x80, 0x04, 0x03, 0x80, 0x04, 0x03, 0x80, 0x05, 0x01, 0x80,
+    0x06, 0x09, 0x80, 0x07, 0x04, 0x80, 0x05, 0x02, 0x40, 0x08, 0x80, 0x01,
+    0x80, 0x06, 0x05, 0x40, 0x0a, 0x80, 0x06, 0x80, 0x07, 0x80, 0x00, 0x80,
+    0x04, 0x80, 0x00, 0x40, 0x0d, 0x00, 0x80, 0x05, 0x80, 0x06, 0x01, 0x81,
+    0x07, 0x03, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x06, 0x08, 0x80, 0x04,
+    0x03, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x05, 0x80, 0x07, 0x80, 0x05,
+    0x80, 0x07, 0x81, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x01, 0x04, 0x41, 0x10, 0x10, 0x80, 0x05, 0x40, 0x10,
+    0x80, 0x06, 0x80, 0x05, 0x01, 0x81, 0x07, 0x80, 0x06, 0x00, 0x82, 0x01,
+    0x83, 0x00, 0x80, 0x05, 0x80, 0x00, 0x00, 0x81, 0x06, 0x00, 0x80, 0x06,
+    0x01, 0x80, 0x06, 0x00, 0x80, 0x05, 0x00, 0x80, 0x04, 0x05, 0x80, 0x06,
+    0x01, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x83, 0x00, 0x40, 0x08, 0x81,
+    0x06, 0x81, 0x01, 0x05, 0x80, 0x06, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05,
+    0x04, 0x80, 0x07, 0x80, 0x06, 0x81, 0x05, 0x80, 0x00, 0x80, 0x07, 0x80,
+    0x00, 0x80, 0x05, 0x80, 0x00, 0x02, 0x80, 0x06, 0x00, 0x80, 0x07, 0x0a,
+    0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x05, 0x03, 0x80, 0x06, 0x81, 0x00,
+    0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05,
+    0x80, 0x07, 0x01, 0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x07, 0x02, 0x80,
+    0x06, 0x80, 0x07, 0x02, 0x80, 0x04, 0x00, 0x80, 0x04, 0x80, 0x01, 0x80,
+    0x05, 0x80, 0x00, 0x80, 0x04, 0x83, 0x00, 0x00, 0x80, 0x05, 0x00, 0x80,
+    0x04, 0x02, 0x80, 0x07, 0x80, 0x04, 0x03, 0x80, 0x07, 0x01, 0x81, 0x07,
+    0x03, 0x80, 0x00, 0x41, 0x15, 0x15, 0x80, 0x05, 0x46, 0x15, 0x15, 0x15,
+    0xb0, 0x30, 0x30, 0x56, 0x80, 0x04, 0x85, 0x01, 0x80, 0x06, 0x80, 0x07,
+    0x82, 0x01, 0x81, 0x07, 0x83, 0x01, 0x80, 0x07, 0x48, 0x30, 0x30, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x5b, 0x80, 0x04, 0x80, 0x00, 0x00, 0x80,
+    0x06, 0x02, 0x80, 0x06, 0x05, 0x80, 0x07, 0x01, 0x80, 0x06, 0x80, 0x07,
+    0x00, 0x80, 0x07, 0x80, 0x04, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x03,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x01, 0x81, 0x07, 0x80, 0x05, 0x86, 0x01,
+    0x80, 0x06, 0x80, 0x01, 0x80, 0x06, 0x80, 0x07, 0x80, 0x01, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x07, 0x01,
+    0x80, 0x06, 0x40, 0x00, 0x81, 0x00, 0x02, 0x80, 0x07, 0x80, 0x04, 0x04,
+    0x80, 0x05, 0x06, 0x80, 0x05, 0x80, 0x00, 0x04, 0x80, 0x04, 0x00, 0x80,
+    0x07, 0x00, 0x40, 0x56, 0x80, 0x06, 0x80, 0x01, 0x81, 0x07, 0x82, 0x01,
+    0x80, 0x06, 0x83, 0x01, 0x80, 0x07, 0x80, 0x01, 0x80, 0x04, 0x80, 0x01,
+    0x80, 0x05, 0x80, 0x04, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x07,
+    0x40, 0x00, 0x81, 0x00, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80,
+    0x04, 0x00, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x05,
+    0x02, 0x80, 0x04, 0x40, 0x4d, 0x80, 0x06, 0x80, 0x04, 0x40, 0x1d, 0x00,
+    0x80, 0x05, 0x06, 0x47, 0xf5, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x80, 0x07, 0x40, 0x16, 0x80, 0x06, 0x46, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x80, 0x06, 0x80, 0x07, 0x00, 0x81, 0x06, 0x04, 0x41, 0x53,
+    0x1d, 0x80, 0x05, 0x40, 0x4b, 0x81, 0x00, 0x02, 0x82, 0x06, 0x03, 0x80,
+    0x07, 0x00, 0x80, 0x05, 0x40, 0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x06,
+    0x01, 0x80, 0x06, 0x03, 0x80, 0x07, 0x80, 0x03, 0x80, 0x07, 0x00, 0x80,
+    0x07, 0x01, 0x86, 0x03, 0x00, 0x80, 0x07, 0x00, 0x81, 0x07, 0x08, 0x80,
+    0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x00, 0x05, 0x80,
+    0x07, 0x01, 0x80, 0x05, 0x02, 0x40, 0x05, 0x00, 0x80, 0x07, 0x00, 0x81,
+    0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x03, 0x80, 0x06, 0x80, 0x03,
+    0x80, 0x07, 0x02, 0x80, 0x06, 0x80, 0x03, 0x80, 0x04, 0x82, 0x03, 0x80,
+    0x05, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x06, 0x81, 0x07, 0x04,
+    0x80, 0x05, 0x00, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00, 0x80, 0x07, 0x81,
+    0x00, 0x02, 0x80, 0x04, 0x80, 0x05, 0x01, 0x80, 0x07, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x06, 0x41, 0x1d, 0x74, 0x80, 0x07, 0x04, 0x81, 0x06, 0x80,
+    0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x40, 0x2a, 0x80, 0x07, 0x83,
+    0x03, 0x40, 0xa0, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80,
+    0x04, 0x40, 0x71, 0x80, 0x03, 0x80, 0x05, 0x82, 0x03, 0x80, 0x06, 0x81,
+    0x07, 0x00, 0x80, 0x06, 0x81, 0x02, 0x01, 0x80, 0x07, 0x81, 0x06, 0x00,
+    0x40, 0x5c, 0x80, 0x06, 0x41, 0x1d, 0x4b, 0x00, 0x80, 0x07, 0x00, 0x80,
+    0x04, 0x80, 0x07, 0x00, 0x80, 0x06, 0x81, 0x05, 0x40, 0x05, 0x80, 0x02,
+    0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x03, 0x80, 0x07, 0x01, 0x81, 0x02,
+    0x80, 0x07, 0x00, 0x80, 0x04, 0x81, 0x03, 0x80, 0x06, 0x80, 0x03, 0x80,
+    0x07, 0x40, 0x29, 0x04, 0x40, 0x27, 0x83, 0x03, 0x80, 0x07, 0x80, 0x03,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x02,
+    0x00, 0x80, 0x07, 0x05, 0x80, 0x02, 0x40, 0x04, 0x80, 0x06, 0x00, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x01, 0x80, 0x04, 0x40, 0x05, 0x80, 0x06, 0x81,
+    0x02, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x04, 0x01, 0x80, 0x05,
+    0x80, 0x02, 0x80, 0x07, 0x80, 0x02, 0x00, 0x40, 0x2a, 0x80, 0x04, 0x80,
+    0x03, 0x80, 0x07, 0x81, 0x03, 0x40, 0x29, 0x02, 0x80, 0x05, 0x80, 0x06,
+    0x40, 0x27, 0x81, 0x03, 0x80, 0x04, 0x80, 0x05, 0x81, 0x03, 0x80, 0x04,
+    0x01, 0x81, 0x07, 0x80, 0x02, 0x01, 0x80, 0x06, 0x04, 0x80, 0x02, 0x40,
+    0x04, 0x00, 0x80, 0x04, 0x80, 0x06, 0x00, 0x80, 0x04, 0x01, 0x80, 0x07,
+    0x80, 0x06, 0x40, 0x05, 0x81, 0x02, 0x81, 0x05, 0x80, 0x04, 0x03, 0x42,
+    0x22, 0x22, 0x22, 0x80, 0x04, 0x80, 0x02, 0x00, 0x40, 0x13, 0x80, 0x07,
+    0x44, 0x13, 0x13, 0x13, 0x13, 0x75, 0x82, 0x02, 0x80, 0x04, 0x80, 0x05,
+    0x42, 0x3c, 0x13, 0x13, 0x80, 0x06, 0x42, 0x13, 0x13, 0x13, 0x80, 0x06,
+    0x80, 0x05, 0x00, 0x41, 0x22, 0x22, 0x80, 0x06, 0x00, 0x80, 0x04, 0x02,
+    0x81, 0x07, 0x80, 0x05, 0x80, 0x02, 0x80, 0x07, 0x04, 0x80, 0x04, 0x00,
+    0x80, 0x07, 0x00, 0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80,
+    0x06, 0x00, 0x80, 0x05, 0x01, 0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x05,
+    0x00, 0x80, 0x05, 0x81, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x02, 0x80,
+    0x07, 0x00, 0x80, 0x06, 0x80, 0x05, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x04, 0x00, 0x80, 0x04, 0x01,
+    0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x05, 0x01,
+    0x82, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x01, 0x81, 0x06,
+    0x00, 0x80, 0x05, 0x01, 0x82, 0x07, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80,
+    0x04, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x04, 0x40, 0x2e, 0x02, 0x80,
+    0x07, 0x00, 0x80, 0x06, 0x03, 0x80, 0x07, 0x00, 0x80, 0x07, 0x80, 0x04,
+    0x00, 0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x03, 0x03, 0x80, 0x06, 0x80,
+    0x05, 0x81, 0x07, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x06, 0x00, 0x80,
+    0x07, 0x02, 0x80, 0x04, 0x01, 0x81, 0x05, 0x81, 0x06, 0x00, 0x81, 0x04,
+    0x02, 0x80, 0x05, 0x01, 0x80, 0x07, 0x82, 0x05, 0x01, 0x80, 0x04, 0x81,
+    0x05, 0x80, 0x07, 0x80, 0x05, 0x02, 0x81, 0x07, 0x02, 0x80, 0x06, 0x03,
+    0x80, 0x06, 0x80, 0x05, 0x03, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x80,
+    0x06, 0x01, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80, 0x04, 0x00, 0x80, 0x05,
+    0x01, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x00,
+    0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x81, 0x04, 0x80, 0x05, 0x80, 0x06,
+    0x03, 0x80, 0x06, 0x00, 0x80, 0x05, 0x00, 0x81, 0x05, 0x00, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x00, 0x81,
+    0x06, 0x80, 0x04, 0x01, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04, 0x81, 0x03,
+    0x81, 0x07, 0x80, 0x06, 0x01, 0x80, 0x04, 0x00, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x04, 0x00, 0x80, 0x05,
+    0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x06, 0x02, 0x80, 0x07, 0x02, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x01, 0x80, 0x05, 0x81, 0x04, 0x80, 0x05, 0x80,
+    0x04, 0x80, 0x01, 0x80, 0x07, 0x40, 0x50, 0x80, 0x06, 0x80, 0x03, 0x01,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x82, 0x05, 0x80, 0x07, 0x80, 0x06,
+    0x80, 0x05, 0x00, 0x80, 0x06, 0x00, 0x80, 0x07, 0x01, 0x80, 0x06, 0x81,
+    0x07, 0x81, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x82, 0x01, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x06, 0x00, 0x81, 0x06,
+    0x01, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x00,
+    0x80, 0x04, 0x83, 0x06, 0x00, 0x81, 0x06, 0x00, 0x80, 0x07, 0x80, 0x04,
+    0x02, 0x80, 0x07, 0x00, 0x80, 0x06, 0x01, 0x81, 0x04, 0x80, 0x05, 0x03,
+    0x80, 0x07, 0x80, 0x06, 0x01, 0x80, 0x07, 0x81, 0x04, 0x00, 0x82, 0x06,
+    0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x81, 0x01, 0x00, 0x80, 0x05, 0x80,
+    0x07, 0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x06, 0x81, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x05, 0x00, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x81, 0x04,
+    0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x00,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x81, 0x06, 0x82, 0x04, 0x80, 0x06,
+    0x80, 0x04, 0x02, 0x80, 0x07, 0x01, 0x80, 0x06, 0x80, 0x03, 0x80, 0x05,
+    0x40, 0x3b, 0x80, 0x04, 0x01, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x81,
+    0x04, 0x80, 0x01, 0x01, 0x80, 0x04, 0x01, 0x80, 0x06, 0x80, 0x04, 0x00,
+    0x80, 0x06, 0x00, 0x81, 0x05, 0x00, 0x80, 0x07, 0x40, 0x0d, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x06, 0x00, 0x81, 0x05, 0x80, 0x04, 0x81, 0x06, 0x80,
+    0x05, 0x41, 0x1c, 0x1c, 0x80, 0x04, 0x40, 0x1c, 0x80, 0x05, 0x40, 0x1c,
+    0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x41, 0x1c, 0x1c, 0x80, 0x07, 0x81,
+    0x05, 0x40, 0x1c, 0x80, 0x04, 0x41, 0x1c, 0x1c, 0x80, 0x04, 0x42, 0x1c,
+    0x1c, 0x1c, 0x80, 0x06, 0x81, 0x04, 0x02, 0x80, 0x05, 0x00, 0x81, 0x05,
+    0x81, 0x01, 0x80, 0x07, 0x00, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x07,
+    0x01, 0x80, 0x05, 0x00, 0x80, 0x05, 0x81, 0x04, 0x80, 0x06, 0x00, 0x80,
+    0x07, 0x00, 0x80, 0x07, 0x80, 0x06, 0x01, 0x81, 0x04, 0x01, 0x80, 0x07,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x07, 0x00,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x02, 0x80, 0x04, 0x00,
+    0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00, 0x80,
+    0x07, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x05, 0x03, 0x80, 0x07, 0x81, 0x05, 0x00, 0x80, 0x07, 0x40,
+    0x0d, 0x82, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x81, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x06, 0x06,
+    0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x04, 0x01, 0x80, 0x04, 0x81, 0x07,
+    0x00, 0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06,
+    0x80, 0x07, 0x81, 0x06, 0x80, 0x07, 0x80, 0x04, 0x80, 0x01, 0x01, 0x80,
+    0x05, 0x80, 0x07, 0x81, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x04, 0x00, 0x40, 0x0d, 0x00, 0x80, 0x04, 0x00,
+    0x80, 0x04, 0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x00,
+    0x82, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x01, 0x80, 0x05, 0x00,
+    0x80, 0x05, 0x01, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x04, 0x00, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x02, 0x80, 0x06,
+    0x01, 0x80, 0x04, 0x80, 0x05, 0x00, 0x81, 0x05, 0x80, 0x01, 0x80, 0x06,
+    0x80, 0x05, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x05,
+    0x01, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x07, 0x01, 0x80,
+    0x06, 0x00, 0x80, 0x07, 0x01, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x05, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x05, 0x01, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x81, 0x07, 0x80,
+    0x05, 0x02, 0x80, 0x07, 0x00, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x81,
+    0x07, 0x80, 0x05, 0x80, 0x01, 0x80, 0x05, 0x80, 0x01, 0x01, 0x80, 0x05,
+    0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x05, 0x01, 0x81,
+    0x07, 0x80, 0x06, 0x80, 0x04, 0x01, 0x80, 0x05, 0x01, 0x80, 0x04, 0x00,
+    0x80, 0x04, 0x81, 0x07, 0x00, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x04,
+    0x02, 0x80, 0x05, 0x00, 0x81, 0x06, 0x00, 0x80, 0x04, 0x80, 0x05, 0x01,
+    0x80, 0x06, 0x01, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80,
+    0x04, 0x02, 0x80, 0x04, 0x80, 0x06, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x01, 0x80, 0x05, 0x03, 0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x06, 0x00,
+    0x80, 0x06, 0x00, 0x81, 0x04, 0x80, 0x05, 0x40, 0x0d, 0x80, 0x06, 0x80,
+    0x07, 0x00, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x02,
+    0x80, 0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x07, 0x81, 0x06, 0x00, 0x80,
+    0x06, 0x81, 0x04, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80, 0x04, 0x00, 0x80,
+    0x07, 0x00, 0x80, 0x05, 0x01, 0x80, 0x05, 0x00, 0x80, 0x06, 0x01, 0x81,
+    0x07, 0x80, 0x06, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06,
+    0x02, 0x80, 0x06, 0x81, 0x04, 0x00, 0x81, 0x04, 0x00, 0x80, 0x06, 0x01,
+    0x80, 0x05, 0x80, 0x04, 0x02, 0x80, 0x04, 0x80, 0x06, 0x00, 0x80, 0x06,
+    0x00, 0x83, 0x07, 0x80, 0x05, 0x01, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x80, 0x07, 0x00, 0x80, 0x07, 0x01, 0x81, 0x06, 0x00, 0x81, 0x04,
+    0x04, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x05,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x01, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x07, 0x00, 0x80, 0x07, 0x80, 0x05,
+    0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x00,
+    0x80, 0x06, 0x00, 0x81, 0x06, 0x03, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x80, 0x04, 0x00, 0x80, 0x06, 0x81, 0x04, 0x80, 0x05, 0x80, 0x04,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x04, 0x01,
+    0x80, 0x07, 0x80, 0x06, 0x02, 0x80, 0x04, 0x02, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x80, 0x07, 0x80, 0x01, 0x81, 0x07, 0x80, 0x04, 0x00, 0x80, 0x04,
+    0x02, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x07, 0x00, 0x80, 0x04, 0x00,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x00, 0x81, 0x07, 0x01,
+    0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x81, 0x05, 0x80, 0x06, 0x00, 0x81,
+    0x07, 0x00, 0x80, 0x05, 0x01, 0x80, 0x06, 0x80, 0x05, 0x00, 0x81, 0x04,
+    0x00, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x06, 0x81, 0x07, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06,
+    0x00, 0x81, 0x05, 0x80, 0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x02,
+    0x81, 0x07, 0x00, 0x80, 0x04, 0x02, 0x80, 0x04, 0x00, 0x80, 0x07, 0x01,
+    0x80, 0x05, 0x00, 0x80, 0x05, 0x81, 0x06, 0x00, 0x80, 0x05, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x02, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x04, 0x40,
+    0x0a, 0x00, 0x81, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81, 0x04,
+    0x80, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x00,
+    0x80, 0x06, 0x82, 0x07, 0x03, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x01,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x81, 0x06, 0x01, 0x81, 0x07, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x00, 0x80, 0x07, 0x80, 0x05, 0x81, 0x07, 0x00, 0x80,
+    0x07, 0x00, 0x80, 0x06, 0x02, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x06,
+    0x01, 0x80, 0x05, 0x40, 0x0a, 0x80, 0x05, 0x00, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x00, 0x00, 0x80, 0x06, 0x80, 0x01, 0x40, 0x06, 0x80,
+    0x06, 0x02, 0x80, 0x04, 0x00, 0x81, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06,
+    0x80, 0x05, 0x01, 0x80, 0x07, 0x80, 0x05, 0x00, 0x80, 0x05, 0x00, 0x80,
+    0x07, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x06, 0x81, 0x04, 0x81,
+    0x06, 0x80, 0x05, 0x00, 0x80, 0x04, 0x40, 0x0b, 0x00, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x00, 0x80,
+    0x06, 0x02, 0x81, 0x07, 0x80, 0x06, 0x81, 0x04, 0x80, 0x05, 0x00, 0x81,
+    0x00, 0x80, 0x05, 0x81, 0x01, 0x40, 0x06, 0x00, 0x80, 0x07, 0x01, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x80, 0x07, 0x01, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x05, 0x00, 0x81, 0x07, 0x80, 0x06, 0x80, 0x04, 0x81, 0x05, 0x00, 0x80,
+    0x06, 0x80, 0x04, 0x80, 0x07, 0x82, 0x06, 0x80, 0x04, 0x01, 0x80, 0x06,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x00, 0x81, 0x05, 0x80, 0x06, 0x00,
+    0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06,
+    0x80, 0x07, 0x00, 0x80, 0x06, 0x40, 0x0a, 0x81, 0x05, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x00, 0x00, 0x81, 0x01, 0x80, 0x04, 0x00, 0x80,
+    0x05, 0x80, 0x07, 0x02, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x00,
+    0x80, 0x06, 0x80, 0x07, 0x03, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x81,
+    0x05, 0x00, 0x80, 0x07, 0x01, 0x80, 0x07, 0x80, 0x05, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x01, 0x81, 0x04, 0x00, 0x80,
+    0x06, 0x00, 0x80, 0x05, 0x80, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x40, 0x0a, 0x80, 0x06, 0x01, 0x80,
+    0x06, 0x81, 0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x07, 0x01, 0x81, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05,
+    0x80, 0x06, 0x03, 0x80, 0x06, 0x01, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07,
+    0x82, 0x04, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x81,
+    0x05, 0x00, 0x80, 0x07, 0x80, 0x05, 0x81, 0x06, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x81, 0x05, 0x80, 0x07, 0x00, 0x80, 0x07, 0x81, 0x04, 0x00, 0x80,
+    0x05, 0x80, 0x07, 0x80, 0x06, 0x40, 0x0a, 0x82, 0x04, 0x00, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x01, 0x40, 0x06, 0x80, 0x06,
+    0x00, 0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x04, 0x03, 0x82,
+    0x04, 0x00, 0x80, 0x06, 0x00, 0x82, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x03, 0x80, 0x04, 0x81, 0x06, 0x80, 0x04, 0x00, 0x82, 0x04, 0x80,
+    0x07, 0x00, 0x43, 0x0c, 0x0c, 0x0c, 0x0c, 0x80, 0x06, 0x40, 0x0c, 0x80,
+    0x07, 0x80, 0x04, 0x40, 0x0f, 0x80, 0x06, 0x41, 0x0f, 0x0f, 0x80, 0x07,
+    0x40, 0x0c, 0x81, 0x05, 0x81, 0x06, 0x40, 0x0c, 0x00, 0x80, 0x07, 0x80,
+    0x06, 0x40, 0x06, 0x00, 0x81, 0x04, 0x80, 0x05, 0x02, 0x80, 0x06, 0x00,
+    0x81, 0x06, 0x81, 0x04, 0x80, 0x06, 0x00, 0x80, 0x04, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x02, 0x80, 0x04, 0x00, 0x81, 0x07, 0x80,
+    0x04, 0x80, 0x06, 0x01, 0x80, 0x04, 0x40, 0x0b, 0x80, 0x07, 0x81, 0x06,
+    0x00, 0x80, 0x06, 0x00, 0x80, 0x06, 0x80, 0x07, 0x80, 0x01, 0x40, 0x06,
+    0x01, 0x80, 0x04, 0x80, 0x05, 0x80, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05,
+    0x80, 0x07, 0x80, 0x05, 0x02, 0x80, 0x07, 0x80, 0x05, 0x81, 0x07, 0x00,
+    0x80, 0x04, 0x00, 0x81, 0x05, 0x01, 0x80, 0x07, 0x02, 0x80, 0x07, 0x00,
+    0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x04, 0x03, 0x80, 0x04, 0x00, 0x81, 0x05, 0x00,
+    0x40, 0x0b, 0x80, 0x04, 0x05, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x06, 0x02, 0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x05, 0x00,
+    0x82, 0x05, 0x80, 0x07, 0x81, 0x04, 0x00, 0x81, 0x06, 0x80, 0x04, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05, 0x02, 0x80,
+    0x05, 0x80, 0x07, 0x82, 0x04, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06,
+    0x01, 0x81, 0x05, 0x00, 0x80, 0x06, 0x01, 0x80, 0x07, 0x40, 0x0b, 0x02,
+    0x80, 0x07, 0x00, 0x80, 0x04, 0x02, 0x40, 0x83, 0x80, 0x05, 0x40, 0x09,
+    0x80, 0x06, 0x80, 0x05, 0x41, 0x09, 0x98, 0x80, 0x05, 0x82, 0x04, 0x01,
+    0x80, 0x06, 0x80, 0x01, 0x80, 0x07, 0x40, 0x06, 0x80, 0x07, 0x80, 0x04,
+    0x00, 0x80, 0x04, 0x01, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x07, 0x81, 0x04, 0x00, 0x80, 0x06, 0x00, 0x80, 0x05, 0x00,
+    0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x00,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81, 0x05, 0x80, 0x07, 0x81, 0x05,
+    0x80, 0x06, 0x00, 0x80, 0x06, 0x00, 0x81, 0x07, 0x00, 0x80, 0x06, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80,
+    0x05, 0x00, 0x80, 0x05, 0x02, 0x81, 0x01, 0x80, 0x07, 0x01, 0x80, 0x07,
+    0x00, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x01, 0x80, 0x06, 0x03, 0x80,
+    0x04, 0x00, 0x80, 0x06, 0x80, 0x05, 0x00, 0x83, 0x06, 0x00, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x00, 0x81, 0x07, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x00,
+    0x80, 0x07, 0x02, 0x80, 0x07, 0x80, 0x06, 0x81, 0x07, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x04, 0x01, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80,
+    0x07, 0x81, 0x01, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x04, 0x80, 0x05,
+    0x80, 0x04, 0x00, 0x80, 0x04, 0x01, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x06, 0x00, 0x80,
+    0x07, 0x80, 0x04, 0x82, 0x06, 0x80, 0x07, 0x80, 0x05, 0x00, 0x80, 0x07,
+    0x80, 0x05, 0x81, 0x06, 0x81, 0x04, 0x40, 0x0b, 0x80, 0x01, 0x81, 0x04,
+    0x01, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x02, 0x81, 0x04,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x01, 0x80, 0x06, 0x81, 0x01, 0x81,
+    0x06, 0x80, 0x01, 0x80, 0x04, 0x80, 0x07, 0x81, 0x06, 0x00, 0x80, 0x05,
+    0x80, 0x07, 0x00, 0x80, 0x04, 0x81, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80,
+    0x05, 0x81, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04, 0x81, 0x07, 0x80, 0x04,
+    0x81, 0x07, 0x02, 0x80, 0x04, 0x02, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04,
+    0x00, 0x80, 0x05, 0x00, 0x82, 0x04, 0x02, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x00,
+    0x80, 0x06, 0x01, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80, 0x04, 0x00, 0x80,
+    0x04, 0x00, 0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x02, 0x80, 0x04, 0x00,
+    0x80, 0x04, 0x80, 0x06, 0x00, 0x80, 0x05, 0x01, 0x81, 0x05, 0x80, 0x04,
+    0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x03, 0x80, 0x04,
+    0x01, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x07, 0x80,
+    0x06, 0x00, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07,
+    0x01, 0x80, 0x07, 0x80, 0x05, 0x02, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x80, 0x05, 0x00, 0x80, 0x05, 0x80, 0x01, 0x80, 0x06, 0x80, 0x04,
+    0x01, 0x80, 0x06, 0x01, 0x80, 0x04, 0x81, 0x05, 0x80, 0x04, 0x80, 0x05,
+    0x81, 0x06, 0x01, 0x80, 0x07, 0x00, 0x80, 0x05, 0x81, 0x04, 0x01, 0x80,
+    0x06, 0x00, 0x80, 0x07, 0x80, 0x05, 0x00, 0x81, 0x07, 0x80, 0x00, 0x00,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80,
+    0x05, 0x80, 0x07, 0x40, 0x4f, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x81,
+    0x04, 0x80, 0x07, 0x82, 0x01, 0x80, 0x06, 0x80, 0x05, 0x80, 0x01, 0x80,
+    0x07, 0x80, 0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x01, 0x80,
+    0x07, 0x81, 0x04, 0x80, 0x05, 0x02, 0x80, 0x05, 0x00, 0x80, 0x07, 0x81,
+    0x04, 0x01, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x05, 0x04, 0x80, 0x06, 0x80, 0x07,
+    0x40, 0x15, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x00, 0x80, 0x04,
+    0x01, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x40, 0x14, 0x83, 0x07, 0x81,
+    0x04, 0x40, 0x14, 0x80, 0x04, 0x40, 0x14, 0x80, 0x04, 0x41, 0x14, 0x14,
+    0x80, 0x07, 0x40, 0x14, 0x80, 0x05, 0x40, 0x14, 0x80, 0x06, 0x40, 0x14,
+    0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x81, 0x04, 0x01, 0x80, 0x04, 0x01,
+    0x41, 0x15, 0x15, 0x80, 0x05, 0x00, 0x80, 0x04, 0x80, 0x05, 0x81, 0x04,
+    0x03, 0x80, 0x07, 0x00, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x40, 0x05,
+    0x80, 0x06, 0x80, 0x05, 0x82, 0x04, 0x81, 0x05, 0x81, 0x07, 0x80, 0x06,
+    0x80, 0x05, 0x00, 0x40, 0x27, 0x00, 0x81, 0x07, 0x80, 0x04, 0x02, 0x80,
+    0x05, 0x00, 0x81, 0x06, 0x80, 0x07, 0x80, 0x05, 0x81, 0x04, 0x80, 0x05,
+    0x00, 0x80, 0x05, 0x80, 0x03, 0x81, 0x05, 0x80, 0x04, 0x00, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x01, 0x80, 0x04, 0x80, 0x02, 0x80,
+    0x04, 0x80, 0x06, 0x80, 0x07, 0x01, 0x80, 0x05, 0x00, 0x80, 0x05, 0x00,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x81, 0x00, 0x81, 0x05,
+    0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x00,
+    0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x00,
+    0x80, 0x05, 0x01, 0x80, 0x03, 0x80, 0x06, 0x80, 0x03, 0x83, 0x06, 0x00,
+    0x80, 0x05, 0x00, 0x81, 0x07, 0x81, 0x03, 0x80, 0x07, 0x01, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x06, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x07, 0x80, 0x05, 0x01, 0x80, 0x07, 0x00, 0x81, 0x05, 0x00,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x42, 0x15, 0x15, 0x5a,
+    0x80, 0x06, 0x80, 0x07, 0x01, 0x81, 0x06, 0x80, 0x07, 0x81, 0x04, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x40, 0x12, 0x80, 0x04, 0x40,
+    0x12, 0x80, 0x05, 0x80, 0x04, 0x40, 0x24, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x03, 0x00, 0x80, 0x07, 0x80, 0x05,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x05, 0x01, 0x81, 0x07,
+    0x00, 0x80, 0x04, 0x80, 0x05, 0x40, 0x15, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x04, 0x81, 0x07, 0x80, 0x04, 0x01, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x03, 0x81, 0x07, 0x81, 0x04, 0x01,
+    0x80, 0x05, 0x00, 0x80, 0x05, 0x01, 0x81, 0x07, 0x40, 0x28, 0x80, 0x07,
+    0x80, 0x04, 0x81, 0x06, 0x80, 0x02, 0x81, 0x06, 0x02, 0x80, 0x07, 0x80,
+    0x03, 0x80, 0x05, 0x80, 0x06, 0x04, 0x80, 0x06, 0x02, 0x80, 0x07, 0x00,
+    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x07, 0x80, 0x06, 0x01, 0x80,
+    0x04, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x01, 0x80, 0x07, 0x80,
+    0x04, 0x02, 0x80, 0x07, 0x00, 0x81, 0x06, 0x80, 0x02, 0x80, 0x05, 0x00,
+    0x80, 0x05, 0x40, 0x27, 0x80, 0x05, 0x80, 0x06, 0x81, 0x07, 0x80, 0x03,
+    0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80,
+    0x07, 0x40, 0x24, 0x81, 0x03, 0x80, 0x06, 0x82, 0x03, 0x80, 0x06, 0x81,
+    0x04, 0x80, 0x02, 0x80, 0x04, 0x02, 0x80, 0x07, 0x01, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x02, 0x80, 0x07, 0x00, 0x80, 0x05,
+    0x01, 0x80, 0x04, 0x01, 0x40, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x01, 0x80, 0x04, 0x80, 0x07, 0x40, 0x22, 0x80, 0x04, 0x40,
+    0xd4, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x04,
+    0x40, 0x13, 0x80, 0x05, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x04, 0x81, 0x05, 0x40, 0x13, 0x80, 0x07, 0x40, 0x13, 0x80, 0x06,
+    0x80, 0x05, 0x80, 0x02, 0x80, 0x07, 0x40, 0x43, 0x80, 0x04, 0x40, 0x22,
+    0x80, 0x05, 0x80, 0x07, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x07, 0x80,
+    0x04, 0x40, 0x00, 0x80, 0x06, 0x00, 0x81, 0x06, 0x81, 0x04, 0x81, 0x05,
+    0x00, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x02, 0x80, 0x05, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x00, 0x82, 0x04, 0x00, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x07, 0x00, 0x81, 0x04, 0x81, 0x05, 0x80, 0x06, 0x80,
+    0x07, 0x81, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x00, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x06, 0x81, 0x04,
+    0x00, 0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x05, 0x81, 0x04, 0x00, 0x80,
+    0x05, 0x01, 0x80, 0x05, 0x81, 0x04, 0x80, 0x07, 0x40, 0x10, 0x00, 0x80,
+    0x05, 0x80, 0x07, 0x81, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x06, 0x81, 0x05, 0x81, 0x06, 0x80, 0x07, 0x80, 0x04, 0x01, 0x80, 0x04,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x00, 0x81, 0x04, 0x83, 0x06, 0x80,
+    0x03, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x06, 0x40, 0x10, 0x00, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x04, 0x01, 0x80, 0x07, 0x81, 0x05, 0x00, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x81, 0x05, 0x80, 0x07,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x00,
+    0x81, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07,
+    0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x07, 0x00, 0x80, 0x05, 0x81, 0x06, 0x80, 0x04, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x03, 0x80, 0x04, 0x80,
+    0x03, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x07, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x07, 0x00, 0x80, 0x05,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x01, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x81, 0x07,
+    0x80, 0x04, 0x00, 0x80, 0x04, 0x81, 0x06, 0x80, 0x05, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x03, 0x81, 0x06, 0x80, 0x07,
+    0x80, 0x06, 0x80, 0x04, 0x81, 0x06, 0x80, 0x04, 0x00, 0x80, 0x04, 0x80,
+    0x03, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x06, 0x82, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x07, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0xff, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x07, 0x07, 0x04, 0x05, 0x04, 0x06, 0x07, 0x04, 0x06, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06,
+    0x06, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x05, 0x06,
+    0x06, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x06, 0x06, 0x07, 0x06, 0x04, 0x07, 0x04, 0x07, 0x06, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x07, 0x04,
+    0x07, 0x05, 0x07, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x04, 0x06,
+    0x04, 0x07, 0x04, 0x04, 0x06, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x05, 0x07, 0x05, 0x06, 0x05, 0x05, 0x07, 0x04, 0x04, 0x07, 0x05,
+    0x06, 0x06, 0x06, 0x06, 0x07, 0x04, 0x07, 0x04, 0x04, 0x06, 0x04, 0x06,
+    0x06, 0x05, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06,
+    0x04, 0x05, 0x07, 0x05, 0x06, 0x07, 0x05, 0x07, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x04, 0x05, 0x06, 0x07, 0x04, 0x07, 0x04, 0x05, 0x06, 0x04, 0x06,
+    0x04, 0x04, 0x04, 0x04, 0x07, 0x06, 0x04, 0x06, 0x07, 0x04, 0x05, 0x07,
+    0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x07, 0x06, 0x06, 0x05,
+    0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x06, 0x05, 0x05, 0x04, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x04, 0x05, 0x06, 0x07, 0x06,
+    0x04, 0x05, 0x07, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x04, 0x05,
+    0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x04, 0x07, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x06, 0x04, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06,
+    0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x05, 0x04,
+    0x04, 0x05, 0x06, 0x05, 0x05, 0x04, 0x07, 0x04, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x04, 0x05, 0x06, 0x07, 0x04, 0x06, 0x04, 0x04, 0x05, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x04, 0x06, 0x04, 0x05,
+    0x06, 0x06, 0x06, 0x07, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x07, 0x07, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05,
+    0x07, 0x06, 0x04, 0x04, 0x07, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x05,
+    0x07, 0x07, 0x07, 0x07, 0x05, 0x07, 0x06, 0x04, 0x04, 0x06, 0x07, 0x05,
+    0x04, 0x04, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x06,
+    0x04, 0x07, 0x07, 0x05, 0x04, 0x04, 0x07, 0x06, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x05, 0x07, 0x05, 0x07, 0x07,
+    0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x04, 0x07, 0x04, 0x05, 0x05,
+    0x06, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x04, 0x04,
+    0x07, 0x04, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07, 0x04, 0x04, 0x04, 0x04,
+    0x06, 0x05, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04, 0x05, 0x05, 0x05, 0x05,
+    0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x05, 0x07, 0x05, 0x05, 0x05, 0x06,
+    0x07, 0x07, 0x04, 0x04, 0x07, 0x07, 0x07, 0x07, 0x04, 0x06, 0x04, 0x04,
+    0x04, 0x07, 0x04, 0x07, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x07, 0x06, 0x06, 0x04, 0x04, 0x07, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x06, 0x04, 0x06, 0x07, 0x05, 0x07,
+    0x05, 0x07, 0x07, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x05, 0x06,
+    0x05, 0x04, 0x05, 0x04, 0x07, 0x07, 0x04, 0x07, 0x03, 0x03, 0x03, 0x03,
+    0x06, 0x05, 0x05, 0x06, 0x06, 0x04, 0x04, 0x06, 0x07, 0x06, 0x05, 0x05,
+    0x06, 0x06, 0x06, 0x06, 0x04, 0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x07,
+    0x07, 0x05, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x06, 0x06,
+    0x04, 0x06, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x05, 0x05, 0x05, 0x05,
+    0x04, 0x05, 0x05, 0x04, 0x07, 0x04, 0x06, 0x04, 0x06, 0x07, 0x06, 0x06,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x07, 0x06, 0x05, 0x04, 0x04,
+    0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x05, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x04, 0x05, 0x04, 0x07, 0x07, 0x07, 0x07,
+    0x04, 0x04, 0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x07,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x07,
+    0x04, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x06,
+    0x07, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03,
+    0x05, 0x06, 0x06, 0x04, 0x07, 0x06, 0x05, 0x07, 0x07, 0x06, 0x07, 0x05,
+    0x04, 0x04, 0x04, 0x04, 0x07, 0x06, 0x07, 0x07, 0x06, 0x04, 0x05, 0x06,
+    0x05, 0x07, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x04, 0x07, 0x04, 0x07,
+    0x07, 0x07, 0x06, 0x05, 0x07, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x06, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x06, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x04, 0x06, 0x05, 0x07, 0x06, 0x07,
+    0x07, 0x06, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x06, 0x05, 0x07, 0x06,
+    0x07, 0x05, 0x07, 0x04, 0x04, 0x05, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x07, 0x04, 0x06, 0x05, 0x05, 0x07, 0x04, 0x06, 0x07, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07,
+    0x06, 0x05, 0x07, 0x06, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06,
+    0x04, 0x05, 0x06, 0x04, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x04, 0x06, 0x05, 0x04, 0x04, 0x05, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05,
+    0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x04, 0x04, 0x07, 0x07, 0x07, 0x05,
+    0x06, 0x04, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x05, 0x05,
+    0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07,
+    0x06, 0x07, 0x06, 0x04, 0x07, 0x06, 0x07, 0x04, 0x05, 0x05, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x07, 0x05,
+    0x06, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x07, 0x06,
+    0x06, 0x04, 0x06, 0x07, 0x05, 0x07, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x07, 0x05, 0x04, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x07, 0x05, 0x04,
+    0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x05, 0x05, 0x06, 0x04, 0x05, 0x04,
+    0x06, 0x05, 0x04, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x04, 0x07, 0x04,
+    0x05, 0x04, 0x07, 0x05, 0x04, 0x05, 0x05, 0x07, 0x07, 0x06, 0x07, 0x04,
+    0x05, 0x07, 0x06, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04, 0x06, 0x04, 0x07,
+    0x05, 0x07, 0x04, 0x07, 0x05, 0x05, 0x07, 0x07, 0x04, 0x06, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x06, 0x07, 0x05, 0x06, 0x04, 0x04, 0x07, 0x07, 0x05,
+    0x06, 0x04, 0x05, 0x06, 0x06, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
+    0x06, 0x04, 0x07, 0x05, 0x04, 0x05, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05,
+    0xf7, 0x06, 0x04, 0x04, 0x07, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05,
+    0x05, 0x04, 0x04, 0x04, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06, 0x04, 0x06,
+    0x05, 0x06, 0x06, 0x04, 0x04, 0x05, 0x05, 0x07, 0x05, 0x07, 0x06, 0x05,
+    0x07, 0x04, 0x07, 0x07, 0x04, 0x07, 0x05, 0x06, 0x05, 0x07, 0x05, 0x05,
+    0x07, 0x06, 0x04, 0x06, 0x05, 0x05, 0x07, 0x05, 0x07, 0x05, 0x04, 0x05,
+    0x04, 0x06, 0x05, 0x05, 0x07, 0x04, 0x04, 0x07, 0x06, 0x04, 0x04, 0x04,
+    0x07, 0x04, 0x04, 0x06, 0x05, 0x06, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06,
+    0x05, 0x04, 0x05, 0x07, 0x04, 0x07, 0x07, 0x05, 0x07, 0x04, 0x06, 0x05,
+    0x04, 0x07, 0x04, 0x07, 0x05, 0x05, 0x05, 0x06, 0x07, 0x06, 0x04, 0x07,
+    0x07, 0x07, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x07, 0x06,
+    0x04, 0x04, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x06, 0x05, 0x06, 0x04,
+    0x07, 0x05, 0x06, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07, 0x05, 0x07, 0x06,
+    0x04, 0x05, 0x05, 0x04, 0x07, 0x07, 0x04, 0x07, 0x04, 0x05, 0x05, 0x06,
+    0x05, 0x05, 0x07, 0x05, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x06, 0x05,
+    0x04, 0x05, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x07, 0x07, 0x06, 0x04,
+    0x06, 0x07, 0x06, 0x07, 0x04, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x06,
+    0x07, 0x06, 0x06, 0x04, 0x06, 0x04, 0x04, 0x06, 0x07, 0x06, 0x04, 0x04,
+    0x06, 0x05, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x05, 0x07, 0x05, 0x05,
+    0x07, 0x07, 0x07, 0x06, 0x07, 0x04, 0x06, 0x05, 0x07, 0x05, 0x06, 0x06,
+    0x04, 0x05, 0x04, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x07, 0x05, 0x07, 0x07,
+    0x07, 0x04, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x06, 0x04, 0x07, 0x06,
+    0x06, 0x06, 0x04, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07,
+    0x07, 0x07, 0x05, 0x04, 0x05, 0x07, 0x07, 0x05, 0x04, 0x04, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x04, 0x04, 0x04, 0x07, 0x05, 0x07, 0x06, 0x07, 0x07,
+    0x07, 0x05, 0x05, 0x06, 0x06, 0x04, 0x07, 0x05, 0x07, 0x04, 0x07, 0x05,
+    0x05, 0x04, 0x04, 0x05, 0x04, 0x07, 0x05, 0x07, 0x04, 0x07, 0x06, 0x04,
+    0x05, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0x07, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06, 0x06,
+    0x05, 0x04, 0x04, 0x04, 0x07, 0x06, 0x06, 0x05, 0x04, 0x04, 0x07, 0x07,
+    0x07, 0x07, 0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x04,
+    0x06, 0x05, 0x07, 0x07, 0x06, 0x05, 0x06, 0x04, 0x04, 0x05, 0x05, 0x04,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x05, 0x04, 0x05, 0x05, 0x07, 0x07, 0x06,
+    0x07, 0x05, 0x07, 0x05, 0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x05, 0x04,
+    0x07, 0x07, 0x05, 0x05, 0x04, 0x07, 0x05, 0x04, 0x04, 0x05, 0x06, 0x04,
+    0x05, 0x04, 0x05, 0x07, 0x06, 0x05, 0x07, 0x07, 0x07, 0x06, 0x04, 0x05,
+    0x04, 0x04, 0x07, 0x06, 0x07, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x04,
+    0x06, 0x07, 0x05, 0x04, 0x07, 0x07, 0x04, 0x07, 0x06, 0x04, 0x06, 0x04,
+    0x07, 0x05, 0x04, 0x07, 0x05, 0x04, 0x04, 0x06, 0x04, 0x07, 0x05, 0x06,
+    0x06, 0x04, 0x05, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07,
+    0x04, 0x07, 0x06, 0x07, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x06, 0x07,
+    0x06, 0x04, 0x05, 0x04, 0x07, 0x05, 0x04, 0x06, 0x04, 0x06, 0x07, 0x06,
+    0x05, 0x06, 0x04, 0x06, 0x05, 0x06, 0x07, 0x06, 0x06, 0x04, 0x05, 0x07,
+    0x07, 0x04, 0x06, 0x05, 0x05, 0x07, 0x05, 0x07, 0x06, 0x05, 0x06, 0x04,
+    0x06, 0x07, 0x05, 0x06, 0x07, 0x06, 0x04, 0x06, 0x07, 0x04, 0x05, 0x07,
+    0x05, 0x05, 0x05, 0x04, 0x07, 0x07, 0x06, 0x05, 0x04, 0x07, 0x07, 0x04,
+    0x04, 0x06, 0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x07, 0x05, 0x07, 0x07,
+    0x04, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x06, 0x04, 0x05, 0x06, 0x07,
+    0x06, 0x04, 0x05, 0x06, 0x04, 0x07, 0x05, 0x06, 0x04, 0x05, 0x05, 0x04,
+    0x06, 0x05, 0x07, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06,
+    0x07, 0x07, 0x05, 0x05, 0x07, 0x07, 0x05, 0x04, 0x05, 0x06, 0x07, 0x06,
+    0x06, 0x07, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x04, 0x07, 0x05, 0x04, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x07,
+    0x05, 0x05, 0x07, 0x04, 0x05, 0x06, 0x05, 0x07, 0x04, 0x07, 0x06, 0x07,
+    0x04, 0x06, 0x07, 0x05, 0x07, 0x05, 0x07, 0x06, 0x06, 0x07, 0x06, 0x07,
+    0x06, 0x04, 0x05, 0x06, 0x04, 0x04, 0x06, 0x06, 0x05, 0x06, 0x07, 0x04,
+    0x07, 0x04, 0x04, 0x05, 0x04, 0x06, 0x05, 0x06, 0x04, 0x07, 0x05, 0x05,
+    0x07, 0x05, 0x07, 0x04, 0x06, 0x07, 0x04, 0x05, 0x05, 0x07, 0x05, 0x04,
+    0x07, 0x05, 0x06, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05,
+    0x05, 0x04, 0x04, 0x04, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x07, 0x06,
+    0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x04, 0x06, 0x04, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x05, 0x04, 0x06, 0x06, 0x04, 0x05, 0x04, 0x07, 0x05, 0x06,
+    0x06, 0x05, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x06,
+    0x06, 0x06, 0x07, 0x05, 0x06, 0x05, 0x06, 0x07, 0x04, 0x05, 0x06, 0x06,
+    0x06, 0x04, 0x06, 0x04, 0x05, 0x06, 0x04, 0x04, 0x05, 0x07, 0x07, 0x07,
+    0x04, 0x07, 0x04, 0x06, 0x06, 0x05, 0x06, 0x04, 0x05, 0x06, 0x05, 0x07,
+    0x07, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x05, 0x07, 0x05,
+    0x04, 0x05, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x04, 0x06, 0x06, 0x05,
+    0x06, 0x05, 0x05, 0x07, 0x04, 0x07, 0x06, 0x04, 0x04, 0x04, 0x07, 0x04,
+    0x04, 0x07, 0x06, 0x04, 0x04, 0x07, 0x06, 0x07, 0x05, 0x06, 0x07, 0x06,
+    0x06, 0x07, 0x05, 0x06, 0x05, 0x05, 0x05, 0x04, 0x05, 0x06, 0x05, 0x04,
+    0x05, 0x07, 0x04, 0x04, 0x04, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x06,
+    0x05, 0x06, 0x07, 0x04, 0x06, 0x07, 0x07, 0x06, 0x04, 0x07, 0x07, 0x05,
+    0x05, 0x07, 0x05, 0x06, 0x05, 0x07, 0x04, 0x07, 0x05, 0x04, 0x06, 0x06,
+    0x04, 0x06, 0x05, 0x07, 0x04, 0x04, 0x04, 0x07, 0x07, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x07, 0x80, 0x00, 0x80, 0x07, 0x80, 0x05, 0x81,
+    0x04, 0x00, 0x80, 0x06, 0x80, 0x05, 0x82, 0x06, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x05, 0x81, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x00,
+    0x80, 0x04, 0x80, 0x01, 0x80, 0x07, 0x81, 0x06, 0x80, 0x04, 0x80, 0x01,
+    0x81, 0x04, 0x80, 0x05, 0x00, 0x81, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x04, 0x81, 0x05,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x00, 0x81, 0x04, 0x80, 0x07, 0x80,
+    0x06, 0x80, 0x07, 0x82, 0x06, 0x80, 0x04, 0x80, 0x05, 0x81, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x00, 0x81, 0x05, 0x80, 0x07, 0x00, 0x81, 0x07, 0x80,
+    0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81, 0x05, 0x80,
+    0x06, 0x80, 0x07, 0x81, 0x06, 0x80, 0x01, 0x80, 0x05, 0x80, 0x07, 0x80,
+    0x01, 0x80, 0x05, 0x80, 0x01, 0x80, 0x04, 0x81, 0x05, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x06, 0x81, 0x07, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x04,
+    0x80, 0x06, 0x80, 0x04, 0x01, 0x80, 0x04, 0x01, 0x80, 0x06, 0x80, 0x05,
+    0x80, 0x00, 0x80, 0x04, 0x80, 0x06, 0x01, 0x80, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x05, 0x00, 0x81, 0x07, 0x81, 0x06, 0x80, 0x05,
+    0x81, 0x04, 0x01, 0x80, 0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x01, 0x80, 0x07, 0x80,
+    0x01, 0x00, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x06, 0x81,
+    0x04, 0x81, 0x07, 0x81, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x01, 0x80, 0x05, 0x00, 0x82, 0x05, 0x80, 0x04, 0x81, 0x06,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x01, 0x80, 0x04, 0x80, 0x01, 0x80, 0x06, 0x82,
+    0x04, 0x80, 0x07, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x06, 0x00, 0x81, 0x04, 0x80, 0x07, 0x80, 0x01, 0x80,
+    0x07, 0x80, 0x01, 0x00, 0x80, 0x05, 0x82, 0x07, 0x80, 0x04, 0x80, 0x05,
+    0x00, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x82, 0x06, 0x80,
+    0x04, 0x80, 0x05, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80,
+    0x05, 0x81, 0x04, 0x00, 0x80, 0x00, 0x81, 0x06, 0x80, 0x00, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x82, 0x06, 0x81, 0x05, 0x00, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05,
+    0x80, 0x06, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x01, 0x80, 0x06, 0x00, 0x81, 0x06, 0x80, 0x05, 0x80, 0x07,
+    0x81, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x01,
+    0x80, 0x06, 0x80, 0x04, 0x80, 0x01, 0x00, 0x80, 0x04, 0x81, 0x06, 0x80,
+    0x04, 0x00, 0x81, 0x05, 0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x00, 0x81, 0x06, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x04, 0x81, 0x06, 0x81, 0x07, 0x80, 0x04, 0x81, 0x06, 0x80,
+    0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x00, 0x81, 0x04, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x06, 0x80, 0x07, 0x80, 0x01, 0x80, 0x06, 0x00, 0x80, 0x06, 0x80,
+    0x05, 0x81, 0x06, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80,
+    0x06, 0x81, 0x07, 0x81, 0x05, 0x80, 0x00, 0x81, 0x06, 0x82, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x06, 0x81, 0x07, 0x81, 0x06, 0x82, 0x07, 0x80,
+    0x04, 0x00, 0x81, 0x04, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x81,
+    0x06, 0x80, 0x01, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x06, 0x00, 0x81, 0x06, 0x00, 0x80, 0x07, 0x81, 0x05, 0x00,
+    0x81, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x82, 0x06,
+    0x80, 0x05, 0x81, 0x04, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x00, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80,
+    0x05, 0x81, 0x06, 0x82, 0x05, 0x81, 0x07, 0x02, 0x80, 0x06, 0x00, 0x80,
+    0x04, 0x81, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x04, 0x80, 0x01, 0x80, 0x04, 0x00, 0x80, 0x05, 0x00, 0x80, 0x05, 0x80,
+    0x07, 0x81, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x01, 0x82, 0x05,
+    0x83, 0x06, 0x80, 0x07, 0x80, 0x04, 0x83, 0x06, 0x01, 0x80, 0x07, 0x80,
+    0x04, 0x00, 0x81, 0x05, 0x40, 0xce, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07,
+    0x83, 0x04, 0x81, 0x06, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x07, 0x00, 0x40, 0x17, 0x80, 0x04, 0x80, 0x06, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x80, 0x07, 0x81, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05,
+    0x81, 0x07, 0x00, 0x80, 0x05, 0x81, 0x06, 0x82, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x40, 0x17, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04,
+    0x80, 0x00, 0x00, 0x81, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x04,
+    0x81, 0x00, 0x81, 0x05, 0x80, 0x01, 0x80, 0x06, 0x82, 0x05, 0x80, 0x04,
+    0x00, 0x80, 0x00, 0x80, 0x06, 0x81, 0x04, 0x80, 0x05, 0x80, 0x07, 0x00,
+    0x80, 0x05, 0x80, 0x04, 0x81, 0x00, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07,
+    0x81, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04,
+    0x81, 0x07, 0x81, 0x04, 0x80, 0x07, 0x81, 0x05, 0x80, 0x04, 0x82, 0x05,
+    0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x82, 0x06, 0x80, 0x05, 0x80,
+    0x04, 0x81, 0x05, 0x80, 0x04, 0x80, 0x07, 0x00, 0x81, 0x05, 0x82, 0x04,
+    0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x04, 0x01, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x00,
+    0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x81, 0x06, 0x80, 0x05, 0x00, 0x80,
+    0x04, 0x00, 0x81, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x00, 0x80, 0x06, 0x82, 0x04, 0x00, 0x81,
+    0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x00, 0x81, 0x06, 0x80, 0x05,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x00, 0x80, 0x06, 0x80, 0x07, 0x40, 0x08, 0x80, 0x05, 0x81, 0x04,
+    0x80, 0x06, 0x80, 0x00, 0x80, 0x05, 0x80, 0x00, 0x00, 0x80, 0x00, 0x81,
+    0x07, 0x80, 0x05, 0x81, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81, 0x05, 0x80,
+    0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x82,
+    0x06, 0x80, 0x07, 0x80, 0x05, 0x80, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81,
+    0x07, 0x82, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x04, 0x81, 0x06, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80, 0x05, 0x80, 0x07,
+    0x81, 0x05, 0x80, 0x07, 0x80, 0x04, 0x82, 0x05, 0x00, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x04, 0x81, 0x07, 0x00, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x05, 0x82, 0x04, 0x80, 0x07, 0x80, 0x05, 0x81, 0x06,
+    0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x81, 0x06, 0x80,
+    0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x81, 0x04, 0x80, 0x07, 0x80, 0x06,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x81, 0x05,
+    0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x01, 0x80, 0x01, 0x80,
+    0x06, 0x80, 0x04, 0x80, 0x05, 0x00, 0x81, 0x04, 0x80, 0x05, 0x80, 0x04,
+    0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x06, 0x83, 0x05, 0x81, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04, 0x81, 0x06, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x81,
+    0x07, 0x80, 0x05, 0x81, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x82,
+    0x06, 0x80, 0x05, 0x80, 0x07, 0x81, 0x05, 0x80, 0x07, 0x40, 0x08, 0x80,
+    0x05, 0x81, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x01, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x07, 0x81, 0x00, 0x81, 0x05, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x81,
+    0x04, 0x00, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x05, 0x82, 0x06, 0x00, 0x80, 0x06, 0x81, 0x07, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x00, 0x81, 0x05, 0x80, 0x04, 0x80, 0x06, 0x82, 0x04, 0x81,
+    0x07, 0x81, 0x04, 0x80, 0x07, 0x81, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x06, 0x81, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x04, 0x81, 0x06, 0x81, 0x07, 0x40, 0x0c, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x01, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x00, 0x81, 0x06,
+    0x00, 0x80, 0x05, 0x80, 0x00, 0x80, 0x06, 0x80, 0x04, 0x83, 0x07, 0x80,
+    0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x00, 0x81,
+    0x06, 0x81, 0x04, 0x80, 0x01, 0x81, 0x07, 0x80, 0x01, 0x80, 0x07, 0x80,
+    0x05, 0x01, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80,
+    0x04, 0x80, 0x07, 0x81, 0x06, 0x80, 0x04, 0x81, 0x07, 0x80, 0x06, 0x80,
+    0x01, 0x80, 0x04, 0x80, 0x07, 0x81, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x04, 0x00, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05,
+    0x01, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x04, 0x82, 0x05, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x04, 0x81, 0x05, 0x80, 0x07, 0x00, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x05, 0x81, 0x07, 0x00, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x05, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80, 0x04, 0x00, 0x80, 0x00,
+    0x80, 0x05, 0x80, 0x06, 0x81, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04,
+    0x82, 0x06, 0x81, 0x07, 0x80, 0x04, 0x81, 0x06, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04,
+    0x00, 0x81, 0x05, 0x81, 0x04, 0x81, 0x05, 0x80, 0x06, 0x81, 0x04, 0x80,
+    0x06, 0x00, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x00, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x81, 0x07, 0x80, 0x05, 0x82,
+    0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x00,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x40, 0x09, 0x80, 0x04,
+    0x81, 0x06, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x05, 0x00, 0x80, 0x04,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05,
+    0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x81, 0x05, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x07, 0x00, 0x82, 0x06, 0x80, 0x05,
+    0x81, 0x07, 0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x05, 0x81, 0x07, 0x80,
+    0x06, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x07, 0x00, 0x82, 0x05, 0x80,
+    0x04, 0x80, 0x05, 0x81, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x00,
+    0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x06, 0x83, 0x07, 0x81, 0x04, 0x80,
+    0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x02, 0x80, 0x04,
+    0x81, 0x07, 0x81, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06,
+    0x82, 0x05, 0x80, 0x07, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80,
+    0x07, 0x80, 0x04, 0x80, 0x06, 0x81, 0x04, 0x00, 0x80, 0x06, 0x00, 0x81,
+    0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x81,
+    0x07, 0x80, 0x05, 0x80, 0x07, 0x00, 0x82, 0x05, 0x80, 0x04, 0x81, 0x07,
+    0x83, 0x04, 0x00, 0x82, 0x06, 0x82, 0x05, 0x00, 0x81, 0x04, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x81, 0x04, 0x00, 0x80,
+    0x04, 0x00, 0x81, 0x07, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x05, 0x00, 0x80, 0x05, 0x83, 0x04, 0x80, 0x06, 0x00, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x82, 0x07, 0x80, 0x01, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x82, 0x06,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x07, 0x00, 0x80, 0x05, 0x82, 0x04, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x06, 0x82, 0x05, 0x00, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x81,
+    0x04, 0x80, 0x05, 0x80, 0x04, 0x82, 0x05, 0x80, 0x07, 0x81, 0x04, 0x80,
+    0x05, 0x80, 0x07, 0x82, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80,
+    0x04, 0x81, 0x07, 0x80, 0x06, 0x80, 0x07, 0x82, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x04,
+    0x80, 0x05, 0x81, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x81, 0x07,
+    0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x40, 0x07, 0x80, 0x06, 0x00, 0x80,
+    0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80,
+    0x05, 0x80, 0x06, 0x81, 0x05, 0x80, 0x07, 0x80, 0x06, 0x81, 0x05, 0x80,
+    0x07, 0x81, 0x06, 0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x06, 0x80, 0x04,
+    0x80, 0x07, 0x00, 0x81, 0x04, 0x80, 0x02, 0x80, 0x07, 0x81, 0x04, 0x80,
+    0x07, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04, 0x00,
+    0x81, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x81, 0x05,
+    0x80, 0x06, 0x80, 0x05, 0x40, 0x32, 0x80, 0x05, 0x00, 0x81, 0x04, 0x81,
+    0x06, 0x81, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x81, 0x06, 0x80,
+    0x05, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05,
+    0x81, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07,
+    0x81, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x06, 0x81, 0x07, 0x81, 0x06, 0x80, 0x07, 0x80, 0x05,
+    0x82, 0x07, 0x80, 0x04, 0x80, 0x07, 0x81, 0x04, 0x82, 0x05, 0x80, 0x06,
+    0x81, 0x04, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x05, 0x81, 0x06, 0x82,
+    0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x06, 0x83, 0x05, 0x80, 0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x80,
+    0x07, 0x81, 0x05, 0x80, 0x06, 0x81, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x00,
+    0x81, 0x06, 0x80, 0x05, 0x81, 0x04, 0x80, 0x05, 0x80, 0x07, 0x81, 0x04,
+    0x80, 0x05, 0x00, 0x82, 0x06, 0x80, 0x04, 0x81, 0x06, 0x40, 0x16, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x40, 0x16, 0x80, 0x04, 0x81,
+    0x07, 0x00, 0x80, 0x05, 0x80, 0x07, 0x01, 0x81, 0x07, 0x80, 0x05, 0x80,
+    0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x40, 0x1d, 0x80, 0x05, 0x81,
+    0x07, 0x80, 0x05, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x82, 0x05,
+    0x80, 0x07, 0x80, 0x06, 0x81, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06,
+    0x81, 0x07, 0x00, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x00, 0x80, 0x06,
+    0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x03, 0x80, 0x06, 0x80, 0x05, 0x82, 0x04, 0x80,
+    0x06, 0x00, 0x81, 0x06, 0x80, 0x05, 0x80, 0x03, 0x81, 0x07, 0x00, 0x80,
+    0x04, 0x80, 0x02, 0x80, 0x05, 0x81, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80,
+    0x04, 0x80, 0x02, 0x00, 0x81, 0x04, 0x81, 0x05, 0x00, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x00, 0x80, 0x05, 0x80, 0x07, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05, 0x00,
+    0x80, 0x04, 0x81, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06,
+    0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x81, 0x06, 0x81, 0x05,
+    0x80, 0x07, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x81, 0x05, 0x80, 0x04,
+    0x83, 0x05, 0x80, 0x03, 0x80, 0x06, 0x81, 0x04, 0x80, 0x07, 0x00, 0x80,
+    0x05, 0x80, 0x06, 0x00, 0x80, 0x06, 0x80, 0x07, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x02, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x04, 0x80, 0x07,
+    0x00, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x00,
+    0x80, 0x04, 0x81, 0x07, 0x80, 0x04, 0x81, 0x05, 0x80, 0x04, 0x00, 0x81,
+    0x05, 0x00, 0x81, 0x06, 0x82, 0x04, 0x80, 0x06, 0x00, 0x80, 0x07, 0x80,
+    0x05, 0x80, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80,
+    0x06, 0x80, 0x05, 0x80, 0x04, 0x81, 0x07, 0x80, 0x06, 0x80, 0x07, 0x80,
+    0x06, 0x82, 0x05, 0x81, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x80,
+    0x07, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x04, 0x00, 0x81, 0x04,
+    0x81, 0x07, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x05, 0x82, 0x06,
+    0x80, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x81, 0x06, 0x80, 0x04,
+    0x80, 0x06, 0x00, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x06, 0x81, 0x04,
+    0x80, 0x05, 0x80, 0x07, 0x80, 0x04, 0x40, 0x24, 0x80, 0x05, 0x80, 0x06,
+    0x80, 0x04, 0x80, 0x05, 0x00, 0x80, 0x04, 0x82, 0x06, 0x80, 0x07, 0x00,
+    0x81, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x05, 0x81, 0x06, 0x81, 0x05,
+    0x80, 0x04, 0x00, 0x81, 0x06, 0x80, 0x04, 0x00, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x07, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x06, 0x80, 0x05,
+    0x80, 0x07, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x00, 0x80, 0x04, 0x80,
+    0x07, 0x00, 0x80, 0x07, 0x82, 0x06, 0x00, 0x80, 0x04, 0x80, 0x06, 0x81,
+    0x07, 0x80, 0x05, 0x00, 0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x82, 0x06,
+    0x80, 0x07, 0x80, 0x05, 0x01, 0x80, 0x07, 0x80, 0x03, 0x00, 0x80, 0x07,
+    0x01, 0x80, 0x05, 0x80, 0x02, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x07,
+    0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x05, 0x81, 0x04, 0x80, 0x05, 0x80,
+    0x04, 0x00, 0x80, 0x05, 0x80, 0x02, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x07, 0x83, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07,
+    0x80, 0x05, 0x80, 0x00, 0x80, 0x07, 0x81, 0x05, 0x80, 0x02, 0x80, 0x05,
+    0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x00, 0x80, 0x06, 0x81, 0x07,
+    0x80, 0x06, 0x80, 0x05, 0x00, 0x80, 0x07, 0x00, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x04, 0x80, 0x05, 0x81, 0x03, 0x80, 0x07, 0x40, 0x28, 0x80, 0x04,
+    0x00, 0x80, 0x06, 0x80, 0x04, 0x80, 0x06, 0x80, 0x02, 0x81, 0x04, 0x00,
+    0x80, 0x05, 0x80, 0x07, 0x80, 0x06, 0x00, 0x80, 0x04, 0x80, 0x02, 0x00,
+    0x80, 0x05, 0x80, 0x02, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x80, 0x06,
+    0x00, 0x80, 0x06, 0x80, 0x04, 0x81, 0x05, 0x80, 0x07, 0x00, 0x80, 0x05,
+    0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x00,
+    0x81, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x02, 0x80, 0x06, 0x01, 0x80,
+    0x07, 0x80, 0x04, 0x00, 0x82, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x02,
+    0x80, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x06, 0x80, 0x07,
+    0x80, 0x06, 0x81, 0x07, 0x00, 0x80, 0x02, 0x80, 0x04, 0x80, 0x05, 0x01,
+    0x81, 0x06, 0x00, 0x81, 0x05, 0x00, 0x80, 0x06, 0x80, 0x04, 0x81, 0x07,
+    0x00, 0x80, 0x05, 0x80, 0x04, 0x81, 0x05, 0x80, 0x06, 0x80, 0x07, 0x81,
+    0x05, 0x00, 0x80, 0x07, 0x80, 0x04, 0x00, 0x80, 0x06, 0x80, 0x04, 0x80,
+    0x00, 0x00, 0x80, 0x00, 0x80, 0x06, 0x80, 0x05, 0x80, 0x06, 0x80, 0x04,
+    0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x07, 0x80,
+    0x04, 0x80, 0x07, 0x80, 0x05, 0x80, 0x07, 0x82, 0x05, 0x80, 0x06, 0x80,
+    0x04, 0x80, 0x05, 0x80, 0x04, 0x80, 0x07, 0x80, 0x04, 0x81, 0x06, 0x80,
+    0x07, 0x80, 0x06, 0x00, 0x82, 0x07, 0x80, 0x06, 0x80, 0x04, 0x80, 0x02,
+    0x81, 0x04, 0x83, 0x05, 0x80, 0x06, 0x80, 0x07, 0x81, 0x04, 0x82, 0x05,
+    0x81, 0x04, 0x81, 0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x80, 0x04,
+    0x80, 0x06,
+};
+
+const signed char scream_sound[] __attribute__((aligned(4))) = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0xFE, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFE, 0xFE, 0xFC, 0xFC, 0x00, 0xFE, 0xFC,
+    0x00, 0x01, 0x00, 0xFD, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x04,
+    0x01, 0x01, 0x02, 0x03, 0x00, 0xFF, 0x06, 0x00, 0x01, 0x00, 0x02, 0x07,
+    0x05, 0x08, 0x05, 0x04, 0x06, 0x03, 0x08, 0x0D, 0x09, 0x03, 0x0B, 0x0F,
+    0x10, 0x05, 0x0B, 0x0D, 0x06, 0x0C, 0x12, 0x07, 0x0C, 0x16, 0x13, 0x0D,
+    0x16, 0x0C, 0xF8, 0xF3, 0xF4, 0xF6, 0xEE, 0xF0, 0xEE, 0xF2, 0xEE, 0xF2,
+    0xE7, 0xF9, 0xEE, 0xEE, 0xF8, 0xEA, 0xF3, 0xF2, 0xF6, 0xFC, 0xF3, 0xF9,
+    0xF0, 0xF1, 0xFC, 0xFB, 0xFB, 0xF4, 0xFC, 0xEE, 0x00, 0xFF, 0xFE, 0x04,
+    0xFF, 0xFD, 0xFF, 0xFB, 0xF7, 0xFD, 0xF3, 0xFF, 0x0B, 0x00, 0x00, 0xFD,
+    0xF7, 0xFF, 0x0A, 0x0A, 0xF9, 0xFE, 0x0F, 0x11, 0xFF, 0x0E, 0x06, 0x02,
+    0xFF, 0x06, 0x0C, 0x0D, 0x06, 0x1C, 0x1A, 0x06, 0x05, 0x19, 0x06, 0x14,
+    0x22, 0x10, 0x14, 0x0E, 0x0D, 0x21, 0x1E, 0x25, 0x0F, 0x2B, 0x29, 0x17,
+    0x12, 0x1C, 0x01, 0x09, 0xD3, 0xEB, 0xD7, 0xD8, 0xEE, 0xD0, 0xD2, 0xE4,
+    0xE8, 0xD4, 0xEC, 0xED, 0xD8, 0xF4, 0xE4, 0xF2, 0xDB, 0xEF, 0xE3, 0xEE,
+    0xF2, 0xF9, 0xFF, 0xFF, 0xFB, 0xFD, 0xE7, 0x03, 0x02, 0xFD, 0xEE, 0x07,
+    0x08, 0xFE, 0xF4, 0xF5, 0xFC, 0xE9, 0xF2, 0x0C, 0xF4, 0xF3, 0x10, 0xFE,
+    0x13, 0x16, 0x13, 0xF9, 0x09, 0xF7, 0xFD, 0x16, 0x0A, 0x12, 0x13, 0x20,
+    0x16, 0x08, 0x08, 0x04, 0x1C, 0x27, 0x2B, 0x19, 0x24, 0x1B, 0x31, 0x22,
+    0x2F, 0x25, 0x1A, 0x3B, 0x34, 0x30, 0x1C, 0x33, 0x35, 0x29, 0x2D, 0x24,
+    0x3D, 0x11, 0x03, 0xFB, 0xC7, 0xCD, 0xC3, 0xB9, 0xE7, 0xDC, 0xE4, 0xD1,
+    0xEC, 0xC0, 0xE4, 0xE7, 0xE5, 0xE3, 0xDD, 0xE1, 0xE0, 0xD1, 0xE6, 0xEE,
+    0xD1, 0xD7, 0xE8, 0xF2, 0xEC, 0xD0, 0x02, 0xF8, 0x08, 0xF8, 0xEB, 0x01,
+    0xFE, 0xF7, 0xF4, 0xE2, 0x09, 0x12, 0x05, 0xF4, 0xEE, 0x17, 0xFB, 0x1C,
+    0x09, 0xF7, 0xFC, 0xF8, 0x22, 0x07, 0xF7, 0x19, 0x20, 0x19, 0xFF, 0x37,
+    0x05, 0x07, 0x08, 0x32, 0x15, 0x37, 0x15, 0x1F, 0x43, 0x1F, 0x47, 0x3C,
+    0x3B, 0x2E, 0x1E, 0x1E, 0x3E, 0x35, 0x56, 0x5A, 0x43, 0x42, 0x61, 0xFF,
+    0x09, 0x1A, 0x00, 0xB7, 0xB7, 0xCC, 0xAE, 0xDC, 0xBD, 0xDB, 0xE5, 0xC7,
+    0xC0, 0xDF, 0xD7, 0xD0, 0xB0, 0xE6, 0xE7, 0xD1, 0xBC, 0xD1, 0xC0, 0xDC,
+    0xEB, 0xDF, 0xE2, 0xD4, 0xE0, 0xC7, 0xEC, 0xEF, 0xE3, 0xD6, 0x05, 0xF1,
+    0x10, 0x01, 0xD9, 0x13, 0x19, 0x22, 0xE0, 0xF1, 0x18, 0x08, 0x23, 0xEA,
+    0x13, 0x02, 0x07, 0xF8, 0x3C, 0x24, 0x22, 0xFD, 0xFF, 0x3F, 0x43, 0x05,
+    0x0B, 0x0E, 0x3A, 0x2E, 0x1E, 0x33, 0x34, 0x15, 0x52, 0x49, 0x32, 0x62,
+    0x64, 0x3F, 0x57, 0x43, 0x64, 0x71, 0x32, 0xEA, 0xF8, 0x14, 0x0B, 0x1D,
+    0xCA, 0xC8, 0xBC, 0xBB, 0xA5, 0xCB, 0xB1, 0x9A, 0xCD, 0xA8, 0xEA, 0xEA,
+    0xD0, 0xA9, 0xD7, 0xC9, 0xEB, 0xD9, 0xCD, 0xE7, 0xFC, 0x01, 0xDC, 0xF6,
+    0xC7, 0xCB, 0x03, 0xEA, 0xEA, 0xFC, 0x14, 0x0C, 0x0A, 0xDF, 0xF0, 0x08,
+    0xE5, 0x05, 0x1F, 0xF3, 0x24, 0x01, 0xE7, 0x19, 0x23, 0xFF, 0x27, 0xF4,
+    0x13, 0xFB, 0x38, 0x04, 0x29, 0x0A, 0x09, 0x23, 0x39, 0x44, 0x14, 0x4D,
+    0x43, 0x10, 0x50, 0x37, 0x3C, 0x41, 0x25, 0x2B, 0x4F, 0x42, 0x6F, 0x60,
+    0x3F, 0x60, 0xFD, 0xF4, 0xF6, 0x1C, 0xEE, 0x03, 0xC1, 0xC6, 0xA1, 0xD5,
+    0x95, 0xDE, 0xCC, 0xA2, 0xB3, 0xA1, 0xE7, 0xE1, 0xA7, 0xB9, 0xEA, 0xE6,
+    0xE2, 0xDA, 0xCD, 0xF8, 0xE2, 0xC8, 0xC9, 0xCD, 0xD7, 0xEE, 0xCA, 0xC9,
+    0xEC, 0xEE, 0x09, 0x0E, 0xDB, 0xDA, 0x1D, 0xF9, 0x1E, 0xEB, 0x21, 0x16,
+    0xF4, 0x28, 0x15, 0xF1, 0x25, 0x1F, 0x3C, 0x05, 0x1B, 0x06, 0x2B, 0x1A,
+    0x13, 0x10, 0x3C, 0x41, 0x52, 0x24, 0x27, 0x0F, 0x4B, 0x1E, 0x5E, 0x57,
+    0x47, 0x50, 0x2D, 0x47, 0x59, 0x4C, 0x31, 0x5A, 0xDB, 0xF0, 0x1D, 0xFB,
+    0x25, 0x00, 0x28, 0x91, 0xD0, 0x99, 0xBD, 0xA7, 0xB5, 0xC1, 0xA1, 0xB9,
+    0xAD, 0xD2, 0xB0, 0xD1, 0xCE, 0xBF, 0xDD, 0xF5, 0xF7, 0xD1, 0xC5, 0xE3,
+    0xC5, 0xEC, 0xDB, 0xD4, 0xD2, 0xE9, 0xD5, 0x12, 0x0B, 0x04, 0xFA, 0xF2,
+    0xF4, 0xDC, 0xDD, 0xEA, 0x2A, 0x24, 0xF0, 0x0A, 0xEF, 0x08, 0x1D, 0x19,
+    0x15, 0x1D, 0x1C, 0x16, 0xFF, 0x3C, 0x17, 0x03, 0x0E, 0x48, 0x38, 0x53,
+    0x4A, 0x1F, 0x3B, 0x49, 0x20, 0x1F, 0x32, 0x44, 0x41, 0x5F, 0x55, 0x29,
+    0x56, 0x19, 0xF2, 0x0A, 0xF7, 0x15, 0x16, 0x21, 0xFE, 0xA2, 0xB5, 0xC5,
+    0xDF, 0xD0, 0x9E, 0x9B, 0xCD, 0xBA, 0xD6, 0xDC, 0xBD, 0xE5, 0xB1, 0xB8,
+    0xCF, 0xC1, 0xEF, 0xE8, 0xC3, 0xDB, 0xEB, 0x07, 0xF2, 0xF3, 0x00, 0xFC,
+    0xDF, 0x0E, 0xF8, 0xF5, 0xFB, 0xEC, 0xDD, 0xF2, 0x23, 0xE8, 0x06, 0xEA,
+    0x06, 0x08, 0xFF, 0xF1, 0x34, 0xFF, 0x11, 0x40, 0x1E, 0x12, 0x10, 0x44,
+    0x0F, 0x34, 0x29, 0x2F, 0x35, 0x4F, 0x1E, 0x34, 0x28, 0x4D, 0x3E, 0x3C,
+    0x3A, 0x33, 0x51, 0x3E, 0x48, 0x05, 0x16, 0x14, 0x11, 0xEE, 0x1E, 0x0C,
+    0x00, 0x0E, 0xCB, 0xA9, 0xD0, 0xB1, 0x99, 0xDD, 0xC6, 0xD8, 0xA6, 0xBE,
+    0xB8, 0xC0, 0xAE, 0xB9, 0xBE, 0xD4, 0xCA, 0xB8, 0xD4, 0xCA, 0xCE, 0xF6,
+    0xE3, 0xC7, 0xC6, 0xCA, 0xFF, 0x09, 0xD6, 0x0D, 0xDE, 0xE9, 0xFF, 0xF5,
+    0x26, 0xEB, 0xF2, 0x25, 0x0C, 0x1F, 0xF9, 0x26, 0x0B, 0x31, 0x11, 0x06,
+    0x23, 0xFE, 0x07, 0x0F, 0x44, 0x41, 0x2F, 0x27, 0x28, 0x1E, 0x4C, 0x33,
+    0x32, 0x53, 0x1B, 0x3C, 0x4C, 0x21, 0x51, 0x24, 0x4D, 0xDD, 0x19, 0xF3,
+    0xE6, 0xFA, 0xF2, 0x19, 0x01, 0x26, 0x15, 0xA5, 0x9B, 0xA9, 0xB7, 0xD3,
+    0xCB, 0xBC, 0xCB, 0xDD, 0xC2, 0xD9, 0xEA, 0xD9, 0xEC, 0xC3, 0xB9, 0xD0,
+    0xBF, 0xFC, 0xD2, 0x01, 0xFC, 0xEF, 0xC8, 0x12, 0x13, 0xFB, 0xD1, 0xF9,
+    0xE4, 0xFE, 0x11, 0x04, 0xE2, 0x24, 0x29, 0xEB, 0x00, 0x22, 0x1E, 0x1E,
+    0x39, 0x0D, 0xF6, 0x3F, 0x37, 0x14, 0x1E, 0x46, 0x40, 0x40, 0x26, 0x4E,
+    0x10, 0x48, 0x1A, 0x29, 0x36, 0x35, 0x37, 0x40, 0x50, 0x44, 0x6B, 0x6C,
+    0xD3, 0xEC, 0xD9, 0xEF, 0xFC, 0xF5, 0x1F, 0x09, 0x22, 0x29, 0xF7, 0xD1,
+    0xDE, 0xDB, 0xAC, 0xDC, 0xA3, 0xDC, 0xAC, 0xBB, 0xDA, 0xB9, 0xBF, 0xAF,
+    0xD3, 0xD3, 0xEC, 0xE0, 0xDE, 0xD5, 0xEB, 0xEB, 0xDC, 0xC7, 0xDF, 0x12,
+    0x10, 0x13, 0xD5, 0xDB, 0xFA, 0x03, 0xFB, 0xED, 0x1C, 0xF1, 0xFD, 0xFC,
+    0x0A, 0x03, 0xEE, 0x0E, 0xF8, 0x2D, 0x36, 0x02, 0x38, 0x42, 0x21, 0x23,
+    0x0D, 0x1D, 0x43, 0x2B, 0x41, 0x37, 0x58, 0x47, 0x58, 0x55, 0x5E, 0x1C,
+    0x4B, 0x2C, 0x65, 0x02, 0x07, 0xDF, 0x10, 0x1D, 0x23, 0x00, 0xEE, 0x22,
+    0x0B, 0x10, 0x99, 0xCD, 0x96, 0xAE, 0xB3, 0xCA, 0xD7, 0xAB, 0xBE, 0xF0,
+    0xB2, 0xBD, 0xD0, 0xEB, 0xF0, 0xFF, 0xF4, 0xE8, 0xDC, 0xFA, 0xE0, 0x09,
+    0xC9, 0xEB, 0xF4, 0x0A, 0x0A, 0xEC, 0x02, 0x12, 0x04, 0x04, 0x22, 0xF6,
+    0x0B, 0x0F, 0x06, 0x05, 0xFC, 0x28, 0x33, 0x39, 0x16, 0xFD, 0x24, 0x27,
+    0x3B, 0x2B, 0x26, 0x35, 0x10, 0x28, 0x3D, 0x3A, 0x14, 0x16, 0x56, 0x49,
+    0x47, 0x62, 0x64, 0x32, 0x68, 0xE3, 0x03, 0xF6, 0xF5, 0xEE, 0xF6, 0x25,
+    0xE9, 0x10, 0x18, 0x15, 0x0A, 0xEE, 0xC7, 0xCC, 0xC4, 0xD4, 0xB2, 0xDA,
+    0xC0, 0xCB, 0xB6, 0xC1, 0xB1, 0xB6, 0xDB, 0xB5, 0xBF, 0xDB, 0xC8, 0x05,
+    0xC9, 0x02, 0x00, 0xFD, 0xC9, 0xD0, 0xD1, 0xDA, 0xFE, 0x03, 0xEF, 0xDB,
+    0xFC, 0xEF, 0x02, 0x1F, 0x04, 0x1A, 0x2E, 0xED, 0x0B, 0x2E, 0xFF, 0x31,
+    0x3C, 0x34, 0x11, 0x25, 0x28, 0x0A, 0x1D, 0x3B, 0x11, 0x32, 0x43, 0x14,
+    0x58, 0x55, 0x23, 0x1E, 0x34, 0x5B, 0x3F, 0xD7, 0x08, 0x03, 0xD8, 0x0A,
+    0xF9, 0x07, 0x03, 0xED, 0xE2, 0x1E, 0xF4, 0xF5, 0x2D, 0xCD, 0xB3, 0x9C,
+    0xB8, 0xC1, 0xC9, 0xC9, 0xC6, 0xD2, 0xB2, 0xF4, 0xD4, 0xF8, 0xDE, 0xE3,
+    0xC1, 0xED, 0xF6, 0xD7, 0xCC, 0xE6, 0xDC, 0xCD, 0x0E, 0x03, 0xF9, 0xD9,
+    0xE5, 0xEE, 0xF3, 0x12, 0xE3, 0x12, 0xE7, 0x18, 0x24, 0xFB, 0xF7, 0x25,
+    0x33, 0x19, 0x39, 0x2F, 0x32, 0x17, 0x02, 0x37, 0x19, 0x49, 0x21, 0x4B,
+    0x0F, 0x31, 0x46, 0x43, 0x1E, 0x17, 0x2F, 0x5C, 0x34, 0x68, 0x01, 0x00,
+    0xF4, 0xDE, 0x1B, 0x0C, 0x1D, 0x05, 0x22, 0xFB, 0xED, 0x2F, 0xFD, 0xF9,
+    0x9C, 0xB5, 0xD0, 0xBA, 0xD4, 0xDE, 0xBE, 0xEC, 0xBE, 0xD9, 0xB5, 0xF0,
+    0xBF, 0xD2, 0xDE, 0xE8, 0xC2, 0xE8, 0x0A, 0xF3, 0xD2, 0x03, 0x10, 0xE5,
+    0xE4, 0x02, 0xDC, 0x12, 0x15, 0x00, 0x01, 0x24, 0xFE, 0xFF, 0x25, 0x05,
+    0xF5, 0x25, 0x2B, 0x0D, 0x29, 0x03, 0x35, 0x31, 0x1D, 0x07, 0x41, 0x4D,
+    0x25, 0x51, 0x3F, 0x35, 0x4E, 0x59, 0x40, 0x22, 0x23, 0x1C, 0x27, 0x41,
+    0xD0, 0xDD, 0xD6, 0xEE, 0x1C, 0x1F, 0x1E, 0xF3, 0xE2, 0xF7, 0x04, 0x0F,
+    0x21, 0x2D, 0x08, 0xAD, 0xE1, 0xDF, 0xCE, 0xDF, 0xA9, 0xC0, 0xE5, 0xE5,
+    0xC4, 0xDA, 0xF8, 0xB4, 0xBC, 0xEA, 0xBF, 0xFB, 0xEC, 0xED, 0xFE, 0xDF,
+    0xE3, 0xDD, 0xDB, 0x15, 0x0A, 0xE8, 0x00, 0xEE, 0x13, 0xDE, 0x18, 0x1A,
+    0xE8, 0xEA, 0x19, 0x00, 0x1D, 0x2A, 0x26, 0x37, 0x2D, 0x21, 0x3B, 0x3B,
+    0x0D, 0x36, 0x34, 0x2F, 0x1E, 0x28, 0x4C, 0x4A, 0x54, 0x4F, 0x1B, 0x1C,
+    0x49, 0x50, 0x06, 0x03, 0x08, 0x17, 0xDF, 0xEE, 0xE6, 0x18, 0x1B, 0x0E,
+    0x21, 0xFB, 0x1B, 0x26, 0xED, 0x20, 0xB1, 0xA4, 0xBD, 0x9F, 0xD4, 0xEA,
+    0xD5, 0xB0, 0xC9, 0xBD, 0xBF, 0xD6, 0xC4, 0xED, 0x00, 0xE0, 0xC6, 0xE9,
+    0xE8, 0xDB, 0xD0, 0xD2, 0x08, 0xF1, 0xDD, 0xD6, 0xE1, 0xF7, 0xF1, 0xE4,
+    0x25, 0x1E, 0x0E, 0xE9, 0x1B, 0x03, 0xFA, 0x1E, 0x38, 0x2B, 0x31, 0x32,
+    0x37, 0x1A, 0x3E, 0x36, 0x39, 0x0A, 0x27, 0x25, 0x12, 0x0E, 0x4E, 0x48,
+    0x21, 0x1D, 0x5E, 0x5E, 0xDE, 0xEB, 0xF8, 0xD4, 0x09, 0x17, 0x19, 0x16,
+    0xEE, 0xFB, 0x05, 0x15, 0x0D, 0xF5, 0x23, 0xFA, 0x30, 0x1F, 0xD8, 0xA0,
+    0xDE, 0xD4, 0xAE, 0xEE, 0xE9, 0xB1, 0xB0, 0xDC, 0xC9, 0xB5, 0xC9, 0xED,
+    0xF7, 0x01, 0x00, 0xDC, 0x0A, 0xF7, 0xE8, 0x09, 0xFF, 0x00, 0xFE, 0xDC,
+    0x01, 0x0D, 0xF1, 0x26, 0xEA, 0x14, 0x08, 0xEE, 0xF2, 0xF3, 0xFF, 0x25,
+    0x17, 0x15, 0x0E, 0x30, 0x2A, 0x1C, 0x11, 0x45, 0x2F, 0x43, 0x20, 0x39,
+    0x35, 0x13, 0x39, 0x2C, 0x3C, 0x28, 0x50, 0xDB, 0xDA, 0xD6, 0xFB, 0xE6,
+    0xEF, 0xF1, 0x1C, 0x1E, 0x1F, 0x13, 0x10, 0x26, 0xEC, 0x10, 0x19, 0xFE,
+    0x2B, 0xE1, 0xDC, 0xA6, 0xE9, 0xE4, 0xA9, 0xBF, 0xB1, 0xC5, 0xD5, 0xEE,
+    0xD6, 0xED, 0xD4, 0xE5, 0xFA, 0xF9, 0xE9, 0xEF, 0x0A, 0xFD, 0xFB, 0xFD,
+    0x03, 0x07, 0xD5, 0x1A, 0x18, 0x03, 0x10, 0xF3, 0x2A, 0x04, 0x08, 0x0F,
+    0x0E, 0xEE, 0x25, 0x00, 0x30, 0x18, 0x38, 0x08, 0x45, 0x21, 0x3E, 0x3F,
+    0x10, 0x2D, 0x0B, 0x2B, 0x36, 0x18, 0x18, 0x4C, 0x44, 0x4C, 0xE8, 0xFD,
+    0xD2, 0xF6, 0xDA, 0xF6, 0xEE, 0xE6, 0x0C, 0x23, 0xF7, 0x07, 0x1E, 0x18,
+    0x0E, 0xF0, 0xEE, 0xFC, 0x33, 0xCE, 0xC1, 0xB6, 0xCE, 0xA6, 0xE4, 0xBC,
+    0xE7, 0xCF, 0xEF, 0xF1, 0xBA, 0xF4, 0xC9, 0xFB, 0xC1, 0xF1, 0xC8, 0x00,
+    0x09, 0xEB, 0xD9, 0x10, 0x13, 0xF4, 0xDD, 0x16, 0x0E, 0x15, 0x08, 0xE3,
+    0xEB, 0xF6, 0x22, 0x01, 0x25, 0xF1, 0x24, 0xF3, 0x31, 0x12, 0x15, 0x2B,
+    0x1D, 0x44, 0x4B, 0x2F, 0x42, 0x4E, 0x21, 0x39, 0x27, 0x17, 0x23, 0x2C,
+    0x25, 0xD5, 0x0D, 0xF7, 0x09, 0xD0, 0xD4, 0x0A, 0xDA, 0xFE, 0xFA, 0xFE,
+    0x06, 0xF7, 0xFE, 0x0D, 0x0C, 0x2B, 0x2C, 0x17, 0xFC, 0x22, 0xC2, 0xB2,
+    0xB9, 0xBE, 0xBC, 0xE9, 0xF1, 0xC6, 0xFA, 0xC4, 0xD4, 0xE1, 0xCB, 0xC3,
+    0xE7, 0xEE, 0x00, 0xCA, 0x00, 0xF7, 0xE7, 0xDD, 0xED, 0x0F, 0xFB, 0xF5,
+    0x16, 0x1A, 0xFB, 0xE9, 0xE6, 0xE7, 0x2A, 0xF7, 0x0E, 0x1B, 0x12, 0xF9,
+    0xF8, 0x0B, 0x36, 0x0F, 0x03, 0x32, 0x12, 0x3F, 0x1A, 0x42, 0x2F, 0x46,
+    0x2C, 0x3A, 0x23, 0x23, 0x4B, 0xFA, 0xF7, 0x0F, 0xEF, 0xD9, 0xF7, 0x18,
+    0xFE, 0xE1, 0xE0, 0x1A, 0xE3, 0x22, 0xE4, 0x01, 0x11, 0xF3, 0xFB, 0x14,
+    0x11, 0x04, 0x28, 0xB3, 0xA5, 0xE9, 0xCB, 0xD2, 0xE1, 0xBD, 0xBC, 0xD6,
+    0xB3, 0xE4, 0xFF, 0x01, 0xC6, 0xC1, 0xD7, 0xCD, 0xFB, 0xE9, 0x0A, 0xEE,
+    0xD0, 0xF2, 0xEF, 0x18, 0x0C, 0xEE, 0xF8, 0xF1, 0xE8, 0xEF, 0x1E, 0x20,
+    0x24, 0x2C, 0x0F, 0x37, 0x1D, 0x11, 0xFD, 0x25, 0x19, 0x33, 0x1C, 0x46,
+    0x2B, 0x43, 0x4B, 0x3A, 0x45, 0x31, 0x1B, 0x29, 0x38, 0x1E, 0xF5, 0xCB,
+    0x0E, 0xFC, 0x0B, 0x14, 0x03, 0xED, 0xFF, 0x1B, 0xF3, 0xFD, 0xEC, 0xF4,
+    0xF2, 0x23, 0x12, 0x1D, 0xFA, 0x30, 0x1F, 0xF9, 0xF9, 0xD3, 0xA5, 0xEE,
+    0xC1, 0xED, 0xCC, 0xD9, 0xC9, 0xC0, 0xF2, 0xCC, 0xEE, 0xDD, 0xBF, 0x03,
+    0xF2, 0xD1, 0x08, 0x0D, 0xE9, 0x0F, 0xD9, 0xE8, 0xE9, 0x11, 0x0C, 0x05,
+    0x1E, 0xE2, 0xF6, 0xF8, 0x08, 0x2B, 0x1E, 0xFD, 0xF1, 0x0D, 0x20, 0x06,
+    0x38, 0x05, 0x00, 0x18, 0x3F, 0x0C, 0x43, 0x49, 0x1B, 0x0E, 0x4D, 0x28,
+    0x59, 0x25, 0x24, 0xFC, 0xF7, 0xC9, 0x0A, 0xD7, 0xD4, 0x10, 0x05, 0xE1,
+    0xE8, 0x16, 0xF4, 0xF3, 0x0F, 0x24, 0x03, 0x1C, 0x2B, 0x00, 0x22, 0x33,
+    0xF1, 0x04, 0x39, 0xC8, 0xBE, 0xC7, 0xE5, 0xAE, 0xCF, 0xBE, 0xBB, 0xCA,
+    0xDD, 0xE3, 0xF3, 0xBE, 0xE8, 0x08, 0xFF, 0xD0, 0x05, 0xD8, 0xCC, 0x06,
+    0xED, 0xF7, 0xFF, 0x1C, 0xF8, 0x14, 0x21, 0xE5, 0x26, 0xE5, 0x0E, 0x04,
+    0xEF, 0xF9, 0x0D, 0xFE, 0x24, 0x0E, 0x2E, 0x39, 0x29, 0x31, 0x01, 0x1D,
+    0x31, 0x38, 0x51, 0x52, 0x39, 0x44, 0x38, 0x42, 0x4B, 0xE5, 0xFA, 0xF4,
+    0x0D, 0x03, 0x0C, 0xF7, 0xFD, 0x1A, 0x07, 0x14, 0x12, 0xDC, 0x0A, 0x23,
+    0xE8, 0x00, 0x2E, 0x06, 0x1A, 0xFC, 0x1F, 0x30, 0x06, 0x30, 0xBA, 0xCE,
+    0xC3, 0xE1, 0xAE, 0xD7, 0xD7, 0xB3, 0xBE, 0xD2, 0xE2, 0x03, 0xEF, 0xE5,
+    0xDD, 0x03, 0xC6, 0x0E, 0xEF, 0xEC, 0xF5, 0xDA, 0xED, 0x1A, 0x17, 0xE2,
+    0x12, 0x13, 0xFB, 0xF3, 0xF8, 0x14, 0xE9, 0x21, 0x0A, 0xF7, 0x37, 0x29,
+    0x38, 0x34, 0x35, 0x26, 0x42, 0x3D, 0x26, 0x2A, 0x27, 0x26, 0x34, 0x3C,
+    0x4F, 0x1E, 0x50, 0xE4, 0x06, 0xF1, 0xDE, 0xD3, 0x00, 0xF3, 0x00, 0x14,
+    0xEE, 0xEB, 0x01, 0x11, 0xE8, 0x17, 0xE9, 0x21, 0x17, 0xFA, 0xF8, 0x0F,
+    0x1A, 0x26, 0x13, 0x02, 0x18, 0x3F, 0xAE, 0xE7, 0xEE, 0xB8, 0xDC, 0xBD,
+    0xDB, 0xF1, 0xF7, 0xC4, 0xF9, 0xDA, 0xD5, 0x00, 0xD8, 0x00, 0xE6, 0xCB,
+    0x13, 0xD9, 0xE8, 0xDD, 0xFC, 0x16, 0x0E, 0x00, 0x0F, 0x14, 0xF2, 0x1A,
+    0x10, 0x19, 0x09, 0x26, 0x0E, 0x0A, 0x1E, 0x31, 0x27, 0x1E, 0x13, 0x16,
+    0x10, 0x41, 0x1C, 0x3F, 0x36, 0x23, 0x38, 0x11, 0x3F, 0x33, 0x27, 0xD7,
+    0xCB, 0xD9, 0x07, 0xF4, 0x09, 0xE3, 0xFB, 0xFE, 0x15, 0xFF, 0xF9, 0x00,
+    0x21, 0xF5, 0x12, 0xF1, 0x12, 0x24, 0x00, 0x1D, 0x1D, 0x11, 0x1D, 0x04,
+    0x07, 0x06, 0x0C, 0xBA, 0xC9, 0xE8, 0xDC, 0xAF, 0xD3, 0xC5, 0xCA, 0xF4,
+    0xBE, 0xEA, 0xCE, 0xCA, 0xDC, 0xE0, 0xDB, 0xE5, 0xE6, 0xE8, 0xFA, 0xDE,
+    0x04, 0xDB, 0x0D, 0xF6, 0x21, 0x22, 0x00, 0x14, 0xFE, 0x23, 0xEA, 0x04,
+    0xFB, 0xF9, 0x07, 0x26, 0x08, 0x25, 0x1F, 0x0F, 0x38, 0x3A, 0x0A, 0x22,
+    0x1F, 0x40, 0x26, 0x38, 0x0E, 0x24, 0x58, 0xFB, 0xF3, 0xD1, 0xF7, 0xD4,
+    0x04, 0xDD, 0xD8, 0xD2, 0xE7, 0xD6, 0xDA, 0x1B, 0x0D, 0xFA, 0xDF, 0x1A,
+    0x1B, 0x2A, 0x00, 0x18, 0x25, 0x08, 0xFE, 0xFD, 0x09, 0x2A, 0x14, 0x13,
+    0xEE, 0xBB, 0xB3, 0xBF, 0xB9, 0xB3, 0xB7, 0xCC, 0xFD, 0xF8, 0xD4, 0xCF,
+    0x02, 0xC3, 0xDD, 0xF5, 0xE0, 0xD3, 0xD3, 0xDD, 0xD9, 0xDB, 0xE3, 0xF5,
+    0xE0, 0xE9, 0x04, 0x22, 0x24, 0xF6, 0x29, 0x05, 0x20, 0x14, 0x2D, 0x2D,
+    0x2B, 0x14, 0x1F, 0xF9, 0x38, 0xFE, 0x3C, 0x38, 0x23, 0x17, 0x3D, 0x34,
+    0x12, 0x12, 0x1A, 0x52, 0x02, 0xE3, 0xEA, 0x00, 0xD8, 0xCF, 0x03, 0x10,
+    0xE5, 0xD9, 0xD5, 0xD9, 0xE9, 0x02, 0xFC, 0xEB, 0xE1, 0x19, 0xEA, 0xE9,
+    0xF6, 0x2A, 0x12, 0x2F, 0xFE, 0xF3, 0x24, 0x0C, 0x3F, 0x24, 0x2B, 0xC0,
+    0xF1, 0xE6, 0xC5, 0xE2, 0xEC, 0xD0, 0xF2, 0xE0, 0xE1, 0xDF, 0xE4, 0xF4,
+    0xC6, 0xEC, 0xCD, 0xF8, 0xEE, 0xDD, 0xD4, 0x0D, 0xD8, 0xDB, 0x03, 0x0E,
+    0xF5, 0x06, 0x09, 0xF8, 0x24, 0x2E, 0x17, 0xF5, 0x24, 0x21, 0x15, 0xF7,
+    0x35, 0x3C, 0x01, 0x05, 0x1D, 0x2E, 0x2F, 0x1A, 0x3C, 0x32, 0x13, 0x33,
+    0x34, 0x18, 0xD5, 0xD6, 0xE8, 0x02, 0xFF, 0xDE, 0x06, 0x05, 0x04, 0xE3,
+    0xFB, 0xF8, 0x05, 0x05, 0xE9, 0xE1, 0xDE, 0x20, 0x06, 0x1A, 0x09, 0xEC,
+    0x1C, 0xF9, 0x25, 0x2F, 0x37, 0xFF, 0x24, 0x3D, 0x20, 0x19, 0xE7, 0xCB,
+    0xD3, 0xE4, 0xF5, 0xDE, 0xBB, 0xBB, 0xCA, 0xD0, 0x04, 0xF5, 0x00, 0xFE,
+    0xF6, 0xD5, 0x09, 0x10, 0xD9, 0x08, 0x06, 0xEE, 0x1D, 0x20, 0x1B, 0x0F,
+    0xEE, 0x0F, 0x00, 0xF9, 0xFA, 0x30, 0xF0, 0x22, 0x34, 0xF7, 0x03, 0x2D,
+    0x3A, 0x11, 0x36, 0x00, 0x19, 0x35, 0x35, 0x42, 0x2C, 0x36, 0x22, 0x32,
+    0xF0, 0xDF, 0xCA, 0xCD, 0xDF, 0xF6, 0xE4, 0x08, 0xEE, 0x11, 0x16, 0xD4,
+    0xD5, 0xDB, 0x00, 0xF5, 0xE0, 0x0A, 0x1E, 0xF3, 0x26, 0x07, 0xF9, 0x15,
+    0x23, 0xF9, 0x1E, 0x0E, 0x11, 0xFF, 0x08, 0x03, 0x2B, 0x3E, 0xCA, 0xC8,
+    0xBB, 0xCC, 0xE7, 0xD5, 0xD0, 0xF0, 0xBC, 0xC0, 0xCF, 0xDE, 0xF5, 0xDA,
+    0xF5, 0xD1, 0x05, 0xEC, 0xDF, 0x12, 0xDB, 0xD7, 0xE2, 0xF5, 0xE3, 0xDF,
+    0x08, 0x25, 0x0B, 0x24, 0xF3, 0x00, 0xEF, 0x12, 0x30, 0xF7, 0x30, 0x31,
+    0x11, 0x20, 0xFF, 0x1F, 0x42, 0x03, 0x0C, 0x1D, 0x12, 0x1D, 0x13, 0xF3,
+    0xCC, 0xFF, 0xD4, 0xF8, 0xE6, 0xE6, 0xFB, 0xE9, 0x0C, 0x00, 0x17, 0x10,
+    0x12, 0xF2, 0x1E, 0xE4, 0x0F, 0xF2, 0xFB, 0x05, 0x06, 0xEC, 0xF0, 0x25,
+    0x34, 0xF4, 0xF7, 0xF9, 0x1F, 0x10, 0x26, 0x2C, 0x21, 0x36, 0xD6, 0xB8,
+    0xE8, 0xC5, 0xE1, 0xF8, 0xBA, 0x00, 0xC0, 0xE8, 0xF2, 0xDF, 0xED, 0xFA,
+    0xFF, 0x00, 0x0D, 0xE9, 0xEF, 0xDD, 0xDC, 0xE8, 0x17, 0xFE, 0x06, 0x22,
+    0xEC, 0x18, 0x1B, 0x21, 0x06, 0xF4, 0x29, 0x00, 0xFE, 0x03, 0x24, 0x21,
+    0x1A, 0xFE, 0x35, 0x0F, 0x00, 0x1D, 0x31, 0x2E, 0x0B, 0x18, 0x34, 0xF0,
+    0xC1, 0xFD, 0xF9, 0x00, 0xD4, 0xFD, 0xD5, 0xF1, 0xD9, 0xD3, 0xE5, 0xEE,
+    0x0C, 0x0C, 0x19, 0xE7, 0x13, 0x25, 0x1E, 0x00, 0xF5, 0xFC, 0xF1, 0xF2,
+    0x27, 0xFA, 0x0D, 0x01, 0x37, 0xF8, 0x08, 0x23, 0x2D, 0x01, 0x3E, 0xAE,
+    0xB9, 0xCA, 0xCE, 0xB9, 0xE3, 0xF3, 0xD6, 0xE6, 0xC2, 0xE7, 0xC9, 0xCC,
+    0xF4, 0xFE, 0xF6, 0xE7, 0xE2, 0x13, 0xD9, 0xEA, 0x11, 0xFF, 0xF3, 0xDF,
+    0x16, 0xEC, 0xE7, 0x20, 0x1A, 0x20, 0xF5, 0x11, 0x14, 0x2E, 0x15, 0x27,
+    0x0C, 0x01, 0x2F, 0x11, 0x46, 0x00, 0x2D, 0x16, 0x23, 0x4A, 0x23, 0xBB,
+    0xC6, 0xEE, 0xCD, 0xD5, 0xCA, 0x00, 0xDC, 0x03, 0xDD, 0xE7, 0xFF, 0xE1,
+    0xFC, 0xFD, 0xDE, 0x05, 0x16, 0x1F, 0x21, 0x07, 0x15, 0x24, 0xF5, 0xFF,
+    0x2F, 0x22, 0x0F, 0x1C, 0x27, 0x14, 0x35, 0x04, 0x31, 0x2F, 0x14, 0x22,
+    0xBF, 0xEE, 0xD0, 0xE2, 0xD0, 0xBE, 0xFD, 0xEB, 0xD3, 0xFD, 0xFE, 0xFD,
+    0xED, 0x05, 0x01, 0xDF, 0x00, 0x06, 0x10, 0xD6, 0x14, 0x0F, 0x0E, 0xEC,
+    0x19, 0xFA, 0xFA, 0x07, 0x07, 0xEA, 0xF5, 0x12, 0x08, 0x18, 0x0F, 0x1F,
+    0x20, 0x2D, 0x36, 0x3D, 0x0C, 0x06, 0x2F, 0x2A, 0x1E, 0x18, 0x38, 0xE1,
+    0xCD, 0xED, 0x00, 0xBF, 0xF2, 0xEC, 0xE7, 0xF7, 0x08, 0x02, 0x0F, 0x07,
+    0xF5, 0x14, 0xEA, 0xFA, 0xE9, 0x0D, 0xF4, 0x0C, 0x27, 0xEF, 0xF7, 0xE8,
+    0x22, 0xF8, 0x04, 0x00, 0x15, 0x13, 0x21, 0x12, 0xFE, 0x38, 0x05, 0x44,
+    0x22, 0x01, 0xCA, 0xB8, 0xEA, 0xFC, 0xF3, 0xC3, 0xFA, 0xDC, 0xE7, 0xE9,
+    0xED, 0xEF, 0xD9, 0xF6, 0x08, 0xF7, 0xE6, 0xF1, 0x0B, 0x10, 0xEE, 0x1A,
+    0x05, 0xFD, 0x0E, 0xF7, 0x08, 0x24, 0x09, 0x29, 0x16, 0x19, 0xF9, 0x2E,
+    0x03, 0x28, 0x02, 0x37, 0x05, 0x12, 0x03, 0x28, 0x32, 0x1B, 0x25, 0x3A,
+    0xE6, 0xC9, 0xD0, 0xEB, 0xFA, 0xDE, 0xD2, 0xFF, 0xD8, 0x07, 0xE8, 0x07,
+    0x13, 0xDF, 0x0C, 0xE4, 0x0A, 0xFE, 0x1A, 0x00, 0x1C, 0x07, 0x0B, 0xF7,
+    0x2B, 0x05, 0xF9, 0x0B, 0x21, 0xF2, 0x10, 0xFF, 0x16, 0xF9, 0xFD, 0x13,
+    0x18, 0x01, 0x18, 0x13, 0xDE, 0xD4, 0xC3, 0xD3, 0xF9, 0xFD, 0xD2, 0xE8,
+    0xC3, 0xE4, 0xD2, 0xF5, 0xFA, 0xFD, 0xF5, 0xDA, 0xDF, 0xDA, 0x02, 0x00,
+    0x06, 0xF8, 0xEA, 0xF6, 0xE1, 0xE9, 0x0E, 0x1D, 0xF7, 0x20, 0xF4, 0x32,
+    0x19, 0x37, 0xFA, 0x2B, 0xFB, 0x25, 0x11, 0x04, 0x33, 0x30, 0x0D, 0x1A,
+    0x4D, 0xF3, 0xCE, 0x01, 0xCA, 0xF8, 0xE9, 0xFE, 0xFC, 0xDB, 0xFF, 0xF4,
+    0x12, 0xDA, 0xE4, 0xE6, 0xE3, 0x14, 0x04, 0xDC, 0x19, 0xFC, 0x25, 0x26,
+    0x05, 0x13, 0xF8, 0x10, 0xED, 0xF2, 0x36, 0x15, 0x03, 0x13, 0x24, 0x34,
+    0xFD, 0x1D, 0x25, 0x13, 0x43, 0xC3, 0xD1, 0xF3, 0xDA, 0xC8, 0xD1, 0xCA,
+    0xDB, 0xC4, 0xD5, 0xD4, 0xCA, 0xF5, 0xDD, 0xF8, 0x07, 0xD3, 0xF7, 0xE1,
+    0xDD, 0xD9, 0x08, 0x24, 0x19, 0x12, 0x1A, 0x05, 0x14, 0xF3, 0x13, 0x22,
+    0x15, 0xF5, 0x11, 0x0C, 0x34, 0x30, 0x23, 0x02, 0x23, 0x08, 0x0D, 0x45,
+    0x47, 0xE0, 0xE6, 0xFF, 0xBF, 0xC0, 0xE6, 0xF5, 0xF8, 0x01, 0x03, 0xD7,
+    0xF8, 0xD1, 0xF4, 0x00, 0x05, 0xF3, 0x15, 0xE7, 0x01, 0xF2, 0xE2, 0x15,
+    0xF0, 0x0B, 0x22, 0xFF, 0x00, 0x21, 0x1B, 0x1A, 0x2B, 0x12, 0xF8, 0x13,
+    0x30, 0x13, 0x0E, 0x1C, 0x36, 0x20, 0x18, 0xCB, 0xB8, 0xF4, 0xD0, 0xE7,
+    0xD7, 0xF2, 0x00, 0xE6, 0x00, 0xD7, 0xDE, 0xFD, 0x12, 0x0B, 0xDD, 0x0E,
+    0xF4, 0xD8, 0x1D, 0xE3, 0xFD, 0x04, 0x0D, 0xE9, 0x05, 0x25, 0x11, 0x05,
+    0x1F, 0x30, 0x02, 0x1F, 0x3C, 0xFB, 0x21, 0x3D, 0x03, 0x22, 0x3B, 0x0F,
+    0x22, 0xC9, 0xDA, 0xEE, 0xD2, 0xDC, 0x02, 0xC6, 0xF5, 0xCD, 0xFC, 0xF4,
+    0x01, 0xF1, 0x12, 0xFB, 0xDB, 0xF0, 0xDE, 0x07, 0xF6, 0x14, 0xFA, 0x02,
+    0x25, 0x09, 0xEA, 0x1F, 0x10, 0x2B, 0x03, 0x14, 0x18, 0x30, 0x29, 0x00,
+    0x10, 0x30, 0x40, 0x2F, 0x15, 0x2A, 0x11, 0x08, 0xE0, 0xF9, 0xF2, 0xE5,
+    0xF9, 0xD9, 0x08, 0xC8, 0xF0, 0xEC, 0xF5, 0x05, 0xCF, 0xF0, 0x09, 0xE9,
+    0x16, 0x1D, 0x19, 0x1D, 0x16, 0xE9, 0x15, 0x0D, 0x1B, 0xF4, 0x29, 0xF9,
+    0xFD, 0x1D, 0x25, 0x08, 0x10, 0x1D, 0x0C, 0x1E, 0x1B, 0x26, 0x0F, 0x3D,
+    0x36, 0xCC, 0xD3, 0xF0, 0xFD, 0xE7, 0xD2, 0xF7, 0xF5, 0xCE, 0xFF, 0x03,
+    0xF7, 0xF9, 0xDE, 0xD7, 0x09, 0x05, 0xF2, 0xEB, 0x11, 0x0B, 0x06, 0xE7,
+    0x10, 0x2A, 0x22, 0xF2, 0x00, 0x0B, 0x11, 0x1B, 0xFB, 0xF4, 0x33, 0x24,
+    0x39, 0x06, 0x00, 0x0A, 0x2C, 0x2D, 0x2A, 0x30, 0xED, 0xF7, 0xF3, 0x00,
+    0xF2, 0x03, 0xC6, 0xF4, 0xEB, 0xCF, 0xDD, 0xCF, 0xD9, 0xE5, 0x16, 0xF6,
+    0xEA, 0xFD, 0xE9, 0x07, 0x23, 0xE3, 0x06, 0xE7, 0x2B, 0x21, 0xF0, 0x00,
+    0xF4, 0x06, 0x02, 0x18, 0x01, 0x18, 0x2B, 0x2C, 0x28, 0x2B, 0x33, 0x3C,
+    0xED, 0xDF, 0xD4, 0xFC, 0xC9, 0xF5, 0xD6, 0xFB, 0xE0, 0xE4, 0xCA, 0xFA,
+    0xEF, 0xF3, 0xE7, 0x03, 0x18, 0x00, 0xE1, 0x12, 0xE5, 0x0C, 0x0B, 0x1F,
+    0x0D, 0xE5, 0x2C, 0xF6, 0x03, 0x04, 0x32, 0x1A, 0x0E, 0x1A, 0x0B, 0x16,
+    0x03, 0x31, 0x21, 0x45, 0x21, 0x3E, 0x3E, 0x1B, 0xF4, 0xCA, 0xE8, 0xDB,
+    0xF1, 0xCD, 0xE8, 0xC6, 0xD8, 0xE9, 0xDE, 0x12, 0xDE, 0x0C, 0xE3, 0xEC,
+    0x18, 0x00, 0xF7, 0xDE, 0x00, 0xFC, 0x09, 0xFB, 0x02, 0x11, 0x18, 0x00,
+    0x2B, 0x26, 0x01, 0x21, 0x39, 0x1C, 0x06, 0x00, 0x39, 0x35, 0xD1, 0xB4,
+    0xE9, 0xFC, 0xC1, 0xC5, 0xD3, 0xE9, 0xE7, 0x0A, 0xFE, 0xEA, 0x00, 0xCD,
+    0xF3, 0xF8, 0xD2, 0x15, 0xDD, 0xE8, 0x17, 0xF1, 0x24, 0xEF, 0x16, 0x11,
+    0x1D, 0x01, 0xFD, 0x30, 0x11, 0x09, 0x15, 0x0D, 0x0D, 0xFE, 0x0A, 0x20,
+    0x0F, 0x03, 0x0D, 0x34, 0x38, 0x30, 0xEF, 0xE9, 0xEE, 0xE0, 0xD4, 0xD1,
+    0xDA, 0xEC, 0x0C, 0xE1, 0x0D, 0xEE, 0xD6, 0xFC, 0xE2, 0x00, 0xFA, 0xF4,
+    0x06, 0x14, 0x0C, 0xF0, 0x00, 0x21, 0xF2, 0xF9, 0xF2, 0x0F, 0xFE, 0x2C,
+    0x16, 0x32, 0xFD, 0x2D, 0x39, 0x31, 0x47, 0xD9, 0xBA, 0xEE, 0xD8, 0xD1,
+    0xEF, 0xDD, 0xE9, 0xCC, 0xC4, 0xE5, 0xF8, 0xD1, 0xEE, 0xD1, 0xCE, 0x00,
+    0x15, 0xF8, 0x07, 0xDC, 0x02, 0xFB, 0x12, 0xFC, 0x1F, 0x1D, 0x2C, 0xF4,
+    0x26, 0x05, 0x24, 0x25, 0xF6, 0x28, 0x2E, 0x3E, 0x16, 0x26, 0x2B, 0x20,
+    0x48, 0x16, 0x24, 0x41, 0xC1, 0xE6, 0xC7, 0xD9, 0xFD, 0xCA, 0xF7, 0xE4,
+    0xD2, 0xFC, 0xE0, 0x0E, 0xEE, 0x0E, 0xD6, 0xFF, 0x05, 0x19, 0x0E, 0x1E,
+    0x11, 0x27, 0x00, 0x07, 0x22, 0xFF, 0x2F, 0xF3, 0x00, 0x04, 0x36, 0x00,
+    0x3D, 0x1C, 0x19, 0xD4, 0xC7, 0xCE, 0xCE, 0xE9, 0xF3, 0xD8, 0xFD, 0xCD,
+    0xC9, 0xDC, 0x06, 0xED, 0xD4, 0xE5, 0x0E, 0xDC, 0xE1, 0xD6, 0x00, 0x00,
+    0x14, 0x17, 0x12, 0xF2, 0x05, 0xE4, 0xE9, 0x00, 0x01, 0x2B, 0x0F, 0xF3,
+    0x30, 0x11, 0x20, 0x00, 0x0C, 0x09, 0x34, 0x1F, 0x09, 0x27, 0x17, 0x0E,
+    0x13, 0xE6, 0xC5, 0x00, 0xF9, 0xE2, 0xEC, 0xF1, 0xE5, 0xF9, 0xE8, 0x08,
+    0xFD, 0xED, 0xD9, 0xF3, 0x17, 0x16, 0x11, 0xFF, 0x0D, 0xED, 0x0B, 0xF2,
+    0x26, 0x03, 0x00, 0x24, 0x2D, 0x20, 0x3B, 0x0E, 0x11, 0x36, 0x11, 0xCA,
+    0xDC, 0xDD, 0xC0, 0xDF, 0xBB, 0xD8, 0xD6, 0xCE, 0xE3, 0xED, 0xF8, 0xFE,
+    0x02, 0xCE, 0xF8, 0xE9, 0xF0, 0xF7, 0xF0, 0x08, 0x0C, 0x12, 0xF2, 0xF4,
+    0x29, 0x00, 0x2A, 0x24, 0x1C, 0x14, 0x0D, 0x1F, 0x02, 0xFA, 0x2C, 0x10,
+    0x30, 0x18, 0x42, 0x2D, 0x06, 0x2C, 0x0D, 0x1E, 0xEA, 0xD0, 0xCA, 0xFC,
+    0xCB, 0xEB, 0xCC, 0xCE, 0xE8, 0xFE, 0xFF, 0x0A, 0x18, 0xE9, 0xEE, 0xE1,
+    0xDF, 0x1A, 0x00, 0x0C, 0xF6, 0x11, 0xFE, 0xFE, 0xF5, 0x09, 0x00, 0xF7,
+    0x15, 0x20, 0x10, 0x32, 0x26, 0xEB, 0xC6, 0xD3, 0xB8, 0xF7, 0xC9, 0xC5,
+    0xDB, 0xDA, 0x05, 0xFB, 0x01, 0xD6, 0xCB, 0x05, 0xFE, 0xF1, 0xD2, 0xDC,
+    0xF8, 0xF9, 0xF1, 0xF6, 0x18, 0x12, 0xF8, 0xF7, 0x12, 0x0E, 0x13, 0x2F,
+    0x13, 0xF4, 0xF5, 0x18, 0xFC, 0x01, 0x2A, 0x01, 0x02, 0x10, 0x0F, 0x39,
+    0x35, 0x35, 0x4F, 0xD5, 0xD6, 0x04, 0xFF, 0xC6, 0xDE, 0xD2, 0x0D, 0xF6,
+    0xF3, 0x16, 0xFC, 0xFA, 0x13, 0x1F, 0x05, 0x11, 0x03, 0xE8, 0xF1, 0x2D,
+    0x17, 0x20, 0x32, 0x09, 0x04, 0x23, 0x08, 0xFB, 0x1B, 0x0F, 0xEA, 0xBC,
+    0xF0, 0xB8, 0xEC, 0xDD, 0xED, 0xF5, 0xBF, 0x05, 0x01, 0x09, 0xD9, 0xE3,
+    0xEF, 0xF8, 0x0D, 0x0E, 0xEB, 0xD8, 0xF9, 0xF8, 0xF1, 0x14, 0xF4, 0xF3,
+    0x12, 0xF1, 0x1A, 0xF0, 0x26, 0x14, 0xF2, 0x10, 0x1B, 0x3A, 0x33, 0x3E,
+    0x29, 0x3D, 0x31, 0x30, 0x2B, 0x42, 0x21, 0x4A, 0xD8, 0x00, 0xF3, 0x03,
+    0x02, 0xD8, 0x10, 0x0B, 0x02, 0xFF, 0x0E, 0x04, 0x0F, 0xFA, 0xEB, 0x0E,
+    0xE4, 0x03, 0xFA, 0xF5, 0x24, 0x16, 0xFD, 0x17, 0xF9, 0xF5, 0x27, 0x03,
+    0x3A, 0xD5, 0xBF, 0xED, 0xD4, 0xE2, 0xC0, 0xDD, 0xDF, 0xBF, 0xC7, 0xE1,
+    0xFE, 0xDC, 0x0C, 0x07, 0x01, 0xEE, 0x0C, 0x14, 0xD6, 0x18, 0xE6, 0x0E,
+    0x08, 0x06, 0xEC, 0xF0, 0x16, 0x02, 0x0A, 0x15, 0x30, 0xFB, 0x27, 0xFB,
+    0xFB, 0x1F, 0x3D, 0x13, 0x03, 0x0F, 0x45, 0x1D, 0x40, 0x24, 0x48, 0x10,
+    0xD1, 0xDA, 0xE5, 0xF2, 0xE7, 0x00, 0xFC, 0xDE, 0x08, 0xD8, 0x0A, 0xEA,
+    0x03, 0xEE, 0x02, 0x00, 0x11, 0x03, 0x19, 0x27, 0xF2, 0x1D, 0x0D, 0xF7,
+    0x14, 0x09, 0xFD, 0x07, 0xC8, 0xD6, 0xB7, 0xDB, 0xE6, 0xB5, 0xBD, 0xBD,
+    0xEF, 0xDC, 0xFD, 0xD9, 0xDF, 0xEE, 0xF0, 0x10, 0x04, 0xFB, 0xF4, 0xF0,
+    0x05, 0xF5, 0xE7, 0x1D, 0x19, 0x0B, 0xF7, 0x29, 0x0F, 0xF7, 0x17, 0x32,
+    0x2D, 0x2B, 0x20, 0xFB, 0xFB, 0x2D, 0x41, 0x39, 0x20, 0x11, 0x34, 0x0E,
+    0x20, 0x27, 0x40, 0xC3, 0xFE, 0xD7, 0xE1, 0xC9, 0xD9, 0xF3, 0xEE, 0xD6,
+    0x14, 0x0F, 0xF4, 0x05, 0x06, 0x0C, 0x13, 0xEB, 0xF0, 0x07, 0xEC, 0x22,
+    0x22, 0x12, 0x00, 0x01, 0x33, 0x0B, 0xE5, 0xD5, 0xB7, 0xBB, 0xDA, 0xC2,
+    0xB7, 0xE4, 0xCE, 0xFD, 0xE0, 0xFD, 0xFC, 0xE0, 0xE1, 0xDA, 0x06, 0xE8,
+    0xFF, 0xDB, 0xDE, 0xDD, 0x03, 0x1C, 0xF0, 0x1E, 0x1C, 0xF3, 0x18, 0x1F,
+    0x0F, 0x01, 0x0C, 0xFC, 0x03, 0x2F, 0x28, 0xFE, 0x13, 0x43, 0x47, 0x39,
+    0x27, 0x4E, 0x51, 0x4A, 0x39, 0xDA, 0xDA, 0x03, 0xE0, 0xE4, 0x12, 0xCF,
+    0xEF, 0x17, 0xE8, 0xE1, 0xFA, 0x00, 0xF6, 0xEE, 0x1A, 0xF9, 0x20, 0x11,
+    0xF7, 0x00, 0x26, 0xF9, 0x02, 0x31, 0xB8, 0xB0, 0xAF, 0xC9, 0xE9, 0xC6,
+    0xE6, 0xDB, 0xF1, 0xC1, 0xEA, 0xC3, 0xFD, 0xE9, 0xE3, 0xDC, 0x08, 0x0A,
+    0xEF, 0x11, 0xF4, 0x03, 0xE9, 0xF9, 0x23, 0xFE, 0xE7, 0x17, 0xE9, 0x07,
+    0x04, 0x2A, 0x2D, 0x27, 0xF9, 0x2D, 0x06, 0x04, 0x03, 0x29, 0x30, 0x49,
+    0x14, 0x0B, 0x19, 0x1D, 0x51, 0x3E, 0xE8, 0x08, 0x0B, 0x05, 0xD5, 0xD4,
+    0xFE, 0xEE, 0xF3, 0x04, 0x1D, 0x12, 0x10, 0x10, 0x0D, 0x0B, 0x26, 0x0F,
+    0xFD, 0xF2, 0xFC, 0x03, 0x00, 0x0A, 0xDE, 0xE4, 0xED, 0xB2, 0xD3, 0xF7,
+    0xBA, 0xE0, 0xF1, 0xF9, 0xE3, 0xD7, 0x06, 0xCB, 0xFE, 0x0A, 0x10, 0x08,
+    0xEE, 0x11, 0xE0, 0x02, 0xE9, 0x19, 0xE3, 0x15, 0xFA, 0xF7, 0xEE, 0x21,
+    0xF0, 0xFF, 0x23, 0x25, 0xFB, 0x32, 0x0E, 0x04, 0x14, 0x1C, 0x0D, 0x3A,
+    0x2A, 0x2A, 0x3F, 0x27, 0x2E, 0x2F, 0xE3, 0xFD, 0x03, 0x04, 0xE0, 0xD7,
+    0x02, 0xFA, 0xED, 0xE4, 0x0C, 0x1B, 0xED, 0xF9, 0xE7, 0x27, 0xF4, 0x16,
+    0x2E, 0xFD, 0x02, 0x00, 0xE3, 0xBE, 0xB3, 0xCF, 0xE5, 0xB2, 0xD0, 0xBF,
+    0xF5, 0xE1, 0xC0, 0xC5, 0xFE, 0xF5, 0xF9, 0xEB, 0xF6, 0xD1, 0xD5, 0xF6,
+    0x0F, 0xDD, 0x09, 0xFF, 0x08, 0x0F, 0x0F, 0x21, 0xEB, 0x01, 0x0A, 0x2C,
+    0x00, 0x1D, 0x29, 0xFB, 0xFB, 0x0E, 0x11, 0x37, 0x15, 0x48, 0x31, 0x40,
+    0x0C, 0x14, 0x19, 0x4A, 0x50, 0xE0, 0xD1, 0xD3, 0x10, 0x03, 0xFD, 0xEC,
+    0x16, 0xE5, 0x18, 0xE5, 0x22, 0xEE, 0x1A, 0x18, 0x27, 0x0E, 0x09, 0x0A,
+    0x29, 0x2E, 0xDD, 0xB3, 0xD6, 0xE7, 0xD9, 0xD1, 0xD7, 0xC6, 0xFA, 0xCB,
+    0xD3, 0xE0, 0xC6, 0xEE, 0xD0, 0x02, 0xD1, 0xD1, 0xEA, 0xEC, 0xF4, 0x13,
+    0x0E, 0x09, 0xF4, 0xF2, 0x15, 0xE6, 0xF8, 0xEC, 0x25, 0x30, 0x25, 0x1F,
+    0x10, 0x35, 0x16, 0x07, 0x31, 0x2A, 0x3B, 0x0B, 0x3A, 0x1D, 0x3F, 0x38,
+    0x54, 0x22, 0xDE, 0x03, 0xF0, 0xE5, 0xD2, 0x03, 0xE5, 0xDF, 0x16, 0xFC,
+    0xE1, 0xF1, 0xED, 0x00, 0x04, 0x14, 0x14, 0x0C, 0x2C, 0x04, 0x25, 0xBB,
+    0xEA, 0xD0, 0xBB, 0xC3, 0xF4, 0xE1, 0xF8, 0xEF, 0xCD, 0xC9, 0xCA, 0xEB,
+    0xE5, 0xE6, 0xD5, 0xEE, 0xD2, 0xF2, 0xFA, 0xEB, 0xF2, 0xFA, 0x02, 0x03,
+    0xE2, 0x18, 0x1D, 0xF8, 0x06, 0x0F, 0x05, 0xF4, 0xF9, 0x1A, 0x19, 0x18,
+    0x04, 0x1F, 0x0F, 0x42, 0x2B, 0x45, 0x2B, 0x1B, 0x20, 0x21, 0x59, 0x43,
+    0xD0, 0xF8, 0xE6, 0xDD, 0x17, 0xD5, 0x10, 0x07, 0x04, 0xF8, 0xF7, 0xE5,
+    0x17, 0x05, 0x17, 0x2D, 0x32, 0x09, 0x34, 0xAC, 0xD1, 0xE0, 0xC3, 0xC0,
+    0xE3, 0xF0, 0xCD, 0xBA, 0x00, 0xEE, 0xE1, 0xF4, 0xF4, 0xF2, 0xEF, 0xD9,
+    0x10, 0xE2, 0xD7, 0xEF, 0xE7, 0x18, 0xF1, 0xFC, 0x1F, 0x00, 0xE9, 0x23,
+    0x2D, 0x19, 0x00, 0xFE, 0x28, 0xF9, 0x0F, 0x29, 0x2A, 0x41, 0x0C, 0x1F,
+    0x49, 0x19, 0x23, 0x37, 0x1C, 0x41, 0x5B, 0x20, 0xE8, 0x01, 0x12, 0xE8,
+    0xEB, 0x17, 0xDF, 0x1D, 0xED, 0x03, 0x10, 0xEF, 0xF3, 0xEC, 0xF0, 0x01,
+    0x2E, 0x09, 0xA3, 0xAD, 0xC7, 0xE1, 0xB2, 0xB7, 0xB2, 0xC4, 0xBE, 0xCC,
+    0xCA, 0xE4, 0xD2, 0xC6, 0xFD, 0x09, 0xE0, 0xE8, 0xF7, 0x04, 0xD4, 0xE1,
+    0x10, 0x14, 0x0A, 0xEB, 0x24, 0x16, 0x11, 0xF3, 0x1E, 0x1C, 0x15, 0x15,
+    0x0B, 0x30, 0x23, 0x30, 0x35, 0x10, 0x35, 0x45, 0x28, 0x0C, 0x21, 0x47,
+    0x56, 0x2F, 0x1F, 0xD4, 0xE3, 0x06, 0xEE, 0x11, 0x0C, 0xFC, 0x01, 0xDE,
+    0xDF, 0xF9, 0xF3, 0x12, 0xFF, 0xF1, 0xFF, 0x22, 0x1D, 0xDE, 0xCF, 0xBE,
+    0xCC, 0xBB, 0xBA, 0xBF, 0xE4, 0xE8, 0xFA, 0xFA, 0xE4, 0xEE, 0xF7, 0xD4,
+    0xF6, 0x07, 0x07, 0xD8, 0x0E, 0xF6, 0xFD, 0xF7, 0xED, 0xEB, 0xE1, 0x10,
+    0xFC, 0x18, 0x00, 0xF6, 0x15, 0x2F, 0xFB, 0x03, 0x07, 0x05, 0x37, 0x33,
+    0x30, 0x30, 0x23, 0x4C, 0x39, 0x10, 0x22, 0x43, 0x30, 0x3A, 0xD8, 0xEB,
+    0xF0, 0xF4, 0x10, 0xD7, 0x1D, 0xFC, 0xE2, 0xFA, 0xE4, 0x19, 0x17, 0x1A,
+    0x01, 0x17, 0xFC, 0xB4, 0xC7, 0xC0, 0xB5, 0xC1, 0xB4, 0xC7, 0xE0, 0xF2,
+    0xD6, 0xF0, 0xBD, 0xF9, 0xC6, 0xF3, 0xFD, 0xD0, 0xE7, 0x02, 0x05, 0x17,
+    0xEF, 0x1C, 0xF0, 0xF4, 0xEC, 0x25, 0x09, 0xFE, 0x05, 0x00, 0x13, 0x0A,
+    0x2E, 0xFC, 0x2F, 0x10, 0x22, 0x08, 0x0E, 0x18, 0x07, 0x2F, 0x27, 0x1F,
+    0x1A, 0x34, 0x47, 0x50, 0x1C, 0xD5, 0x0C, 0xF8, 0x0A, 0x00, 0xE2, 0xDE,
+    0xF7, 0xF9, 0xF4, 0x02, 0x07, 0x1F, 0xF6, 0x01, 0xAC, 0xDC, 0xC9, 0xDD,
+    0xB4, 0xE6, 0xB5, 0xD9, 0xB9, 0xE7, 0xC1, 0xCC, 0xC7, 0xF1, 0xD3, 0xE5,
+    0xD1, 0xF3, 0x03, 0x06, 0x11, 0xE0, 0xFA, 0xE2, 0xFB, 0x07, 0x07, 0xF9,
+    0xF2, 0x13, 0xF3, 0xF8, 0x04, 0x0D, 0x29, 0x25, 0x12, 0x40, 0x24, 0x2E,
+    0x47, 0x25, 0x2F, 0x37, 0x3E, 0x34, 0x2D, 0x21, 0x4E, 0x5E, 0x35, 0xD2,
+    0xE1, 0x0E, 0x0C, 0xDA, 0x1E, 0x0E, 0x09, 0x0C, 0xF7, 0xF8, 0xF9, 0x02,
+    0x2F, 0xAD, 0xD1, 0xBC, 0xC5, 0xB5, 0xBB, 0xB8, 0xE0, 0xE7, 0xF7, 0xC4,
+    0xDD, 0xDA, 0xD0, 0xF2, 0xEA, 0xE2, 0xE5, 0xD0, 0xF5, 0x06, 0xFF, 0xFF,
+    0x1C, 0xFD, 0x17, 0x22, 0x00, 0xED, 0x06, 0x0F, 0x00, 0x0F, 0x0F, 0x11,
+    0x2F, 0x27, 0x29, 0x35, 0x0E, 0x22, 0x30, 0x23, 0x49, 0x13, 0x11, 0x3D,
+    0x3E, 0x23, 0x2F, 0x32, 0xFE, 0xE6, 0xE9, 0xE6, 0xF6, 0x03, 0x1B, 0x04,
+    0x13, 0xFD, 0xF6, 0xF4, 0xF1, 0xB3, 0xA3, 0xAF, 0xE7, 0xCB, 0xB9, 0xB5,
+    0xD1, 0xD1, 0xBB, 0xF3, 0xC9, 0xC8, 0x01, 0xE4, 0xD3, 0xF2, 0xDC, 0xEC,
+    0xEB, 0xE1, 0xD7, 0xDA, 0x08, 0x01, 0x0D, 0xE8, 0x0A, 0xE5, 0x20, 0x26,
+    0x29, 0xF7, 0xF1, 0x06, 0x2B, 0x2B, 0x2B, 0x1B, 0x44, 0x25, 0x0A, 0x19,
+    0x0C, 0x3C, 0x14, 0x2B, 0x58, 0x5A, 0x24, 0x52, 0x34, 0xE8, 0x04, 0x14,
+    0xEE, 0xFA, 0xE9, 0x0A, 0xED, 0xF7, 0xE8, 0x27, 0x04, 0xDB, 0xCA, 0xD2,
+    0xE8, 0xB7, 0xAC, 0xAE, 0xDF, 0xC9, 0xEF, 0xBF, 0xEE, 0xFA, 0xE2, 0xE4,
+    0xFA, 0xCE, 0xDD, 0xDF, 0xD2, 0xD4, 0xFD, 0x05, 0xE2, 0xF7, 0x1B, 0xED,
+    0xEE, 0x12, 0x12, 0xFE, 0xFE, 0x2C, 0xF8, 0x05, 0x28, 0x13, 0x19, 0x16,
+    0x19, 0x14, 0x09, 0x14, 0x23, 0x1A, 0x11, 0x18, 0x4F, 0x40, 0x4E, 0x47,
+    0x3E, 0x5C, 0xF3, 0xF3, 0xD9, 0x0F, 0x0C, 0x21, 0xEC, 0xFB, 0xF0, 0xEF,
+    0x0E, 0xDA, 0xAD, 0xC8, 0xDD, 0xC9, 0xA8, 0xDE, 0xEA, 0xD5, 0xD0, 0xD5,
+    0xD0, 0xF8, 0xF9, 0xE2, 0xC8, 0xF3, 0xDA, 0x08, 0x06, 0xE6, 0xDA, 0xF4,
+    0xE7, 0x0B, 0x04, 0x0C, 0x00, 0x0A, 0xF9, 0xEB, 0xF1, 0x27, 0x02, 0x2A,
+    0xF9, 0x19, 0x36, 0x23, 0x01, 0x29, 0x40, 0x48, 0x12, 0x33, 0x2A, 0x4B,
+    0x22, 0x36, 0x5C, 0x29, 0x43, 0x34, 0xE3, 0xE4, 0xFD, 0x14, 0x0E, 0xF0,
+    0x1E, 0xED, 0x13, 0x17, 0xED, 0xA8, 0xB4, 0xC8, 0xDD, 0xDC, 0xD1, 0xC9,
+    0xED, 0xE4, 0xE5, 0xBE, 0xCC, 0xC1, 0xCF, 0xCD, 0xEA, 0x06, 0xE5, 0x05,
+    0xD7, 0xE8, 0xDB, 0xEE, 0xD9, 0x00, 0xE1, 0x05, 0x02, 0x00, 0xF3, 0xFC,
+    0x2C, 0x20, 0x0C, 0x33, 0xFB, 0x3A, 0x0C, 0x21, 0x19, 0x43, 0x0A, 0x20,
+    0x21, 0x2C, 0x50, 0x2E, 0x22, 0x59, 0x44, 0x3D, 0x4C, 0x2E, 0xD5, 0xE7,
+    0x19, 0x08, 0x16, 0xE3, 0xF3, 0x20, 0x17, 0x1F, 0xB9, 0xC7, 0xC4, 0xD4,
+    0xBB, 0xD2, 0xEA, 0xCC, 0xCD, 0xB4, 0xF0, 0xC7, 0xDF, 0xD9, 0xD1, 0xD7,
+    0xC4, 0xC8, 0xF4, 0xCF, 0x0B, 0xF6, 0xD9, 0x04, 0xF6, 0xF4, 0xFB, 0x15,
+    0x06, 0x07, 0xED, 0x18, 0x22, 0x14, 0x15, 0xF8, 0x16, 0x1B, 0x27, 0x36,
+    0x31, 0x20, 0x21, 0x24, 0x35, 0x48, 0x4C, 0x27, 0x49, 0x46, 0x1D, 0x61,
+    0x25, 0x2C, 0xF5, 0xF6, 0xF3, 0x00, 0xF2, 0xE2, 0xF6, 0x0F, 0x19, 0xBF,
+    0xC2, 0xC6, 0xCF, 0xB4, 0xBE, 0xB8, 0xEA, 0xD9, 0xC5, 0xD5, 0xC1, 0xDA,
+    0xBA, 0xDF, 0xE2, 0xCE, 0xEE, 0xDF, 0x0B, 0xFF, 0xD5, 0xF3, 0x10, 0xE2,
+    0xDD, 0xEF, 0xF7, 0x16, 0xFD, 0x00, 0xF6, 0x16, 0xFC, 0x2C, 0x05, 0x00,
+    0x1F, 0x36, 0x0D, 0xFF, 0x0C, 0x19, 0x20, 0x1D, 0x3D, 0x47, 0x33, 0x2A,
+    0x40, 0x43, 0x5B, 0x4C, 0x52, 0x53, 0xFA, 0xD9, 0x12, 0x1B, 0x00, 0x1A,
+    0x22, 0x15, 0xC5, 0xA0, 0xD5, 0xD1, 0xE0, 0xDC, 0xB4, 0xC0, 0xCA, 0xEF,
+    0xCA, 0xCA, 0xF6, 0xC4, 0xDE, 0xFD, 0xDC, 0xD5, 0xD2, 0xD5, 0x0A, 0xE1,
+    0xE4, 0xEB, 0x04, 0x0A, 0x0B, 0x19, 0xF7, 0x09, 0x14, 0x16, 0x1E, 0x05,
+    0xF0, 0xF7, 0x1A, 0x18, 0x2B, 0x2C, 0x0D, 0x0F, 0x39, 0x3C, 0x15, 0x4C,
+    0x19, 0x21, 0x51, 0x4A, 0x25, 0x4A, 0x4C, 0x5D, 0x4A, 0x57, 0xE5, 0x0E,
+    0x01, 0xFB, 0xEE, 0xF5, 0x06, 0xC6, 0xD2, 0xA7, 0xB8, 0xD4, 0xC8, 0xE5,
+    0xB4, 0xE2, 0xD9, 0xC2, 0xE5, 0xBE, 0xF2, 0xEE, 0xBE, 0xEF, 0xE5, 0xF2,
+    0xD0, 0xE2, 0x10, 0xF5, 0xF6, 0x16, 0xFC, 0xDE, 0xEC, 0xF0, 0xE4, 0x09,
+    0x16, 0x0D, 0x19, 0x29, 0x00, 0x20, 0x19, 0x2E, 0x35, 0x36, 0x37, 0x2E,
+    0x15, 0x25, 0x11, 0x49, 0x19, 0x42, 0x39, 0x23, 0x1A, 0x47, 0x37, 0x46,
+    0x33, 0x3F, 0xF8, 0xFD, 0xFA, 0x1D, 0x12, 0xFD, 0x00, 0xBD, 0xA4, 0xA6,
+    0xBE, 0xA7, 0xB1, 0xB2, 0xBE, 0xB7, 0xB8, 0xE4, 0xE6, 0xD8, 0xDD, 0xE6,
+    0xC4, 0xE8, 0x06, 0xE1, 0xDB, 0xF9, 0x01, 0x11, 0xDE, 0x0B, 0x00, 0xEB,
+    0x1D, 0x11, 0xEA, 0x19, 0xF1, 0xFE, 0xF6, 0x2F, 0x2B, 0x0B, 0xFC, 0x13,
+    0x3D, 0x33, 0x33, 0x46, 0x1B, 0x44, 0x21, 0x31, 0x47, 0x38, 0x39, 0x2D,
+    0x57, 0x5F, 0x4B, 0x2C, 0x35, 0x4D, 0xE1, 0x0F, 0xFD, 0xF6, 0xF6, 0xEC,
+    0xB2, 0xDA, 0xC8, 0xC0, 0xAD, 0xB0, 0xD3, 0xE5, 0xB1, 0xCD, 0xBF, 0xCD,
+    0xC1, 0xC3, 0xFD, 0xE5, 0xED, 0xF3, 0x03, 0xCC, 0xF0, 0xF6, 0x12, 0x0F,
+    0xE4, 0x10, 0x0C, 0x0D, 0xF2, 0x0C, 0xE4, 0xF4, 0x22, 0x01, 0xFE, 0x19,
+    0x23, 0x21, 0x20, 0x25, 0x17, 0x3E, 0x23, 0x14, 0x43, 0x37, 0x45, 0x22,
+    0x2E, 0x1F, 0x59, 0x51, 0x5E, 0x36, 0x4D, 0x24, 0x64, 0x63, 0x1A, 0xDC,
+    0x1F, 0xFF, 0x11, 0xCF, 0x98, 0xB6, 0xC8, 0xBB, 0xB3, 0xDE, 0xDE, 0xB5,
+    0xB8, 0xE2, 0xBF, 0xBC, 0xF3, 0xE2, 0xD8, 0xC2, 0xDE, 0xCB, 0xCA, 0x07,
+    0xF9, 0xE1, 0xFC, 0xF4, 0x0D, 0x0A, 0xFB, 0x07, 0xE7, 0x03, 0xF1, 0x05,
+    0xFC, 0x1D, 0x16, 0x09, 0x07, 0x2D, 0x0C, 0x31, 0x16, 0x2F, 0x36, 0x12,
+    0x13, 0x32, 0x1B, 0x51, 0x4A, 0x15, 0x57, 0x2E, 0x45, 0x1C, 0x5B, 0x43,
+    0x67, 0x64, 0xFC, 0xDF, 0x17, 0xE5, 0xAC, 0xD2, 0xCA, 0xD6, 0xB8, 0xBC,
+    0xC9, 0xBD, 0xBF, 0xD5, 0xBD, 0xCC, 0xD6, 0xD8, 0xD4, 0xDB, 0xE1, 0xF8,
+    0xE5, 0xD5, 0xF3, 0xF4, 0x0A, 0xF4, 0x12, 0xF0, 0xD5, 0xF2, 0xEF, 0xEE,
+    0xF0, 0xF4, 0xEA, 0x23, 0x00, 0xFF, 0x2A, 0x1B, 0x27, 0xF5, 0x1C, 0x0D,
+    0xFD, 0x0E, 0x3F, 0x3D, 0x1B, 0x3F, 0x10, 0x28, 0x17, 0x3A, 0x19, 0x44,
+    0x58, 0x49, 0x36, 0x3B, 0x54, 0x56, 0x43, 0x0F, 0x0A, 0x23, 0xB3, 0xCD,
+    0xC4, 0xC4, 0xC0, 0xC4, 0xE0, 0xE8, 0xC9, 0xAC, 0xEF, 0xB5, 0xB5, 0xD9,
+    0xEF, 0xCF, 0xD5, 0xED, 0x02, 0xCF, 0xF7, 0xD4, 0xF9, 0xD9, 0x10, 0xF3,
+    0x0D, 0x19, 0x1A, 0xED, 0xF7, 0x0B, 0xEF, 0xE7, 0xEA, 0xEC, 0x2B, 0x31,
+    0xF2, 0x2F, 0x35, 0xF9, 0x1D, 0x03, 0x20, 0x29, 0x3D, 0x2A, 0x4D, 0x21,
+    0x29, 0x44, 0x2D, 0x4E, 0x4A, 0x2F, 0x33, 0x2A, 0x27, 0x4A, 0x38, 0x64,
+    0xF5, 0x0E, 0xBA, 0xB7, 0xC4, 0xB9, 0xA6, 0xB5, 0xCE, 0xBD, 0xA8, 0xE7,
+    0xBA, 0xC2, 0xBA, 0xB5, 0xCE, 0xBD, 0xE5, 0xF1, 0xE3, 0x03, 0xCC, 0xFD,
+    0xE8, 0xF8, 0xD6, 0xDF, 0x01, 0x16, 0xD9, 0xEF, 0x1F, 0x09, 0x23, 0xFF,
+    0xE6, 0xF6, 0x1E, 0x23, 0xF8, 0x00, 0x2B, 0x32, 0x2A, 0x2D, 0x13, 0x11,
+    0x2A, 0x47, 0x34, 0x37, 0x30, 0x10, 0x1A, 0x58, 0x44, 0x1E, 0x59, 0x3E,
+    0x3E, 0x64, 0x33, 0x4E, 0x48, 0xE5, 0xBD, 0xCB, 0x9B, 0x99, 0xB1, 0xDE,
+    0xB7, 0xD7, 0xBD, 0xB1, 0xD4, 0xE0, 0xEB, 0xB0, 0xD2, 0xE5, 0xC0, 0xF3,
+    0xE8, 0xCE, 0xC2, 0xCF, 0xEF, 0x07, 0xE2, 0xF3, 0xDF, 0xFF, 0xDE, 0xE1,
+    0xE9, 0x1F, 0xE1, 0x03, 0xE6, 0x28, 0x29, 0x24, 0x03, 0xFB, 0xF7, 0x14,
+    0x27, 0x2B, 0xFF, 0x28, 0x1C, 0x07, 0x3F, 0x1B, 0x35, 0x3E, 0x30, 0x4E,
+    0x1B, 0x47, 0x51, 0x49, 0x5D, 0x28, 0x52, 0x43, 0x35, 0x4A, 0xE3, 0xD2,
+    0xA5, 0xBE, 0x9E, 0x9D, 0xB0, 0xA6, 0xCB, 0xAC, 0xCF, 0xB4, 0xB1, 0xC1,
+    0xCF, 0xCE, 0xC4, 0xDF, 0xBD, 0xF7, 0xDA, 0x03, 0xF1, 0xF8, 0xD9, 0xE4,
+    0xEC, 0x0B, 0xD6, 0xEC, 0x00, 0x03, 0x10, 0x10, 0x1A, 0xF5, 0xF9, 0x12,
+    0x15, 0x10, 0xF7, 0x22, 0x03, 0x13, 0x08, 0x40, 0x16, 0x25, 0x07, 0x20,
+    0x3C, 0x49, 0x0D, 0x1D, 0x20, 0x2A, 0x2B, 0x23, 0x56, 0x53, 0x2B, 0x37,
+    0x69, 0x42, 0x49, 0x4A, 0x96, 0x92, 0xA7, 0xA2, 0xB0, 0xAE, 0xCE, 0xE5,
+    0xE5, 0xB0, 0xCD, 0xEC, 0xBB, 0xD0, 0xCA, 0xEA, 0xE4, 0xCB, 0xC6, 0xE8,
+    0xEA, 0xFF, 0xF0, 0xEF, 0xE4, 0xE5, 0xE1, 0x0B, 0xDA, 0x0E, 0xF4, 0xE9,
+    0x21, 0xEE, 0xF9, 0x06, 0x09, 0xFB, 0x00, 0x1E, 0x29, 0x0B, 0x2A, 0x03,
+    0x32, 0x19, 0x30, 0x16, 0x3C, 0x2A, 0x46, 0x17, 0x3F, 0x36, 0x22, 0x22,
+    0x25, 0x28, 0x52, 0x4A, 0x62, 0x57, 0x49, 0x3B, 0x49, 0x00, 0xAD, 0xA7,
+    0xD3, 0xD4, 0xB8, 0xCB, 0xDB, 0xC2, 0xCE, 0xBF, 0xE0, 0xEB, 0xDB, 0xD9,
+    0xEA, 0xBA, 0xD3, 0xC0, 0xC1, 0xC0, 0xEE, 0xF5, 0xE3, 0xCA, 0xE1, 0xDF,
+    0x09, 0x11, 0xF6, 0x0A, 0x1A, 0x04, 0xDF, 0xE3, 0x10, 0x12, 0xEF, 0x2B,
+    0x26, 0x2D, 0x11, 0xF9, 0x13, 0x31, 0xFB, 0x35, 0x0F, 0x1F, 0x27, 0x2E,
+    0x41, 0x20, 0x4B, 0x29, 0x42, 0x27, 0x3A, 0x3C, 0x5C, 0x3A, 0x21, 0x61,
+    0x57, 0x57, 0x5A, 0xF4, 0xFA, 0xCF, 0xA5, 0xD1, 0xD5, 0xBA, 0xDB, 0xC2,
+    0xD7, 0xC6, 0xE8, 0xB2, 0xCF, 0xD0, 0xDE, 0xE2, 0xDF, 0xF4, 0xC1, 0xEB,
+    0xDA, 0xCE, 0x05, 0xDB, 0xDE, 0x0A, 0x08, 0x08, 0xFB, 0xEA, 0x15, 0xDE,
+    0x17, 0xE7, 0x1F, 0x13, 0x21, 0xED, 0x0F, 0x17, 0x0F, 0x1B, 0x25, 0x27,
+    0x12, 0x3A, 0x03, 0x16, 0x44, 0x1E, 0x36, 0x13, 0x1B, 0x19, 0x30, 0x53,
+    0x3E, 0x58, 0x49, 0x53, 0x2F, 0x4E, 0x2F, 0x53, 0x29, 0xEF, 0xEA, 0xFD,
+    0xCB, 0xC1, 0x99, 0xD8, 0xCF, 0xB1, 0xC2, 0xC6, 0xC3, 0xE7, 0xAC, 0xB3,
+    0xF3, 0xE7, 0xC8, 0xE6, 0xC0, 0xCD, 0xCD, 0xF8, 0xED, 0xEA, 0xCA, 0xD4,
+    0xEC, 0xF1, 0x14, 0xF0, 0xD7, 0xF8, 0xE8, 0x1E, 0xF8, 0xEE, 0xFE, 0x09,
+    0x05, 0x05, 0x22, 0x0B, 0x2E, 0x33, 0x20, 0x3B, 0x25, 0x00, 0x3E, 0x42,
+    0x1D, 0x09, 0x20, 0x33, 0x34, 0x4A, 0x17, 0x50, 0x19, 0x3E, 0x43, 0x21,
+    0x49, 0x48, 0x59, 0x5B, 0x1A, 0xF5, 0xEA, 0xBE, 0xA2, 0xB6, 0xD7, 0xA8,
+    0xCB, 0xE2, 0xE5, 0xC2, 0xC1, 0xD2, 0xE0, 0xB7, 0xF6, 0xC3, 0xEC, 0xBC,
+    0xD0, 0xD0, 0xF6, 0xD1, 0xFC, 0x06, 0xCC, 0xD3, 0xD6, 0xE8, 0xF9, 0xE1,
+    0xE1, 0x17, 0x11, 0x0F, 0xF1, 0x13, 0x06, 0xF9, 0x09, 0x01, 0x02, 0x2A,
+    0x1F, 0x14, 0x28, 0x1E, 0x08, 0x14, 0x27, 0x12, 0x2C, 0x30, 0x0C, 0x35,
+    0x41, 0x17, 0x29, 0x29, 0x54, 0x39, 0x2E, 0x5A, 0x36, 0x5F, 0x57, 0xF4,
+    0xED, 0xF7, 0x12, 0xCA, 0xB9, 0xAA, 0xC6, 0xD5, 0xC4, 0xC0, 0xDB, 0xE7,
+    0xCD, 0xCF, 0xD1, 0xEC, 0xDE, 0xD0, 0xFA, 0xDC, 0xD3, 0xC6, 0xE0, 0xD9,
+    0xF0, 0xF0, 0xD0, 0x04, 0xD9, 0x10, 0xD9, 0xEE, 0xF7, 0xED, 0xF9, 0xEF,
+    0x11, 0x20, 0x28, 0x04, 0x1F, 0x08, 0x0D, 0x12, 0x12, 0xFD, 0x05, 0x35,
+    0x26, 0x36, 0x37, 0x07, 0x18, 0x34, 0x44, 0x21, 0x50, 0x2C, 0x48, 0x29,
+    0x56, 0x44, 0x55, 0x63, 0x58, 0x66, 0x60, 0x14, 0xED, 0x09, 0xF4, 0xEC,
+    0xBD, 0xB3, 0xC3, 0xAA, 0xD0, 0xB1, 0xA6, 0xB6, 0xB4, 0xAD, 0xBF, 0xC7,
+    0xD0, 0xF5, 0xE1, 0xD3, 0xE1, 0xC7, 0xEE, 0xD2, 0xE8, 0xE2, 0xE5, 0xF1,
+    0x0F, 0x02, 0xE5, 0xF3, 0xF9, 0xFF, 0x07, 0xF0, 0x22, 0xE6, 0x0A, 0x28,
+    0x1C, 0xF1, 0x04, 0xF9, 0x13, 0xFD, 0x16, 0x0B, 0x39, 0x07, 0x43, 0x2F,
+    0x09, 0x0A, 0x11, 0x20, 0x21, 0x45, 0x17, 0x50, 0x3F, 0x4C, 0x2C, 0x44,
+    0x60, 0x47, 0x46, 0xE1, 0x1E, 0xEE, 0xF9, 0x1C, 0x24, 0xA8, 0xD7, 0xB3,
+    0xA5, 0xB2, 0xA4, 0xB4, 0xAA, 0xE5, 0xB7, 0xC7, 0xBB, 0xCC, 0xF0, 0xE9,
+    0xF6, 0xD2, 0xDA, 0xEC, 0xE3, 0xED, 0x07, 0xFB, 0xEC, 0x00, 0x04, 0xD8,
+    0xDF, 0xF3, 0xFC, 0xEA, 0xF5, 0xE8, 0xF7, 0xF8, 0x2A, 0x1A, 0xF2, 0x16,
+    0xF3, 0x00, 0x15, 0x06, 0x3C, 0x3D, 0x16, 0x0E, 0x28, 0x16, 0x47, 0x32,
+    0x42, 0x23, 0x3F, 0x57, 0x2F, 0x20, 0x2F, 0x27, 0x4E, 0x3C, 0x2A, 0xE3,
+    0xEF, 0xF8, 0x1A, 0xF0, 0x04, 0xF4, 0xCE, 0xBA, 0xA7, 0xD8, 0xBC, 0xAF,
+    0xB5, 0xE0, 0xD5, 0xE7, 0xD4, 0xC8, 0xCA, 0xE4, 0xD7, 0xD6, 0xC6, 0xD6,
+    0xE2, 0xC7, 0xF3, 0xE6, 0xCE, 0xE4, 0x06, 0xFB, 0xFA, 0xE3, 0x15, 0xFC,
+    0xEE, 0xFE, 0x15, 0xE7, 0x15, 0x03, 0xFB, 0x03, 0xFE, 0xF2, 0x28, 0xF8,
+    0x36, 0x06, 0x07, 0x17, 0x42, 0x2B, 0x48, 0x08, 0x19, 0x19, 0x50, 0x1D,
+    0x1F, 0x31, 0x4E, 0x1E, 0x5E, 0x46, 0x58, 0x2F, 0xFA, 0xF5, 0xDE, 0x03,
+    0xEC, 0xEF, 0xE9, 0x27, 0xBE, 0xD0, 0xB5, 0xA8, 0xD3, 0xD4, 0xC6, 0xBA,
+    0xC8, 0xED, 0xE4, 0xB9, 0xC4, 0xBF, 0xE6, 0xC2, 0xC0, 0xE2, 0xED, 0xCB,
+    0xC8, 0x06, 0xE6, 0xD9, 0xD4, 0xFD, 0xE6, 0x06, 0x02, 0xDD, 0xE8, 0x11,
+    0x24, 0xFC, 0x08, 0x19, 0x26, 0x00, 0xFC, 0x20, 0x03, 0x0C, 0xFF, 0x05,
+    0x11, 0x18, 0x3F, 0x3A, 0x48, 0x0B, 0x3B, 0x2F, 0x4C, 0x29, 0x33, 0x3D,
+    0x56, 0x4C, 0x42, 0x45, 0x58, 0x0E, 0x06, 0xFF, 0xF4, 0x16, 0xF6, 0x0B,
+    0xF5, 0x25, 0x0B, 0xA9, 0xD1, 0xCE, 0xD0, 0xCB, 0xCE, 0xC6, 0xD2, 0xCF,
+    0xDA, 0xDC, 0xD2, 0xE6, 0xE4, 0xBD, 0xCF, 0xCB, 0x04, 0xED, 0xCA, 0xCB,
+    0xF3, 0xD1, 0xFF, 0xE4, 0xDD, 0x10, 0x00, 0xFE, 0xFB, 0x13, 0xFD, 0x12,
+    0x00, 0xF6, 0xF3, 0x12, 0x2D, 0x1D, 0x15, 0x08, 0x01, 0x0A, 0xFF, 0x0C,
+    0x42, 0x27, 0x12, 0x33, 0x10, 0x0F, 0x13, 0x42, 0x1C, 0x35, 0x1B, 0x37,
+    0x4F, 0x47, 0x5A, 0xDB, 0x00, 0xF5, 0xE4, 0xF9, 0x18, 0x1F, 0xF0, 0x00,
+    0x2A, 0xAF, 0x9F, 0xB6, 0xD1, 0xD0, 0xE4, 0xC4, 0xD4, 0xDA, 0xE2, 0xD9,
+    0xBA, 0xD1, 0xEC, 0xC8, 0xD0, 0xDD, 0xE1, 0xF6, 0xDA, 0xEE, 0xF8, 0xEE,
+    0xF9, 0x13, 0xFB, 0xED, 0xE8, 0xDE, 0x0A, 0x02, 0x05, 0xF5, 0x28, 0x28,
+    0x20, 0xF0, 0x1F, 0xFB, 0x20, 0xFD, 0x06, 0x08, 0x26, 0x15, 0x2A, 0x0B,
+    0x06, 0x2D, 0x36, 0x1E, 0x1B, 0x37, 0x42, 0x44, 0x54, 0x48, 0x3E, 0x40,
+    0x43, 0xDC, 0xFB, 0xFB, 0x16, 0x0B, 0xEC, 0xEB, 0xEF, 0x11, 0xEC, 0xF2,
+    0xD0, 0xC5, 0xAD, 0xD0, 0xD8, 0xD6, 0xD3, 0xC9, 0xC8, 0xE7, 0xF0, 0xD1,
+    0xDB, 0xF6, 0xD9, 0xBF, 0xDC, 0xD3, 0xE1, 0x00, 0x0C, 0xDC, 0xD9, 0x0D,
+    0xFF, 0x00, 0x09, 0xFA, 0xF2, 0xEE, 0xEB, 0x11, 0x22, 0x0F, 0x17, 0x1A,
+    0x25, 0x25, 0x21, 0x0F, 0x22, 0x3A, 0x02, 0x2F, 0x16, 0x3F, 0x0A, 0x33,
+    0x3C, 0x27, 0x16, 0x38, 0x27, 0x49, 0x4E, 0x47, 0x4D, 0x29, 0x2B, 0x12,
+    0x05, 0xDB, 0xDF, 0x09, 0xE1, 0xF1, 0xFC, 0xE9, 0x03, 0xEA, 0xEC, 0xD6,
+    0xBC, 0xC8, 0xD3, 0xC0, 0xD3, 0xB2, 0xAD, 0xEA, 0xE6, 0xBA, 0xBA, 0xD0,
+    0xF6, 0xC2, 0xD5, 0xE9, 0xDA, 0xDA, 0xE4, 0xCE, 0x07, 0xE5, 0xFE, 0xE0,
+    0xF1, 0x01, 0xF1, 0xF2, 0x1E, 0xEB, 0x1C, 0x1F, 0xE8, 0x09, 0x1F, 0x01,
+    0x02, 0x24, 0x24, 0x2A, 0x32, 0x1D, 0x38, 0x35, 0x3A, 0x0D, 0x3A, 0x29,
+    0x3D, 0x20, 0x47, 0x15, 0x4A, 0x38, 0x3E, 0x4D, 0x42, 0x38, 0x00, 0xEB,
+    0x0B, 0xED, 0xE7, 0xF0, 0x02, 0xE9, 0x0B, 0x1B, 0xEA, 0x0B, 0x1D, 0xC5,
+    0xE1, 0xE0, 0xC6, 0xC5, 0xE1, 0xB5, 0xD7, 0xC5, 0xC0, 0xF1, 0xCD, 0xEF,
+    0xF0, 0xEE, 0xC7, 0xEA, 0xDC, 0xDA, 0x0C, 0xEA, 0x05, 0xFA, 0xF2, 0x0F,
+    0xD9, 0xE2, 0x12, 0xED, 0x22, 0x15, 0xEB, 0xE9, 0x07, 0x06, 0xFB, 0x2D,
+    0xF5, 0x25, 0x25, 0x2A, 0x32, 0x29, 0x3B, 0x20, 0x43, 0x08, 0x3D, 0x10,
+    0x27, 0x3C, 0x26, 0x4C, 0x33, 0x46, 0x41, 0x5E, 0xFB, 0xF0, 0xDF, 0xDB,
+    0xE4, 0x17, 0x07, 0xE8, 0x06, 0x07, 0xF7, 0x00, 0x0F, 0xED, 0xA1, 0xD1,
+    0xD0, 0xB2, 0xAC, 0xB8, 0xD9, 0xBB, 0xCF, 0xD5, 0xC6, 0xE9, 0xD6, 0xC3,
+    0xF5, 0xDA, 0xFB, 0x00, 0xEB, 0xE1, 0xCF, 0xCF, 0xD2, 0xE1, 0x0C, 0xF1,
+    0xED, 0x00, 0x0C, 0xF6, 0xF1, 0xF4, 0x21, 0xF7, 0xEE, 0x1F, 0xF3, 0x1D,
+    0xFC, 0x0B, 0x17, 0x11, 0x01, 0x1C, 0x17, 0x2D, 0x35, 0x13, 0x46, 0x1D,
+    0x2A, 0x12, 0x1A, 0x53, 0x3C, 0x1D, 0x2B, 0xDC, 0xE5, 0x0E, 0xF9, 0xEF,
+    0x0C, 0x16, 0x0A, 0x12, 0x19, 0x0B, 0xF0, 0x00, 0x06, 0xFE, 0xB2, 0xCF,
+    0xD7, 0xE0, 0xDA, 0xCA, 0xB9, 0xDC, 0xC3, 0xDC, 0xE8, 0xFE, 0xCE, 0xD2,
+    0xD5, 0xDF, 0xEA, 0x05, 0xEB, 0x0C, 0xE3, 0xE2, 0xED, 0x01, 0xDB, 0x19,
+    0xFD, 0x10, 0xE4, 0x01, 0x1E, 0x1D, 0xFA, 0x14, 0x1C, 0x21, 0xF6, 0x2C,
+    0x13, 0x1B, 0x10, 0x1B, 0x06, 0x0F, 0x13, 0x37, 0x33, 0x1E, 0x2D, 0x4E,
+    0x1B, 0x48, 0x29, 0x2E, 0x2F, 0x0A, 0x02, 0x0D, 0x16, 0x11, 0xE2, 0x06,
+    0x11, 0xED, 0xF3, 0xF0, 0xEF, 0x0A, 0x29, 0x09, 0x00, 0xA3, 0xC6, 0xC6,
+    0xEA, 0xC2, 0xDB, 0xEF, 0xD7, 0xD8, 0xD2, 0xF9, 0xF9, 0xF0, 0xFA, 0xE1,
+    0xCB, 0xFD, 0xCB, 0xFA, 0x0C, 0x0F, 0xFF, 0x10, 0xEE, 0xEB, 0x0E, 0xEE,
+    0x0D, 0x0A, 0xF8, 0x1B, 0x19, 0x29, 0x09, 0x28, 0xFC, 0x19, 0x11, 0x13,
+    0x2D, 0x36, 0x2D, 0x37, 0x1C, 0x45, 0x3F, 0x1E, 0x23, 0x10, 0x20, 0x48,
+    0x40, 0x32, 0x2E, 0x49, 0x0A, 0xE5, 0xF3, 0xDF, 0xF6, 0xF9, 0xF3, 0xFE,
+    0x07, 0x14, 0xFB, 0x00, 0x02, 0x1F, 0x00, 0xF0, 0xCA, 0xCF, 0xB3, 0xCC,
+    0xDB, 0xB2, 0xB8, 0xED, 0xE3, 0xE0, 0xF6, 0xF5, 0xDE, 0xF6, 0xCF, 0xFA,
+    0xDB, 0xE8, 0xE6, 0xF5, 0xD4, 0xE8, 0xF3, 0xEA, 0xEC, 0xDB, 0x1D, 0xDF,
+    0xE2, 0x22, 0x1A, 0x12, 0x0E, 0x20, 0x2F, 0xFD, 0x1A, 0x2C, 0x37, 0x10,
+    0x0C, 0x08, 0x30, 0x28, 0x17, 0x47, 0x3E, 0x32, 0x49, 0x26, 0x3C, 0x26,
+    0x38, 0x48, 0xFB, 0xFF, 0x06, 0xE9, 0x00, 0xD9, 0xF2, 0xFD, 0xDF, 0x01,
+    0x09, 0xFB, 0xF8, 0xEF, 0x0A, 0xF3, 0x24, 0xE1, 0xC2, 0xB0, 0xD2, 0xE3,
+    0xE3, 0xCF, 0xE0, 0xDE, 0xC1, 0xED, 0xE3, 0xF0, 0xEE, 0x00, 0xFD, 0xFD,
+    0xD1, 0xE7, 0xD8, 0x06, 0xE0, 0x11, 0x08, 0xDC, 0x0F, 0x09, 0x0A, 0x1E,
+    0x16, 0xE7, 0xF9, 0x10, 0x25, 0x2A, 0x12, 0xF6, 0x12, 0x31, 0x21, 0x06,
+    0x02, 0x3E, 0x0F, 0x14, 0x31, 0x1C, 0x24, 0x2D, 0x28, 0x44, 0x2F, 0x3C,
+    0xEB, 0xE4, 0x01, 0x06, 0xE6, 0xF7, 0xEA, 0xFD, 0x19, 0x02, 0x1E, 0xEB,
+    0x07, 0xF5, 0x21, 0xF8, 0x07, 0x1B, 0xBB, 0xBE, 0xD7, 0xD7, 0xEF, 0xB3,
+    0xD3, 0xB9, 0xEA, 0xEA, 0xE2, 0xC0, 0x02, 0xEB, 0xEC, 0xCB, 0x08, 0xDD,
+    0xCF, 0xDA, 0xE8, 0xDC, 0x11, 0x0F, 0x10, 0xFB, 0x07, 0xF0, 0x21, 0x19,
+    0x12, 0x06, 0x1E, 0x01, 0x26, 0x02, 0x38, 0x39, 0x39, 0x3E, 0x37, 0x15,
+    0x16, 0x25, 0x1B, 0x25, 0x2F, 0x13, 0x23, 0x20, 0x50, 0x07, 0xDD, 0xEF,
+    0xDF, 0x04, 0xD7, 0xF8, 0x02, 0x15, 0x13, 0x0F, 0x18, 0xEC, 0x18, 0x12,
+    0x1F, 0x04, 0xF4, 0x0B, 0xD9, 0xE6, 0xEA, 0xE1, 0xD0, 0xEE, 0xF6, 0xCA,
+    0xF1, 0xDC, 0xD2, 0xF5, 0xDE, 0xEC, 0x03, 0x05, 0xFF, 0xE9, 0x07, 0x08,
+    0xD9, 0xFA, 0x13, 0x05, 0x19, 0x08, 0x06, 0xE5, 0x19, 0x07, 0x01, 0x05,
+    0x0D, 0x23, 0x0F, 0x11, 0xF8, 0x2F, 0x08, 0x28, 0x2C, 0x0A, 0x24, 0x2E,
+    0x22, 0x2A, 0x16, 0x30, 0x31, 0x4F, 0x43, 0xFE, 0xD5, 0xDD, 0x03, 0xE3,
+    0xE7, 0xE0, 0x09, 0x03, 0xEA, 0x05, 0x10, 0xFD, 0x16, 0x0B, 0x1D, 0x0A,
+    0x2E, 0x0F, 0xC1, 0xC0, 0xD3, 0xCA, 0xE9, 0xBD, 0xC4, 0xC0, 0xF9, 0xC6,
+    0xF8, 0xFF, 0xE3, 0xCF, 0x00, 0xDD, 0xEA, 0xE8, 0x10, 0xE5, 0xEF, 0x10,
+    0xDE, 0xFC, 0xEB, 0x03, 0xFE, 0x18, 0xFC, 0xF2, 0x1C, 0x1B, 0x0A, 0x23,
+    0x35, 0x00, 0x08, 0x1F, 0x37, 0x3B, 0x3E, 0x1D, 0x31, 0x2C, 0x14, 0x36,
+    0x20, 0x13, 0x16, 0x06, 0xEE, 0x07, 0xE5, 0x0E, 0xE4, 0x08, 0xFA, 0xF8,
+    0x08, 0xEA, 0xE7, 0xE9, 0x1E, 0x17, 0x1C, 0x14, 0xF3, 0x2F, 0xFE, 0x1C,
+    0xD2, 0xD1, 0xBC, 0xC3, 0xE4, 0xCA, 0xBE, 0xC1, 0xD6, 0xF9, 0xE8, 0xCE,
+    0xE5, 0xF4, 0x03, 0xED, 0xD5, 0xE2, 0x04, 0x11, 0xF7, 0x17, 0x00, 0x01,
+    0x1B, 0x08, 0x1C, 0x13, 0xF9, 0xF6, 0xFC, 0xF6, 0xF4, 0xFA, 0x2E, 0x14,
+    0x39, 0x1D, 0x40, 0x41, 0x09, 0x3F, 0x42, 0x2F, 0x35, 0x35, 0x4B, 0xEF,
+    0xEF, 0x00, 0xD0, 0xF8, 0xD8, 0xEC, 0x0B, 0xF5, 0x02, 0xEE, 0x14, 0x17,
+    0x08, 0x1D, 0xFA, 0x2A, 0xF6, 0x1D, 0xFE, 0xFE, 0xE2, 0xBA, 0xAF, 0xEB,
+    0xC3, 0xC6, 0xDF, 0xF3, 0xD7, 0x00, 0xF9, 0xD0, 0xD6, 0xE8, 0x05, 0xD8,
+    0xE1, 0xE1, 0xE9, 0xED, 0xE8, 0x00, 0x19, 0xEF, 0x02, 0x1C, 0xF9, 0x05,
+    0x01, 0x24, 0xEF, 0x11, 0x03, 0x01, 0x1D, 0x02, 0x2E, 0x1D, 0x0C, 0x31,
+    0x44, 0x27, 0x16, 0x33, 0x2F, 0x1B, 0x29, 0xF9, 0xEC, 0xE0, 0xED, 0xDB,
+    0xFA, 0x03, 0x00, 0xF7, 0xF5, 0x06, 0xEE, 0xF8, 0x00, 0xFF, 0x09, 0x0E,
+    0x22, 0x32, 0x2A, 0x08, 0x1C, 0xDB, 0xD1, 0xD4, 0xC8, 0xD3, 0xCA, 0xF2,
+    0xD5, 0xFD, 0xD5, 0xD4, 0xF4, 0xD4, 0xF8, 0x0B, 0x0F, 0xDE, 0xD8, 0x14,
+    0xF0, 0xFB, 0xF3, 0xE5, 0x11, 0xFA, 0xF5, 0x05, 0x05, 0x0A, 0x31, 0x1E,
+    0x2B, 0x29, 0x02, 0x1A, 0x10, 0x2D, 0x35, 0x27, 0x1A, 0x46, 0x0C, 0x27,
+    0x1A, 0x12, 0xDE, 0xEF, 0xDD, 0xF4, 0xDF, 0xE8, 0xFF, 0xE8, 0xF4, 0x01,
+    0x15, 0xE4, 0x06, 0x00, 0x1D, 0xF5, 0x04, 0x0E, 0x1A, 0x18, 0x2C, 0x2B,
+    0xB3, 0xCF, 0xDE, 0xED, 0xC5, 0xC2, 0xEE, 0xCE, 0xD0, 0xFC, 0xC5, 0x00,
+    0xDF, 0xE1, 0xED, 0xF6, 0x0C, 0xFF, 0x15, 0xF8, 0x06, 0x1B, 0x0C, 0x0A,
+    0xF4, 0xF7, 0x27, 0x18, 0x2E, 0x1A, 0xF8, 0x1A, 0x0A, 0x2D, 0x0C, 0x22,
+    0x03, 0x0F, 0x28, 0x48, 0x3C, 0x31, 0x23, 0x1A, 0xD4, 0xF4, 0xD5, 0x08,
+    0xE5, 0xF2, 0x0F, 0xE5, 0x15, 0xDF, 0xE6, 0xE7, 0xFC, 0xF5, 0x10, 0x0C,
+    0x00, 0xF5, 0x01, 0x09, 0x2E, 0x1E, 0x29, 0xD6, 0xEA, 0xDF, 0xEC, 0xDA,
+    0xF4, 0xF1, 0xD0, 0xF2, 0xDB, 0xDC, 0x03, 0xD4, 0xDA, 0xE5, 0x00, 0x00,
+    0xF7, 0xE1, 0xE3, 0xF6, 0xFF, 0x07, 0xF0, 0x07, 0xF8, 0x0D, 0x00, 0xF6,
+    0xF9, 0x11, 0x39, 0x35, 0x37, 0x11, 0x24, 0x23, 0x27, 0x0C, 0x19, 0x3F,
+    0x4E, 0xC6, 0xEF, 0xEB, 0xF5, 0xE0, 0xE3, 0xF0, 0x04, 0xDE, 0x02, 0x11,
+    0xE7, 0xE6, 0xF7, 0x23, 0x04, 0x12, 0x29, 0x28, 0xFA, 0x0B, 0x29, 0x27,
+    0x02, 0xCF, 0xC9, 0xC2, 0xC6, 0xC9, 0xF2, 0xD8, 0xE4, 0xF9, 0xF2, 0xEB,
+    0xFF, 0xDA, 0x09, 0xFB, 0xD9, 0xEB, 0xE2, 0x19, 0x15, 0xEA, 0xFF, 0x1E,
+    0xEF, 0x00, 0x2A, 0xF0, 0x00, 0x31, 0x18, 0x1D, 0x1F, 0x0E, 0x3D, 0x40,
+    0x2F, 0x42, 0x1D, 0x1D, 0x13, 0x2A, 0xCD, 0xE5, 0x0A, 0xF8, 0xEC, 0xD1,
+    0xFA, 0xFD, 0xF6, 0xE5, 0x0B, 0xE3, 0x17, 0x03, 0x0E, 0x00, 0x0A, 0x00,
+    0xF0, 0x0C, 0x10, 0x2B, 0x01, 0x03, 0xDA, 0xB6, 0xD9, 0xC7, 0xED, 0xC7,
+    0xE6, 0xD3, 0xEA, 0xD1, 0x09, 0xD8, 0xE5, 0x05, 0x00, 0x00, 0xF0, 0xF8,
+    0xF7, 0xEF, 0x19, 0xF4, 0x0A, 0xEC, 0x15, 0x04, 0xF2, 0xF9, 0x25, 0x33,
+    0x1C, 0x0B, 0x12, 0x2A, 0x0E, 0x44, 0x31, 0x2B, 0x3E, 0x1A, 0xDD, 0xF3,
+    0xFB, 0x02, 0x01, 0x00, 0x00, 0xE0, 0xDE, 0x19, 0xF0, 0xE0, 0x1B, 0x14,
+    0xEC, 0x05, 0x25, 0x15, 0x2A, 0x0F, 0x0B, 0xFE, 0x33, 0x1B, 0x19, 0xE2,
+    0xF1, 0xBE, 0xDB, 0xEA, 0xE3, 0xE1, 0xEF, 0xD6, 0xE3, 0x07, 0xE2, 0x09,
+    0xE9, 0xD8, 0x07, 0xE1, 0x12, 0x0F, 0x08, 0xF8, 0xF9, 0x21, 0x0C, 0xF2,
+    0x26, 0x17, 0x09, 0xFB, 0x24, 0x13, 0x2D, 0x0C, 0x31, 0x35, 0x1A, 0x0D,
+    0x10, 0xF8, 0xF5, 0xFD, 0xF6, 0xF2, 0xE2, 0xDE, 0xE4, 0x02, 0xE9, 0xE7,
+    0x0D, 0x0C, 0xFD, 0xEC, 0x11, 0xEC, 0x17, 0xF5, 0x2E, 0x03, 0x21, 0x31,
+    0x15, 0x23, 0x36, 0xE1, 0xDA, 0xD0, 0xEF, 0xD2, 0xDA, 0xD5, 0xC6, 0xD5,
+    0xD2, 0x07, 0xFD, 0x0A, 0xE7, 0x02, 0x09, 0xE0, 0x0E, 0x02, 0x1C, 0xF5,
+    0x04, 0xEF, 0x06, 0x08, 0x00, 0x24, 0x2E, 0x24, 0x00, 0x14, 0x32, 0x08,
+    0x11, 0x0A, 0x47, 0x40, 0xFB, 0xEB, 0xD2, 0xDC, 0x04, 0xDB, 0xEB, 0xDC,
+    0xFE, 0xE5, 0xFC, 0xFD, 0x1D, 0xF1, 0x03, 0xF7, 0x0D, 0xF7, 0x00, 0x28,
+    0x21, 0x17, 0x00, 0x26, 0x2E, 0x0C, 0xE5, 0xBA, 0xE0, 0xEA, 0xDD, 0xDE,
+    0xCE, 0xE4, 0x05, 0xF3, 0x07, 0xDE, 0xE5, 0x04, 0x08, 0x0F, 0xE9, 0x03,
+    0xE5, 0x07, 0x00, 0x12, 0x0A, 0x23, 0x20, 0xF9, 0x1D, 0x0F, 0xF9, 0x39,
+    0x1B, 0x24, 0x38, 0x23, 0x36, 0x0A, 0xE9, 0xE2, 0x05, 0x00, 0xCF, 0xF6,
+    0xE3, 0xE6, 0x0F, 0x0F, 0xF7, 0x19, 0xE3, 0x1A, 0x12, 0x07, 0x00, 0x09,
+    0xF2, 0x02, 0x25, 0x00, 0x32, 0x33, 0x13, 0x2A, 0x0D, 0xF6, 0xBA, 0xEA,
+    0xE0, 0xFE, 0xF2, 0xE0, 0xF2, 0xE3, 0xE7, 0xF0, 0x0E, 0x05, 0xF7, 0xEC,
+    0x10, 0x13, 0xEE, 0xE3, 0x09, 0x11, 0x1B, 0x2C, 0x09, 0x2F, 0x2A, 0x1A,
+    0x34, 0x0E, 0x2B, 0x36, 0x17, 0x41, 0x2F, 0x46, 0xFF, 0xF8, 0xFB, 0xE1,
+    0xFC, 0x02, 0x0E, 0x05, 0xFC, 0x0E, 0x0B, 0x00, 0xEB, 0x09, 0x05, 0xF2,
+    0x19, 0x1D, 0x11, 0x0E, 0x31, 0x28, 0xFC, 0x17, 0x11, 0x15, 0x18, 0xEB,
+    0xF5, 0xD0, 0xF6, 0xFC, 0xC8, 0xEA, 0xE3, 0xD7, 0xF2, 0x0B, 0xF6, 0x0C,
+    0x15, 0x08, 0x07, 0xF5, 0x06, 0xF7, 0x1A, 0xF1, 0x13, 0x1F, 0x2E, 0x28,
+    0x11, 0x27, 0x39, 0x3B, 0x3B, 0x13, 0x42, 0x45, 0x34, 0xE1, 0xC8, 0xDB,
+    0xCE, 0xF8, 0xD4, 0xF7, 0xD4, 0xF5, 0xE0, 0xE7, 0x0C, 0xEF, 0x02, 0xFB,
+    0x13, 0x1A, 0x06, 0x23, 0x2D, 0x0C, 0x2F, 0x0D, 0x19, 0x35, 0x3A, 0x38,
+    0xB8, 0xC8, 0xC3, 0xD0, 0x00, 0xE3, 0x04, 0xCF, 0xE4, 0xE0, 0x0A, 0xE7,
+    0xFD, 0xDB, 0xDE, 0x12, 0xF7, 0x0B, 0x0A, 0x0A, 0xF0, 0x1E, 0xFB, 0x06,
+    0x26, 0xFB, 0x26, 0x1A, 0x19, 0x2B, 0x16, 0x45, 0x0B, 0xEC, 0xF7, 0xE3,
+    0xC6, 0xCC, 0xFE, 0xDE, 0x03, 0xE5, 0xD5, 0xD8, 0xE6, 0xE0, 0x15, 0x04,
+    0xE9, 0x10, 0x08, 0x05, 0x08, 0xF9, 0x30, 0x12, 0x1A, 0x0B, 0xFF, 0x25,
+    0x15, 0xEE, 0xCE, 0xC5, 0xC3, 0xEA, 0x02, 0xE1, 0xDC, 0x01, 0x05, 0xE9,
+    0xFE, 0xE8, 0xFF, 0xE1, 0xFD, 0x12, 0x11, 0x27, 0xFC, 0x03, 0xF5, 0x15,
+    0x0D, 0x26, 0x03, 0x02, 0x35, 0x33, 0x08, 0x0B, 0xEA, 0xC0, 0xDB, 0xCE,
+    0xE8, 0xDD, 0xF9, 0xEB, 0xDE, 0xEA, 0x15, 0x10, 0x09, 0xE5, 0x02, 0x0D,
+    0x05, 0x0F, 0xEB, 0xF4, 0x2F, 0x19, 0x34, 0x0C, 0x14, 0x1C, 0x24, 0x1B,
+    0x23, 0xF6, 0xD2, 0xD3, 0xED, 0xD8, 0xEC, 0xF2, 0x08, 0xE6, 0xE5, 0xE9,
+    0xEA, 0xDF, 0x0D, 0x17, 0x1C, 0x07, 0x12, 0x12, 0x1B, 0x02, 0xF1, 0x03,
+    0x02, 0x2E, 0x27, 0x1F, 0x24, 0x0C, 0x20, 0xE5, 0xEA, 0xED, 0xFA, 0xE6,
+    0xEF, 0xFD, 0xFC, 0xE2, 0xD4, 0x12, 0xF2, 0x0D, 0xFD, 0xE6, 0x19, 0xF1,
+    0xF0, 0xFD, 0x2C, 0x15, 0xF3, 0x2B, 0x13, 0x32, 0x30, 0x25, 0x10, 0x0D,
+    0x25, 0xEC, 0xD9, 0xD1, 0xD5, 0xE9, 0xDD, 0x09, 0xFA, 0xE4, 0xE1, 0xF2,
+    0x00, 0xF1, 0x00, 0xF3, 0xF6, 0xF7, 0xEE, 0x1F, 0xF2, 0x10, 0x26, 0x32,
+    0x25, 0x14, 0x0E, 0x07, 0x37, 0x3B, 0xEF, 0xD6, 0xDD, 0xE5, 0xCB, 0xE1,
+    0xE3, 0xFA, 0xDB, 0xDA, 0xF3, 0xF8, 0xEA, 0xF7, 0x10, 0x0F, 0xF6, 0xF7,
+    0xFB, 0xF3, 0x0E, 0xFA, 0xFA, 0x20, 0x09, 0xFD, 0x3F, 0x36, 0x23, 0x26,
+    0xE4, 0xE1, 0xD2, 0xF5, 0xF1, 0xCF, 0xDD, 0xF5, 0x03, 0xE2, 0xED, 0xFD,
+    0x00, 0x10, 0x0A, 0xF7, 0xF5, 0x1B, 0xFC, 0x22, 0x00, 0x1B, 0x26, 0x33,
+    0x2A, 0x1B, 0x16, 0x0F, 0xD3, 0xEB, 0xC4, 0xEC, 0xEB, 0xE2, 0xD1, 0xEC,
+    0x03, 0xEB, 0x05, 0xE8, 0x12, 0xEA, 0xF3, 0xEB, 0x21, 0x04, 0x1B, 0x1E,
+    0x20, 0xFB, 0x29, 0x11, 0x21, 0x1A, 0x03, 0x17, 0x1D, 0x1C, 0xC5, 0xD0,
+    0xF2, 0xD4, 0xFF, 0xD6, 0xFE, 0xFE, 0xF5, 0xF1, 0xD7, 0x01, 0x18, 0xED,
+    0x00, 0x00, 0x0E, 0x19, 0x04, 0x21, 0xF5, 0x0E, 0x29, 0x0C, 0x01, 0x05,
+    0x00, 0x26, 0xE7, 0xC5, 0xD1, 0xCE, 0xFB, 0xCE, 0xF4, 0xD0, 0x09, 0x05,
+    0x0E, 0x0B, 0xFA, 0x0D, 0x13, 0x0A, 0xED, 0x26, 0x1B, 0x2B, 0x23, 0xF2,
+    0x07, 0x05, 0x2C, 0x06, 0x2F, 0x28, 0x05, 0x3A, 0xCA, 0xEA, 0xC5, 0xD9,
+    0xE9, 0xF7, 0x07, 0xEC, 0x0E, 0xEF, 0xDA, 0xE0, 0xFC, 0xE7, 0x06, 0xFA,
+    0x16, 0x0A, 0x25, 0x18, 0x28, 0x33, 0x26, 0x25, 0x05, 0x10, 0x13, 0xDA,
+    0xDE, 0xE9, 0xC3, 0xD2, 0xD0, 0xFB, 0xF4, 0x07, 0xE9, 0xD4, 0x0B, 0xE6,
+    0x14, 0x14, 0x19, 0x20, 0x0F, 0xF8, 0xFC, 0x09, 0xFE, 0x26, 0x27, 0x15,
+    0x24, 0x05, 0x09, 0x03, 0x36, 0x21, 0xD4, 0xD2, 0xC8, 0xCE, 0x01, 0x06,
+    0xD1, 0xE1, 0x12, 0xE6, 0x02, 0x0A, 0x0F, 0x05, 0x14, 0xEC, 0x14, 0x02,
+    0x1A, 0x22, 0xF5, 0x29, 0x37, 0x38, 0x27, 0x0F, 0xF0, 0xEB, 0xEA, 0xD5,
+    0xD6, 0xDA, 0xCE, 0x03, 0xFC, 0xDA, 0xFE, 0xD6, 0xFB, 0x00, 0x07, 0x1E,
+    0xF9, 0x00, 0x06, 0xFD, 0x1B, 0x20, 0x00, 0x21, 0x23, 0x35, 0x2F, 0x31,
+    0x0E, 0x18, 0x3A, 0x25, 0xFE, 0xD5, 0xF0, 0xE8, 0xEE, 0xDC, 0xE1, 0xFB,
+    0xEE, 0xE8, 0x07, 0xE7, 0xF6, 0xF5, 0x10, 0xEA, 0x02, 0x16, 0x0D, 0x1E,
+    0x2F, 0x17, 0x3C, 0x38, 0xD4, 0xE2, 0xDA, 0xEB, 0xD8, 0xF2, 0x02, 0xD8,
+    0xF4, 0xE2, 0xF3, 0xD4, 0xF8, 0x0C, 0xE9, 0x0A, 0xF0, 0x0A, 0x17, 0x26,
+    0xFB, 0xF0, 0x24, 0x04, 0x0C, 0x1E, 0x2A, 0x38, 0x1B, 0x02, 0x1D, 0x2D,
+    0x14, 0xF2, 0xCE, 0xD5, 0xE5, 0xF5, 0xDD, 0x05, 0xE1, 0xDC, 0xFC, 0x0F,
+    0x00, 0xF5, 0xED, 0xEC, 0xEF, 0x08, 0x15, 0x03, 0x33, 0x01, 0x31, 0x1A,
+    0x11, 0xD7, 0xEC, 0xF3, 0xC2, 0xD8, 0xD7, 0xCD, 0xF1, 0xEA, 0x0C, 0x07,
+    0x04, 0xD8, 0x10, 0xFC, 0x1E, 0x1F, 0x05, 0xF8, 0x0B, 0xED, 0x10, 0xF3,
+    0x15, 0x19, 0x0E, 0x22, 0x2C, 0x21, 0x43, 0x46, 0x1A, 0x14, 0x03, 0xE2,
+    0xEB, 0xF1, 0xF0, 0x01, 0x0D, 0xEC, 0x03, 0xEA, 0xFA, 0x02, 0xF1, 0x01,
+    0xFB, 0x1E, 0x06, 0xFB, 0xFB, 0x00, 0x17, 0x1D, 0x22, 0xCF, 0xBD, 0xD2,
+    0xE2, 0xCD, 0xC7, 0x01, 0x00, 0x04, 0x08, 0x0C, 0x06, 0xFD, 0xF5, 0x13,
+    0x19, 0x10, 0xFC, 0x21, 0x1F, 0xF2, 0x28, 0x24, 0xFE, 0x03, 0xFC, 0x0B,
+    0x2D, 0x19, 0x17, 0x35, 0x0A, 0x49, 0xD6, 0xFA, 0xF5, 0x00, 0xD1, 0x10,
+    0x00, 0xD6, 0xE2, 0xF2, 0xF7, 0xED, 0x12, 0xF5, 0xF5, 0x0E, 0x12, 0x1F,
+    0x09, 0xFC, 0x16, 0x3B, 0xF3, 0xC7, 0xC5, 0xD1, 0xFD, 0xCF, 0xF8, 0xE8,
+    0x00, 0xE2, 0x08, 0xF4, 0xF3, 0x0F, 0xFF, 0x00, 0xE4, 0xF2, 0xE5, 0x1A,
+    0x06, 0x29, 0x22, 0x01, 0x0D, 0x24, 0x1D, 0x0E, 0x15, 0x29, 0x31, 0x29,
+    0x45, 0x46, 0xDF, 0xF7, 0xD6, 0x0B, 0x07, 0xEE, 0xF8, 0xFA, 0xE2, 0xED,
+    0x13, 0x1C, 0xFC, 0x05, 0x18, 0xF7, 0x18, 0x0F, 0x1F, 0x23, 0x36, 0x1E,
+    0xED, 0xCD, 0xCE, 0xE0, 0xEA, 0xC7, 0xC8, 0xE8, 0xCB, 0xD5, 0x01, 0x09,
+    0x13, 0xF5, 0x03, 0x06, 0xF8, 0x02, 0xF7, 0x07, 0xEB, 0xF0, 0x22, 0x0F,
+    0x2E, 0x1C, 0x36, 0xFD, 0x29, 0x2A, 0x31, 0x42, 0x45, 0x2C, 0xE0, 0xF5,
+    0xCB, 0x03, 0xE1, 0x00, 0x0F, 0xFD, 0xED, 0xF7, 0x1A, 0xFD, 0x23, 0xF5,
+    0xFD, 0x1D, 0x12, 0xFA, 0x1C, 0x33, 0x21, 0xBD, 0xE8, 0xE4, 0xF4, 0xCA,
+    0xD0, 0xD9, 0xF3, 0xFD, 0xF6, 0xE8, 0xD4, 0x09, 0x08, 0xDD, 0x07, 0x00,
+    0xFB, 0x0B, 0xF9, 0x25, 0xEB, 0x01, 0xFB, 0x11, 0x1D, 0x2B, 0x26, 0x33,
+    0x28, 0x35, 0x07, 0x2A, 0x1A, 0x2F, 0xDA, 0xE0, 0x05, 0xDD, 0xEB, 0xFB,
+    0x0A, 0xF3, 0xEF, 0xF0, 0x15, 0xF5, 0x09, 0x13, 0xEF, 0xF1, 0x1A, 0x05,
+    0x25, 0x19, 0xCA, 0xE9, 0xE5, 0xF3, 0xCC, 0xDF, 0xD1, 0xFA, 0xCE, 0xD8,
+    0xF9, 0x0D, 0xED, 0xF1, 0xE9, 0x17, 0xF9, 0xFE, 0xEA, 0x1A, 0xFD, 0x23,
+    0x07, 0x11, 0x1A, 0x23, 0x2A, 0x11, 0x23, 0x10, 0x38, 0x42, 0x1B, 0x23,
+    0x3C, 0x26, 0xCC, 0x04, 0xEB, 0xDB, 0x05, 0xF1, 0xED, 0x18, 0x0D, 0xF6,
+    0xE7, 0xF3, 0x0C, 0xF8, 0x14, 0xFD, 0xF8, 0x01, 0x21, 0xE6, 0xD3, 0xF0,
+    0xEB, 0xD6, 0xFC, 0xF6, 0x01, 0xED, 0xDE, 0x05, 0x05, 0x00, 0x0C, 0xF1,
+    0xED, 0xFB, 0xFB, 0xFE, 0xEC, 0x08, 0x0E, 0xFE, 0x19, 0xFA, 0x2E, 0x08,
+    0x0A, 0x22, 0x0D, 0x1A, 0x19, 0x12, 0x12, 0x44, 0x4C, 0x3F, 0xE1, 0xDA,
+    0xF2, 0xD1, 0xDA, 0xD8, 0x11, 0xE7, 0x16, 0xED, 0xEA, 0x04, 0xF9, 0x16,
+    0x07, 0xFE, 0x31, 0x23, 0xCB, 0xB5, 0xDD, 0xC8, 0xF3, 0xBF, 0xCB, 0xE2,
+    0xF5, 0xFA, 0xD5, 0xD1, 0xDD, 0xF0, 0x08, 0xE3, 0xF0, 0xE3, 0x00, 0x0A,
+    0x1A, 0x09, 0xEB, 0x1C, 0x1B, 0x0A, 0x2B, 0x01, 0x00, 0xFF, 0x06, 0x13,
+    0x2A, 0x07, 0x48, 0x28, 0x26, 0x2E, 0xCC, 0xE7, 0x03, 0x0A, 0xE1, 0xFD,
+    0x19, 0x13, 0xFB, 0x08, 0xFC, 0x1C, 0xFB, 0x16, 0x12, 0x24, 0x12, 0xDB,
+    0xE6, 0xC6, 0xF2, 0xF8, 0xEF, 0xC2, 0xC1, 0xD3, 0xE4, 0xD6, 0xF8, 0xFC,
+    0xEA, 0xEB, 0xE5, 0xE3, 0x0A, 0xFF, 0xE1, 0x05, 0xE8, 0x0F, 0xFE, 0x24,
+    0xF7, 0x1A, 0x21, 0x32, 0x16, 0x1F, 0x35, 0x22, 0x3F, 0x30, 0x34, 0x29,
+    0x45, 0xD2, 0xE0, 0xED, 0x00, 0xE9, 0xF3, 0x00, 0x02, 0x03, 0xFE, 0x22,
+    0xEC, 0x1D, 0xF7, 0x1F, 0x10, 0xFB, 0xC3, 0xE8, 0xCD, 0xD3, 0xC5, 0xC1,
+    0xCF, 0xEE, 0xC5, 0xED, 0xF7, 0xFF, 0xEF, 0xEA, 0xF7, 0x0A, 0xEE, 0xDD,
+    0xFF, 0x1E, 0x09, 0x13, 0x21, 0xF1, 0x00, 0x14, 0x32, 0x03, 0xFD, 0x00,
+    0x2C, 0x1C, 0x21, 0x3F, 0x1C, 0x32, 0x29, 0x28, 0x48, 0xE9, 0xDF, 0xD5,
+    0xE6, 0xF6, 0x12, 0xFA, 0x0A, 0x0A, 0x18, 0x12, 0xFF, 0xF4, 0x1B, 0x06,
+    0x18, 0xDB, 0xDD, 0xC0, 0xD5, 0xEA, 0xBD, 0xC1, 0xF4, 0xD6, 0xD4, 0x05,
+    0xE8, 0xFF, 0xF7, 0xD8, 0x00, 0xE1, 0xE3, 0xE3, 0xE6, 0xE7, 0x1F, 0xF1,
+    0xF7, 0xF4, 0x22, 0x24, 0x17, 0x11, 0x33, 0x19, 0x3D, 0x0C, 0x3F, 0x42,
+    0x47, 0x4A, 0x2E, 0x17, 0x36, 0x06, 0x07, 0x07, 0xDF, 0xD9, 0xE6, 0xE1,
+    0x1E, 0x11, 0xFF, 0x00, 0x09, 0x1A, 0x1F, 0x1F, 0xAD, 0xBD, 0xD8, 0xC6,
+    0xB6, 0xD6, 0xEB, 0xD1, 0xF9, 0xFD, 0xD5, 0xFC, 0xE4, 0xFD, 0x0B, 0xF2,
+    0x12, 0x07, 0xFF, 0xF9, 0xF4, 0x17, 0xFF, 0x0E, 0x09, 0x00, 0x04, 0x08,
+    0x26, 0x04, 0xFE, 0x11, 0x1F, 0x07, 0x07, 0x39, 0x17, 0x32, 0x2F, 0x44,
+    0xE6, 0xF8, 0xF3, 0xE7, 0xF7, 0xDC, 0xE4, 0x0F, 0x03, 0x12, 0xEB, 0x00,
+    0xF7, 0x25, 0xFB, 0xAE, 0xE3, 0xB0, 0xD0, 0xD3, 0xEB, 0xBC, 0xFB, 0xD0,
+    0xF9, 0xEF, 0xD0, 0xDF, 0xD0, 0x07, 0xDC, 0x10, 0x0E, 0xF6, 0x0F, 0xEF,
+    0x0C, 0xEA, 0x20, 0x29, 0x1C, 0xF3, 0x00, 0x17, 0x04, 0x09, 0xFF, 0x12,
+    0x3F, 0x41, 0x1A, 0x39, 0x48, 0x3D, 0x22, 0x22, 0x02, 0xE6, 0xEB, 0x05,
+    0x14, 0xF5, 0xF8, 0xF3, 0x03, 0x0C, 0xF3, 0xF0, 0x00, 0x20, 0x05, 0xB5,
+    0xB8, 0xD5, 0xE8, 0xC2, 0xD2, 0xC5, 0xE8, 0xF0, 0xEA, 0xDC, 0xF2, 0x09,
+    0x0D, 0x06, 0x06, 0xF5, 0x07, 0xF6, 0x03, 0xEF, 0x09, 0x11, 0x09, 0x23,
+    0xFA, 0x27, 0x2C, 0x29, 0xFC, 0xFF, 0x0F, 0x1E, 0x33, 0x27, 0x26, 0x4B,
+    0x2B, 0x2E, 0x18, 0x42, 0xF5, 0x0B, 0xDC, 0xDB, 0xE4, 0xEE, 0xEC, 0x0B,
+    0x1B, 0xEF, 0xEE, 0x07, 0x25, 0x23, 0xB9, 0xDF, 0xD7, 0xD3, 0xD1, 0xE2,
+    0xF9, 0xCA, 0xD3, 0xD8, 0xDB, 0xE4, 0xEF, 0x03, 0xE5, 0xF3, 0x05, 0x0B,
+    0xF4, 0xEF, 0xE6, 0xE9, 0x01, 0xFB, 0x17, 0x0F, 0x04, 0x0D, 0xF6, 0x31,
+    0x1F, 0x36, 0x02, 0x1C, 0x0B, 0x26, 0x24, 0x44, 0x4A, 0x13, 0x30, 0x3B,
+    0x07, 0xFD, 0xF1, 0x05, 0xED, 0xEC, 0x1D, 0xEE, 0x0F, 0xF9, 0x1D, 0x24,
+    0x03, 0xD5, 0xD6, 0xD5, 0xCE, 0xCE, 0xC4, 0xF2, 0xF8, 0xF9, 0xF4, 0xDA,
+    0xF1, 0xDA, 0x07, 0xFD, 0x04, 0x04, 0x11, 0xE4, 0x0E, 0xE4, 0x1E, 0x19,
+    0x1B, 0x04, 0x0C, 0x10, 0x22, 0xFB, 0x30, 0x26, 0x29, 0x10, 0x20, 0x03,
+    0x06, 0x3E, 0x34, 0x44, 0x45, 0x12, 0x4C, 0x51, 0x43, 0xE5, 0xD5, 0x04,
+    0xDD, 0xE3, 0xE6, 0x08, 0xF2, 0x02, 0x00, 0xFD, 0x08, 0xD3, 0xBD, 0xD3,
+    0xEA, 0xD7, 0xC4, 0xE1, 0xC7, 0xBD, 0xDA, 0xD0, 0xDB, 0xEE, 0xCA, 0xE1,
+    0xD6, 0xEE, 0x00, 0x01, 0xE7, 0x18, 0x18, 0xEF, 0xFC, 0x08, 0x18, 0x00,
+    0xEF, 0xFD, 0x02, 0x2D, 0x38, 0x2D, 0x19, 0x28, 0x0D, 0x3B, 0x27, 0x13,
+    0x18, 0x48, 0x4C, 0x4E, 0x21, 0xDC, 0x10, 0xEF, 0x15, 0x18, 0x05, 0x14,
+    0x14, 0xE8, 0x28, 0x0E, 0x25, 0xC2, 0xE5, 0xB3, 0xE9, 0xE8, 0xF3, 0xDB,
+    0xCC, 0xDD, 0xE1, 0xF6, 0xCE, 0xE7, 0xF2, 0xE8, 0xED, 0xD6, 0xFC, 0x09,
+    0x00, 0xF9, 0xED, 0xF3, 0xE8, 0x01, 0x23, 0x0D, 0x24, 0x01, 0x16, 0xFC,
+    0x18, 0x00, 0x3A, 0x2F, 0x3D, 0x33, 0x25, 0x1E, 0x37, 0x39, 0x22, 0x49,
+    0x37, 0x29, 0x0F, 0xDF, 0xF2, 0xE9, 0x0C, 0x14, 0x08, 0x00, 0x0A, 0xF9,
+    0x11, 0xB7, 0xBE, 0xCE, 0xDC, 0xE6, 0xEB, 0xDD, 0xE3, 0xBC, 0xE3, 0xCA,
+    0xD8, 0xF4, 0xEC, 0xDE, 0xEE, 0xFD, 0x0C, 0xEE, 0xFA, 0xDC, 0xF0, 0xE5,
+    0x1A, 0xE9, 0xF2, 0x0A, 0xF8, 0xF3, 0x27, 0x2D, 0x00, 0x04, 0x22, 0x0F,
+    0x03, 0x16, 0x2B, 0x35, 0x20, 0x46, 0x43, 0x26, 0x48, 0x54, 0x57, 0xF2,
+    0xF2, 0xE1, 0x18, 0x18, 0x0F, 0xFE, 0xF8, 0x04, 0x15, 0xC9, 0xD8, 0xDB,
+    0xE5, 0xE1, 0xB5, 0xD0, 0xD7, 0xE7, 0xCB, 0xF1, 0xC4, 0xC7, 0xD4, 0xE6,
+    0xF3, 0x01, 0xF4, 0x03, 0x04, 0xDC, 0xE7, 0xEA, 0xED, 0xEC, 0x09, 0x15,
+    0x27, 0x0B, 0xF3, 0xF9, 0x24, 0x21, 0x24, 0x09, 0x1E, 0x1F, 0x10, 0x17,
+    0x0C, 0x3F, 0x3D, 0x3E, 0x29, 0x4E, 0x4A, 0x20, 0xE6, 0x05, 0xF7, 0x13,
+    0xED, 0x07, 0x0C, 0x17, 0x1A, 0x01, 0xA9, 0xD1, 0xAE, 0xD5, 0xED, 0xB5,
+    0xC6, 0xF6, 0xDA, 0xBE, 0xF8, 0xEC, 0xFF, 0xEA, 0xDA, 0xEA, 0xE7, 0xDD,
+    0x0D, 0xFF, 0xFF, 0x11, 0x12, 0x1B, 0x1E, 0xEF, 0x27, 0x10, 0xF5, 0xFF,
+    0x13, 0x21, 0x2A, 0x00, 0x07, 0x00, 0x29, 0x10, 0x10, 0x0F, 0x14, 0x32,
+    0x1B, 0x31, 0x20, 0x4C, 0x48, 0x50, 0xE7, 0xE6, 0x1B, 0x07, 0x01, 0x02,
+    0x11, 0x02, 0xDE, 0xBC, 0xC9, 0xDC, 0xB5, 0xE1, 0xB9, 0xB5, 0xF2, 0xE2,
+    0xC8, 0xF1, 0xD2, 0xFE, 0xD6, 0xCE, 0x07, 0xDE, 0xF8, 0x0B, 0xEA, 0x02,
+    0x02, 0x0E, 0xF5, 0xF1, 0xF1, 0x0D, 0x26, 0xF7, 0x1A, 0x1B, 0x12, 0x00,
+    0xFE, 0x16, 0x16, 0x3D, 0x04, 0x25, 0x30, 0x23, 0x1B, 0x23, 0x40, 0x4B,
+    0x1E, 0x1D, 0x53, 0xEF, 0xEC, 0xF4, 0xE3, 0xF9, 0xE6, 0x1F, 0x21, 0xB8,
+    0xCE, 0xDD, 0xCF, 0xC5, 0xE2, 0xE8, 0xCB, 0xDF, 0xBB, 0xC7, 0xE6, 0xEA,
+    0xD5, 0xDB, 0xEE, 0xCD, 0xEC, 0x0C, 0x08, 0xE0, 0x14, 0x07, 0xDD, 0x1C,
+    0xED, 0xF6, 0x05, 0x26, 0x1A, 0xFB, 0x14, 0x09, 0x06, 0x25, 0x08, 0x3A,
+    0x23, 0x30, 0x0C, 0x18, 0x2B, 0x20, 0x18, 0x3D, 0x42, 0x45, 0x4A, 0x39,
+    0x2F, 0xE7, 0xFD, 0xFA, 0xF0, 0x0A, 0x22, 0x1F, 0x02, 0xD6, 0xDC, 0xB6,
+    0xC5, 0xBB, 0xE6, 0xBE, 0xBD, 0xC0, 0xC0, 0xC7, 0xEE, 0xF6, 0xE2, 0xE0,
+    0x00, 0xF9, 0x00, 0x00, 0xF0, 0xE7, 0xE4, 0x02, 0xEC, 0xF1, 0x1E, 0xE9,
+    0xF4, 0x1C, 0xFA, 0x28, 0x0F, 0x30, 0x13, 0x12, 0x2A, 0x13, 0x1E, 0x11,
+    0x13, 0x28, 0x33, 0x34, 0x26, 0x1B, 0x18, 0x16, 0x55, 0x33, 0x54, 0x2E,
+    0xF9, 0x16, 0xF2, 0xF4, 0xFE, 0x13, 0x22, 0xC8, 0xAB, 0xB9, 0xAA, 0xEB,
+    0xE3, 0xDA, 0xF2, 0xF4, 0xF2, 0xDA, 0xFB, 0xEC, 0xEA, 0xDA, 0xCE, 0xD4,
+    0xE6, 0xD2, 0xFD, 0xF1, 0xEE, 0xF5, 0x13, 0x05, 0x1D, 0xFA, 0xF6, 0xFB,
+    0xF3, 0x18, 0x12, 0x2B, 0x2D, 0x27, 0x00, 0x2C, 0x07, 0x03, 0x25, 0x3F,
+    0x34, 0x37, 0x46, 0x43, 0x47, 0x26, 0x29, 0x41, 0x3A, 0x2C, 0x31, 0xEA,
+    0xF2, 0xFA, 0xE7, 0x1A, 0xC2, 0xB6, 0xD1, 0xD9, 0xD5, 0xE2, 0xEB, 0xE0,
+    0xD3, 0xE0, 0xEE, 0xE0, 0xDE, 0xD9, 0xED, 0xF8, 0xDB, 0xDC, 0xF4, 0xD9,
+    0xD3, 0xFF, 0x08, 0xE0, 0xF0, 0x05, 0x10, 0xF2, 0x03, 0xF5, 0x27, 0x06,
+    0x00, 0x20, 0x29, 0x17, 0x27, 0xFE, 0x3B, 0x0D, 0x0E, 0x16, 0x0B, 0x24,
+    0x3D, 0x41, 0x32, 0x31, 0x28, 0x1C, 0x40, 0x4B, 0x40, 0x58, 0xFA, 0x0B,
+    0x13, 0x13, 0x0F, 0xA3, 0xA9, 0xB1, 0xDF, 0xE1, 0xBD, 0xC4, 0xE8, 0xE4,
+    0xE7, 0xE7, 0xEA, 0xE2, 0xD6, 0xEF, 0xED, 0xFD, 0xEA, 0xE7, 0xD9, 0xF2,
+    0xE0, 0xF3, 0xFF, 0xEE, 0xF8, 0xFE, 0x00, 0xED, 0x0C, 0x0A, 0xF7, 0x0A,
+    0x2A, 0x26, 0xFA, 0x0B, 0x2E, 0x33, 0x11, 0x2C, 0x10, 0x09, 0x14, 0x2A,
+    0x2C, 0x45, 0x42, 0x28, 0x30, 0x56, 0x5A, 0x35, 0x4E, 0xEF, 0xFE, 0x09,
+    0x15, 0xD4, 0xAB, 0xB6, 0xB2, 0xDA, 0xAC, 0xB2, 0xC9, 0xEB, 0xD9, 0xD0,
+    0xCE, 0xC8, 0xF8, 0xD4, 0xE4, 0xE7, 0xDE, 0xE9, 0xD3, 0xF2, 0xEE, 0xFD,
+    0xDF, 0xFB, 0x0A, 0x06, 0xE7, 0xEE, 0xFB, 0xF6, 0x0D, 0xF3, 0x24, 0x16,
+    0x16, 0x0F, 0x36, 0x23, 0x33, 0x19, 0x41, 0x07, 0x27, 0x11, 0x0E, 0x2C,
+    0x17, 0x40, 0x26, 0x1D, 0x26, 0x2F, 0x21, 0x37, 0x17, 0x0B, 0x17, 0x02,
+    0xC7, 0xC6, 0xB1, 0xE0, 0xD9, 0xD8, 0xD1, 0xB6, 0xE0, 0xE7, 0xD2, 0xEC,
+    0xF8, 0xD6, 0xEC, 0xF2, 0x00, 0x04, 0xD7, 0xF3, 0xF6, 0xE4, 0xED, 0xDE,
+    0xDB, 0x0F, 0xEE, 0x18, 0x05, 0x0F, 0xE7, 0x21, 0xFE, 0xF0, 0xFF, 0x0E,
+    0xF9, 0x09, 0x31, 0x26, 0x0F, 0x26, 0x3C, 0x12, 0x22, 0x3C, 0x3D, 0x2E,
+    0x37, 0x4E, 0x4C, 0x2D, 0x1D, 0x2E, 0x3A, 0x3C, 0x0F, 0x0E, 0x14, 0xCD,
+    0xC0, 0xB5, 0xCA, 0xA9, 0xB1, 0xB2, 0xD4, 0xE7, 0xD5, 0xC5, 0xF0, 0xD5,
+    0xC0, 0xC4, 0xD9, 0xC9, 0x01, 0xD9, 0xD2, 0xDE, 0xFE, 0x0E, 0xED, 0x12,
+    0xF6, 0xE5, 0x00, 0xFB, 0x09, 0xF6, 0x05, 0xEA, 0xF2, 0xFA, 0x0E, 0xF8,
+    0x03, 0x33, 0x29, 0x0A, 0x0E, 0x27, 0x32, 0x18, 0x1E, 0x37, 0x46, 0x4D,
+    0x22, 0x45, 0x31, 0x3C, 0x2F, 0x45, 0x5F, 0x26, 0x45, 0xFA, 0x13, 0xBB,
+    0xD9, 0xCD, 0xE0, 0xCF, 0xDE, 0xDF, 0xCB, 0xCE, 0xC7, 0xC7, 0xDA, 0xCC,
+    0xCC, 0xDF, 0xDF, 0xCE, 0xDD, 0xDC, 0xD0, 0xEC, 0xF2, 0xDA, 0xF7, 0x0E,
+    0xEA, 0xE8, 0x00, 0xEC, 0xEA, 0xFC, 0x14, 0xF3, 0x03, 0xFC, 0x0A, 0x1D,
+    0x1F, 0x13, 0x00, 0x21, 0x31, 0x0D, 0x27, 0x2C, 0x1A, 0x28, 0x2F, 0x4E,
+    0x4F, 0x2F, 0x53, 0x49, 0x55, 0x2D, 0x2B, 0x27, 0x3C, 0x0D, 0xBF, 0xAD,
+    0xB0, 0xB7, 0xA7, 0xC6, 0xB5, 0xE5, 0xB1, 0xD2, 0xBC, 0xEA, 0xC2, 0xC8,
+    0xF7, 0xC9, 0xE0, 0xE1, 0xD9, 0xDB, 0xEB, 0xFB, 0xDA, 0xD3, 0xFC, 0xED,
+    0xF6, 0xE5, 0xDF, 0x08, 0x07, 0xF6, 0xFD, 0x03, 0x00, 0xF0, 0xFC, 0x24,
+    0xFE, 0xFB, 0x05, 0x22, 0x14, 0x2A, 0x31, 0x30, 0x0E, 0x22, 0x1B, 0x33,
+    0x1B, 0x44, 0x26, 0x56, 0x47, 0x4A, 0x5A, 0x48, 0x45, 0x5C, 0xD1, 0xB2,
+    0xCC, 0xB5, 0xB2, 0xB8, 0xE4, 0xD6, 0xD5, 0xDB, 0xCD, 0xB9, 0xDD, 0xEA,
+    0xC7, 0xC4, 0xE4, 0xF6, 0xEB, 0xF8, 0xCF, 0xD6, 0xED, 0xF0, 0xE9, 0xDA,
+    0x06, 0xE9, 0x06, 0x0E, 0x06, 0x1E, 0x13, 0xFC, 0xF6, 0x01, 0x27, 0x1C,
+    0x1D, 0x00, 0x09, 0x38, 0x1B, 0x09, 0x08, 0x30, 0x2B, 0x15, 0x36, 0x2E,
+    0x25, 0x45, 0x4B, 0x4C, 0x25, 0x2A, 0x4E, 0x32, 0x40, 0x62, 0x0C, 0xD6,
+    0xCB, 0xB5, 0xAD, 0xBF, 0xBF, 0xE7, 0xE6, 0xCA, 0xDD, 0xEB, 0xCF, 0xC2,
+    0xDD, 0xEF, 0xE7, 0xE9, 0xDD, 0xF9, 0xE4, 0xFD, 0xD6, 0xE6, 0xE3, 0x0F,
+    0xEF, 0xED, 0xFF, 0xF8, 0xFB, 0x08, 0xE9, 0x13, 0x25, 0x02, 0xF4, 0x25,
+    0x1F, 0x29, 0x06, 0x00, 0x32, 0x26, 0x0D, 0x1A, 0x09, 0x2F, 0x2B, 0x23,
+    0x45, 0x1F, 0x2E, 0x37, 0x25, 0x44, 0x2E, 0x5A, 0x31, 0x4D, 0x37, 0xF6,
+    0xBC, 0xD6, 0xB9, 0xD1, 0xC7, 0xAD, 0xBC, 0xC9, 0xDE, 0xC1, 0xDF, 0xC2,
+    0xCD, 0xC2, 0xC2, 0xCB, 0xC5, 0xF7, 0xFF, 0xF8, 0xE4, 0xE5, 0xE9, 0xFA,
+    0xFE, 0xFE, 0xDC, 0xEC, 0xE6, 0x1A, 0x20, 0x07, 0xE9, 0x1E, 0x13, 0x0A,
+    0x08, 0x1B, 0x0F, 0x20, 0x31, 0x28, 0x0B, 0x34, 0x07, 0x0C, 0x17, 0x30,
+    0x48, 0x21, 0x2D, 0x30, 0x50, 0x3A, 0x36, 0x3A, 0x3A, 0x2D, 0x48, 0xF6,
+    0x0C, 0xA0, 0xB8, 0xA1, 0xA4, 0xB4, 0xCF, 0xE4, 0xBC, 0xDD, 0xDF, 0xE3,
+    0xD6, 0xD1, 0xC3, 0xF8, 0xCC, 0xF6, 0x00, 0xCE, 0x04, 0xE5, 0xD4, 0xEF,
+    0x0A, 0xE7, 0xEE, 0xFD, 0xF5, 0x02, 0x19, 0x01, 0x20, 0xF6, 0x18, 0xF7,
+    0x1D, 0xF5, 0x17, 0xFB, 0x2E, 0x01, 0x1C, 0x17, 0x1F, 0x2F, 0x32, 0x0C,
+    0x1B, 0x24, 0x4D, 0x31, 0x4C, 0x31, 0x28, 0x22, 0x50, 0x47, 0x56, 0x5C,
+    0xEC, 0x09, 0xAC, 0xC6, 0xC8, 0xA5, 0xC0, 0xAE, 0xD7, 0xE7, 0xE2, 0xD8,
+    0xC0, 0xD2, 0xD8, 0xDD, 0xE3, 0xD4, 0xC7, 0xEF, 0xEA, 0xD2, 0xCD, 0x0C,
+    0x04, 0xF1, 0xE9, 0x13, 0xFB, 0xE0, 0x17, 0x10, 0x15, 0x17, 0x04, 0xFF,
+    0x0F, 0xF5, 0x25, 0x22, 0x0D, 0x0F, 0xFE, 0x26, 0x28, 0x2D, 0x29, 0x34,
+    0x1B, 0x12, 0x20, 0x29, 0x34, 0x40, 0x39, 0x49, 0x4B, 0x28, 0x47, 0x5B,
+    0xF5, 0x11, 0x0A, 0xDB, 0xC2, 0xA8, 0xAB, 0xAF, 0xC0, 0xD1, 0xB7, 0xD8,
+    0xC6, 0xD4, 0xBD, 0xC7, 0xD7, 0xD3, 0xC9, 0xD6, 0xCC, 0xEF, 0xD3, 0xFC,
+    0xD2, 0xF6, 0xFE, 0xEF, 0xF9, 0xF7, 0xEB, 0x08, 0x00, 0xEC, 0xF6, 0x0B,
+    0xFB, 0x0A, 0x13, 0x0C, 0x0A, 0x24, 0x1A, 0x2F, 0x00, 0x29, 0x21, 0x0F,
+    0x0D, 0x2C, 0x0D, 0x32, 0x36, 0x17, 0x4A, 0x19, 0x33, 0x41, 0x33, 0x38,
+    0x48, 0x18, 0xF5, 0xFE, 0xF1, 0xB0, 0xB8, 0xCC, 0xAD, 0xAC, 0xC2, 0xBE,
+    0xB9, 0xD8, 0xC8, 0xED, 0xDC, 0xF4, 0xDD, 0xE2, 0xF7, 0xDA, 0xFB, 0x03,
+    0xF3, 0xE6, 0x0E, 0xD9, 0xFC, 0x0E, 0x12, 0xEC, 0xFC, 0x07, 0xE9, 0xEA,
+    0x10, 0x26, 0x1E, 0x16, 0xF4, 0xFC, 0x01, 0x1C, 0x09, 0x0E, 0x38, 0x21,
+    0x28, 0x34, 0x21, 0x22, 0x38, 0x15, 0x27, 0x20, 0x35, 0x1E, 0x5B, 0x45,
+    0x55, 0xF9, 0xF9, 0x03, 0x1E, 0x14, 0xC0, 0xA9, 0xAB, 0xE5, 0xB9, 0xB5,
+    0xBA, 0xB4, 0xCE, 0xBD, 0xF0, 0xDB, 0xDD, 0xE6, 0xF6, 0xEB, 0x01, 0xF6,
+    0xEE, 0xFA, 0xED, 0xE1, 0xE2, 0x0E, 0xEC, 0xE4, 0xFC, 0x1D, 0xEF, 0x21,
+    0x24, 0x08, 0x25, 0xF2, 0x2E, 0x2B, 0x11, 0x34, 0x13, 0x13, 0x1B, 0x22,
+    0x26, 0x17, 0x22, 0x20, 0x1C, 0x1B, 0x25, 0x27, 0x4B, 0x20, 0x3A, 0x1F,
+    0x21, 0x5D, 0x0C, 0xE0, 0xE7, 0xEF, 0x1B, 0xBD, 0xC0, 0xAF, 0xAC, 0xAE,
+    0xB2, 0xBF, 0xC7, 0xD3, 0xC2, 0xDE, 0xF0, 0xD0, 0xC3, 0xDB, 0xD0, 0xD1,
+    0xF9, 0xD3, 0xE8, 0xF5, 0xEA, 0xEF, 0x12, 0xFE, 0xE8, 0xE9, 0x07, 0x0E,
+    0x15, 0x02, 0x23, 0x19, 0xF2, 0x17, 0x09, 0x02, 0xFD, 0x17, 0x08, 0x28,
+    0x14, 0x11, 0x36, 0x0A, 0x0D, 0x2E, 0x2A, 0x2F, 0x2C, 0x53, 0x2E, 0x3C,
+    0x4A, 0x3D, 0x08, 0xF7, 0x0D, 0xE8, 0xFF, 0xEF, 0xA8, 0xAD, 0xC7, 0xDA,
+    0xB5, 0xB3, 0xBD, 0xB9, 0xE1, 0xDA, 0xD8, 0xE5, 0xDA, 0xE1, 0xF1, 0xCF,
+    0xCF, 0xFE, 0xEA, 0x0B, 0xE4, 0xF7, 0xD8, 0xEC, 0xDE, 0xEF, 0x1A, 0x19,
+    0xF1, 0x06, 0xF0, 0x0E, 0x11, 0x2A, 0xF6, 0x31, 0x00, 0x0A, 0x11, 0x2E,
+    0x18, 0x2C, 0x42, 0x2F, 0x1C, 0x48, 0x2F, 0x47, 0x2A, 0x45, 0x28, 0x4B,
+    0x47, 0x33, 0xE0, 0x18, 0xF9, 0xF0, 0x04, 0x05, 0x1E, 0xB4, 0xAF, 0xAE,
+    0xB5, 0xD0, 0xCA, 0xCB, 0xB6, 0xE1, 0xDB, 0xD3, 0xE2, 0xFD, 0xF3, 0xF8,
+    0xF7, 0xD2, 0xF6, 0xCE, 0xD9, 0xFD, 0x00, 0x12, 0xEB, 0xF5, 0xE5, 0x1D,
+    0x1A, 0xF0, 0x0B, 0x17, 0xFE, 0xF8, 0x0E, 0x28, 0x17, 0xFB, 0x08, 0x04,
+    0x14, 0x23, 0x0D, 0x19, 0x1A, 0x3A, 0x36, 0x1E, 0x1A, 0x1B, 0x34, 0x55,
+    0x4B, 0x4E, 0xE3, 0x16, 0xE3, 0xE5, 0x1F, 0xEB, 0x1E, 0xFE, 0xD8, 0xA8,
+    0xC1, 0xD8, 0xBB, 0xB6, 0xE2, 0xB6, 0xC3, 0xC6, 0xD7, 0xEC, 0xFA, 0xF5,
+    0xE4, 0xF0, 0xD9, 0xD0, 0xDD, 0x02, 0xFA, 0xEA, 0xF7, 0x16, 0x02, 0x03,
+    0x06, 0xF9, 0xF5, 0xF4, 0x01, 0x22, 0x00, 0x0D, 0x08, 0x19, 0x0B, 0x26,
+    0x13, 0x30, 0x3F, 0x12, 0x44, 0x31, 0x35, 0x30, 0x2B, 0x48, 0x28, 0x37,
+    0x3D, 0x48, 0x0B, 0xF2, 0xFA, 0xE2, 0xF7, 0x1A, 0x01, 0x1A, 0xDB, 0xB5,
+    0xE3, 0xCB, 0xBC, 0xB2, 0xEC, 0xDC, 0xC5, 0xC2, 0xC2, 0xDC, 0xC5, 0xDB,
+    0x00, 0xF7, 0xF1, 0x00, 0xF0, 0xE5, 0xF2, 0xE0, 0xDE, 0x11, 0x18, 0x1B,
+    0xEE, 0xFF, 0xED, 0xF5, 0x01, 0x2A, 0x16, 0x25, 0x06, 0x00, 0x0C, 0x1B,
+    0x21, 0x08, 0x08, 0x1A, 0x31, 0x3A, 0x37, 0x4B, 0x2A, 0x36, 0x2B, 0x24,
+    0x28, 0xE6, 0xE1, 0xE9, 0xE1, 0x15, 0xFD, 0xEA, 0x1A, 0xFE, 0xC4, 0xDC,
+    0xD9, 0xC1, 0xDB, 0xED, 0xE1, 0xCD, 0xD8, 0xDB, 0xF0, 0xF4, 0xC3, 0xE1,
+    0xCE, 0xF7, 0xF9, 0xDF, 0xFC, 0xF3, 0x04, 0x14, 0xE2, 0xED, 0x00, 0x14,
+    0x14, 0x09, 0x04, 0xF7, 0xF9, 0x0E, 0x21, 0x1E, 0x30, 0x0A, 0x25, 0x25,
+    0x0F, 0x2C, 0x18, 0x3F, 0x32, 0x19, 0x13, 0x4B, 0x40, 0x1A, 0x2F, 0x1F,
+    0xDB, 0xF3, 0x08, 0x09, 0x10, 0x14, 0x22, 0x16, 0xF3, 0x1D, 0xBD, 0xD5,
+    0xBB, 0xD1, 0xB6, 0xEA, 0xC9, 0xEA, 0xC1, 0xD5, 0xF9, 0xCC, 0xC5, 0xE2,
+    0xED, 0xE8, 0xDC, 0xF2, 0xDB, 0xE0, 0x0F, 0xEC, 0x10, 0x06, 0x0C, 0xE8,
+    0x1B, 0xF3, 0x19, 0xF6, 0xF3, 0xFF, 0x11, 0x18, 0x0D, 0x13, 0x1B, 0x1F,
+    0x06, 0x2F, 0x18, 0x43, 0x26, 0x12, 0x4A, 0x3E, 0x2C, 0x54, 0x45, 0xF3,
+    0x15, 0xE0, 0xDE, 0xE8, 0xFC, 0x0C, 0x19, 0x07, 0x1C, 0xFA, 0xD6, 0xE4,
+    0xC6, 0xC7, 0xE9, 0xD8, 0xCF, 0xE5, 0xD3, 0xCB, 0xC5, 0xE9, 0xC8, 0xEE,
+    0xFB, 0xD1, 0xE9, 0x0C, 0x11, 0xEB, 0x02, 0xE2, 0x19, 0xF0, 0x10, 0x16,
+    0x25, 0x26, 0x1A, 0x1F, 0xF6, 0x27, 0x20, 0x1A, 0x1C, 0x09, 0x2D, 0x3B,
+    0x1B, 0x38, 0x25, 0x35, 0x15, 0x26, 0x50, 0x3D, 0x2E, 0xE0, 0x09, 0x07,
+    0x0C, 0x04, 0xFD, 0xE7, 0xFC, 0x1B, 0xF3, 0x19, 0xF8, 0xB5, 0xDA, 0xCD,
+    0xC7, 0xD4, 0xE9, 0xF5, 0xC6, 0xC7, 0xCC, 0xDD, 0xCE, 0xF0, 0xD2, 0xEF,
+    0xFD, 0x02, 0xF7, 0x13, 0x00, 0xED, 0xF2, 0xE5, 0x03, 0x10, 0xEE, 0x17,
+    0x18, 0xFD, 0x20, 0x00, 0x07, 0x19, 0x0C, 0x19, 0x1E, 0x12, 0x35, 0x2A,
+    0x12, 0x41, 0x49, 0x21, 0x4A, 0x1C, 0x3F, 0xEA, 0xDC, 0xF5, 0xDC, 0xE6,
+    0xE9, 0xEF, 0x1A, 0xFE, 0x14, 0xF9, 0xF2, 0xE0, 0xB5, 0xCE, 0xB6, 0xD8,
+    0xEB, 0xC8, 0xBC, 0xC8, 0xDB, 0xD5, 0xE3, 0x01, 0xD5, 0xCF, 0xE8, 0x05,
+    0xF4, 0xDD, 0x04, 0xFD, 0x0C, 0xFB, 0x15, 0xF1, 0x21, 0xF9, 0x0F, 0x08,
+    0xF2, 0xF6, 0x2E, 0x2F, 0x22, 0x05, 0x20, 0x1A, 0x1B, 0x43, 0x36, 0x44,
+    0x49, 0x15, 0x36, 0x48, 0x45, 0x00, 0xDD, 0xF4, 0x0C, 0xEC, 0xF7, 0x15,
+    0x0C, 0x04, 0xF9, 0x13, 0xF3, 0xC9, 0xB0, 0xE9, 0xD3, 0xD1, 0xF4, 0xD7,
+    0xF3, 0xD7, 0xC8, 0xE8, 0xDD, 0xE1, 0xEB, 0x08, 0xE7, 0xF3, 0xFC, 0xF0,
+    0x01, 0x00, 0xE4, 0xFF, 0xEB, 0x06, 0xEE, 0x05, 0x16, 0x1E, 0x24, 0x1A,
+    0x2B, 0x24, 0x2A, 0x13, 0x25, 0x36, 0x3A, 0x2D, 0x26, 0x12, 0x1B, 0x34,
+    0x20, 0x2C, 0xFF, 0xFE, 0xDC, 0xF8, 0x0A, 0xFC, 0x15, 0xEF, 0x1F, 0xF0,
+    0x02, 0x26, 0x1C, 0xCE, 0xB5, 0xBA, 0xBE, 0xD8, 0xE6, 0xBC, 0xEC, 0xD1,
+    0xE5, 0xF2, 0xF4, 0xD4, 0xD4, 0xFA, 0x01, 0x06, 0xD8, 0x0D, 0xEE, 0x05,
+    0xE5, 0xF0, 0x0F, 0x12, 0x26, 0x04, 0xF3, 0x08, 0x1D, 0x04, 0x02, 0x08,
+    0x34, 0x33, 0x35, 0x32, 0x3B, 0x37, 0x24, 0x27, 0x45, 0x47, 0xE7, 0x00,
+    0x03, 0xF2, 0x06, 0xF7, 0x16, 0x05, 0x07, 0x13, 0xF3, 0xEE, 0x23, 0x0D,
+    0xB1, 0xE4, 0xB5, 0xE4, 0xCC, 0xC0, 0xE2, 0xBF, 0xD3, 0xFF, 0xCF, 0xFD,
+    0xDB, 0xDE, 0xE0, 0xDF, 0x05, 0xE2, 0xF5, 0x02, 0x18, 0x08, 0xF7, 0x03,
+    0x1B, 0xEE, 0x08, 0x1D, 0x18, 0x13, 0x2F, 0x12, 0x16, 0x1F, 0x24, 0x1D,
+    0x3B, 0x31, 0x28, 0x36, 0x4C, 0x26, 0x30, 0xF5, 0xD6, 0x00, 0x03, 0x00,
+    0xEA, 0x0C, 0xFB, 0xF5, 0x03, 0x07, 0x11, 0x15, 0x26, 0xCF, 0xB5, 0xE9,
+    0xE8, 0xD3, 0xBC, 0xD2, 0xEF, 0xF2, 0xD4, 0xD7, 0xFC, 0xDB, 0x04, 0xF7,
+    0xDA, 0x01, 0x15, 0x0B, 0xE0, 0x02, 0x0B, 0x06, 0x12, 0xFD, 0x26, 0xF3,
+    0x0F, 0xF9, 0x2C, 0x2B, 0x05, 0x36, 0x25, 0x1C, 0x2E, 0x3A, 0x46, 0x3C,
+    0x4D, 0x26, 0x09, 0x01, 0x00, 0x11, 0x02, 0xF0, 0x06, 0x19, 0xE8, 0x0B,
+    0x00, 0x24, 0x0A, 0x07, 0x25, 0x0E, 0xBE, 0xD9, 0xC2, 0xD8, 0xC7, 0xD4,
+    0xD1, 0xD8, 0xFA, 0xDB, 0xFE, 0xDB, 0xD7, 0xE6, 0xF2, 0xEB, 0xFA, 0x10,
+    0xF4, 0x1C, 0x0A, 0xF0, 0x00, 0x0A, 0x22, 0x27, 0x18, 0xF9, 0x04, 0x0E,
+    0x25, 0x21, 0x3A, 0x38, 0x38, 0x18, 0x34, 0x46, 0x4A, 0x1D, 0xEC, 0x07,
+    0xF1, 0x13, 0x04, 0xE7, 0x0C, 0xFC, 0xF1, 0xF9, 0x0C, 0xFB, 0xF6, 0xFF,
+    0x0D, 0xD5, 0xD9, 0xE2, 0xD0, 0xBD, 0xC9, 0xDF, 0xCE, 0xF4, 0xC8, 0xCF,
+    0xFD, 0xD6, 0xD1, 0xF5, 0xE0, 0xF5, 0xDF, 0xE2, 0x06, 0xE9, 0xED, 0x0A,
+    0x07, 0x04, 0xFE, 0x03, 0x2E, 0x2E, 0x17, 0x0D, 0x38, 0x06, 0x2C, 0x38,
+    0x0A, 0x0F, 0x1E, 0x2B, 0xDF, 0xE3, 0xD7, 0x05, 0xFB, 0x08, 0x11, 0x06,
+    0x07, 0x08, 0xF1, 0xFF, 0x1E, 0x1B, 0xFF, 0x0D, 0x23, 0xEA, 0xBB, 0xD6,
+    0xCC, 0xF8, 0xC8, 0xEB, 0xD5, 0xFE, 0xDA, 0xDB, 0x02, 0xE0, 0xF3, 0x04,
+    0x03, 0x16, 0x00, 0xF8, 0xF8, 0x03, 0x00, 0x23, 0xF3, 0x06, 0x05, 0x31,
+    0x13, 0x19, 0xFE, 0x36, 0x14, 0x0F, 0x13, 0x2B, 0x2D, 0x36, 0x21, 0xDF,
+    0xD6, 0xD5, 0xF1, 0x00, 0xF7, 0xF8, 0xF0, 0x06, 0x09, 0xF9, 0x03, 0xFD,
+    0x1F, 0x2B, 0x2C, 0x22, 0xC3, 0xEC, 0xCD, 0xE7, 0xEE, 0xEE, 0xEF, 0xD5,
+    0xF9, 0xD4, 0xD9, 0xFD, 0x0A, 0x06, 0x0C, 0x04, 0x11, 0xE4, 0x17, 0xE7,
+    0xFE, 0x0D, 0x1B, 0x25, 0x24, 0x0B, 0xFB, 0xFD, 0x13, 0x38, 0x19, 0x32,
+    0x1B, 0x26, 0x13, 0x29, 0x25, 0xDA, 0x04, 0xE1, 0xF6, 0x0A, 0xDF, 0xE4,
+    0xEA, 0x0A, 0x17, 0x0B, 0x00, 0x1E, 0x11, 0x2A, 0x26, 0x20, 0xB9, 0xE1,
+    0xDF, 0xF3, 0xEA, 0xCD, 0xDD, 0xD7, 0x01, 0xF9, 0xDC, 0xE9, 0x09, 0xD5,
+    0xF8, 0xE6, 0xF6, 0xE6, 0x1D, 0xF8, 0x02, 0x0C, 0xFC, 0x1C, 0xF6, 0xF9,
+    0xFF, 0xFD, 0x09, 0x31, 0x3C, 0x27, 0x39, 0x13, 0x25, 0x1B, 0xCC, 0xED,
+    0xFC, 0x00, 0xE2, 0x06, 0xF6, 0x0B, 0xF5, 0x18, 0xFC, 0xEB, 0xF3, 0x1F,
+    0x1D, 0x12, 0x26, 0x15, 0x1E, 0xEA, 0xCD, 0xD3, 0xE4, 0xD1, 0xC5, 0xF7,
+    0xE3, 0x05, 0xF1, 0xE3, 0xF0, 0xF5, 0xF8, 0xF5, 0x19, 0xEC, 0xEA, 0xFB,
+    0x1F, 0xED, 0xFA, 0xF3, 0x19, 0x08, 0x25, 0x27, 0x27, 0x2C, 0x30, 0x22,
+    0x1B, 0x23, 0x3E, 0x21, 0xDD, 0x04, 0xDA, 0xFA, 0x0E, 0xF6, 0x0E, 0xE1,
+    0xEB, 0x0F, 0xFC, 0xF1, 0x22, 0x01, 0x0D, 0x2E, 0x2F, 0x2C, 0xB6, 0xD0,
+    0xD0, 0xE1, 0xF5, 0xF2, 0xD2, 0x00, 0xE7, 0x05, 0xEF, 0xFA, 0xF4, 0xEF,
+    0x00, 0xE0, 0xE4, 0x1C, 0x1C, 0x00, 0x21, 0x09, 0x2A, 0x29, 0x25, 0x29,
+    0x06, 0x37, 0x0D, 0x36, 0x1D, 0x2A, 0x2E, 0x40, 0xDE, 0xFC, 0xE8, 0xFC,
+    0xE2, 0xEB, 0x0D, 0x17, 0x0E, 0xE2, 0xF9, 0x0B, 0x0A, 0x19, 0x0F, 0x10,
+    0xF7, 0x1B, 0x2D, 0xBE, 0xC3, 0xE4, 0xCF, 0xCB, 0xE2, 0xD8, 0x01, 0xEC,
+    0xE8, 0xD4, 0xE0, 0xE7, 0x05, 0x0A, 0x07, 0x1B, 0xEE, 0x08, 0xEC, 0x1C,
+    0x20, 0x0A, 0x23, 0x28, 0x23, 0x0E, 0x09, 0x22, 0x27, 0x3C, 0x19, 0x31,
+    0x18, 0xE5, 0xD7, 0xEA, 0xEF, 0x04, 0x08, 0xDB, 0x0A, 0xFB, 0x14, 0x01,
+    0xFC, 0xEE, 0x21, 0xFF, 0x29, 0xF7, 0x0D, 0x00, 0xCC, 0xEE, 0xF6, 0xD1,
+    0xF2, 0xE3, 0xD1, 0xD0, 0xF0, 0x07, 0xFB, 0x0E, 0x09, 0x01, 0xE3, 0xE9,
+    0xE7, 0xF3, 0x1B, 0xFA, 0x21, 0x03, 0xF5, 0xFB, 0x2C, 0x06, 0x26, 0x1B,
+    0x1C, 0x3F, 0x32, 0x11, 0x34, 0xE9, 0xD5, 0xF5, 0xEC, 0xF6, 0xDE, 0x0F,
+    0x01, 0x0C, 0x01, 0x05, 0xF9, 0x05, 0x22, 0x19, 0x00, 0x07, 0x2B, 0x10,
+    0x1D, 0xBB, 0xF2, 0xD0, 0xED, 0xC9, 0xD4, 0xEF, 0x00, 0xFA, 0xE3, 0xE6,
+    0xFF, 0xE9, 0x04, 0xE2, 0x19, 0x0B, 0x06, 0x03, 0x02, 0x12, 0x20, 0x1A,
+    0x17, 0x04, 0x1C, 0x36, 0x2F, 0x1C, 0x10, 0x2B, 0xEA, 0xD8, 0xD3, 0x00,
+    0xED, 0xF2, 0x12, 0xEB, 0x0B, 0x09, 0x0B, 0x0D, 0x15, 0x02, 0xF7, 0xF8,
+    0x0D, 0x1B, 0x17, 0x07, 0x12, 0xC2, 0xE9, 0xED, 0xFE, 0xED, 0xD9, 0xE2,
+    0x01, 0xDF, 0x07, 0xE2, 0xE5, 0xFF, 0xE3, 0xF2, 0x12, 0xF3, 0xF5, 0x20,
+    0xF2, 0x04, 0x14, 0x16, 0xFD, 0x0D, 0x2C, 0x1A, 0x39, 0x34, 0x31, 0xF5,
+    0xD7, 0xD1, 0xD3, 0xE2, 0xF8, 0xF7, 0xF3, 0xF2, 0x17, 0xE7, 0x15, 0xFB,
+    0x0F, 0xF6, 0x03, 0x0A, 0x1D, 0x30, 0x15, 0x17, 0x27, 0xD5, 0xC6, 0xF9,
+    0xC4, 0xCD, 0xE9, 0xFB, 0xD7, 0xF1, 0xFF, 0x0B, 0xF1, 0xEF, 0xE7, 0xE9,
+    0xF2, 0x0C, 0x12, 0x20, 0xF1, 0xF5, 0x10, 0x22, 0x02, 0x07, 0x0B, 0x3B,
+    0x21, 0x10, 0xD0, 0x00, 0xE2, 0xF4, 0xF1, 0xD3, 0x07, 0xFE, 0x08, 0xDE,
+    0xFD, 0x1B, 0xF7, 0xFB, 0x16, 0xFF, 0xFD, 0x02, 0xFA, 0x1C, 0x27, 0x0E,
+    0xD3, 0xC8, 0xCB, 0xD0, 0xE1, 0xD8, 0x00, 0xFA, 0xD4, 0x08, 0x0A, 0xF9,
+    0x0E, 0x18, 0xF0, 0xF9, 0x02, 0xF8, 0x13, 0xF4, 0x15, 0x03, 0xFF, 0x34,
+    0x2D, 0x04, 0x30, 0x13, 0x09, 0xFB, 0xCB, 0xD4, 0x04, 0xE3, 0xE4, 0xEE,
+    0xE8, 0xEA, 0x0E, 0xE9, 0x10, 0x19, 0xFD, 0x14, 0xF0, 0x0E, 0x29, 0xFB,
+    0x09, 0x20, 0x00, 0x17, 0xDF, 0xF9, 0xDB, 0xD3, 0xD7, 0x04, 0xFF, 0xDC,
+    0x05, 0x01, 0x04, 0xE1, 0xEB, 0x05, 0xEE, 0x1B, 0x20, 0xF3, 0x14, 0x01,
+    0x18, 0x22, 0x1E, 0x10, 0x0D, 0x3C, 0x14, 0x16, 0xCB, 0xCA, 0x00, 0xEE,
+    0xF4, 0x00, 0xE4, 0xF9, 0xE3, 0x10, 0x0D, 0xE9, 0x09, 0x17, 0x10, 0xFD,
+    0x16, 0x1D, 0x07, 0x09, 0x36, 0x22, 0x26, 0xDB, 0xF0, 0xE6, 0xEF, 0xF3,
+    0xF7, 0xD0, 0xD5, 0x09, 0x0F, 0x04, 0xE0, 0x10, 0x0E, 0xF9, 0xF9, 0xF9,
+    0xF0, 0xF8, 0xF7, 0x27, 0x26, 0x2D, 0x31, 0x3B, 0x31, 0x0D, 0xF6, 0xE0,
+    0xED, 0x06, 0x07, 0xE2, 0x01, 0xEB, 0xEC, 0x16, 0x09, 0xE4, 0x17, 0x06,
+    0xEE, 0x0D, 0x25, 0x04, 0x0C, 0x2A, 0x13, 0x02, 0x0F, 0xC2, 0xE9, 0xC8,
+    0xD4, 0x00, 0xFE, 0xE2, 0xFE, 0xFC, 0xEF, 0xE0, 0xE3, 0x19, 0xF4, 0x00,
+    0x03, 0x07, 0x16, 0x09, 0xF7, 0x21, 0xFE, 0x36, 0x26, 0x1E, 0x19, 0x2B,
+    0xE5, 0xEA, 0xCD, 0x00, 0x02, 0xD5, 0x0C, 0xFF, 0xF6, 0xEE, 0xE2, 0xF1,
+    0x08, 0x03, 0x12, 0x22, 0x26, 0x00, 0x1D, 0x0F, 0x11, 0x26, 0x1C, 0x34,
+    0xCE, 0xE5, 0xF4, 0xD0, 0xCF, 0xD0, 0xFA, 0xF4, 0xE5, 0x07, 0xEB, 0xED,
+    0xF6, 0xE9, 0x21, 0xF2, 0xF5, 0x13, 0x06, 0x08, 0x14, 0x00, 0x12, 0x39,
+    0x2E, 0xF5, 0xCB, 0xF6, 0xD4, 0xDD, 0xE7, 0xEC, 0xE5, 0xF5, 0xDC, 0xE5,
+    0x08, 0xF9, 0xF5, 0x00, 0x02, 0x13, 0x0C, 0x16, 0x11, 0x0A, 0x02, 0x37,
+    0x06, 0x1F, 0xDE, 0xFF, 0xE0, 0xF9, 0xF4, 0xE5, 0xE6, 0x09, 0x10, 0xF8,
+    0xE3, 0xEA, 0xF8, 0x1E, 0xF1, 0xF4, 0x28, 0x1B, 0x04, 0x0F, 0x02, 0x29,
+    0x2F, 0x21, 0x21, 0xCD, 0xF5, 0xD4, 0xFB, 0xFD, 0x03, 0x0C, 0xED, 0xED,
+    0xF3, 0x01, 0xFC, 0x0D, 0x02, 0x05, 0xF9, 0x1B, 0xFA, 0x10, 0xF8, 0x23,
+    0x30, 0x13, 0x18, 0x06, 0xD6, 0xDB, 0xFE, 0xEB, 0xDD, 0xFA, 0xDE, 0xE0,
+    0x09, 0xE0, 0x04, 0x09, 0xF4, 0x12, 0xEF, 0x21, 0x01, 0x24, 0x24, 0x2F,
+    0x2E, 0x2A, 0x0C, 0x1C, 0xC8, 0xC4, 0xD7, 0xE7, 0x00, 0xF9, 0xE1, 0xE2,
+    0xF9, 0x07, 0xDF, 0xF2, 0xE8, 0xEE, 0xF6, 0x1E, 0x1D, 0x2A, 0x23, 0x29,
+    0x27, 0x16, 0x09, 0x10, 0x2B, 0x1E, 0xE2, 0xF7, 0xEA, 0xFF, 0xF3, 0x08,
+    0xD6, 0x02, 0xDD, 0xE0, 0x00, 0xFB, 0xF8, 0xEF, 0xF1, 0x03, 0x20, 0xF5,
+    0x11, 0x06, 0x11, 0x01, 0x23, 0xF4, 0xF2, 0xFC, 0xDB, 0xE0, 0xDE, 0xD1,
+    0xF1, 0x00, 0xEB, 0xF5, 0x18, 0x03, 0x0B, 0xF2, 0x00, 0x09, 0x22, 0x2A,
+    0x0A, 0x11, 0x34, 0x07, 0x0D, 0x01, 0x0B, 0x09, 0xF2, 0xE8, 0xF9, 0xDC,
+    0xEE, 0x04, 0xE0, 0xDF, 0x07, 0x08, 0x12, 0xE8, 0xF1, 0x20, 0x0F, 0x09,
+    0x11, 0x06, 0x0D, 0x00, 0x03, 0x0B, 0xD7, 0xDD, 0xE4, 0xDC, 0xD8, 0xF1,
+    0xFD, 0x08, 0xE9, 0x0C, 0xEC, 0x16, 0xE9, 0x1A, 0x14, 0x1B, 0x04, 0xFC,
+    0x19, 0x02, 0x00, 0x2A, 0x11, 0x0E, 0x33, 0x19, 0x27, 0xF0, 0xDE, 0xFA,
+    0xE0, 0x00, 0x00, 0xF0, 0xEA, 0xE6, 0x0A, 0x18, 0xF0, 0x1E, 0xEE, 0xFD,
+    0xFA, 0x06, 0x18, 0xF8, 0x2B, 0x21, 0x1D, 0xF6, 0xEB, 0xC7, 0xCB, 0xEB,
+    0xF7, 0xFB, 0xE4, 0xFC, 0xE0, 0xF0, 0x0F, 0xF0, 0xF0, 0x01, 0x0D, 0xFF,
+    0x13, 0x20, 0xF8, 0x0E, 0x0A, 0x0F, 0x37, 0x35, 0x21, 0x3C, 0x1A, 0xCC,
+    0x02, 0x01, 0xF1, 0x09, 0xFF, 0xFA, 0x09, 0x11, 0xFB, 0xE9, 0x02, 0xF4,
+    0x25, 0xFA, 0xFD, 0x13, 0x2F, 0x26, 0x01, 0x26, 0xC8, 0xC1, 0xE0, 0xEA,
+    0xC8, 0xF3, 0xD9, 0xD4, 0x0D, 0xDF, 0x12, 0xE5, 0xED, 0xF6, 0xFF, 0x03,
+    0x1D, 0x24, 0xFC, 0x14, 0x14, 0x1E, 0xFB, 0x1D, 0x1A, 0x04, 0x12, 0x26,
+    0xDE, 0xFD, 0x03, 0xCF, 0xFA, 0xD6, 0xEA, 0xE5, 0x0B, 0x0A, 0xFC, 0x15,
+    0xF5, 0x05, 0x00, 0xFD, 0x14, 0x07, 0x03, 0x06, 0x26, 0xEA, 0xC4, 0xFC,
+    0xFF, 0x00, 0xF1, 0xEE, 0x01, 0xE6, 0xF0, 0xDE, 0x0E, 0xEF, 0xF6, 0xF1,
+    0xFD, 0xF4, 0x08, 0x1E, 0x01, 0xF9, 0xF8, 0x0D, 0xFD, 0x0A, 0x0B, 0x0E,
+    0x3E, 0x19, 0x02, 0xD1, 0xD0, 0xD3, 0x07, 0x0E, 0xE7, 0x16, 0x0C, 0x1B,
+    0x09, 0x12, 0xFF, 0x08, 0x29, 0xFF, 0x29, 0x20, 0x10, 0x35, 0xEB, 0xE7,
+    0xFD, 0xEE, 0xD3, 0xCC, 0x01, 0xD3, 0x07, 0x0C, 0xE0, 0xF5, 0x02, 0xF3,
+    0x1A, 0x05, 0x16, 0xEE, 0xF8, 0x29, 0x29, 0x11, 0x23, 0x31, 0x28, 0x13,
+    0x2C, 0x32, 0x45, 0xFD, 0xF8, 0xEF, 0xD4, 0xDC, 0xF6, 0xE1, 0x0C, 0xF0,
+    0x1C, 0x12, 0xF7, 0x1A, 0x19, 0x21, 0x07, 0x1D, 0x0C, 0x16, 0xDF, 0xEE,
+    0xF3, 0xED, 0xE1, 0xD7, 0xE7, 0x02, 0xE4, 0xF1, 0x0B, 0xEC, 0x0D, 0x12,
+    0x19, 0x19, 0x18, 0xEF, 0xFF, 0x0C, 0x14, 0x0C, 0x1A, 0x0B, 0x1E, 0x30,
+    0x1D, 0x35, 0x1D, 0x39, 0xE0, 0xF2, 0xDE, 0xDD, 0x06, 0xFD, 0xFA, 0xF6,
+    0xFC, 0xF6, 0x02, 0x1A, 0xF1, 0xF7, 0x17, 0xF7, 0x0F, 0x2E, 0x04, 0xF0,
+    0xD9, 0xC9, 0xFA, 0xE8, 0xE3, 0xCE, 0xCE, 0xEA, 0x06, 0xFA, 0xFC, 0x12,
+    0x00, 0xFD, 0x17, 0x1C, 0xF1, 0xF1, 0x19, 0x19, 0x18, 0x1A, 0x0D, 0x21,
+    0x10, 0x3A, 0x31, 0x40, 0x0D, 0xFB, 0xD6, 0xD4, 0xFB, 0x00, 0xF5, 0xE6,
+    0xDD, 0x12, 0x06, 0xF9, 0xF7, 0x09, 0xFC, 0xFD, 0xFE, 0xF7, 0xFD, 0x31,
+    0xDB, 0xBE, 0xD3, 0xEE, 0xF1, 0xEA, 0xDA, 0x05, 0xE8, 0xF9, 0x0F, 0x07,
+    0xDD, 0xF9, 0x0C, 0xE5, 0x06, 0x1F, 0x13, 0x28, 0x01, 0x16, 0x04, 0x0D,
+    0x1A, 0x2B, 0x3B, 0x3B, 0x37, 0x22, 0x2B, 0xE4, 0x06, 0xDF, 0xD7, 0x0A,
+    0xFE, 0x01, 0xE2, 0xED, 0xFB, 0x0D, 0xEF, 0xFF, 0xF5, 0xF9, 0x1A, 0x00,
+    0xE7, 0xDC, 0xC0, 0xE3, 0xDC, 0xC6, 0xD9, 0xCF, 0xCE, 0xF2, 0xDB, 0xE1,
+    0xF5, 0xEF, 0x02, 0x0F, 0xF4, 0xEF, 0x1C, 0xFB, 0x02, 0x1C, 0x0A, 0x01,
+    0x0E, 0x08, 0x19, 0x0B, 0x0D, 0x12, 0x24, 0x2E, 0xE6, 0xD0, 0x00, 0x02,
+    0x0D, 0xDF, 0x00, 0xE4, 0x00, 0xF6, 0x14, 0x11, 0x0F, 0xFD, 0x20, 0x27,
+    0x0D, 0xD2, 0xD2, 0xEB, 0xF8, 0xD0, 0xF2, 0xDF, 0xDF, 0xD4, 0xF3, 0xE3,
+    0xE9, 0x0A, 0x0D, 0xF6, 0x03, 0xFD, 0x08, 0x02, 0xEF, 0x12, 0x26, 0xF8,
+    0x1E, 0x12, 0x02, 0x04, 0x1A, 0x3B, 0x0E, 0x2B, 0x14, 0x3D, 0xE4, 0xDC,
+    0xF2, 0xF7, 0xE8, 0xF8, 0x11, 0xED, 0xF9, 0xFC, 0x22, 0x11, 0x01, 0x2D,
+    0x04, 0x20, 0xB7, 0xE5, 0xDA, 0xDF, 0xFC, 0xDC, 0xFC, 0xDF, 0x06, 0xDA,
+    0xDE, 0xF7, 0x10, 0xE8, 0x0B, 0xFA, 0x0A, 0xFD, 0x07, 0x0E, 0x1B, 0x05,
+    0x2B, 0x28, 0x10, 0x0C, 0x25, 0x05, 0x2E, 0x19, 0x25, 0x14, 0x15, 0xE0,
+    0xD2, 0xFB, 0xEC, 0xE9, 0xDD, 0xF7, 0xF3, 0x0F, 0xF8, 0x03, 0x0B, 0x1C,
+    0x2C, 0x0D, 0x18, 0xE4, 0xCC, 0xBF, 0xCA, 0xD6, 0xC6, 0xFC, 0xEF, 0x04,
+    0xDF, 0xD7, 0xE1, 0xE6, 0xF7, 0xEC, 0xEF, 0x00, 0xFA, 0x06, 0x0F, 0x08,
+    0xF9, 0x27, 0xF9, 0x00, 0x0F, 0x28, 0x1E, 0x16, 0x35, 0x29, 0x35, 0x34,
+    0x1F, 0xE3, 0xF0, 0xFC, 0x0F, 0xE0, 0x09, 0xE2, 0x09, 0xE9, 0xF2, 0x13,
+    0xF8, 0xFD, 0x06, 0x0C, 0xEE, 0xE2, 0xF1, 0xEE, 0xD1, 0xF3, 0xFA, 0xCB,
+    0xFA, 0x01, 0xFA, 0xE8, 0xD9, 0x05, 0xF1, 0xFF, 0x09, 0xF3, 0xEC, 0x15,
+    0x1E, 0x23, 0x25, 0x28, 0x13, 0x1C, 0x2E, 0x28, 0x22, 0x21, 0x2B, 0x3D,
+    0x15, 0x12, 0xDC, 0xDF, 0xDE, 0xF2, 0x00, 0xE3, 0x00, 0x02, 0xF1, 0xFA,
+    0x22, 0xFF, 0xF6, 0x0C, 0x18, 0xCD, 0xEE, 0xF4, 0xE6, 0xCB, 0xDC, 0xEC,
+    0x02, 0xDB, 0xFE, 0xD3, 0xEB, 0xEE, 0xFE, 0xE7, 0x16, 0xFF, 0xE4, 0xEA,
+    0x20, 0xF7, 0xFD, 0x1E, 0x0D, 0x23, 0x0B, 0x09, 0x28, 0x11, 0x38, 0x0D,
+    0x1D, 0x43, 0x42, 0x22, 0x04, 0x0D, 0xF9, 0x05, 0x12, 0x04, 0x0F, 0x1C,
+    0x21, 0xF0, 0xF1, 0x06, 0x00, 0x25, 0xC7, 0xE4, 0xDE, 0xC2, 0xEB, 0xED,
+    0xD6, 0xDA, 0xFF, 0xDE, 0xDB, 0xE9, 0xE6, 0xDF, 0xEB, 0xFD, 0x16, 0x0B,
+    0xFB, 0xF1, 0x05, 0x05, 0x0F, 0x1B, 0x2E, 0x31, 0x30, 0x1D, 0x2F, 0x13,
+    0x0D, 0x23, 0x3B, 0x12, 0x42, 0x2C, 0xE8, 0xDD, 0x04, 0xEB, 0x13, 0x0F,
+    0xE8, 0xF3, 0x13, 0xEE, 0xFE, 0x11, 0x16, 0xE3, 0xE7, 0xD0, 0xD8, 0xE2,
+    0xF0, 0xC5, 0xEF, 0xD7, 0xFE, 0xDF, 0xFA, 0x0A, 0xEE, 0xE3, 0xE1, 0x04,
+    0x01, 0xFC, 0x0B, 0xF7, 0x17, 0x01, 0xF8, 0x13, 0x23, 0x32, 0x09, 0x00,
+    0x32, 0x32, 0x07, 0x18, 0x32, 0x23, 0x1D, 0x38, 0xF7, 0x05, 0xE2, 0xE9,
+    0x10, 0xFB, 0x14, 0x19, 0x0C, 0xF4, 0x27, 0x07, 0x18, 0xED, 0xEE, 0xBF,
+    0xD7, 0xF4, 0xC9, 0xF4, 0xDB, 0xE2, 0xF1, 0xF3, 0xE4, 0x06, 0x0F, 0xFD,
+    0xEB, 0x03, 0x0A, 0x07, 0x08, 0x21, 0x08, 0x02, 0x2B, 0x2C, 0x2F, 0x14,
+    0x2A, 0x1A, 0x0B, 0x2B, 0x07, 0x1F, 0x33, 0x11, 0x33, 0x35, 0xD6, 0xF4,
+    0x0B, 0xED, 0xE6, 0x19, 0x18, 0x0F, 0xF3, 0x01, 0xFE, 0xF3, 0xCB, 0xD2,
+    0xDC, 0xCC, 0xD1, 0xCF, 0xD2, 0xF6, 0xDE, 0xE9, 0xFB, 0xD7, 0xE4, 0x00,
+    0x01, 0xFA, 0x03, 0xFF, 0x0D, 0xF9, 0xEE, 0x08, 0xF9, 0x0C, 0x22, 0xF7,
+    0x08, 0x2A, 0x14, 0x38, 0x08, 0x17, 0x25, 0x3E, 0x41, 0x2F, 0x22, 0x46,
+    0xD7, 0xEA, 0xEC, 0x11, 0x06, 0x15, 0xFE, 0x07, 0x08, 0xF6, 0x1C, 0x21,
+    0xD6, 0xE7, 0xC8, 0xC3, 0xC0, 0xDB, 0xD9, 0xE1, 0xF5, 0xC9, 0x05, 0x01,
+    0xEC, 0xDA, 0x04, 0x00, 0xE0, 0x08, 0x0B, 0xF6, 0xEA, 0xF8, 0xF2, 0xFE,
+    0x1F, 0xFF, 0xFD, 0x22, 0x28, 0x2D, 0x25, 0x18, 0x2B, 0x3D, 0x1B, 0x3E,
+    0x2C, 0x3C, 0x46, 0x07, 0x09, 0x03, 0x0F, 0x0A, 0x11, 0xEA, 0xF4, 0x15,
+    0x24, 0x28, 0xBF, 0xDD, 0xCB, 0xE2, 0xC7, 0xD3, 0xD2, 0xF2, 0xD0, 0xE8,
+    0xE4, 0xF5, 0xF7, 0x00, 0xF0, 0xEE, 0xF4, 0xF6, 0xE2, 0x06, 0xEE, 0x0F,
+    0xF3, 0x06, 0x0C, 0x07, 0x09, 0x12, 0x22, 0x2B, 0x2A, 0x3C, 0x21, 0x3E,
+    0x3C, 0x35, 0x1D, 0x15, 0x48, 0x35, 0xDE, 0xE1, 0xEA, 0xE9, 0xE7, 0x0B,
+    0x14, 0x0C, 0xF0, 0x14, 0xAF, 0xC9, 0xD0, 0xEF, 0xC1, 0xC9, 0xE0, 0xD1,
+    0xF5, 0xE9, 0xE5, 0xF8, 0xDF, 0xE6, 0xE8, 0x09, 0xED, 0xEA, 0x07, 0x0E,
+    0xEF, 0x03, 0xFE, 0x22, 0x03, 0x23, 0x19, 0x1D, 0x23, 0x25, 0x36, 0x12,
+    0x26, 0x22, 0x26, 0x26, 0x13, 0x1F, 0x43, 0x4E, 0x4F, 0xDA, 0x01, 0xF5,
+    0x0F, 0x13, 0xEC, 0xFB, 0xF8, 0x14, 0xAE, 0xE0, 0xDA, 0xCC, 0xEF, 0xD6,
+    0xD1, 0xDA, 0xDA, 0xEC, 0xF6, 0xFC, 0xE0, 0xE4, 0xEB, 0xDA, 0x00, 0xEF,
+    0xFC, 0xF3, 0xF8, 0xF7, 0xEE, 0x14, 0x01, 0x26, 0x19, 0x1D, 0x0E, 0x06,
+    0x22, 0x25, 0x0E, 0x15, 0x2C, 0x1B, 0x28, 0x36, 0x2F, 0x31, 0x3D, 0x30,
+    0xFB, 0xEF, 0xE3, 0xFD, 0x03, 0x17, 0x20, 0xF7, 0x05, 0xDC, 0xC0, 0xD3,
+    0xC6, 0xCF, 0xD6, 0xF5, 0xE6, 0xDB, 0xFD, 0xCB, 0xEE, 0xDB, 0xFF, 0xFB,
+    0xF1, 0xEF, 0xF1, 0x0B, 0x11, 0x03, 0x00, 0x0B, 0x19, 0x0D, 0x27, 0x11,
+    0xFC, 0x00, 0x0B, 0x16, 0x2D, 0x1E, 0x21, 0x26, 0x1F, 0x39, 0x30, 0x41,
+    0x16, 0x3D, 0x1B, 0x09, 0x0D, 0xE2, 0x01, 0xED, 0xEC, 0x0D, 0x24, 0x03,
+    0xC8, 0xE3, 0xE0, 0xBD, 0xE4, 0xCC, 0xCC, 0xC7, 0xDE, 0xDB, 0xFC, 0xCB,
+    0xD2, 0xD7, 0xD9, 0xD6, 0xEF, 0xF1, 0xE5, 0xFF, 0x1B, 0x0D, 0xFE, 0x16,
+    0x1A, 0xFD, 0x06, 0x28, 0xFC, 0x20, 0x1B, 0x01, 0x28, 0x30, 0x40, 0x3B,
+    0x27, 0x36, 0x24, 0x39, 0x41, 0x37, 0x4C, 0x0D, 0xF7, 0x15, 0x18, 0xE9,
+    0x1C, 0x0B, 0xAB, 0xB4, 0xC6, 0xCC, 0xC3, 0xD2, 0xED, 0xCB, 0xC2, 0xF4,
+    0xE5, 0xD6, 0xDB, 0xDC, 0x06, 0xE9, 0x0B, 0x03, 0xFC, 0xF7, 0x01, 0xF1,
+    0xEC, 0x18, 0xF3, 0xF0, 0xF0, 0x14, 0x2B, 0x0A, 0xFA, 0x08, 0x09, 0x2A,
+    0x1C, 0x33, 0x19, 0x3D, 0x46, 0x16, 0x36, 0x33, 0x50, 0x39, 0x07, 0x05,
+    0x00, 0xF2, 0x01, 0x0E, 0x20, 0x1F, 0xBC, 0xB9, 0xBA, 0xD6, 0xE3, 0xF2,
+    0xD7, 0xE9, 0xF5, 0xE8, 0xFC, 0xF5, 0xDA, 0xD4, 0xDC, 0xDF, 0xDB, 0xE0,
+    0x01, 0x10, 0xED, 0xF3, 0x13, 0x04, 0xFE, 0xFB, 0x23, 0x09, 0x21, 0xFB,
+    0xFB, 0x0E, 0x09, 0x20, 0x09, 0x08, 0x3C, 0x0E, 0x46, 0x14, 0x41, 0x36,
+    0x3C, 0x2D, 0xDC, 0x14, 0xF4, 0xF4, 0xFE, 0x09, 0xFA, 0xB6, 0xE3, 0xC2,
+    0xBB, 0xD4, 0xBC, 0xBA, 0xC4, 0xD9, 0xE8, 0xC7, 0xDC, 0xFB, 0xF4, 0xDA,
+    0xD7, 0xF2, 0xD9, 0xE1, 0xEF, 0xF6, 0x0B, 0xEB, 0x0B, 0xEC, 0xFE, 0x09,
+    0x1E, 0x27, 0x17, 0x22, 0x1C, 0x33, 0x10, 0x10, 0x05, 0x11, 0x31, 0x3F,
+    0x29, 0x30, 0x1A, 0x47, 0x24, 0x42, 0x55, 0xFA, 0xEE, 0xFC, 0xFF, 0x03,
+    0xAD, 0xCB, 0xDB, 0xDE, 0xD5, 0xB5, 0xF0, 0xC2, 0xDE, 0xD4, 0xF8, 0xDD,
+    0xE1, 0xCF, 0xDB, 0xEC, 0xF3, 0xDD, 0xED, 0xF6, 0xF2, 0x0B, 0x11, 0x04,
+    0x1D, 0xEF, 0x1C, 0x21, 0x07, 0x1F, 0x2D, 0x05, 0x01, 0x0C, 0x1A, 0x14,
+    0x3E, 0x3E, 0x0B, 0x1F, 0x24, 0x43, 0x37, 0x45, 0x29, 0x2C, 0x3C, 0x09,
+    0xF3, 0x07, 0xF1, 0x0D, 0xDB, 0xB1, 0xE5, 0xD0, 0xBA, 0xBB, 0xE5, 0xC0,
+    0xD5, 0xC7, 0xE2, 0xEA, 0xF9, 0xF3, 0x02, 0xE0, 0xD1, 0xE6, 0xF0, 0xFA,
+    0xF9, 0x0C, 0xE8, 0xFE, 0x01, 0x00, 0x00, 0x09, 0x18, 0x28, 0x09, 0x22,
+    0x00, 0x1B, 0x06, 0x30, 0x1C, 0x0E, 0x09, 0x24, 0x20, 0x1D, 0x28, 0x26,
+    0x1E, 0x38, 0x38, 0x38, 0xF4, 0x06, 0xF3, 0x04, 0xAB, 0xE3, 0xB0, 0xCD,
+    0xD4, 0xE5, 0xE8, 0xC3, 0xD0, 0xCC, 0xE3, 0xE2, 0xF2, 0xF8, 0x01, 0xEF,
+    0xD9, 0xFE, 0xF6, 0x04, 0x12, 0xEA, 0x17, 0x07, 0xF5, 0x05, 0x1E, 0xED,
+    0x11, 0x11, 0xFE, 0x27, 0xFC, 0x1B, 0x2B, 0x27, 0x1E, 0x3D, 0x18, 0x3D,
+    0x10, 0x16, 0x3F, 0x22, 0x24, 0x47, 0x24, 0x36, 0xE1, 0xE3, 0x13, 0xF8,
+    0xB6, 0xDF, 0xD0, 0xDC, 0xB8, 0xE3, 0xC1, 0xDB, 0xEB, 0xF6, 0xCB, 0xF9,
+    0xD1, 0xCA, 0xFE, 0xE2, 0x04, 0xEA, 0x06, 0xE9, 0x10, 0xF5, 0xE9, 0xE9,
+    0xF4, 0x0A, 0xFB, 0x06, 0xFE, 0x21, 0x1F, 0x26, 0x12, 0x06, 0x28, 0x14,
+    0x2D, 0x35, 0x29, 0x2A, 0x27, 0x21, 0x32, 0x45, 0x4F, 0x3E, 0x4D, 0x46,
+    0x53, 0x05, 0x0C, 0x00, 0x1F, 0xDC, 0xB9, 0xDD, 0xB3, 0xD0, 0xC1, 0xD2,
+    0xD5, 0xE5, 0xDA, 0xCE, 0xE6, 0xF3, 0xD5, 0xF1, 0xF4, 0xFC, 0xE5, 0xE1,
+    0xFA, 0x05, 0x0E, 0xFF, 0xF3, 0x15, 0xEB, 0x09, 0x08, 0x1E, 0x0C, 0x2A,
+    0xF8, 0x1C, 0x31, 0x16, 0x28, 0x19, 0x06, 0x1F, 0x2F, 0x42, 0x3F, 0x22,
+    0x25, 0x49, 0x27, 0x49, 0x36, 0x4E, 0xEE, 0xF9, 0x03, 0xC5, 0xD8, 0xBC,
+    0xC3, 0xC9, 0xB4, 0xD3, 0xDD, 0xBB, 0xBC, 0xDB, 0xF0, 0xC8, 0xFD, 0xD8,
+    0xF7, 0xFC, 0xDF, 0xDD, 0xFC, 0xFF, 0xE3, 0x00, 0xEF, 0x14, 0x16, 0x02,
+    0xF0, 0xF4, 0x0A, 0x0B, 0x10, 0x0B, 0x2F, 0x0F, 0x00, 0x0F, 0x26, 0x3D,
+    0x37, 0x42, 0x3E, 0x16, 0x1A, 0x40, 0x28, 0x38, 0x28, 0x40, 0x3C, 0x28,
+    0x04, 0x1C, 0xA9, 0xDA, 0xC2, 0xD4, 0xC8, 0xC0, 0xE5, 0xCD, 0xC4, 0xEC,
+    0xCF, 0xC9, 0xDB, 0xE8, 0xFE, 0xEF, 0xF2, 0xFA, 0x0A, 0xDD, 0xF6, 0xE8,
+    0x0F, 0x0C, 0xF0, 0x16, 0x1A, 0xFB, 0xFA, 0x25, 0xF3, 0xFD, 0x2B, 0x0A,
+    0x1B, 0x06, 0x20, 0x14, 0x14, 0x0D, 0x34, 0x11, 0x1A, 0x36, 0x1E, 0x4F,
+    0x1C, 0x34, 0x51, 0x38, 0x58, 0xFC, 0xDC, 0xD2, 0xBA, 0xAC, 0xB6, 0xC4,
+    0xDB, 0xD6, 0xD9, 0xDC, 0xD9, 0xEA, 0xE3, 0xD3, 0xC9, 0xCC, 0xF1, 0xD9,
+    0xD9, 0xD6, 0xF8, 0x0C, 0xF5, 0xDF, 0x08, 0xF8, 0x12, 0xF9, 0x09, 0xFF,
+    0x08, 0xFB, 0x22, 0x25, 0x00, 0x09, 0x2A, 0x1E, 0x1C, 0x07, 0x0A, 0x39,
+    0x18, 0x2B, 0x1B, 0x31, 0x1E, 0x19, 0x45, 0x2A, 0x33, 0x40, 0x3F, 0xC5,
+    0xB7, 0xD3, 0xD1, 0xC9, 0xB5, 0xEB, 0xE9, 0xC5, 0xE8, 0xC7, 0xD9, 0xCF,
+    0xC5, 0xCC, 0xFA, 0xD9, 0xFE, 0x04, 0xDC, 0x0C, 0xD9, 0xFC, 0xEB, 0xF0,
+    0xFB, 0xE6, 0x03, 0xF8, 0x05, 0x1B, 0x14, 0xF9, 0x12, 0x14, 0x1E, 0x02,
+    0x00, 0x38, 0x2C, 0x39, 0x2C, 0x44, 0x3A, 0x35, 0x28, 0x1B, 0x27, 0x3A,
+    0x54, 0x2C, 0x31, 0x56, 0xBE, 0xD8, 0xD9, 0xBA, 0xC4, 0xB3, 0xC7, 0xC6,
+    0xBC, 0xC2, 0xD6, 0xC8, 0xD5, 0xDA, 0xEC, 0xF1, 0xF8, 0xE9, 0xE1, 0x02,
+    0x09, 0xE5, 0x07, 0xEB, 0x11, 0x16, 0xE8, 0xF1, 0xF5, 0xF3, 0x20, 0x1D,
+    0x12, 0x29, 0x20, 0x0C, 0xFF, 0x03, 0x16, 0x17, 0x16, 0x11, 0x3A, 0x1B,
+    0x10, 0x27, 0x25, 0x32, 0x34, 0x1D, 0x27, 0x22, 0x27, 0xE5, 0xB8, 0xC4,
+    0xB8, 0xAF, 0xD8, 0xB4, 0xCB, 0xE5, 0xEB, 0xC5, 0xE1, 0xF0, 0xCB, 0xCC,
+    0xFE, 0x00, 0xF2, 0xEF, 0xD9, 0xE0, 0xF0, 0x0F, 0x0F, 0x0B, 0xF1, 0xF8,
+    0x14, 0x1D, 0x13, 0x11, 0x13, 0x1C, 0x00, 0x09, 0x10, 0x02, 0x13, 0x05,
+    0x37, 0x31, 0x2B, 0x34, 0x16, 0x19, 0x49, 0x2C, 0x49, 0x1F, 0x35, 0x51,
+    0x4A, 0x23, 0x03, 0xAA, 0xB3, 0xE0, 0xCB, 0xB5, 0xCC, 0xD8, 0xCF, 0xBA,
+    0xDE, 0xE6, 0xF1, 0xDB, 0xCA, 0xD5, 0xE4, 0xDD, 0xD6, 0xF3, 0xDC, 0x00,
+    0xE9, 0x0E, 0x12, 0x03, 0x01, 0x06, 0xF9, 0x10, 0x05, 0x03, 0xFA, 0x06,
+    0x1C, 0x19, 0xFC, 0x13, 0x0A, 0x08, 0x18, 0x1B, 0x15, 0x42, 0x20, 0x3F,
+    0x2C, 0x2E, 0x44, 0x36, 0x35, 0x33, 0x46, 0xEE, 0xF5, 0xA6, 0xD7, 0xD8,
+    0xB5, 0xAF, 0xCF, 0xD3, 0xD2, 0xD2, 0xE3, 0xD0, 0xCA, 0xF1, 0xF8, 0xED,
+    0xE1, 0x01, 0xFA, 0xF4, 0xF5, 0x0D, 0xF1, 0x02, 0x0E, 0x0A, 0x04, 0x04,
+    0x1B, 0x11, 0x25, 0x08, 0xFA, 0xF7, 0xFB, 0x0F, 0x06, 0x0D, 0x29, 0x26,
+    0x16, 0x26, 0x33, 0x10, 0x1B, 0x28, 0x23, 0x4B, 0x27, 0x23, 0x2C, 0x39,
+    0xFE, 0x02, 0xE8, 0xCF, 0xD7, 0xE0, 0xDA, 0xD1, 0xD8, 0xE8, 0xC4, 0xEC,
+    0xE4, 0xD2, 0xD4, 0xF8, 0xE9, 0xCC, 0xF4, 0x04, 0xF7, 0xEF, 0xE6, 0xF2,
+    0x08, 0x03, 0x12, 0x0A, 0xF5, 0xF9, 0x08, 0x08, 0x01, 0x21, 0x0B, 0x17,
+    0x27, 0x32, 0x1F, 0x1D, 0x30, 0x3B, 0x1A, 0x2A, 0x19, 0x10, 0x2C, 0x46,
+    0x22, 0x1A, 0x36, 0x26, 0x58, 0x08, 0x10, 0xF1, 0xF5, 0xB9, 0xC6, 0xCB,
+    0xBF, 0xD2, 0xD9, 0xE3, 0xEC, 0xC5, 0xEA, 0xE5, 0xD7, 0xFB, 0xED, 0xE1,
+    0xCF, 0xF7, 0xDB, 0xE5, 0x09, 0x0E, 0x0E, 0xE4, 0xED, 0xF8, 0xF2, 0x21,
+    0xF3, 0x04, 0xF8, 0x25, 0x19, 0x07, 0x1B, 0x09, 0x1A, 0x35, 0x27, 0x3D,
+    0x28, 0x42, 0x40, 0x21, 0x15, 0x2D, 0x2C, 0x29, 0x34, 0x28, 0x01, 0xEE,
+    0x09, 0x02, 0xAA, 0xC9, 0xE2, 0xBB, 0xE9, 0xED, 0xBE, 0xDC, 0xD7, 0xE3,
+    0xE8, 0xED, 0xF7, 0xD4, 0xCC, 0x01, 0xE2, 0xF2, 0xD8, 0xF0, 0xF1, 0xFC,
+    0xE8, 0x0F, 0x14, 0xF1, 0xED, 0x18, 0x17, 0x21, 0x0F, 0x04, 0x00, 0x0B,
+    0x31, 0x1F, 0x23, 0x28, 0x1A, 0x1F, 0x17, 0x18, 0x45, 0x43, 0x28, 0x19,
+    0x35, 0x49, 0x46, 0x04, 0x17, 0x09, 0x0F, 0xF5, 0xAC, 0xD8, 0xBB, 0xCD,
+    0xCA, 0xBA, 0xE4, 0xE1, 0xC4, 0xD0, 0xFA, 0xEE, 0xF5, 0xCF, 0xDD, 0x00,
+    0x05, 0x0C, 0xF0, 0x0E, 0x00, 0xF2, 0x13, 0xF5, 0xF2, 0x1B, 0x0B, 0x00,
+    0x00, 0x1E, 0x28, 0x1D, 0x0C, 0x26, 0x19, 0x27, 0x33, 0x21, 0x29, 0x1B,
+    0x3F, 0x22, 0x2C, 0x22, 0x35, 0x45, 0x26, 0x00, 0x0C, 0xED, 0x03, 0xF9,
+    0xFB, 0xDC, 0xBC, 0xB7, 0xDF, 0xBB, 0xBE, 0xD8, 0xD0, 0xF2, 0xDC, 0xD5,
+    0xE7, 0xEA, 0xD7, 0xD6, 0xFA, 0x00, 0xEB, 0xDF, 0xE2, 0x09, 0xE4, 0x02,
+    0x0A, 0x03, 0x15, 0xF3, 0x22, 0xF4, 0x14, 0x1F, 0x2F, 0x14, 0x30, 0x06,
+    0x17, 0x0B, 0x17, 0x30, 0x30, 0x32, 0x1A, 0x1F, 0x33, 0x49, 0x3F, 0x2C,
+    0x00, 0xF4, 0xF8, 0x1D, 0x1C, 0x0F, 0xAC, 0xD0, 0xB9, 0xBF, 0xBD, 0xED,
+    0xC2, 0xCB, 0xED, 0xF5, 0xEF, 0xC8, 0xD8, 0xF8, 0xEC, 0xE9, 0xE1, 0xE8,
+    0xF2, 0xF6, 0xE4, 0x0E, 0x05, 0xED, 0x00, 0x0A, 0x0C, 0x10, 0x0B, 0x02,
+    0x25, 0xF9, 0xFC, 0x03, 0x06, 0x32, 0x27, 0x21, 0x18, 0x1C, 0x38, 0x26,
+    0x42, 0x29, 0x3A, 0x1D, 0xF3, 0x0C, 0xF0, 0xFA, 0xFE, 0x14, 0xF4, 0xC1,
+    0xC6, 0xD7, 0xB8, 0xBD, 0xEC, 0xD9, 0xD1, 0xF3, 0xF9, 0xF9, 0xF3, 0xEA,
+    0xCE, 0xE8, 0x05, 0x09, 0x00, 0xF8, 0xE7, 0x15, 0xFB, 0x1A, 0x13, 0x0C,
+    0x0F, 0x1E, 0xF3, 0xFF, 0x28, 0x25, 0x06, 0x22, 0x10, 0x2F, 0x17, 0x0F,
+    0x1F, 0x35, 0x17, 0x18, 0x2E, 0x49, 0x41, 0x28, 0x08, 0x0C, 0x0B, 0x0D,
+    0x01, 0xF7, 0x0B, 0xF0, 0xD6, 0xB1, 0xB6, 0xC8, 0xE9, 0xC8, 0xC5, 0xEA,
+    0xD4, 0xD4, 0xDD, 0xF3, 0xCF, 0xF4, 0x03, 0xD4, 0xDA, 0xF8, 0x00, 0x11,
+    0x03, 0xF0, 0x08, 0x1C, 0x1E, 0xF3, 0x25, 0x02, 0xFA, 0x0D, 0x05, 0x13,
+    0x27, 0x2C, 0x16, 0x22, 0x33, 0x1D, 0x42, 0x30, 0x33, 0x16, 0x38, 0x47,
+    0xE3, 0x11, 0x08, 0xF7, 0xEE, 0xE9, 0x19, 0x11, 0x1C, 0xDB, 0xE4, 0xC3,
+    0xCB, 0xBF, 0xC7, 0xD9, 0xEB, 0xF9, 0xE8, 0xCB, 0x00, 0xDB, 0xF2, 0xF1,
+    0xD9, 0xDE, 0xE4, 0xFC, 0x08, 0xF9, 0x07, 0xE8, 0xFF, 0xF8, 0x12, 0xFF,
+    0xF9, 0x16, 0xFB, 0x2D, 0x12, 0x33, 0x22, 0x38, 0x1F, 0x2A, 0x26, 0x18,
+    0x2F, 0x30, 0x25, 0x33, 0xE6, 0xDE, 0x12, 0x0E, 0xFC, 0xF3, 0x15, 0x0A,
+    0xF6, 0xB8, 0xDF, 0xB6, 0xDC, 0xCE, 0xCB, 0xF5, 0xDD, 0xE2, 0xF2, 0xE5,
+    0xE9, 0x05, 0xD8, 0xFA, 0xED, 0x09, 0xE5, 0xDF, 0xF5, 0x00, 0x11, 0xFA,
+    0xEF, 0xFE, 0xF5, 0x10, 0xF9, 0xFD, 0x00, 0x31, 0x16, 0x28, 0x04, 0x08,
+    0x2A, 0x35, 0x26, 0x25, 0x1B, 0x15, 0x25, 0x48, 0x00, 0x0C, 0xF4, 0xE5,
+    0xE9, 0xF7, 0x10, 0x0E, 0x1A, 0xB5, 0xD1, 0xD1, 0xEF, 0xC5, 0xD1, 0xCF,
+    0xE9, 0xDE, 0xC8, 0xDF, 0xD7, 0xF2, 0x00, 0xDB, 0xE8, 0xE3, 0xDD, 0x04,
+    0x14, 0xFB, 0xF4, 0x0F, 0xF1, 0xF4, 0x03, 0x08, 0xF9, 0x06, 0x1C, 0x0F,
+    0x0D, 0x08, 0x1B, 0x19, 0x22, 0x21, 0x39, 0x35, 0x40, 0x37, 0x4F, 0xEF,
+    0xF5, 0xF8, 0xFB, 0xEA, 0xFE, 0x11, 0xEF, 0xFF, 0x21, 0xD7, 0xB5, 0xED,
+    0xE2, 0xEF, 0xD8, 0xEB, 0xF1, 0xFA, 0xF7, 0xF9, 0xD2, 0x06, 0xE9, 0xEE,
+    0x0C, 0xEC, 0xF6, 0xF3, 0x18, 0xFE, 0xFE, 0xFB, 0x20, 0x16, 0xFF, 0x24,
+    0x03, 0x18, 0x08, 0x34, 0x01, 0x0F, 0x06, 0x2F, 0x0B, 0x19, 0x3C, 0x32,
+    0x32, 0x2C, 0x01, 0xEA, 0xFA, 0xE3, 0xEF, 0xF5, 0x13, 0xEE, 0x08, 0x10,
+    0xE2, 0xCE, 0xDE, 0xBB, 0xC0, 0xBE, 0xEE, 0xFB, 0xDB, 0xF6, 0xE1, 0xFD,
+    0xD1, 0xDF, 0x00, 0xE5, 0xF2, 0x09, 0xFB, 0xE8, 0xF6, 0xF4, 0xF5, 0x05,
+    0x1B, 0x18, 0x1B, 0x0D, 0x10, 0x29, 0x18, 0x2B, 0x2D, 0x22, 0x25, 0x3B,
+    0x3D, 0x1F, 0x1D, 0x44, 0x00, 0xE1, 0xFA, 0xE2, 0xF0, 0x0E, 0x13, 0x02,
+    0x1F, 0xF7, 0x1D, 0x07, 0xC3, 0xCA, 0xC9, 0xD1, 0xD5, 0xC8, 0xC9, 0xF2,
+    0xFD, 0xDC, 0xD7, 0xFA, 0x03, 0xF2, 0x02, 0xEC, 0xDE, 0x07, 0xF7, 0x1B,
+    0x14, 0xED, 0x1F, 0xFE, 0x25, 0x08, 0x10, 0x1F, 0x05, 0x0F, 0x04, 0x36,
+    0x14, 0x38, 0x42, 0x3B, 0x16, 0x29, 0x4A, 0x0C, 0xF7, 0xF1, 0x00, 0x17,
+    0xE7, 0xED, 0xF6, 0xEF, 0x15, 0xF5, 0x15, 0xE2, 0xC5, 0xC4, 0xDD, 0xF3,
+    0xC2, 0xD0, 0xD8, 0xDD, 0xE3, 0xD0, 0xFA, 0x01, 0xDC, 0xE6, 0x11, 0xE4,
+    0xF4, 0x17, 0x09, 0x18, 0x1E, 0x17, 0x20, 0x22, 0x19, 0x07, 0x03, 0x10,
+    0x37, 0x21, 0x0E, 0x2C, 0x33, 0x0C, 0x28, 0x31, 0x33, 0xDD, 0x0F, 0xFC,
+    0xF5, 0xE3, 0xEB, 0xE7, 0xEF, 0xF0, 0xF8, 0xF7, 0xF4, 0xC1, 0xDE, 0xD8,
+    0xCE, 0xCB, 0xDF, 0xF4, 0xE7, 0xE7, 0xD4, 0xE8, 0xFE, 0xE5, 0xEF, 0x08,
+    0xE9, 0xE9, 0x08, 0x09, 0xED, 0x05, 0x0C, 0x0C, 0x02, 0x1C, 0x2C, 0x25,
+    0x12, 0x09, 0x14, 0x14, 0x21, 0x3B, 0x1C, 0x3F, 0x2C, 0x3A, 0x43, 0xF0,
+    0xDF, 0xFA, 0xEF, 0xF8, 0xEA, 0xFF, 0xEF, 0x0E, 0xF0, 0x01, 0x06, 0x08,
+    0xE3, 0xBC, 0xC3, 0xD3, 0xDD, 0xD3, 0xEE, 0xF4, 0xEC, 0xD4, 0x08, 0xF2,
+    0xE4, 0xDD, 0xFA, 0xF5, 0x17, 0xE9, 0xF4, 0xF6, 0xFE, 0xFE, 0xFD, 0x14,
+    0x18, 0x19, 0xFE, 0x0C, 0x2F, 0x2B, 0x32, 0x27, 0x10, 0x36, 0x2A, 0x20,
+    0xF1, 0x0C, 0xF6, 0x0F, 0xFF, 0xE6, 0x03, 0xF9, 0x0A, 0xEC, 0xFD, 0x16,
+    0x08, 0x20, 0xE5, 0xD5, 0xC1, 0xC5, 0xCE, 0xF3, 0xD7, 0xE0, 0xED, 0xDB,
+    0xFA, 0xF1, 0xDD, 0xFC, 0x0A, 0x0F, 0x09, 0x0B, 0x1B, 0xF2, 0xFB, 0x11,
+    0x23, 0xF7, 0xFB, 0x29, 0x0C, 0x2B, 0x0D, 0x37, 0x15, 0x3C, 0x1C, 0x26,
+    0x26, 0xF4, 0x04, 0xDE, 0xEF, 0x10, 0x0A, 0xF6, 0x0A, 0xFC, 0xED, 0xF5,
+    0x10, 0x20, 0x02, 0xDA, 0xC9, 0xCA, 0xD0, 0xE5, 0xE5, 0xEA, 0xDB, 0xE6,
+    0xF7, 0xD7, 0xF4, 0x0C, 0xE9, 0xEF, 0xF8, 0xEA, 0xF9, 0x15, 0x04, 0x00,
+    0x12, 0xF7, 0x1F, 0x0B, 0x23, 0x2A, 0x05, 0x26, 0x39, 0x0B, 0x31, 0x3F,
+    0x44, 0x3F, 0xF3, 0xEE, 0xE2, 0xDF, 0xDF, 0xEE, 0xEF, 0xED, 0xEE, 0x0F,
+    0x1B, 0x0C, 0x1F, 0x14, 0x12, 0xD6, 0xDD, 0xD9, 0xD8, 0xEC, 0xD7, 0xF8,
+    0xF4, 0xFC, 0xEF, 0xEB, 0x01, 0xF0, 0xE9, 0x00, 0xE4, 0x05, 0xEB, 0x16,
+    0xEF, 0x04, 0x25, 0x0C, 0x24, 0xFB, 0x10, 0x1C, 0x35, 0x36, 0x13, 0x1B,
+    0x3D, 0x31, 0x20, 0xF2, 0x04, 0xFA, 0xEF, 0xE2, 0xE6, 0x02, 0xEB, 0xEF,
+    0x0E, 0xFA, 0x25, 0x07, 0xF7, 0x03, 0xC8, 0xE0, 0xF6, 0xE8, 0xDE, 0xE3,
+    0xCC, 0xDA, 0xFD, 0xFB, 0xF3, 0x0E, 0x0A, 0x00, 0xE8, 0x16, 0xE8, 0x14,
+    0x00, 0x06, 0x20, 0x17, 0x25, 0x10, 0x17, 0x15, 0x2F, 0x31, 0x07, 0x1C,
+    0x16, 0x10, 0x3B, 0x00, 0xD9, 0x01, 0x00, 0xF8, 0xF8, 0xF0, 0x19, 0x04,
+    0x11, 0x12, 0x02, 0x18, 0x03, 0x1D, 0xCF, 0xF2, 0xD4, 0xD7, 0xCB, 0xFE,
+    0xDE, 0xCC, 0xED, 0xDE, 0xDE, 0xEF, 0xFC, 0x0A, 0xEE, 0x12, 0xF3, 0x0D,
+    0x11, 0x03, 0xF3, 0x1F, 0xFF, 0x0E, 0x16, 0x0C, 0x02, 0x2B, 0x11, 0x08,
+    0x3A, 0x0E, 0x1A, 0xF0, 0xEA, 0xF1, 0xF9, 0x0B, 0x01, 0x07, 0x13, 0x17,
+    0x0E, 0x00, 0x15, 0x23, 0x0B, 0x10, 0x15, 0xF3, 0xE1, 0xEA, 0xE6, 0xD4,
+    0xFE, 0xFD, 0xEB, 0xF4, 0x01, 0x0C, 0x07, 0x02, 0xF5, 0xFC, 0xFB, 0xFE,
+    0xEB, 0x1C, 0x09, 0xF3, 0x0E, 0x1F, 0x30, 0x1A, 0x16, 0x27, 0x15, 0x0F,
+    0x25, 0x20, 0xE0, 0xE3, 0xFD, 0xE2, 0x0E, 0xFA, 0x14, 0x0D, 0x0C, 0x00,
+    0x0B, 0x05, 0xF2, 0x24, 0xF7, 0x13, 0x2B, 0xD5, 0xD6, 0xDD, 0xC5, 0xF1,
+    0xDC, 0xFF, 0xEC, 0xF6, 0xFA, 0xF1, 0x01, 0xE8, 0x05, 0x14, 0x11, 0x0B,
+    0xF9, 0xF9, 0x01, 0x14, 0x28, 0x1A, 0xFD, 0x26, 0x05, 0x27, 0x06, 0x11,
+    0x17, 0x0F, 0xEA, 0xE8, 0xE6, 0xF7, 0x0A, 0x11, 0xF5, 0xFB, 0xFD, 0xF6,
+    0x13, 0xF3, 0xF8, 0xFE, 0x09, 0x0A, 0x0E, 0xE0, 0xF6, 0xE8, 0xDD, 0xD6,
+    0xEB, 0xF3, 0xE7, 0xD4, 0xF4, 0xE1, 0x0A, 0x14, 0x0F, 0xFE, 0xFD, 0xFF,
+    0xF3, 0x10, 0x21, 0x06, 0x21, 0x20, 0x23, 0x27, 0x06, 0x34, 0x3D, 0x1C,
+    0x3D, 0xD1, 0xEB, 0xFF, 0xE0, 0x03, 0xFF, 0x02, 0xFB, 0x04, 0xEC, 0x1B,
+    0x0B, 0x14, 0x09, 0x0D, 0x28, 0x24, 0xED, 0xF2, 0xE8, 0xE2, 0xDD, 0xD8,
+    0xDC, 0xDB, 0xF5, 0xD7, 0xEA, 0xE7, 0x0B, 0x06, 0x00, 0x14, 0x0C, 0x19,
+    0x1E, 0x24, 0xF7, 0x28, 0x22, 0x2C, 0x01, 0x1E, 0x12, 0x25, 0x36, 0xE5,
+    0xE9, 0xFC, 0xED, 0xD8, 0x0A, 0x09, 0x10, 0xE3, 0xF0, 0x1D, 0x19, 0x1D,
+    0x1C, 0x25, 0x15, 0x09, 0xFE, 0x00, 0xDF, 0xF6, 0xDF, 0xC9, 0xDD, 0xE7,
+    0xD9, 0x00, 0xE0, 0xF4, 0xF2, 0x10, 0xE3, 0xF8, 0xF9, 0x12, 0xEC, 0x1B,
+    0x0A, 0x11, 0x21, 0x11, 0x07, 0x12, 0x13, 0x26, 0x13, 0x28, 0x01, 0xD0,
+    0xD7, 0xF1, 0xFA, 0xFA, 0xE8, 0x0E, 0xED, 0x0C, 0xFC, 0xF2, 0x16, 0x18,
+    0x28, 0xFC, 0x26, 0x0F, 0x2D, 0xD4, 0xDD, 0xD2, 0xE4, 0xD1, 0xF9, 0xE0,
+    0x05, 0xF4, 0xEB, 0x0A, 0xE9, 0xEE, 0x06, 0xF5, 0x14, 0xF4, 0xF4, 0x28,
+    0x08, 0x07, 0x13, 0x2D, 0x0D, 0x21, 0x2A, 0x2D, 0xFC, 0xF0, 0xEB, 0xF0,
+    0xEE, 0xF7, 0xEE, 0xFF, 0x0C, 0x12, 0xF6, 0x1B, 0x0A, 0x18, 0x0D, 0x13,
+    0x27, 0x1D, 0x30, 0xDE, 0xF3, 0xC8, 0xE2, 0xFD, 0xFF, 0xF8, 0xFD, 0xF8,
+    0xFE, 0xFA, 0xE7, 0x14, 0x0D, 0xF8, 0xF8, 0x0E, 0xFF, 0x20, 0x1E, 0x0E,
+    0x05, 0x07, 0x18, 0x07, 0x11, 0x34, 0xFF, 0xEC, 0xF8, 0x06, 0xE7, 0xFA,
+    0x11, 0xF8, 0x09, 0xFE, 0xFF, 0x02, 0x18, 0xF8, 0x1F, 0x16, 0x01, 0x2F,
+    0x05, 0x0D, 0xDC, 0xF4, 0xF8, 0xF4, 0xD1, 0xD1, 0xEB, 0x01, 0xF9, 0xE9,
+    0x0E, 0x14, 0xF1, 0x02, 0x04, 0x21, 0x25, 0xF3, 0x2A, 0x12, 0x04, 0x2E,
+    0x0D, 0x05, 0x27, 0x1D, 0xF0, 0xDD, 0xE8, 0xEC, 0xE4, 0xDB, 0x0C, 0x00,
+    0xFF, 0x00, 0xEE, 0xFC, 0x15, 0x02, 0x10, 0x1A, 0x09, 0x1C, 0x12, 0x1E,
+    0xEB, 0xF5, 0xE7, 0xF3, 0xD8, 0xD3, 0xFB, 0xED, 0x0C, 0xF6, 0xEF, 0x02,
+    0x00, 0x09, 0x01, 0xF8, 0x0F, 0x09, 0x0F, 0x2B, 0x01, 0x31, 0x05, 0x12,
+    0x2B, 0xDA, 0xED, 0xF0, 0xF8, 0xDD, 0xFB, 0xE4, 0xEB, 0x0D, 0x02, 0x13,
+    0x08, 0xFB, 0xF8, 0x06, 0x11, 0x15, 0x05, 0x1D, 0x08, 0x26, 0xD4, 0xE5,
+    0xDF, 0xFF, 0x00, 0xF4, 0xF5, 0xDD, 0xDB, 0xE4, 0xE3, 0xFF, 0x12, 0x03,
+    0x18, 0x18, 0x23, 0xF8, 0x1D, 0x1C, 0x2A, 0x2D, 0x33, 0x2D, 0x17, 0xDB,
+    0xEC, 0xD6, 0xDC, 0xF8, 0x03, 0x0A, 0xF8, 0x16, 0xFB, 0xED, 0xEA, 0xF0,
+    0xF6, 0x09, 0x15, 0x03, 0x18, 0x17, 0x0F, 0x18, 0xCC, 0xF9, 0xF8, 0xD5,
+    0xFF, 0xE4, 0xDA, 0xF6, 0xFA, 0x06, 0xFB, 0x10, 0xFD, 0xEB, 0x01, 0x01,
+    0x04, 0x28, 0x16, 0x15, 0x0B, 0x13, 0x33, 0x20, 0xFB, 0xE7, 0xF2, 0x05,
+    0x09, 0x08, 0x0D, 0xE0, 0xF4, 0x05, 0xFE, 0x01, 0xFA, 0xF1, 0xFD, 0x06,
+    0x21, 0x00, 0x0A, 0x0A, 0x22, 0xC8, 0xD8, 0xE3, 0xDE, 0xD5, 0x01, 0xF2,
+    0xF8, 0x0A, 0x00, 0x0E, 0xE5, 0x0D, 0x09, 0xF5, 0xF7, 0xF3, 0x1F, 0x03,
+    0x2B, 0x29, 0x32, 0x24, 0x09, 0xD8, 0xCD, 0xFD, 0x05, 0xE2, 0xFB, 0xE0,
+    0xEB, 0xFB, 0x12, 0xEC, 0x11, 0xEB, 0x0E, 0xF6, 0x02, 0x07, 0x09, 0x26,
+    0x0D, 0x26, 0x1A, 0xE3, 0xCD, 0xE7, 0xF2, 0xDD, 0xF4, 0x00, 0xDE, 0xDE,
+    0xEC, 0x12, 0xEF, 0xF0, 0xEF, 0x06, 0x08, 0x0F, 0x05, 0x15, 0x23, 0x11,
+    0x33, 0xE7, 0xDB, 0xE9, 0xD8, 0xDC, 0x08, 0xEE, 0xEB, 0x00, 0xFC, 0xE4,
+    0x10, 0xEA, 0x01, 0x1D, 0x03, 0x0C, 0x18, 0x2C, 0x18, 0x04, 0x21, 0x27,
+    0xEF, 0xEB, 0xD6, 0xFE, 0xF3, 0xF3, 0xDC, 0x0C, 0xEE, 0xFE, 0xED, 0xEA,
+    0xEC, 0x0E, 0x24, 0xF9, 0x28, 0x15, 0xFF, 0xFE, 0x2A, 0x0E, 0xD0, 0xF2,
+    0xF2, 0xD4, 0xE8, 0xFB, 0xDC, 0x0E, 0x00, 0xE8, 0xED, 0x10, 0xF8, 0xF1,
+    0x1C, 0x03, 0x0A, 0xF8, 0x2E, 0x14, 0x29, 0x06, 0x21, 0xCB, 0xE4, 0xCF,
+    0xD1, 0xFE, 0xEE, 0xEC, 0x06, 0xEA, 0x00, 0x13, 0x17, 0xEA, 0xF5, 0x01,
+    0x20, 0x04, 0x1B, 0x26, 0x0D, 0x30, 0xE9, 0xEB, 0xCB, 0xFF, 0xFF, 0xED,
+    0x09, 0xEE, 0x0F, 0xFC, 0x0C, 0x03, 0xF0, 0xF3, 0xFF, 0xFE, 0x10, 0x07,
+    0x10, 0x04, 0x06, 0x13, 0x2C, 0x08, 0xD9, 0xDE, 0xE6, 0xDA, 0x08, 0xE1,
+    0x0A, 0x07, 0xFE, 0xFC, 0x07, 0x0E, 0xFE, 0x15, 0x1D, 0xF4, 0xF9, 0x03,
+    0x24, 0x15, 0x10, 0xCF, 0xCC, 0xF9, 0xCE, 0xF1, 0xDA, 0xF2, 0xFE, 0x04,
+    0x0B, 0xE9, 0xF9, 0x10, 0xF9, 0xF8, 0xF3, 0x25, 0x1F, 0x24, 0x27, 0x08,
+    0x34, 0x06, 0x0E, 0xD1, 0xFE, 0xE4, 0xE9, 0xD9, 0xE2, 0xE8, 0xF2, 0x14,
+    0xF1, 0xF4, 0x10, 0xF6, 0xFA, 0x1F, 0xF6, 0x2A, 0x0D, 0x12, 0x10, 0xE5,
+    0xD7, 0xD3, 0xED, 0xFC, 0x00, 0xF5, 0xD8, 0x0D, 0x10, 0xE5, 0x14, 0xF1,
+    0x18, 0x0F, 0x12, 0x03, 0x00, 0xFB, 0x16, 0x2E, 0x19, 0x0B, 0x0D, 0x19,
+    0xFB, 0xF6, 0xE1, 0xF9, 0xFB, 0xE1, 0xDF, 0x00, 0x13, 0x03, 0xFD, 0x17,
+    0xFD, 0x01, 0x0A, 0x0A, 0x06, 0x23, 0x05, 0xD2, 0xE1, 0xDF, 0xD6, 0xD7,
+    0x00, 0xF7, 0xF3, 0xFB, 0xE7, 0xED, 0x0E, 0x10, 0xEF, 0x14, 0x00, 0x0C,
+    0x15, 0xFB, 0xFD, 0x2B, 0x21, 0x2D, 0x1A, 0x21, 0xF6, 0x02, 0xEA, 0xE8,
+    0xDD, 0xE0, 0xEB, 0xE4, 0x13, 0x13, 0x17, 0x09, 0x16, 0x06, 0xFA, 0xF8,
+    0x18, 0x0F, 0x11, 0xE9, 0xE9, 0xE3, 0xD8, 0xDB, 0xE3, 0xF3, 0xF4, 0xF7,
+    0xFC, 0xEB, 0xEF, 0xE5, 0x0B, 0xF7, 0x06, 0x22, 0x03, 0xFF, 0x1F, 0x1C,
+    0x21, 0x34, 0x35, 0x35, 0x39, 0xE5, 0xF4, 0xD4, 0xE8, 0xED, 0xFD, 0x0A,
+    0x12, 0x18, 0xEC, 0xF4, 0xEE, 0x05, 0x14, 0xF7, 0x03, 0x16, 0x2B, 0xD8,
+    0xD5, 0xF2, 0xD9, 0xF9, 0xD5, 0xD8, 0xFD, 0xFD, 0x0A, 0xF7, 0xE8, 0x0B,
+    0x03, 0x14, 0xEE, 0xF1, 0xFA, 0x0D, 0x06, 0x25, 0x11, 0x16, 0x0D, 0x2F,
+    0x11, 0xD0, 0xF3, 0xDA, 0xFD, 0x02, 0xDF, 0xF1, 0x08, 0xED, 0x06, 0x1E,
+    0x08, 0xFA, 0x08, 0x11, 0x0B, 0x2D, 0x07, 0xEC, 0xE1, 0xDC, 0xEB, 0xE7,
+    0x04, 0xFF, 0xD9, 0x00, 0x08, 0xF8, 0x0B, 0xE8, 0x13, 0x1A, 0xEE, 0x24,
+    0x04, 0x08, 0x22, 0x05, 0x24, 0x03, 0x27, 0x12, 0x3A, 0x2B, 0xD4, 0xDA,
+    0xFD, 0xF1, 0xF7, 0xFD, 0xF5, 0x0D, 0x0E, 0xEC, 0x0D, 0x08, 0x0A, 0x10,
+    0x06, 0x0C, 0xC2, 0xF3, 0xD7, 0xE6, 0xF6, 0xF4, 0xFA, 0x06, 0xEE, 0xF8,
+    0x06, 0xEE, 0xE3, 0x0E, 0x14, 0x0B, 0x13, 0x00, 0x04, 0x25, 0x2A, 0x15,
+    0x13, 0x07, 0x21, 0x12, 0x39, 0x30, 0xD0, 0xF5, 0x06, 0xF7, 0xF2, 0xF5,
+    0x0C, 0x19, 0xF7, 0x12, 0xFD, 0x21, 0x0F, 0xF7, 0x2D, 0x06, 0xC1, 0xC3,
+    0xEE, 0xFB, 0xCC, 0xD9, 0xE8, 0xFC, 0xFF, 0xFB, 0xEE, 0xE1, 0xF7, 0xF2,
+    0xF6, 0xF5, 0x00, 0x1B, 0xFE, 0x0B, 0x0B, 0x2F, 0x0D, 0x1B, 0x0D, 0x36,
+    0x3D, 0x40, 0xD6, 0xDC, 0xD8, 0xEE, 0xE5, 0xE0, 0x14, 0x10, 0x12, 0x0A,
+    0x0D, 0x10, 0xFF, 0x26, 0x0D, 0x0E, 0xDD, 0xF0, 0xD1, 0xE0, 0xF0, 0xE1,
+    0xD5, 0xF3, 0xE3, 0xE6, 0x08, 0xDF, 0xF3, 0x06, 0xF8, 0x1A, 0xF4, 0xF4,
+    0x24, 0x13, 0x25, 0x00, 0x19, 0x29, 0x10, 0x11, 0x1F, 0x3A, 0xEF, 0xF9,
+    0xEB, 0xDA, 0xDC, 0xE3, 0x02, 0x16, 0x0B, 0xF8, 0xF1, 0xFE, 0x21, 0xF7,
+    0x1E, 0x01, 0xC6, 0xF2, 0xDE, 0xFA, 0xD4, 0xD1, 0xD5, 0xEF, 0xE1, 0xFD,
+    0x10, 0xEC, 0x0A, 0x0F, 0x03, 0x19, 0x14, 0x19, 0x20, 0x22, 0x02, 0x27,
+    0x15, 0x17, 0x31, 0x2A, 0x19, 0x39, 0x2A, 0xED, 0xDE, 0xF8, 0xE7, 0xE5,
+    0x03, 0x14, 0x14, 0x1C, 0x0E, 0x0B, 0x16, 0x0E, 0x03, 0xCF, 0xDD, 0xE2,
+    0xF2, 0xF8, 0xD7, 0xF9, 0xFF, 0xFC, 0xFB, 0xF3, 0x00, 0xE7, 0xE7, 0xEE,
+    0x15, 0x14, 0x20, 0x1C, 0x07, 0x0D, 0x28, 0x23, 0x16, 0x29, 0x35, 0x2F,
+    0x19, 0x0D, 0x2A, 0xE5, 0xF9, 0x09, 0x00, 0xE1, 0x09, 0x08, 0xEE, 0xF2,
+    0xEF, 0xFA, 0xF4, 0x23, 0x27, 0xE9, 0xE1, 0xC2, 0xCC, 0xD5, 0xD9, 0xD4,
+    0xD7, 0x02, 0xF9, 0xFC, 0x04, 0xE1, 0xE9, 0xF2, 0x00, 0xEF, 0xF3, 0xF1,
+    0x18, 0x1A, 0x03, 0x03, 0x1B, 0x02, 0x18, 0x19, 0x28, 0x2C, 0x25, 0xE1,
+    0xD8, 0xE6, 0x03, 0x10, 0xF8, 0xEE, 0x13, 0xFF, 0x09, 0xF8, 0x1E, 0xFD,
+    0x16, 0xC0, 0xD5, 0xCF, 0xCC, 0xE9, 0xFD, 0xD0, 0x03, 0xF3, 0xF0, 0x00,
+    0xDD, 0x03, 0xF6, 0x03, 0xEC, 0xF1, 0x1C, 0x0E, 0x27, 0x25, 0x22, 0x1E,
+    0x15, 0x01, 0x30, 0x19, 0x33, 0x2A, 0x2F, 0xD6, 0x08, 0xF8, 0xF9, 0xFF,
+    0xFB, 0x0A, 0x18, 0x1A, 0x11, 0xF0, 0x25, 0x0F, 0xE2, 0xEB, 0xF4, 0xE2,
+    0xE9, 0xC9, 0xD6, 0xED, 0xE0, 0xD7, 0xD9, 0xDB, 0x0D, 0x08, 0xF4, 0xED,
+    0xF5, 0x14, 0x04, 0xFB, 0x07, 0x0B, 0x26, 0x03, 0x0D, 0x1A, 0x27, 0x0F,
+    0x09, 0x23, 0x12, 0x44, 0x00, 0xF8, 0x0C, 0x10, 0x00, 0xF8, 0xF5, 0x10,
+    0xFC, 0x19, 0xFB, 0x05, 0xC9, 0xF0, 0xDD, 0xEE, 0xE4, 0xCB, 0xCF, 0xFC,
+    0xE5, 0xD6, 0xD8, 0xF7, 0xF3, 0xF0, 0xE2, 0xFF, 0x13, 0xF6, 0x09, 0x03,
+    0x13, 0x0F, 0x18, 0x05, 0x07, 0x34, 0x11, 0x0A, 0x14, 0x0E, 0x31, 0x21,
+    0x00, 0xF2, 0xDE, 0xE8, 0x00, 0x12, 0xF8, 0x0B, 0xF7, 0x17, 0x05, 0x0C,
+    0xC2, 0xED, 0xE0, 0xC6, 0xCD, 0xD1, 0xD0, 0xE1, 0xEF, 0xEE, 0xE1, 0xDC,
+    0xED, 0xFD, 0x0F, 0xFC, 0xEA, 0x10, 0x03, 0x0E, 0x21, 0x23, 0x0D, 0x0C,
+    0x00, 0x25, 0x34, 0x36, 0x33, 0x14, 0x17, 0x25, 0x2A, 0x07, 0x00, 0x09,
+    0x09, 0x17, 0xF3, 0xED, 0x18, 0x0A, 0x26, 0x1C, 0xE5, 0xED, 0xC8, 0xEE,
+    0xE6, 0xE8, 0xFC, 0xE8, 0xE4, 0xF3, 0xFC, 0xDB, 0x0F, 0xFD, 0xEC, 0x16,
+    0x0A, 0x05, 0x18, 0x0B, 0x18, 0x1B, 0x13, 0x1A, 0x1B, 0x01, 0x1C, 0x2A,
+    0x27, 0x37, 0x3B, 0x13, 0x2B, 0xF2, 0xDF, 0x05, 0x10, 0x00, 0xE7, 0x1D,
+    0xEE, 0x09, 0x1D, 0x00, 0xBD, 0xE4, 0xC6, 0xE4, 0xDB, 0xEC, 0xFA, 0xE2,
+    0xDD, 0xE2, 0xFD, 0xE4, 0xF8, 0x0D, 0x01, 0xED, 0x00, 0xF9, 0x00, 0x19,
+    0x15, 0x22, 0x14, 0x24, 0x0F, 0x19, 0x22, 0x18, 0x2F, 0x1A, 0x29, 0x10,
+    0x3E, 0x2D, 0xFD, 0x05, 0x0C, 0xF8, 0x16, 0x09, 0xFB, 0xF1, 0x0A, 0x02,
+    0xDE, 0xD0, 0xC4, 0xCC, 0xCE, 0xCE, 0xE1, 0xD5, 0xE1, 0xF2, 0xF5, 0xE9,
+    0xDB, 0xDF, 0x13, 0x0A, 0xEA, 0xF8, 0xEC, 0x20, 0x03, 0x19, 0x28, 0x2C,
+    0x0E, 0x1D, 0x2D, 0x13, 0x26, 0x1C, 0x3A, 0x2B, 0x25, 0x20, 0x03, 0xFB,
+    0x0F, 0xFA, 0x02, 0x06, 0x09, 0xF9, 0x07, 0x20, 0xE6, 0xDA, 0xC6, 0xC1,
+    0xC7, 0xDD, 0xE1, 0xE7, 0xD1, 0xE5, 0xEB, 0x00, 0x02, 0x06, 0xF8, 0x13,
+    0xF5, 0xE9, 0x0E, 0x11, 0x1A, 0xF8, 0x1B, 0x1A, 0x22, 0x0B, 0x1B, 0x09,
+    0x33, 0x12, 0x30, 0x2B, 0x34, 0x19, 0x2E, 0xDD, 0xE8, 0xEF, 0xE5, 0x06,
+    0x1C, 0x13, 0x21, 0xF6, 0xE1, 0xBF, 0xC3, 0xEB, 0xEF, 0xCE, 0xD6, 0xFE,
+    0xFB, 0xE0, 0xF7, 0xD5, 0xE6, 0xDD, 0xE2, 0xFE, 0x14, 0xE6, 0x04, 0x06,
+    0x16, 0x17, 0x20, 0xFD, 0xFD, 0x00, 0x08, 0x19, 0x22, 0x39, 0x10, 0x19,
+    0x21, 0x20, 0x38, 0x2E, 0xE0, 0x01, 0xF3, 0x06, 0xF7, 0x0F, 0xFE, 0xFC,
+    0xB4, 0xC7, 0xD5, 0xCE, 0xD3, 0xE4, 0xD3, 0xEA, 0xF8, 0xCE, 0xD0, 0xE6,
+    0xDD, 0xE9, 0x09, 0xF9, 0x00, 0xE8, 0x03, 0x03, 0x16, 0xFE, 0xF1, 0x05,
+    0xF7, 0x00, 0x1A, 0x12, 0x0E, 0x10, 0x0D, 0x19, 0x0D, 0x18, 0x1C, 0x39,
+    0x49, 0x07, 0xE9, 0xFE, 0xE9, 0xEB, 0xEF, 0xF0, 0xFF, 0xE8, 0xDC, 0xEF,
+    0xE4, 0xE5, 0xD8, 0xDA, 0xC8, 0xDC, 0xF4, 0xF5, 0xDA, 0xFA, 0x0C, 0xE4,
+    0x03, 0xE7, 0x0C, 0x10, 0x09, 0x05, 0x1E, 0x16, 0xFB, 0x20, 0x27, 0x19,
+    0x2E, 0x1E, 0x10, 0x21, 0x0A, 0x20, 0x2A, 0x2C, 0x29, 0x3B, 0xE7, 0x11,
+    0x0A, 0x00, 0xF7, 0x07, 0x20, 0xCC, 0xCF, 0xB9, 0xC8, 0xD1, 0xE8, 0xCA,
+    0xD8, 0xF0, 0xE2, 0xF8, 0xF3, 0xF7, 0xF1, 0xFD, 0xEB, 0xF2, 0xEF, 0xFB,
+    0x14, 0x00, 0xEF, 0x07, 0x0A, 0xFC, 0x19, 0x00, 0x16, 0x13, 0x12, 0x16,
+    0x15, 0x22, 0x13, 0x1C, 0x36, 0x39, 0x37, 0x06, 0xF4, 0xE9, 0x04, 0xFF,
+    0x05, 0x03, 0xC4, 0xD2, 0xD5, 0xE2, 0xEE, 0xE9, 0xD5, 0xEC, 0xCC, 0xE9,
+    0xFD, 0xFF, 0xE4, 0xE5, 0xDB, 0xE4, 0xEA, 0xFA, 0x0A, 0xEE, 0x04, 0x18,
+    0x01, 0x13, 0xF9, 0x1D, 0x1D, 0x22, 0x2A, 0x28, 0x05, 0x14, 0x24, 0x3F,
+    0x27, 0x1A, 0x3A, 0x3D, 0xDE, 0xF0, 0xFE, 0x15, 0xF5, 0x0E, 0x1F, 0xC1,
+    0xDE, 0xEA, 0xD0, 0xD2, 0xCE, 0xE5, 0xE5, 0xE4, 0xE3, 0xFD, 0xE2, 0xDD,
+    0xE5, 0x09, 0xFF, 0x01, 0xFE, 0x09, 0x03, 0xF3, 0xFE, 0xF2, 0x1E, 0x0E,
+    0xFD, 0x29, 0x08, 0x2A, 0x27, 0x2D, 0x2D, 0x2B, 0x23, 0x24, 0x30, 0x37,
+    0x3D, 0x3D, 0x0F, 0x09, 0x16, 0x13, 0xF9, 0xEE, 0xE3, 0xC8, 0xE7, 0xD5,
+    0xD8, 0xE7, 0xCF, 0xF8, 0xF7, 0xE6, 0xDA, 0xDC, 0xE1, 0xD7, 0xDB, 0xED,
+    0x00, 0xF1, 0xF8, 0x0E, 0x1B, 0x0A, 0xFC, 0x21, 0x1C, 0xFF, 0x1F, 0x00,
+    0x28, 0x30, 0x2C, 0x34, 0x0C, 0x39, 0x13, 0x34, 0x2F, 0x1A, 0x1A, 0x42,
+    0x0C, 0x02, 0x15, 0xF8, 0xEF, 0xCC, 0xD5, 0xD9, 0xCC, 0xD7, 0xC5, 0xEB,
+    0xF7, 0xE2, 0xDA, 0xEA, 0xF3, 0x02, 0x08, 0x04, 0xF8, 0x01, 0x00, 0x07,
+    0xE5, 0x0C, 0x0D, 0xEE, 0xF3, 0x01, 0x21, 0x05, 0x27, 0x15, 0x08, 0x29,
+    0x1C, 0x1A, 0x33, 0x12, 0x26, 0x14, 0x34, 0x34, 0x31, 0x07, 0x03, 0x15,
+    0x0F, 0x0D, 0xC5, 0xDB, 0xC0, 0xD8, 0xEA, 0xDC, 0xED, 0xD1, 0xDB, 0xC8,
+    0xF7, 0xF6, 0xFD, 0xD8, 0xDC, 0x09, 0xFA, 0xE7, 0xF2, 0x00, 0x09, 0x1B,
+    0xFF, 0x20, 0x03, 0x09, 0x11, 0x26, 0x2E, 0x1B, 0x1E, 0x0A, 0x0C, 0x3B,
+    0x39, 0x2B, 0x19, 0x3D, 0x37, 0x45, 0x50, 0xF8, 0xF6, 0xFC, 0x12, 0xC7,
+    0xD6, 0xD1, 0xC2, 0xD6, 0xDA, 0xE2, 0xEC, 0xCD, 0xE6, 0xCD, 0xEC, 0xD7,
+    0xDE, 0xF0, 0xDB, 0xFB, 0xF2, 0xEB, 0xEE, 0xEB, 0xF5, 0x1B, 0x19, 0x05,
+    0xFB, 0x03, 0x22, 0x05, 0x11, 0x00, 0x28, 0x1D, 0x16, 0x39, 0x3B, 0x42,
+    0x42, 0x3B, 0x29, 0x31, 0x3D, 0xF3, 0xEF, 0x0F, 0xF8, 0xC3, 0xB3, 0xD1,
+    0xD4, 0xEC, 0xBD, 0xCC, 0xDE, 0xF0, 0xE6, 0xDE, 0xDF, 0xD1, 0xDA, 0xF1,
+    0xF4, 0xF2, 0x04, 0xE2, 0x09, 0x13, 0x12, 0x06, 0x19, 0x04, 0x1C, 0x21,
+    0xFC, 0x2C, 0xFE, 0x1C, 0x1A, 0x32, 0x22, 0x0E, 0x32, 0x40, 0x33, 0x26,
+    0x19, 0x20, 0x2A, 0x37, 0xF5, 0xE9, 0xBD, 0xBD, 0xDD, 0xC4, 0xDF, 0xE7,
+    0xE4, 0xEF, 0xC6, 0xC8, 0xD0, 0xF2, 0xF0, 0xFD, 0xD7, 0xF9, 0x03, 0xEA,
+    0x0A, 0x05, 0xF2, 0x12, 0x0B, 0xFE, 0x0A, 0xF7, 0xFA, 0x21, 0x23, 0xFF,
+    0x00, 0x18, 0x09, 0x11, 0x2F, 0x38, 0x1D, 0x3D, 0x31, 0x2E, 0x23, 0x44,
+    0x27, 0x39, 0x0A, 0xF8, 0xBA, 0xBF, 0xC5, 0xCF, 0xC2, 0xE2, 0xD9, 0xC7,
+    0xD9, 0xD9, 0xE9, 0xDF, 0xCF, 0xE3, 0x00, 0xF2, 0xFE, 0x06, 0x0E, 0xF5,
+    0xF2, 0x17, 0x05, 0x16, 0xFE, 0x0E, 0x1A, 0x11, 0x05, 0x04, 0x2F, 0x18,
+    0x16, 0x20, 0x3A, 0x10, 0x11, 0x1E, 0x20, 0x2E, 0x2D, 0x4C, 0x4C, 0x24,
+    0x2C, 0x19, 0xCE, 0xDD, 0xDE, 0xCF, 0xE0, 0xCD, 0xD2, 0xDB, 0xD6, 0xF6,
+    0xF7, 0xCA, 0xDB, 0xF7, 0xE8, 0xFC, 0xDD, 0xFD, 0xDC, 0xF1, 0xE8, 0xEF,
+    0x03, 0x15, 0xFD, 0xF8, 0xFA, 0x18, 0x24, 0x20, 0x15, 0x0C, 0x21, 0x33,
+    0x1D, 0x21, 0x20, 0x19, 0x3A, 0x3C, 0x25, 0x1B, 0x4B, 0x2C, 0x30, 0x16,
+    0xBF, 0xBF, 0xDA, 0xC2, 0xEA, 0xCD, 0xE6, 0xCB, 0xED, 0xEB, 0xCD, 0xDC,
+    0xCC, 0xE8, 0xF5, 0xED, 0xDB, 0xD9, 0xF5, 0xFA, 0xFF, 0xE7, 0xFF, 0x00,
+    0xEE, 0x19, 0x0F, 0x1A, 0x26, 0x1C, 0x17, 0xFE, 0x14, 0x0F, 0x33, 0x0D,
+    0x1B, 0x40, 0x10, 0x37, 0x19, 0x31, 0x29, 0x33, 0x29, 0x40, 0x0E, 0xD0,
+    0xCA, 0xCF, 0xD5, 0xEA, 0xCC, 0xCA, 0xC7, 0xE3, 0xE5, 0xC7, 0xD3, 0xEB,
+    0xD9, 0xDE, 0x06, 0x01, 0x08, 0x04, 0x09, 0xFE, 0x02, 0x0D, 0xF6, 0x06,
+    0x0C, 0x20, 0x0D, 0x0C, 0x1C, 0x1D, 0x00, 0x22, 0x13, 0x22, 0x16, 0x10,
+    0x29, 0x24, 0x2E, 0x14, 0x25, 0x46, 0x3D, 0x4C, 0x32, 0xCD, 0xCE, 0xD7,
+    0xB2, 0xD9, 0xD6, 0xD2, 0xBF, 0xEA, 0xE4, 0xE3, 0xCB, 0xFE, 0xD7, 0xF7,
+    0xD9, 0xEE, 0xE2, 0xF7, 0x0B, 0xFC, 0xFC, 0x14, 0xFB, 0xFC, 0x04, 0xF0,
+    0x01, 0x15, 0x02, 0xFB, 0x1D, 0x1B, 0x25, 0x12, 0x33, 0x31, 0x3B, 0x13,
+    0x16, 0x2A, 0x30, 0x1B, 0x38, 0x24, 0x2F, 0xEB, 0xDA, 0xCA, 0xC5, 0xB9,
+    0xE8, 0xE6, 0xD3, 0xD5, 0xF0, 0xE5, 0xD4, 0xFB, 0xEA, 0xF0, 0xEC, 0xDB,
+    0xED, 0x03, 0xE1, 0x05, 0xF4, 0xE3, 0x08, 0xF0, 0x15, 0xEF, 0x0B, 0xF7,
+    0x0C, 0x15, 0x03, 0x00, 0x17, 0x12, 0x11, 0x31, 0x32, 0x30, 0x1F, 0x30,
+    0x40, 0x1A, 0x1B, 0x3D, 0x4E, 0x2D, 0xE9, 0xB2, 0xB6, 0xB7, 0xC8, 0xD1,
+    0xE7, 0xEE, 0xCE, 0xC7, 0xCC, 0xD3, 0xD1, 0xDD, 0xDD, 0xFB, 0x00, 0xE4,
+    0xEA, 0xFE, 0xF9, 0xF4, 0x0D, 0x0A, 0xFD, 0x19, 0x18, 0x21, 0x1F, 0x08,
+    0x00, 0x11, 0x19, 0x21, 0x0F, 0x33, 0x10, 0x0E, 0x27, 0x38, 0x2D, 0x2D,
+    0x2C, 0x2B, 0x20, 0x46, 0x21, 0x03, 0x05, 0xB1, 0xCE, 0xBB, 0xE6, 0xD1,
+    0xE2, 0xC5, 0xE9, 0xE9, 0xE7, 0xDA, 0xEF, 0xDF, 0xF2, 0xF7, 0xF1, 0x06,
+    0xEA, 0x0F, 0x0C, 0xEA, 0x00, 0xF4, 0xEE, 0x0A, 0xFE, 0xF3, 0x21, 0x00,
+    0x20, 0xFF, 0x16, 0x15, 0x15, 0x26, 0x39, 0x11, 0x3A, 0x3E, 0x22, 0x2D,
+    0x47, 0x39, 0x43, 0x4F, 0x00, 0x13, 0xBA, 0xCB, 0xBE, 0xE0, 0xCC, 0xE8,
+    0xEB, 0xDF, 0xE1, 0xDB, 0xE6, 0xE8, 0xD1, 0xF5, 0xFE, 0xE9, 0xF5, 0xF2,
+    0x03, 0x09, 0xEB, 0x0B, 0x00, 0x06, 0x12, 0x01, 0xF7, 0xF9, 0x14, 0xFF,
+    0x21, 0x31, 0x15, 0x19, 0x29, 0x34, 0x31, 0x20, 0x14, 0x36, 0x2C, 0x24,
+    0x1A, 0x4C, 0xFD, 0xF9, 0x18, 0x1D, 0xB3, 0xE5, 0xBC, 0xC6, 0xBF, 0xD9,
+    0xCF, 0xED, 0xF7, 0xEA, 0xD5, 0xEB, 0xE6, 0x04, 0xF2, 0xF5, 0xE0, 0xFC,
+    0xE0, 0xF8, 0xFA, 0x10, 0xEC, 0xFB, 0x0D, 0x0E, 0x01, 0x0C, 0x05, 0x28,
+    0x22, 0x08, 0x29, 0x0F, 0x1D, 0x20, 0x17, 0x2B, 0x3D, 0x2D, 0x1B, 0x1F,
+    0x36, 0x0C, 0x08, 0xFD, 0x11, 0xBE, 0xBD, 0xD4, 0xDD, 0xD3, 0xE3, 0xEB,
+    0xE4, 0xCF, 0xCC, 0xE7, 0xF9, 0xD6, 0xD6, 0xD7, 0xDC, 0x00, 0x00, 0xEC,
+    0xE2, 0xF3, 0x01, 0x02, 0x08, 0x0B, 0x22, 0x09, 0x18, 0x04, 0x2C, 0x1E,
+    0x30, 0x0F, 0x15, 0x2A, 0x21, 0x2C, 0x20, 0x3D, 0x1C, 0x46, 0x1F, 0x1E,
+    0xFC, 0x13, 0x15, 0xEC, 0x00, 0xB5, 0xDA, 0xDE, 0xCD, 0xCD, 0xD0, 0xDD,
+    0xDB, 0xD9, 0xE2, 0xF7, 0xEC, 0xE2, 0xF1, 0xEA, 0xFC, 0xEA, 0x0C, 0xF4,
+    0xF5, 0xF6, 0xE8, 0x1B, 0xF8, 0x0D, 0x1C, 0x08, 0x26, 0x11, 0x13, 0x14,
+    0x12, 0x1C, 0x0C, 0x12, 0x2C, 0x34, 0x3F, 0x2C, 0x2E, 0x48, 0x31, 0x02,
+    0x05, 0xF3, 0xFB, 0xFC, 0x1D, 0xE1, 0xDA, 0xC5, 0xE4, 0xD6, 0xE6, 0xE5,
+    0xD9, 0xE6, 0xFA, 0xF8, 0xE3, 0xFE, 0xF1, 0x08, 0xDB, 0xFC, 0x09, 0xF4,
+    0xF2, 0xF7, 0xF4, 0x03, 0x01, 0x03, 0x1F, 0x0F, 0x21, 0x25, 0x2D, 0x10,
+    0x1E, 0x2C, 0x1D, 0x0E, 0x31, 0x38, 0x1A, 0x35, 0x46, 0x45, 0x28, 0xFE,
+    0x10, 0xF3, 0x10, 0x1A, 0xD8, 0xE5, 0xCA, 0xC7, 0xC8, 0xC4, 0xC4, 0xC9,
+    0xCF, 0xFB, 0xD3, 0xD5, 0xE7, 0xEF, 0x06, 0xFA, 0x00, 0xDF, 0xF9, 0xE2,
+    0xFD, 0x0D, 0x19, 0x09, 0x13, 0x16, 0x22, 0xF7, 0x0E, 0x16, 0x03, 0x2B,
+    0x29, 0x2C, 0x16, 0x29, 0x16, 0x40, 0x12, 0x33, 0x46, 0x3C, 0x0A, 0xE6,
+    0xEB, 0x12, 0xFC, 0x1D, 0xDE, 0xCD, 0xE8, 0xDE, 0xDB, 0xDE, 0xD8, 0xCD,
+    0xEE, 0xF0, 0xD2, 0xDF, 0xF4, 0xF2, 0xE1, 0xFB, 0xE2, 0x00, 0x09, 0xF3,
+    0xE8, 0x12, 0xEE, 0xF6, 0xFE, 0x00, 0x0B, 0x0E, 0x27, 0x12, 0x00, 0x17,
+    0x30, 0x14, 0x32, 0x2D, 0x1F, 0x31, 0x39, 0x36, 0x36, 0x00, 0xF7, 0x13,
+    0xF9, 0xF0, 0x12, 0x0D, 0xC8, 0xD0, 0xDA, 0xDA, 0xD2, 0xF1, 0xE2, 0xDD,
+    0xEA, 0xD2, 0xF2, 0xEA, 0xD8, 0xE4, 0x08, 0xDD, 0x02, 0x0E, 0xF9, 0x00,
+    0x11, 0xEF, 0xFD, 0xF6, 0x17, 0x11, 0x13, 0x1D, 0x00, 0x1F, 0x1C, 0x1A,
+    0x29, 0x38, 0x29, 0x2E, 0x2F, 0x33, 0x44, 0x36, 0xF3, 0xF5, 0xF1, 0xF3,
+    0x06, 0x11, 0xF9, 0x0A, 0xC8, 0xC9, 0xD0, 0xE7, 0xCE, 0xE2, 0xE8, 0xD2,
+    0xEA, 0xD5, 0xEB, 0xF5, 0xEF, 0x07, 0xDD, 0x00, 0xFB, 0x0C, 0x15, 0xFA,
+    0xEB, 0x09, 0xF2, 0xF2, 0xFE, 0x13, 0x24, 0x18, 0x2D, 0x07, 0x17, 0x0B,
+    0x1A, 0x30, 0x32, 0x32, 0x22, 0x1D, 0x28, 0x04, 0xED, 0x0C, 0xF3, 0xEF,
+    0x18, 0xFF, 0xF3, 0xBD, 0xCB, 0xD5, 0xC3, 0xC1, 0xF0, 0xD5, 0xCC, 0xE2,
+    0xD9, 0xD2, 0xD4, 0xF0, 0xDA, 0xEC, 0xDF, 0x10, 0xE4, 0x16, 0x07, 0xFE,
+    0xFD, 0x07, 0xF6, 0x1E, 0x1F, 0x00, 0x25, 0x19, 0x08, 0x0F, 0x18, 0x0D,
+    0x33, 0x22, 0x2C, 0x19, 0x1D, 0x17, 0xE3, 0xFD, 0xE3, 0xE7, 0x19, 0xFD,
+    0x03, 0x0C, 0xFC, 0xD9, 0xCB, 0xF0, 0xED, 0xC3, 0xCF, 0xF1, 0xDF, 0xD0,
+    0xD3, 0xE5, 0xFB, 0xFA, 0x00, 0xFD, 0xED, 0xE5, 0x01, 0x16, 0x00, 0xF2,
+    0xF3, 0x05, 0x01, 0x03, 0x0E, 0x27, 0x20, 0x09, 0x10, 0x27, 0x36, 0x17,
+    0x1F, 0x3A, 0x1E, 0x1A, 0x2C, 0xE6, 0xF6, 0xE7, 0x05, 0xE9, 0x02, 0x03,
+    0x06, 0x02, 0xD0, 0xD7, 0xD1, 0xCB, 0xC2, 0xD1, 0xE2, 0xD2, 0xD9, 0xFD,
+    0xDF, 0xD3, 0xF9, 0x06, 0xEC, 0xF8, 0xE1, 0x00, 0xE9, 0xF1, 0x07, 0xFB,
+    0x02, 0xF4, 0x0C, 0x0A, 0x03, 0x05, 0xFF, 0x1F, 0x31, 0x09, 0x3A, 0x1C,
+    0x10, 0x31, 0x2C, 0x17, 0xF6, 0x05, 0xE4, 0x10, 0x0F, 0xE9, 0x15, 0x00,
+    0x21, 0xFA, 0xE5, 0xC1, 0xE4, 0xDD, 0xDE, 0xE9, 0xCA, 0xE5, 0xFD, 0xDD,
+    0xE8, 0xF7, 0xF3, 0xF5, 0xE6, 0xE8, 0x0E, 0xF5, 0x08, 0xEE, 0xF3, 0xFE,
+    0x1B, 0x22, 0x14, 0x08, 0x03, 0x13, 0x2D, 0x04, 0x11, 0x32, 0x32, 0x25,
+    0x2B, 0x32, 0x41, 0xEE, 0x0E, 0xF9, 0xE9, 0xF8, 0xFF, 0x19, 0xF6, 0x0E,
+    0x1A, 0xC2, 0xE4, 0xD5, 0xC9, 0xDF, 0xD9, 0xC9, 0xD4, 0xFC, 0xD1, 0xFC,
+    0xD5, 0x06, 0xF9, 0xF6, 0x0E, 0xF3, 0xF1, 0xF8, 0xF3, 0x1A, 0xF0, 0x13,
+    0x01, 0x1E, 0x18, 0x00, 0x2C, 0x28, 0x2E, 0x23, 0x18, 0x0C, 0x22, 0x1F,
+    0x41, 0x2D, 0xDE, 0x02, 0xFA, 0xE7, 0xF0, 0xEB, 0xF4, 0x02, 0x13, 0xFC,
+    0x26, 0xDE, 0xC5, 0xD4, 0xE5, 0xD6, 0xDE, 0xE7, 0xFD, 0xDB, 0xD8, 0x03,
+    0xDB, 0xFB, 0x00, 0xE2, 0x0D, 0xF6, 0xED, 0xED, 0x09, 0xFE, 0x05, 0x10,
+    0x0D, 0x20, 0x11, 0x01, 0x0E, 0x0E, 0x37, 0x2B, 0x1B, 0x1C, 0x30, 0x19,
+    0xFD, 0x0A, 0x0E, 0xFA, 0xE5, 0x0B, 0x09, 0xED, 0xF2, 0x0F, 0xFC, 0x11,
+    0xC3, 0xCE, 0xD2, 0xF6, 0xD4, 0xD0, 0xE3, 0xF0, 0xDF, 0xF7, 0xF5, 0xDB,
+    0xFE, 0x0C, 0xE2, 0xF9, 0x12, 0xFE, 0xFB, 0x00, 0xF4, 0x03, 0x18, 0x0F,
+    0x1F, 0x16, 0x1F, 0x1F, 0x25, 0x21, 0x2F, 0x32, 0x28, 0x2E, 0x29, 0x00,
+    0xE5, 0xFF, 0x06, 0xEF, 0x03, 0xF3, 0xFD, 0x04, 0xFD, 0x1A, 0x23, 0xE0,
+    0xD2, 0xC7, 0xE7, 0xF3, 0xFC, 0xE4, 0xD1, 0xDC, 0xD8, 0x07, 0xDB, 0xDE,
+    0x10, 0x05, 0x07, 0xF0, 0x11, 0x0A, 0xFC, 0xF9, 0xFE, 0x0C, 0x1C, 0xFD,
+    0x06, 0x28, 0x0D, 0x1C, 0x31, 0x0F, 0x3B, 0x36, 0x11, 0xF8, 0x01, 0xFE,
+    0xEE, 0xF0, 0x0E, 0xF0, 0x13, 0x15, 0x02, 0x18, 0x19, 0x1F, 0xCE, 0xC9,
+    0xC6, 0xEB, 0xD2, 0xF5, 0xCF, 0xF1, 0xE3, 0xFE, 0xF1, 0xED, 0xDE, 0xE9,
+    0xF9, 0x08, 0xEA, 0xEE, 0x01, 0x09, 0xFD, 0x24, 0x01, 0x19, 0x2A, 0x18,
+    0x23, 0x2D, 0x15, 0x32, 0x10, 0x21, 0x21, 0xF2, 0x06, 0xE4, 0xEB, 0xFB,
+    0x02, 0xF8, 0xED, 0xEE, 0xFC, 0x11, 0xFA, 0x09, 0xD0, 0xDD, 0xD3, 0xEE,
+    0xD1, 0xD9, 0xDA, 0xEE, 0xF8, 0x04, 0xE7, 0xFD, 0xF3, 0x10, 0x0A, 0xFC,
+    0x14, 0x12, 0x17, 0xF7, 0x0C, 0x11, 0x24, 0x27, 0x02, 0x27, 0x01, 0x34,
+    0x0F, 0x14, 0x15, 0x35, 0x11, 0xED, 0x07, 0xEB, 0x04, 0xF7, 0xF5, 0xED,
+    0xFE, 0xFB, 0x09, 0x21, 0x0F, 0x05, 0x0B, 0xD7, 0xD6, 0xEE, 0xDB, 0xF3,
+    0xD8, 0xFE, 0xD9, 0xD6, 0xEC, 0xDC, 0xF8, 0xF4, 0x08, 0x05, 0x15, 0xFF,
+    0x1B, 0x1A, 0x22, 0x15, 0xFA, 0x28, 0x25, 0x23, 0x13, 0x1A, 0x1D, 0x09,
+    0x2C, 0x2B, 0x3B, 0xDC, 0xF9, 0xF7, 0xF2, 0xFB, 0x14, 0x0A, 0xF9, 0xEC,
+    0xFF, 0x00, 0x04, 0x0A, 0x23, 0xEF, 0xE1, 0xF5, 0xF0, 0xEF, 0xDA, 0xE5,
+    0xD6, 0x00, 0xFE, 0x01, 0xEE, 0xEF, 0xEF, 0x04, 0x06, 0xFB, 0xFA, 0x1E,
+    0x1F, 0x18, 0x1E, 0x15, 0x11, 0x22, 0x0F, 0x05, 0x2C, 0x10, 0x1A, 0x32,
+    0xDE, 0xEA, 0xEA, 0xDE, 0xF9, 0xEF, 0x05, 0x07, 0xEA, 0xFD, 0x17, 0x11,
+    0x1E, 0x28, 0x18, 0xD9, 0xD4, 0xD3, 0xD8, 0xF1, 0xD3, 0xD5, 0xE0, 0xEC,
+    0xF6, 0xDC, 0x0C, 0x0F, 0xE5, 0xF7, 0x0A, 0xF6, 0x0B, 0x0D, 0x22, 0x1B,
+    0x09, 0x16, 0x09, 0x08, 0x0F, 0x05, 0x34, 0x2C, 0x17, 0x12, 0xF4, 0xDF,
+    0xF8, 0xEF, 0xFA, 0xFB, 0xE9, 0xFF, 0x1B, 0x0F, 0x00, 0x11, 0x01, 0x20,
+    0x08, 0xEE, 0xCA, 0xD1, 0xEA, 0xF7, 0xE6, 0xF9, 0xF2, 0xF7, 0xF6, 0xDF,
+    0xF7, 0x0A, 0x0D, 0x04, 0x00, 0x1C, 0xF3, 0xF2, 0xF5, 0x00, 0xFE, 0x1C,
+    0x0A, 0x09, 0x2C, 0x2E, 0x09, 0x14, 0x23, 0x00, 0xF6, 0xDE, 0xE9, 0xEA,
+    0xEB, 0xE5, 0x02, 0xFC, 0xFA, 0xFE, 0x10, 0x10, 0x07, 0x09, 0x0C, 0xE9,
+    0xF1, 0xDE, 0xEC, 0xD0, 0xD4, 0xF9, 0xFA, 0xEC, 0xE6, 0xEF, 0xE9, 0x10,
+    0x01, 0xF7, 0xEB, 0x13, 0x02, 0x15, 0xFE, 0x15, 0x1C, 0x06, 0x1F, 0x18,
+    0x07, 0x34, 0x0A, 0x2A, 0xD6, 0xDE, 0xF5, 0xFF, 0xEE, 0x09, 0x0F, 0x10,
+    0xF8, 0x18, 0x18, 0x21, 0x1B, 0x08, 0x05, 0x02, 0xEF, 0xF6, 0xD7, 0xE1,
+    0xD1, 0xFD, 0xE5, 0x02, 0x03, 0xF3, 0xF8, 0xF3, 0xE5, 0x12, 0xF3, 0x1A,
+    0x09, 0x14, 0x0D, 0x26, 0x14, 0x23, 0x27, 0x02, 0x0D, 0x05, 0x07, 0x10,
+    0xE6, 0xE0, 0xE5, 0x05, 0xF2, 0xE6, 0xF1, 0xEE, 0x15, 0xEB, 0xF9, 0x1D,
+    0x1D, 0x11, 0x22, 0x18, 0x1D, 0xCE, 0xEA, 0xD3, 0xCF, 0xD9, 0xE0, 0xEE,
+    0xEC, 0xE8, 0xF6, 0x0B, 0x04, 0xF6, 0xE8, 0xFB, 0x0D, 0xF8, 0x09, 0x04,
+    0x15, 0xFC, 0xFD, 0x0E, 0x22, 0x28, 0x32, 0x0A, 0x32, 0xD8, 0x00, 0xE7,
+    0x00, 0xF3, 0xF1, 0xE8, 0xF5, 0x16, 0xF2, 0x00, 0xFA, 0x02, 0x16, 0x1B,
+    0x14, 0x25, 0xEC, 0xF1, 0xDF, 0xF0, 0xE6, 0xE1, 0xFE, 0xF2, 0xF9, 0x06,
+    0xF6, 0xE7, 0xED, 0x0C, 0x09, 0x01, 0x18, 0x1F, 0xF6, 0xFC, 0x28, 0x17,
+    0x25, 0x0E, 0x26, 0x31, 0x24, 0xEF, 0xFD, 0xF2, 0xF6, 0xED, 0xFD, 0xF9,
+    0xF7, 0x10, 0x0F, 0xEF, 0x1C, 0xF2, 0x21, 0xFA, 0x1E, 0x29, 0x04, 0xE1,
+    0xEA, 0xD1, 0xE7, 0x00, 0xED, 0xEB, 0xF5, 0xEF, 0xF3, 0xE4, 0xE5, 0x02,
+    0xFE, 0x14, 0x10, 0x0E, 0xF7, 0x20, 0x1F, 0x2C, 0x2C, 0x0B, 0x30, 0x0E,
+    0x1F, 0xE7, 0xE2, 0x06, 0xE1, 0x0A, 0x03, 0x0B, 0x07, 0xEA, 0xFA, 0xF8,
+    0xF0, 0x05, 0x0E, 0x25, 0xFE, 0x29, 0x29, 0x11, 0xCB, 0xEE, 0xFB, 0xF1,
+    0x01, 0xFA, 0xED, 0xF8, 0x09, 0xEC, 0x0A, 0x11, 0x0C, 0x06, 0x11, 0x04,
+    0x03, 0xFC, 0x01, 0x02, 0x12, 0x04, 0x27, 0x20, 0x31, 0xEF, 0xD3, 0xD8,
+    0xE8, 0x08, 0xFA, 0x10, 0xF4, 0xFB, 0xE9, 0xEB, 0x19, 0x09, 0x0E, 0xFF,
+    0x20, 0x1E, 0x11, 0x11, 0xCA, 0xD5, 0xD2, 0xDA, 0xF3, 0xE4, 0xF3, 0xE0,
+    0xDD, 0x02, 0xEA, 0x00, 0xFB, 0xEF, 0xEF, 0x11, 0x21, 0x00, 0x16, 0x0B,
+    0x25, 0x06, 0x02, 0x28, 0x2D, 0x00, 0xE1, 0xD7, 0xFB, 0x06, 0xF2, 0xFD,
+    0xED, 0x11, 0x00, 0x13, 0x1E, 0x01, 0xFA, 0x27, 0x0C, 0x16, 0x17, 0x1E,
+    0xE0, 0xCF, 0xFF, 0xDE, 0xF3, 0xDC, 0x01, 0xF7, 0xF1, 0xE9, 0x11, 0x13,
+    0x0E, 0xF2, 0x18, 0x1E, 0x17, 0x20, 0x02, 0x1D, 0x0A, 0x07, 0x10, 0x2E,
+    0xEF, 0xFC, 0xF4, 0xD7, 0xE8, 0xF2, 0xFB, 0xFC, 0xE8, 0x11, 0x0D, 0x15,
+    0x0F, 0x10, 0x04, 0x02, 0xFC, 0x27, 0x08, 0x2F, 0xF2, 0xE6, 0xD1, 0xD2,
+    0x04, 0xE6, 0x07, 0xFA, 0x00, 0xE6, 0xEF, 0x02, 0x06, 0x19, 0x0D, 0xF9,
+    0x00, 0x01, 0x1B, 0x00, 0x20, 0x1F, 0x31, 0xD2, 0xD6, 0xE8, 0xE9, 0xF4,
+    0xED, 0xF1, 0xF5, 0xFD, 0xEA, 0xF8, 0xFB, 0xFD, 0x07, 0xF8, 0x27, 0x15,
+    0x26, 0x20, 0x09, 0xD7, 0xD2, 0xF1, 0x01, 0xF2, 0x00, 0x06, 0x00, 0xFA,
+    0xEB, 0x0F, 0x0A, 0xF1, 0x1A, 0xFA, 0x12, 0x1B, 0x27, 0x10, 0x00, 0x00,
+    0x14, 0x08, 0xFA, 0xD7, 0xF3, 0x01, 0xD9, 0xE6, 0x0B, 0xE1, 0x12, 0xF0,
+    0x12, 0x13, 0x1A, 0x00, 0xFB, 0x01, 0x10, 0x1A, 0x10, 0x28, 0x11, 0xD9,
+    0xCF, 0xDE, 0xFB, 0xDD, 0xF7, 0x0B, 0x04, 0xEA, 0xEA, 0x13, 0xFC, 0xFE,
+    0x1E, 0xF9, 0xFC, 0x1E, 0xFF, 0x00, 0x01, 0x22, 0x1F, 0xEB, 0xF2, 0xD5,
+    0xD5, 0x07, 0x08, 0xF8, 0x0C, 0xED, 0x10, 0x04, 0x07, 0x14, 0x10, 0x08,
+    0xF7, 0x1B, 0x03, 0x16, 0x0B, 0x34, 0xE5, 0xFC, 0xDA, 0xF2, 0x05, 0xFC,
+    0x00, 0xEB, 0x0F, 0xFC, 0xEE, 0xFC, 0x0D, 0x1A, 0x0B, 0x1C, 0x17, 0x27,
+    0x01, 0x1C, 0x1F, 0xE2, 0xEF, 0xFE, 0xF4, 0xF4, 0x00, 0xE7, 0xE5, 0xEA,
+    0x0C, 0xED, 0x00, 0x15, 0x08, 0x1D, 0x1C, 0xF9, 0x1C, 0x15, 0x18, 0x24,
+    0x33, 0xEB, 0xFC, 0xFC, 0xFD, 0xEA, 0xFA, 0xE7, 0x10, 0xE8, 0xE9, 0xEE,
+    0xEB, 0xFE, 0xF8, 0xF5, 0x0E, 0x16, 0x2B, 0x05, 0x04, 0xCC, 0xDE, 0xD8,
+    0x03, 0xDD, 0xD8, 0xDE, 0x01, 0xEE, 0xE4, 0xE5, 0x02, 0xFF, 0x10, 0x1D,
+    0xFF, 0xF7, 0xFE, 0x19, 0x06, 0x0B, 0x17, 0x1C, 0xE6, 0xDE, 0xEF, 0xEA,
+    0xF7, 0xF5, 0xEA, 0xF4, 0x06, 0xF6, 0x02, 0x00, 0x0C, 0xFD, 0x15, 0x23,
+    0x0D, 0x08, 0x23, 0x04, 0xFD, 0xD4, 0xDF, 0xE0, 0x06, 0xDB, 0xE8, 0x0D,
+    0xFC, 0x00, 0xE9, 0x05, 0x16, 0x10, 0x0B, 0x0F, 0x01, 0x1E, 0x0B, 0x30,
+    0x1A, 0x34, 0xE0, 0xDC, 0xD5, 0xF0, 0xFE, 0xE8, 0xF8, 0xE8, 0xF0, 0x07,
+    0xEC, 0x00, 0xF4, 0xF2, 0x1E, 0x1A, 0x20, 0x03, 0x24, 0xCA, 0xCE, 0xDC,
+    0xD2, 0xE1, 0xE7, 0xFE, 0xE2, 0xE1, 0x03, 0x0D, 0xF8, 0xFB, 0x03, 0xFA,
+    0x20, 0xF7, 0x24, 0x0A, 0x27, 0x29, 0x17, 0x05, 0xDF, 0xE1, 0xF8, 0xF5,
+    0x09, 0xE3, 0xFD, 0xF3, 0x0C, 0x00, 0xF4, 0x11, 0x1D, 0x1E, 0x0D, 0x01,
+    0x14, 0x04, 0x17, 0xC8, 0xEA, 0xE9, 0xDE, 0xD3, 0xD8, 0xF7, 0x09, 0xE9,
+    0x06, 0xE6, 0xF9, 0xF9, 0x05, 0x02, 0x0A, 0x09, 0x08, 0x14, 0x06, 0x2A,
+    0x2A, 0x31, 0x30, 0x00, 0xDA, 0x00, 0xE5, 0xDF, 0xF7, 0xFE, 0x07, 0xF2,
+    0x10, 0x04, 0xF0, 0x13, 0x23, 0x1B, 0x08, 0x07, 0x23, 0xCD, 0xD1, 0xD3,
+    0xD6, 0xDE, 0xD7, 0xE8, 0xF2, 0xE9, 0x12, 0xF8, 0x03, 0xEC, 0x00, 0xF9,
+    0x14, 0x13, 0x06, 0x0B, 0x14, 0x18, 0x32, 0x1D, 0x2C, 0xE6, 0xF4, 0xF1,
+    0xF8, 0xF1, 0x0C, 0xF3, 0xFE, 0xEB, 0xF1, 0xFB, 0x05, 0xFD, 0x25, 0x0C,
+    0x05, 0x22, 0xDF, 0xEF, 0xD9, 0xDF, 0x00, 0xF7, 0xF7, 0x0A, 0xF3, 0x05,
+    0x0D, 0x13, 0xF5, 0xFC, 0x06, 0x1B, 0x1D, 0x14, 0x0C, 0x1A, 0x25, 0x2A,
+    0x19, 0x0B, 0xFE, 0xE2, 0xF8, 0x00, 0xFD, 0xFB, 0xE8, 0x05, 0xE9, 0x12,
+    0xEF, 0xF2, 0x15, 0x00, 0x07, 0x28, 0x07, 0xE4, 0xE9, 0xE3, 0xFE, 0x00,
+    0xD8, 0xDF, 0xFF, 0xFF, 0x04, 0xE7, 0xF0, 0x07, 0x0E, 0x02, 0x20, 0xF5,
+    0x0C, 0xFC, 0x28, 0x0F, 0x2B, 0x2E, 0x33, 0x1C, 0xFC, 0x01, 0x01, 0xFD,
+    0xE9, 0x0E, 0xE6, 0x12, 0x07, 0xF6, 0x06, 0x18, 0xFC, 0x0A, 0x26, 0x00,
+    0xE1, 0xD1, 0xDA, 0xEF, 0xF6, 0xDA, 0x04, 0xE8, 0xF7, 0xFC, 0xF9, 0x02,
+    0x10, 0xF2, 0x06, 0x00, 0x0B, 0x25, 0x1F, 0x0D, 0x0A, 0x25, 0x0F, 0x28,
+    0x1A, 0x01, 0xF2, 0xF4, 0xEF, 0xF7, 0x03, 0xEA, 0xEF, 0xF4, 0xF8, 0xF0,
+    0xF8, 0x04, 0x0E, 0xFB, 0x1F, 0xF1, 0xCF, 0xF8, 0xD5, 0xD5, 0xFA, 0xF5,
+    0xF2, 0x00, 0x03, 0xEF, 0x12, 0xFC, 0xF7, 0xFB, 0xF1, 0x1C, 0x15, 0x11,
+    0x0B, 0x09, 0x16, 0x04, 0x24, 0x1E, 0x38, 0xF4, 0xE0, 0xED, 0xF3, 0xE1,
+    0xED, 0xF0, 0xFE, 0x17, 0x19, 0x18, 0xF5, 0x0E, 0x1F, 0x29, 0xCC, 0xD6,
+    0xE2, 0xCD, 0xE2, 0xF5, 0xDA, 0x00, 0x03, 0x00, 0xEE, 0x06, 0xFA, 0x11,
+    0x0F, 0xF8, 0x02, 0x0F, 0xFB, 0x20, 0x09, 0x11, 0x2C, 0x18, 0x2D, 0x29,
+    0xFD, 0xDF, 0x06, 0xF9, 0x08, 0x05, 0xEB, 0x13, 0x14, 0x14, 0x08, 0x1A,
+    0xF8, 0x12, 0x0F, 0xF0, 0xE2, 0xE3, 0xFE, 0xF9, 0xF5, 0xED, 0xFA, 0xF3,
+    0xF4, 0xF4, 0xE6, 0x05, 0x11, 0x0D, 0x10, 0x1F, 0x15, 0x07, 0xFF, 0x1C,
+    0x07, 0x0B, 0x0A, 0x27, 0x37, 0xDF, 0xF2, 0xFA, 0xF6, 0xFB, 0x08, 0xF6,
+    0xF6, 0xF7, 0x0D, 0xF8, 0x14, 0x1B, 0x0C, 0xED, 0xD1, 0xD0, 0xDD, 0xCF,
+    0xD8, 0xE8, 0x06, 0xE8, 0x0C, 0xF3, 0x07, 0xF3, 0x0C, 0x17, 0xFD, 0x1F,
+    0x13, 0x00, 0x08, 0x11, 0x12, 0x1C, 0x08, 0x16, 0x16, 0x14, 0xE1, 0x04,
+    0xE5, 0xFE, 0x00, 0xF8, 0x0D, 0x14, 0xF9, 0xFA, 0x03, 0x00, 0xFF, 0xE0,
+    0xC8, 0xE8, 0xE6, 0xD0, 0xD4, 0xF6, 0xFC, 0xF6, 0xE9, 0x0A, 0x06, 0xE7,
+    0x05, 0xFB, 0x0B, 0x0A, 0x0A, 0x00, 0xFA, 0x0B, 0x1E, 0x14, 0x04, 0x25,
+    0x1C, 0x33, 0x33, 0xFD, 0xEE, 0xEA, 0xEE, 0x05, 0xED, 0x14, 0x17, 0x05,
+    0x10, 0x20, 0x26, 0x23, 0xC7, 0xC7, 0xE6, 0xD5, 0xF2, 0xE4, 0xD4, 0xE0,
+    0xF5, 0xEC, 0xE6, 0x00, 0x04, 0x03, 0xF6, 0x1B, 0xFA, 0x02, 0xFD, 0x17,
+    0x0C, 0x1F, 0x2C, 0x09, 0x2D, 0x1F, 0x23, 0xFB, 0x02, 0xE5, 0x01, 0xFE,
+    0xE7, 0xF4, 0x00, 0x18, 0x12, 0xF8, 0x0E, 0x28, 0xE9, 0xD9, 0xE3, 0xCD,
+    0xF5, 0xDA, 0xE6, 0xEE, 0xFA, 0xE1, 0xEE, 0xE4, 0x0B, 0x0F, 0x17, 0x1C,
+    0x05, 0x10, 0x1B, 0xF9, 0x07, 0x1B, 0x04, 0x26, 0x0F, 0x11, 0x2D, 0x3C,
+    0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0x02, 0xF8, 0xFD, 0xF8, 0x0A,
+    0xCA, 0xC9, 0xD5, 0xE5, 0xDA, 0xE3, 0xD5, 0xD6, 0x03, 0xFF, 0x00, 0xF8,
+    0x08, 0xFA, 0x0B, 0xED, 0x03, 0xFB, 0x21, 0xF8, 0x10, 0x22, 0x2A, 0x05,
+    0x1E, 0x1E, 0x0D, 0x26, 0x41, 0xF2, 0x00, 0x00, 0xEE, 0x04, 0xF6, 0x01,
+    0xFC, 0x1B, 0xFE, 0x15, 0xD7, 0xDC, 0xD9, 0xDC, 0xE1, 0xF3, 0xFC, 0xE0,
+    0x00, 0x01, 0xFC, 0x00, 0x06, 0xF4, 0x0D, 0x18, 0xFD, 0xF4, 0x19, 0x11,
+    0x08, 0x2B, 0x08, 0x04, 0x29, 0x0A, 0x33, 0x20, 0x36, 0xFE, 0xFB, 0xE1,
+    0x08, 0x0D, 0x07, 0x05, 0x11, 0x1C, 0xFC, 0x1B, 0xD3, 0xD4, 0xDD, 0xEC,
+    0xE1, 0xD7, 0xF9, 0x03, 0xF5, 0xF4, 0x01, 0xEE, 0xE4, 0x09, 0xE9, 0xFA,
+    0x17, 0x09, 0x19, 0x11, 0x0E, 0x00, 0x06, 0x20, 0x1C, 0x18, 0x2E, 0x3A,
+    0x2B, 0x00, 0xE7, 0xE3, 0xFF, 0x11, 0xF9, 0xF4, 0xF3, 0x0E, 0x00, 0x1F,
+    0xD6, 0xCA, 0xD6, 0xF9, 0xE1, 0xD2, 0x01, 0xEC, 0x01, 0xE8, 0xE2, 0xF2,
+    0xE6, 0x06, 0x0D, 0x14, 0x06, 0x18, 0x11, 0x1F, 0xFF, 0x14, 0x05, 0x24,
+    0x23, 0x21, 0x11, 0x30, 0x12, 0x27, 0xF0, 0xEA, 0xF3, 0xFB, 0x08, 0x01,
+    0x15, 0x00, 0x0E, 0xE4, 0xD3, 0xCC, 0xEB, 0xEA, 0xED, 0xF1, 0xF2, 0xEB,
+    0x00, 0xF5, 0xEE, 0x09, 0xF7, 0xF9, 0xF2, 0x15, 0xF4, 0xFE, 0x04, 0x24,
+    0x08, 0x1E, 0x0B, 0x01, 0x28, 0x16, 0x36, 0x17, 0x3E, 0x42, 0xDF, 0x0E,
+    0xEC, 0xE8, 0xEA, 0xF1, 0x1B, 0x06, 0xF4, 0xEA, 0xD7, 0xDB, 0xDB, 0xE7,
+    0xD4, 0xEC, 0xF9, 0xEE, 0xF2, 0xF8, 0xDE, 0xE6, 0xF2, 0x02, 0x04, 0xF0,
+    0xF5, 0xFD, 0xF5, 0x04, 0x08, 0x0B, 0x17, 0x0B, 0x23, 0x2B, 0x12, 0x26,
+    0x2D, 0x3C, 0xEC, 0x03, 0x0F, 0x10, 0x17, 0x1B, 0x19, 0x0F, 0x19, 0xD6,
+    0xD5, 0xC8, 0xE6, 0xF8, 0xD3, 0xD5, 0xE3, 0xD6, 0xF4, 0xDA, 0x00, 0xFC,
+    0xFA, 0x12, 0x07, 0x05, 0x04, 0xFB, 0x1D, 0xF9, 0x17, 0x1A, 0x01, 0x07,
+    0x0C, 0x25, 0x21, 0x18, 0x32, 0x2C, 0xF3, 0xED, 0xF2, 0xFF, 0xFE, 0x16,
+    0x10, 0x0F, 0xDA, 0xC8, 0xD8, 0xCA, 0xE0, 0xD3, 0xD0, 0xEA, 0xEB, 0xF7,
+    0xFA, 0xEE, 0xFB, 0x08, 0x0E, 0xEF, 0xF8, 0xF1, 0x0A, 0x0E, 0x23, 0xFC,
+    0x1A, 0x12, 0x00, 0x14, 0x0B, 0x30, 0x17, 0x38, 0x34, 0x24, 0xE3, 0xFA,
+    0x04, 0xFF, 0xF5, 0x01, 0x17, 0xFA, 0xC9, 0xCC, 0xD4, 0xDC, 0xD6, 0xDA,
+    0xD2, 0xE9, 0xFD, 0xE6, 0xEE, 0x0A, 0x06, 0xEB, 0xF4, 0x05, 0x03, 0x13,
+    0x03, 0x13, 0x20, 0x04, 0x1D, 0x28, 0x0F, 0x22, 0x34, 0x36, 0x11, 0x13,
+    0x26, 0x21, 0x38, 0xFC, 0xE6, 0x06, 0xEE, 0x01, 0xF7, 0xF2, 0xE3, 0xE8,
+    0xE4, 0xE5, 0xCA, 0xCB, 0xDB, 0xE5, 0x02, 0xE2, 0x08, 0xF9, 0xF9, 0x05,
+    0xF0, 0xFC, 0xED, 0x14, 0x1D, 0x15, 0x0D, 0x11, 0x0C, 0x0D, 0x0E, 0x0E,
+    0x1C, 0x10, 0x21, 0x35, 0x1E, 0x24, 0x31, 0x0B, 0x08, 0xEE, 0x06, 0xFD,
+    0x00, 0xE3, 0xEC, 0xE6, 0xE7, 0xE8, 0xF3, 0xEE, 0xE1, 0xE5, 0xD5, 0xD9,
+    0x07, 0x00, 0xED, 0xE2, 0x13, 0x0A, 0x0E, 0x01, 0xFC, 0x05, 0x05, 0x15,
+    0x23, 0x28, 0x2D, 0x24, 0x1B, 0x15, 0x24, 0x1A, 0x41, 0x16, 0x30, 0x07,
+    0xF5, 0x01, 0xF6, 0x0D, 0x0E, 0xC1, 0xED, 0xC4, 0xDB, 0xCE, 0xD1, 0xE3,
+    0xFD, 0xEE, 0xDE, 0x05, 0xFF, 0xE1, 0xF7, 0x0F, 0x04, 0xFB, 0xEE, 0x12,
+    0xFB, 0x21, 0x0B, 0x1C, 0x2A, 0x1F, 0x1C, 0x28, 0x10, 0x0E, 0x11, 0x32,
+    0x32, 0x1C, 0x2D, 0xF7, 0x11, 0xEF, 0xFC, 0x19, 0xE5, 0xD3, 0xE9, 0xDB,
+    0xD6, 0xF5, 0xDB, 0xED, 0xD0, 0xE7, 0xED, 0xFB, 0x06, 0xF5, 0xFE, 0x08,
+    0xE9, 0xFF, 0x07, 0x06, 0x00, 0x04, 0x07, 0x0F, 0x0E, 0x04, 0x21, 0x06,
+    0x25, 0x12, 0x35, 0x15, 0x40, 0x2F, 0x23, 0xE3, 0x14, 0x04, 0x03, 0x0D,
+    0xC0, 0xD5, 0xEA, 0xCE, 0xE0, 0xD9, 0xDB, 0xFC, 0xF6, 0xFF, 0xFA, 0xE2,
+    0xF7, 0xF9, 0x01, 0xF5, 0x03, 0xF7, 0x12, 0x16, 0x03, 0x15, 0x0F, 0xFE,
+    0x20, 0x00, 0x07, 0x2B, 0x2D, 0x15, 0x1F, 0x28, 0x2E, 0x24, 0x45, 0xF5,
+    0xF5, 0xF7, 0x07, 0xF5, 0xB9, 0xD6, 0xE0, 0xDC, 0xCD, 0xEB, 0xE8, 0xDB,
+    0xD2, 0xDF, 0xED, 0x04, 0xF5, 0xDF, 0x00, 0x11, 0xF0, 0x03, 0xF3, 0x19,
+    0xFC, 0xF9, 0x0F, 0x0B, 0x06, 0x08, 0x1E, 0x09, 0x1D, 0x24, 0x18, 0x36,
+    0x40, 0x1A, 0x1A, 0x0D, 0xF4, 0x14, 0xF5, 0xC4, 0xE1, 0xEA, 0xCE, 0xD1,
+    0xDF, 0xD1, 0xCD, 0xF1, 0xF4, 0x00, 0x01, 0x07, 0xF8, 0xFD, 0xF9, 0x06,
+    0x10, 0x10, 0x1A, 0xFB, 0xFB, 0x1C, 0x06, 0x22, 0x2B, 0x03, 0x2E, 0x0D,
+    0x1D, 0x28, 0x16, 0x11, 0x34, 0x40, 0x3B, 0x3E, 0xEB, 0xF4, 0xED, 0xD9,
+    0xD3, 0xD9, 0xEC, 0xEC, 0xDA, 0xEE, 0xDD, 0xEB, 0xFD, 0x00, 0xF2, 0x04,
+    0xE3, 0xEF, 0xF3, 0xEE, 0xEF, 0xFA, 0x03, 0x00, 0x20, 0x05, 0x18, 0x1F,
+    0x02, 0x15, 0x05, 0x04, 0x1D, 0x26, 0x3B, 0x2F, 0x3E, 0x29, 0x1F, 0x3F,
+    0x03, 0x15, 0xF8, 0xCB, 0xE3, 0xDA, 0xC3, 0xD4, 0xE7, 0xCE, 0xE6, 0xE7,
+    0xD5, 0xEC, 0xF9, 0x04, 0xF9, 0xF1, 0xED, 0xEF, 0xFF, 0xFC, 0xF7, 0x0F,
+    0x18, 0x0C, 0x0F, 0x25, 0x25, 0x22, 0x10, 0x33, 0x10, 0x15, 0x21, 0x14,
+    0x1E, 0x43, 0x27, 0x46, 0xEE, 0x0C, 0xEE, 0xDC, 0xC4, 0xD6, 0xC3, 0xE0,
+    0xDC, 0xF2, 0xCA, 0xF0, 0xD5, 0xE1, 0xE6, 0xF0, 0xFC, 0xF5, 0xED, 0xFB,
+    0xEC, 0xEE, 0x19, 0xF6, 0x06, 0x04, 0x20, 0x16, 0x24, 0xFF, 0x02, 0x25,
+    0x0F, 0x1B, 0x1B, 0x0F, 0x12, 0x36, 0x33, 0x22, 0x3C, 0xEF, 0xF2, 0xCA,
+    0xC7, 0xC8, 0xC1, 0xD8, 0xDC, 0xE0, 0xDD, 0xCC, 0xED, 0xDF, 0xEB, 0xDF,
+    0x08, 0xE2, 0x07, 0xF3, 0xFA, 0xF3, 0x0D, 0xF8, 0xF3, 0x1E, 0x24, 0x1A,
+    0x27, 0x0A, 0x08, 0x2F, 0x29, 0x35, 0x39, 0x1B, 0x19, 0x1C, 0x39, 0x42,
+    0x2D, 0xFD, 0x0C, 0xE4, 0xE2, 0xD7, 0xEB, 0xCC, 0xE2, 0xD2, 0xD7, 0xD7,
+    0xF8, 0xF6, 0xF5, 0xDC, 0x07, 0xEE, 0x07, 0x0A, 0xF9, 0xFD, 0x0B, 0xFF,
+    0x00, 0x0A, 0x21, 0x08, 0x15, 0x0A, 0x11, 0x0C, 0x08, 0x1A, 0x13, 0x0E,
+    0x34, 0x1F, 0x39, 0x3E, 0x23, 0x25, 0x06, 0xB7, 0xDF, 0xBC, 0xE5, 0xD5,
+    0xE0, 0xF0, 0xE2, 0xEC, 0xE3, 0xF9, 0x00, 0xDD, 0xF9, 0xF4, 0xFC, 0xE5,
+    0xEE, 0x0D, 0xEA, 0x16, 0x1D, 0x15, 0x0E, 0xFC, 0xFE, 0x1A, 0x15, 0x0F,
+    0x07, 0x18, 0x37, 0x25, 0x19, 0x28, 0x1B, 0x26, 0x3A, 0x1F, 0xF7, 0xBD,
+    0xE6, 0xD5, 0xC6, 0xE8, 0xDE, 0xEC, 0xD0, 0xD7, 0xF9, 0xD8, 0xF0, 0xE0,
+    0x00, 0xE9, 0x00, 0xE8, 0xF0, 0x13, 0xE9, 0xFB, 0xEF, 0x06, 0x01, 0x1E,
+    0x20, 0x26, 0x20, 0x2E, 0x24, 0x22, 0x14, 0x35, 0x25, 0x1E, 0x38, 0x3D,
+    0x1D, 0x3E, 0x38, 0xC3, 0xDD, 0xCE, 0xBC, 0xC0, 0xE6, 0xD6, 0xF5, 0xF4,
+    0xFB, 0xF0, 0xDD, 0xE9, 0x00, 0xDC, 0x00, 0xE7, 0xEA, 0xF8, 0x12, 0xEA,
+    0x14, 0x1C, 0x12, 0x12, 0x08, 0x0D, 0x11, 0x0C, 0x14, 0x08, 0x07, 0x29,
+    0x39, 0x18, 0x3C, 0x26, 0x2B, 0x2D, 0x4A, 0x0C, 0xB9, 0xC6, 0xC4, 0xDA,
+    0xE6, 0xD5, 0xDD, 0xEC, 0xE9, 0xF3, 0xD5, 0xF1, 0xEE, 0xEC, 0xFB, 0x07,
+    0xEB, 0xFB, 0xF3, 0xEF, 0x08, 0x05, 0x1A, 0x0C, 0x07, 0x21, 0x19, 0x17,
+    0x01, 0x05, 0x12, 0x1D, 0x38, 0x36, 0x2F, 0x21, 0x2E, 0x38, 0x2D, 0x2E,
+    0xFA, 0xB8, 0xC8, 0xE6, 0xD2, 0xC6, 0xCC, 0xEC, 0xD7, 0xE8, 0xF6, 0xF1,
+    0xFD, 0xDB, 0x06, 0xE4, 0xF7, 0xE9, 0xFF, 0x08, 0x04, 0x11, 0xFB, 0x15,
+    0xF4, 0x12, 0x14, 0x03, 0x0C, 0x15, 0x19, 0x14, 0x2D, 0x2C, 0x1D, 0x1D,
+    0x30, 0x35, 0x2D, 0x35, 0xF0, 0xF9, 0xE2, 0xBD, 0xD5, 0xDA, 0xC5, 0xE5,
+    0xE7, 0xE0, 0xEA, 0xEF, 0xF8, 0xDE, 0xF6, 0xEB, 0xF7, 0xE0, 0x09, 0xF9,
+    0x07, 0x02, 0xF4, 0xFC, 0x1C, 0x01, 0x25, 0x25, 0x04, 0x11, 0x04, 0x13,
+    0x23, 0x2A, 0x0F, 0x13, 0x17, 0x33, 0x2B, 0x3A, 0x1C, 0x16, 0x0C, 0xBB,
+    0xC8, 0xE6, 0xCB, 0xD0, 0xCD, 0xCD, 0xF5, 0xEA, 0xD4, 0xD8, 0xF5, 0xDE,
+    0x07, 0xFC, 0x03, 0xEE, 0xE6, 0xEF, 0xF2, 0x00, 0x00, 0x1A, 0x1F, 0xF8,
+    0x03, 0x26, 0x0C, 0x26, 0x13, 0x1B, 0x11, 0x34, 0x25, 0x37, 0x1A, 0x1C,
+    0x48, 0xF4, 0xEF, 0xFE, 0xC9, 0xC5, 0xC8, 0xEB, 0xE3, 0xCA, 0xCE, 0xF3,
+    0xD8, 0xEE, 0xDC, 0xF2, 0xF0, 0xDA, 0x03, 0x0D, 0xF0, 0xF8, 0xFF, 0xF0,
+    0x1B, 0x00, 0x03, 0x16, 0x07, 0x07, 0x23, 0x2D, 0x30, 0x1A, 0x0C, 0x20,
+    0x25, 0x27, 0x28, 0x3E, 0x26, 0x32, 0x07, 0xF2, 0xEF, 0xD4, 0xCE, 0xE3,
+    0xC6, 0xE7, 0xC8, 0xED, 0xD2, 0xCC, 0xDD, 0xF6, 0xFF, 0xF4, 0xD9, 0xF4,
+    0xFF, 0x0D, 0xFA, 0xF0, 0x17, 0x0F, 0x11, 0x15, 0xFD, 0x00, 0x05, 0x18,
+    0x21, 0x17, 0x17, 0x14, 0x29, 0x35, 0x12, 0x3A, 0x27, 0x42, 0x44, 0x04,
+    0xF6, 0x02, 0xF2, 0xCD, 0xCA, 0xD9, 0xC9, 0xD0, 0xC8, 0xDC, 0xE7, 0xE8,
+    0xEE, 0xF3, 0xDC, 0xFF, 0xF0, 0xE2, 0x07, 0x02, 0xEA, 0xFA, 0xF7, 0x0B,
+    0x03, 0x1C, 0x14, 0x24, 0xFF, 0xFF, 0x26, 0x23, 0x0C, 0x34, 0x30, 0x2C,
+    0x18, 0x17, 0x18, 0x2F, 0xF6, 0xFF, 0xFC, 0xEF, 0xD2, 0xD6, 0xCB, 0xE3,
+    0xCD, 0xF2, 0xD3, 0xDE, 0xE0, 0xF6, 0xE6, 0xF8, 0xE9, 0xEB, 0xFE, 0x01,
+    0xFD, 0xE6, 0x08, 0x0E, 0x19, 0x0E, 0xFD, 0x00, 0x08, 0xFC, 0x19, 0x07,
+    0x15, 0x21, 0x23, 0x35, 0x39, 0x14, 0x1C, 0x20, 0x3B, 0x12, 0x01, 0x0D,
+    0x03, 0x10, 0xCD, 0xD1, 0xE7, 0xE5, 0xDA, 0xC8, 0xE0, 0xE5, 0xE2, 0xE4,
+    0xEB, 0xE2, 0xEA, 0xE4, 0xE0, 0x0C, 0x13, 0x05, 0xF3, 0x0B, 0x0B, 0x04,
+    0x17, 0x23, 0x12, 0x1D, 0x14, 0x2F, 0x18, 0x1F, 0x24, 0x1E, 0x1C, 0x16,
+    0x36, 0x2B, 0x03, 0x0C, 0x14, 0x0D, 0xF4, 0x16, 0xCB, 0xE9, 0xE5, 0xD0,
+    0xE6, 0xE2, 0xE9, 0xDD, 0xFD, 0xF3, 0xFB, 0xE6, 0xE5, 0xE8, 0xEC, 0xE6,
+    0xF3, 0xF7, 0x0B, 0x0C, 0x1D, 0xF3, 0x21, 0x13, 0x1E, 0x07, 0x1B, 0x1A,
+    0x1F, 0x2F, 0x21, 0x22, 0x3D, 0x2B, 0x42, 0xE1, 0xF2, 0x08, 0x07, 0x1A,
+    0x0C, 0xF5, 0xC6, 0xC6, 0xF0, 0xE3, 0xC8, 0xE9, 0xF6, 0xF0, 0xFC, 0xD5,
+    0xDB, 0xDA, 0xF8, 0x0C, 0xFD, 0xF5, 0xEB, 0x04, 0xFD, 0x19, 0xFD, 0xF7,
+    0xF8, 0xFE, 0x27, 0x22, 0x03, 0x30, 0x1B, 0x32, 0x17, 0x1B, 0x25, 0x39,
+    0x44, 0xED, 0x0C, 0x03, 0x05, 0xF3, 0x0C, 0xCD, 0xD7, 0xC6, 0xD2, 0xDD,
+    0xD5, 0xF0, 0xED, 0xE8, 0xE9, 0xD6, 0xEB, 0xFD, 0xFD, 0x06, 0xEE, 0xFC,
+    0x09, 0xF9, 0x0C, 0xF9, 0xFC, 0x1A, 0x1F, 0xFB, 0x20, 0x01, 0x05, 0x11,
+    0x29, 0x38, 0x1B, 0x23, 0x28, 0x3C, 0xF8, 0xE4, 0x00, 0x00, 0x06, 0xEF,
+    0xF2, 0x15, 0xBE, 0xC4, 0xCC, 0xD4, 0xF4, 0xF6, 0xEA, 0xD7, 0xE5, 0xFE,
+    0xE9, 0xEC, 0xEA, 0xEA, 0xEC, 0xEC, 0x0F, 0xF1, 0xF9, 0x0A, 0x09, 0x1A,
+    0x1E, 0x13, 0x06, 0x11, 0x2D, 0x29, 0x2B, 0x0D, 0x22, 0x36, 0x20, 0x3A,
+    0xE9, 0x02, 0x00, 0x0B, 0x14, 0x0F, 0x0B, 0x0A, 0xC7, 0xE9, 0xE0, 0xC7,
+    0xCB, 0xDA, 0xF8, 0xF6, 0xEB, 0xE9, 0xF2, 0xDF, 0x02, 0x0A, 0x02, 0x04,
+    0xFC, 0x10, 0x04, 0x1A, 0xF8, 0x15, 0xFA, 0x27, 0x0C, 0x16, 0x1A, 0x16,
+    0x17, 0x14, 0x11, 0x1B, 0x1C, 0x17, 0xF3, 0x07, 0x0A, 0xE8, 0xEC, 0x08,
+    0xF6, 0x00, 0xEC, 0xD6, 0xCF, 0xE9, 0xEE, 0xD5, 0xEF, 0xF1, 0xDB, 0xDE,
+    0xEC, 0xFE, 0xFF, 0xE5, 0xFA, 0xE8, 0xF7, 0xED, 0x07, 0xFE, 0x1C, 0xF6,
+    0x17, 0x07, 0x00, 0x21, 0x24, 0x12, 0x2D, 0x2C, 0x37, 0x0F, 0x38, 0xDE,
+    0x05, 0x03, 0xF6, 0x01, 0xF2, 0x15, 0xFE, 0x12, 0xEA, 0xD2, 0xE0, 0xF1,
+    0xCC, 0xE0, 0xF1, 0xE9, 0xF1, 0xF4, 0xF3, 0xE1, 0xEA, 0xE1, 0xF3, 0x0A,
+    0xF8, 0xF9, 0x01, 0xF1, 0x1B, 0x1F, 0x24, 0x17, 0xFF, 0x00, 0x24, 0x0E,
+    0x15, 0x23, 0x15, 0x23, 0x3C, 0x09, 0xF9, 0xF0, 0xEE, 0xEA, 0xED, 0x0D,
+    0x0F, 0x0D, 0x19, 0xC3, 0xC8, 0xE3, 0xF1, 0xF8, 0xDE, 0xD9, 0xF8, 0xD8,
+    0xDB, 0xFD, 0xEA, 0xF2, 0xE6, 0x0C, 0xED, 0xFB, 0x12, 0x04, 0x07, 0xFC,
+    0x0E, 0x0F, 0x11, 0x0F, 0x01, 0x0E, 0x2F, 0x25, 0x28, 0x0F, 0x21, 0xF6,
+    0xFC, 0x08, 0xEC, 0x11, 0x0C, 0xEC, 0x1B, 0x0C, 0x0B, 0xDB, 0xE7, 0xE8,
+    0xE7, 0xED, 0xD7, 0xD3, 0xF9, 0xDE, 0xE5, 0xF4, 0xE8, 0xE6, 0xE3, 0xEC,
+    0xFC, 0xF9, 0xEC, 0xF0, 0x17, 0xF4, 0x20, 0x23, 0xFF, 0x00, 0x27, 0x2C,
+    0x1E, 0x0E, 0x1F, 0x37, 0x35, 0x02, 0x0B, 0xE8, 0x07, 0x07, 0xFC, 0x0B,
+    0x19, 0x1C, 0x1F, 0x1A, 0xEF, 0xD3, 0xD6, 0xC9, 0xF1, 0xCE, 0xFC, 0xFD,
+    0xD9, 0xDC, 0xEB, 0xF0, 0x06, 0xED, 0xFE, 0xFC, 0xFB, 0xFB, 0x1C, 0xF4,
+    0x0F, 0x01, 0x11, 0x18, 0x24, 0x13, 0x10, 0x13, 0x29, 0x22, 0x34, 0x1E,
+    0xFB, 0x0B, 0xEF, 0xF5, 0x04, 0xF9, 0x00, 0x15, 0xF9, 0x13, 0x21, 0xD9,
+    0xDF, 0xD8, 0xF4, 0xF3, 0xED, 0xEC, 0xEA, 0xD8, 0xE2, 0x00, 0xF1, 0x05,
+    0xF4, 0x00, 0x0B, 0x0C, 0x10, 0x16, 0x05, 0x1B, 0x1D, 0x17, 0x25, 0x2C,
+    0x2F, 0x11, 0x26, 0x1B, 0x1B, 0x28, 0xFB, 0xFD, 0xEE, 0x0F, 0xFD, 0x12,
+    0xFA, 0x18, 0x01, 0xFB, 0x23, 0x04, 0xD6, 0xE6, 0xF0, 0xE3, 0xE8, 0xF3,
+    0xF9, 0xD9, 0xEF, 0x08, 0x04, 0x00, 0xF9, 0x06, 0x0F, 0xFE, 0x16, 0x00,
+    0xFB, 0x22, 0x08, 0x03, 0x02, 0x16, 0x13, 0x06, 0x30, 0x1A, 0x0C, 0x11,
+    0xFE, 0xF0, 0x0A, 0x00, 0xE9, 0xEE, 0x0C, 0x04, 0x13, 0x0D, 0xF6, 0x20,
+    0xCB, 0xE5, 0xDD, 0xD2, 0xE0, 0xF9, 0xEB, 0xD9, 0xF4, 0xEE, 0xDE, 0xF9,
+    0x0B, 0x06, 0x12, 0xEE, 0x02, 0xF0, 0xFE, 0x17, 0x16, 0xFE, 0x1D, 0x03,
+    0x17, 0x1B, 0x20, 0x1F, 0x22, 0x27, 0xFF, 0xFA, 0xF1, 0xE3, 0x0D, 0x0A,
+    0x12, 0xEB, 0x15, 0x03, 0x0E, 0x15, 0x05, 0xE4, 0xE5, 0xCD, 0xD2, 0xEA,
+    0xFC, 0xF6, 0x03, 0xDB, 0x05, 0xF8, 0xFF, 0xED, 0x06, 0x03, 0x10, 0x15,
+    0x0A, 0xFF, 0xF6, 0x1C, 0x0F, 0x21, 0x2A, 0x02, 0x27, 0x11, 0x13, 0x1B,
+    0x35, 0x02, 0x09, 0x05, 0x02, 0x07, 0xFD, 0x16, 0x00, 0xF6, 0x06, 0x1B,
+    0x09, 0xFE, 0xD5, 0xF3, 0xDC, 0xF9, 0xE9, 0xE0, 0xDD, 0xE5, 0xE2, 0xE6,
+    0xF4, 0xF4, 0xE5, 0xED, 0x07, 0x06, 0xFA, 0x0B, 0x05, 0xF5, 0x20, 0x0C,
+    0x24, 0x19, 0x09, 0x06, 0x13, 0x24, 0x31, 0xED, 0xEF, 0xF1, 0x09, 0x10,
+    0xF3, 0xE9, 0xF5, 0x14, 0xF8, 0xF4, 0x0F, 0x22, 0x1B, 0xE5, 0xD6, 0xE8,
+    0xE3, 0xD1, 0xD6, 0xF9, 0xE4, 0xF5, 0x06, 0xF8, 0x06, 0x06, 0x04, 0xFB,
+    0x14, 0xFA, 0x02, 0x14, 0x15, 0x19, 0x25, 0x26, 0x08, 0x1E, 0x15, 0x23,
+    0x1E, 0x36, 0xF1, 0xF8, 0xFF, 0xF1, 0xE3, 0x0B, 0xE9, 0x06, 0x16, 0xF9,
+    0x0B, 0x10, 0x23, 0x11, 0xDF, 0xE8, 0xCF, 0xFB, 0xDE, 0xEF, 0xDD, 0xED,
+    0xE2, 0xE1, 0x0A, 0x09, 0xF5, 0x0A, 0xF3, 0xF0, 0x0F, 0x06, 0xFF, 0x01,
+    0x01, 0x17, 0x24, 0x21, 0x28, 0x23, 0x2D, 0x2B, 0xE4, 0xFA, 0x00, 0x08,
+    0x00, 0xE9, 0xED, 0x0D, 0x13, 0xF9, 0xFB, 0x14, 0x07, 0x08, 0x01, 0xC9,
+    0xD7, 0xE0, 0xD4, 0xF2, 0xFD, 0xEF, 0xFE, 0xFD, 0xEB, 0xFF, 0x0F, 0xE6,
+    0xFC, 0x13, 0x01, 0x04, 0xFD, 0x22, 0x0B, 0xFC, 0x06, 0x2C, 0x2D, 0x2D,
+    0x33, 0x09, 0xE9, 0xFE, 0xE7, 0xEB, 0xE0, 0x0A, 0xFC, 0xFC, 0x0D, 0xEE,
+    0xF4, 0x0F, 0x1B, 0x1D, 0x0D, 0x1F, 0xC8, 0xF7, 0xE5, 0xF8, 0xEA, 0xD6,
+    0x02, 0x04, 0xFF, 0xF1, 0xFC, 0xE6, 0x0E, 0xF3, 0x11, 0x0D, 0x10, 0x20,
+    0xFD, 0x1D, 0x25, 0x1D, 0x19, 0x2A, 0x20, 0x1A, 0x0D, 0x00, 0xF5, 0xF3,
+    0xEF, 0x00, 0xE7, 0xE9, 0xEB, 0x00, 0x0A, 0xF2, 0x17, 0x1B, 0x12, 0x08,
+    0x11, 0xF2, 0xED, 0xD0, 0xF1, 0xE8, 0xFA, 0xF2, 0xF8, 0xE5, 0x0D, 0x00,
+    0xF0, 0xFD, 0x15, 0xEC, 0x0B, 0x0A, 0x15, 0x1F, 0x02, 0x12, 0x05, 0x0F,
+    0x28, 0x2C, 0x18, 0xF7, 0xE0, 0xED, 0xEE, 0x07, 0xF5, 0x0D, 0xE9, 0x0F,
+    0x12, 0x1A, 0x10, 0x00, 0x02, 0x20, 0x24, 0x15, 0xD9, 0xE7, 0xD0, 0xF0,
+    0xFD, 0xD9, 0xF7, 0x05, 0xF0, 0x05, 0xFF, 0xEB, 0xFE, 0xF7, 0x08, 0xFB,
+    0xFA, 0xFB, 0x1C, 0x08, 0x16, 0x13, 0x23, 0x0F, 0x2F, 0x1F, 0xDB, 0xDD,
+    0xE5, 0xEA, 0xFB, 0xEF, 0x01, 0xF4, 0xF0, 0xF7, 0xFA, 0x12, 0x19, 0x16,
+    0xFC, 0x03, 0x28, 0xCC, 0xEA, 0xF3, 0xDA, 0xEC, 0x02, 0x00, 0xE7, 0xE9,
+    0x0C, 0x02, 0x13, 0xF2, 0xF5, 0x19, 0xF3, 0x1E, 0x1C, 0xFF, 0x12, 0xFD,
+    0x2D, 0x07, 0x19, 0x12, 0xF7, 0xE3, 0xFA, 0x05, 0xEF, 0xE7, 0x0D, 0xFF,
+    0x02, 0x00, 0xF2, 0x1D, 0x1F, 0x20, 0x02, 0x08, 0x22, 0x11, 0xEB, 0xF3,
+    0xE0, 0xD4, 0xF4, 0xF8, 0xEE, 0xEA, 0xFA, 0xEF, 0xEA, 0xFD, 0x05, 0x10,
+    0x15, 0x19, 0xF9, 0x00, 0x02, 0x24, 0x04, 0x26, 0x25, 0x12, 0xEC, 0xF0,
+    0xD8, 0xE6, 0xF0, 0xF2, 0x02, 0xF0, 0x0B, 0xF6, 0x09, 0x18, 0x00, 0xF9,
+    0xFB, 0x01, 0x0A, 0x1A, 0x00, 0xD4, 0xF7, 0xD9, 0xFA, 0xF3, 0xDE, 0xE8,
+    0xE5, 0xEC, 0x02, 0x13, 0x02, 0xFF, 0x0C, 0x10, 0x11, 0x0C, 0x11, 0x15,
+    0x13, 0x0D, 0x1B, 0x13, 0x34, 0xDE, 0xD8, 0xE0, 0xDD, 0xE3, 0xFF, 0x03,
+    0xE6, 0x0A, 0x00, 0x16, 0xF5, 0x14, 0x09, 0x14, 0x08, 0x09, 0x01, 0xD8,
+    0xDF, 0xE6, 0x00, 0xF7, 0xF6, 0xDC, 0x08, 0xF6, 0xEB, 0x04, 0xF7, 0x00,
+    0x17, 0x15, 0x00, 0x00, 0x21, 0x05, 0x1F, 0x2B, 0x16, 0x16, 0x1A, 0xF2,
+    0xE1, 0xDC, 0xED, 0xF3, 0x09, 0xF6, 0xEC, 0xFF, 0x0B, 0xF0, 0xFD, 0x10,
+    0x1E, 0xFB, 0x23, 0x13, 0x09, 0x09, 0xD7, 0xE8, 0xE3, 0xE5, 0x02, 0xFA,
+    0xF1, 0x03, 0x00, 0xE9, 0xEA, 0xF2, 0xEC, 0x12, 0x19, 0xF5, 0x09, 0x1B,
+    0x15, 0x28, 0x02, 0x2F, 0x0C, 0xE1, 0x02, 0xEE, 0xE9, 0xE0, 0xE3, 0xF8,
+    0xFF, 0x0C, 0x0F, 0xFE, 0x0D, 0x16, 0x09, 0xFD, 0x06, 0xFB, 0x28, 0x1D,
+    0x1F, 0xD4, 0xE8, 0xE1, 0x04, 0xE8, 0x00, 0x0B, 0x08, 0xF9, 0x05, 0x0B,
+    0x13, 0x0B, 0x0D, 0xFE, 0x20, 0xF9, 0x04, 0xFE, 0x25, 0x13, 0x2E, 0xDE,
+    0xD7, 0x02, 0xFB, 0xFE, 0xE3, 0xF3, 0xEC, 0xF6, 0x04, 0xF4, 0x17, 0x13,
+    0x1F, 0xFD, 0x1C, 0x24, 0x16, 0x08, 0x10, 0xDC, 0xE8, 0xD6, 0xF7, 0xE2,
+    0xFB, 0x03, 0xF6, 0xED, 0x04, 0x0D, 0xED, 0x1A, 0x18, 0xFE, 0x08, 0xF9,
+    0x19, 0xFE, 0x1F, 0x22, 0x15, 0xE4, 0xD8, 0xDB, 0xFD, 0xEF, 0xF1, 0x08,
+    0xE8, 0xEB, 0xEC, 0xFF, 0x1A, 0xF3, 0x09, 0x0B, 0x20, 0x19, 0x28, 0x27,
+    0x0A, 0xE6, 0xFD, 0x00, 0xF7, 0xEA, 0xE1, 0xFF, 0xE2, 0xF6, 0xEE, 0xEC,
+    0xFF, 0xFE, 0x17, 0x0D, 0x09, 0x19, 0x0B, 0x21, 0x03, 0x21, 0xE0, 0xF8,
+    0xEB, 0xE6, 0xFC, 0x04, 0x00, 0xFD, 0x0E, 0xFA, 0x0D, 0xF4, 0x08, 0xFB,
+    0xF6, 0xFF, 0x0E, 0x21, 0x0E, 0x22, 0x26, 0x28, 0xFE, 0xE6, 0xD8, 0xFD,
+    0xE9, 0xE3, 0xEA, 0x10, 0x0D, 0xEF, 0x02, 0x00, 0x09, 0xF9, 0xF9, 0x0E,
+    0x03, 0x08, 0x27, 0x1A, 0xDE, 0xE0, 0xED, 0x00, 0xF7, 0xFA, 0xE7, 0x0B,
+    0xF2, 0xF4, 0xF3, 0x0D, 0x18, 0x13, 0x06, 0x00, 0x00, 0x04, 0xFF, 0x27,
+    0x1E, 0x13, 0xD3, 0xEF, 0xD8, 0x04, 0xE3, 0xF0, 0xE4, 0x07, 0xEF, 0xEB,
+    0x13, 0xF5, 0x13, 0x0E, 0x14, 0xFD, 0x0A, 0x1A, 0x0B, 0x14, 0xEA, 0xF2,
+    0xE7, 0xE0, 0xFC, 0xED, 0x08, 0x05, 0x0D, 0x00, 0xF3, 0xF3, 0xF5, 0x17,
+    0xF4, 0x05, 0x22, 0x01, 0x16, 0x29, 0x1B, 0x2E, 0xFF, 0xE5, 0xFB, 0xEB,
+    0xFC, 0x04, 0x06, 0x07, 0xEE, 0x08, 0xF6, 0x1B, 0x06, 0xFB, 0xF7, 0x25,
+    0x0B, 0x16, 0x2B, 0xE1, 0xD6, 0xE7, 0xE1, 0xFF, 0xF4, 0x09, 0xED, 0xF7,
+    0xE7, 0x05, 0x10, 0x12, 0xF1, 0x05, 0x01, 0xFD, 0x21, 0xFD, 0x2B, 0x2A,
+    0x19, 0x09, 0xE2, 0xE7, 0xF2, 0xF3, 0x01, 0x02, 0x03, 0x0E, 0x12, 0xF9,
+    0x0C, 0xF4, 0x07, 0x10, 0x16, 0x03, 0x07, 0x2B, 0xEB, 0xDA, 0xD5, 0xFD,
+    0xDC, 0xFF, 0xEA, 0xFE, 0xEB, 0x05, 0x0B, 0xEB, 0x08, 0xF2, 0x11, 0xFD,
+    0x04, 0x13, 0x13, 0x28, 0x00, 0x0B, 0x14, 0xE9, 0xE0, 0xDA, 0xED, 0xF5,
+    0xEC, 0x0E, 0xEE, 0xF8, 0xEC, 0xFD, 0xF1, 0xF5, 0x17, 0x0C, 0xFF, 0xFD,
+    0x14, 0xE1, 0xEC, 0xF7, 0xFC, 0xE3, 0xDB, 0xDE, 0x02, 0x03, 0x00, 0xEB,
+    0xF4, 0x05, 0x0D, 0x16, 0x11, 0x06, 0xFF, 0x11, 0x17, 0x29, 0x0D, 0x2F,
+    0x22, 0xE2, 0xF1, 0xDE, 0xEE, 0xE7, 0xFF, 0xFD, 0xF4, 0xF5, 0x03, 0x15,
+    0x16, 0x04, 0xF6, 0x0A, 0x11, 0x07, 0xE6, 0xDB, 0xDA, 0xEC, 0xDB, 0xFD,
+    0x02, 0x02, 0xED, 0xE5, 0x06, 0x04, 0xF5, 0xF0, 0x01, 0x07, 0x1D, 0x1B,
+    0x23, 0x0F, 0x25, 0x14, 0x1A, 0x25, 0xE6, 0xDB, 0xDD, 0xF3, 0xE8, 0xF0,
+    0xEB, 0xF3, 0xEB, 0xF0, 0xF5, 0x1C, 0x1B, 0x11, 0x18, 0x0B, 0x26, 0xDF,
+    0xE4, 0xDE, 0xE5, 0xF8, 0xF5, 0x03, 0x03, 0xF9, 0xED, 0x00, 0xFC, 0x0D,
+    0xFF, 0x0F, 0x0F, 0x06, 0x10, 0x07, 0x15, 0x0A, 0x1C, 0x14, 0x0C, 0x33,
+    0xE7, 0xDC, 0xE9, 0xF8, 0xE4, 0xE7, 0x02, 0xF7, 0xFD, 0x0D, 0xFD, 0x18,
+    0x07, 0x09, 0x22, 0x1E, 0xEB, 0xD5, 0xF3, 0xFD, 0xDD, 0xDA, 0x03, 0xFA,
+    0xE4, 0xEE, 0x00, 0xF1, 0x02, 0xF9, 0x03, 0xFF, 0x15, 0x18, 0xFB, 0x07,
+    0x00, 0x1A, 0x16, 0x09, 0x34, 0xEA, 0xFB, 0xDF, 0x09, 0xE5, 0xF9, 0xF5,
+    0x12, 0xED, 0x0E, 0x0B, 0x00, 0x03, 0x1F, 0x00, 0xEF, 0xE0, 0xDD, 0xF6,
+    0xEC, 0xEC, 0xF6, 0xF9, 0xE0, 0xE9, 0xE9, 0xF9, 0x13, 0xF7, 0x00, 0x04,
+    0x0D, 0x04, 0x13, 0x12, 0x1B, 0x25, 0x04, 0x2F, 0x1E, 0x0B, 0xE0, 0xF1,
+    0x03, 0xFD, 0xF1, 0x07, 0x04, 0x08, 0xF4, 0xF0, 0x17, 0x15, 0x24, 0x14,
+    0xCF, 0xE4, 0xD5, 0xD1, 0xEA, 0xE4, 0xE2, 0xF3, 0xEF, 0xFC, 0xE5, 0x06,
+    0xEB, 0x16, 0x0D, 0x14, 0x1E, 0x09, 0x10, 0xFB, 0x28, 0x07, 0x13, 0x29,
+    0x2E, 0x0E, 0xDA, 0xDF, 0xF4, 0xEC, 0x05, 0x00, 0x0B, 0xF5, 0xEF, 0x03,
+    0xF8, 0x15, 0x1F, 0xFB, 0x15, 0xF2, 0xF0, 0xDE, 0xD2, 0xF9, 0xF3, 0xE2,
+    0xF7, 0xE0, 0xF4, 0x03, 0xF0, 0x06, 0xFF, 0xF7, 0x0A, 0xFD, 0x08, 0x11,
+    0x16, 0x24, 0x06, 0x0E, 0x11, 0x20, 0x12, 0xEE, 0x08, 0xF2, 0xF1, 0xE9,
+    0x06, 0xE9, 0xFF, 0x0D, 0x15, 0xF7, 0x14, 0x03, 0x0A, 0xDE, 0xF5, 0xD4,
+    0xE0, 0xEF, 0xF1, 0xFB, 0xFE, 0xE9, 0x01, 0xFD, 0xFA, 0xF2, 0x00, 0x18,
+    0x18, 0xFB, 0xFA, 0x24, 0x16, 0x15, 0x03, 0x23, 0x1C, 0x0C, 0x1C, 0xEC,
+    0xEC, 0xF8, 0xE3, 0x10, 0xEC, 0xEB, 0xF3, 0xF6, 0x0C, 0x1F, 0x1D, 0x0C,
+    0xC7, 0xD0, 0xF8, 0xFB, 0xF7, 0xFF, 0xF5, 0xF4, 0x02, 0xFB, 0x0C, 0xFA,
+    0x04, 0xED, 0x02, 0xF8, 0x18, 0x1A, 0xF9, 0x04, 0x0C, 0x04, 0x29, 0x2D,
+    0x25, 0x0C, 0x1D, 0xFB, 0xEE, 0xFF, 0x01, 0x02, 0xE9, 0x04, 0x18, 0x19,
+    0x18, 0x05, 0x0F, 0x11, 0xDE, 0xEA, 0xE0, 0xDE, 0xF0, 0xED, 0xF4, 0xDD,
+    0xE1, 0xDF, 0xF6, 0xF5, 0xE9, 0xEB, 0xF7, 0x05, 0x00, 0x06, 0x0C, 0x11,
+    0x24, 0x15, 0x1D, 0x1C, 0x0B, 0x0D, 0x35, 0x03, 0xEF, 0xFF, 0xFD, 0xF4,
+    0xFB, 0x09, 0x08, 0xFC, 0x1A, 0xF8, 0x00, 0x14, 0xF4, 0xF0, 0xE4, 0xF8,
+    0xF7, 0xEE, 0xDD, 0x03, 0xE2, 0xF0, 0x09, 0xE8, 0xEB, 0x09, 0xF6, 0x05,
+    0x16, 0x00, 0x23, 0x25, 0x20, 0x03, 0x1A, 0x28, 0x16, 0x2D, 0x23, 0x02,
+    0x05, 0xFB, 0xEC, 0x06, 0x0F, 0x01, 0xF7, 0x1A, 0x07, 0x09, 0x12, 0xC8,
+    0xDC, 0xEA, 0xF5, 0xD7, 0xDD, 0x02, 0x04, 0xEA, 0x06, 0xFC, 0x08, 0xFA,
+    0x0E, 0xFC, 0x05, 0x00, 0x0D, 0x0E, 0xFB, 0x01, 0x1B, 0x04, 0x2E, 0x2F,
+    0x1F, 0x0F, 0x24, 0xEA, 0xF5, 0xE9, 0xEF, 0x00, 0x02, 0x00, 0x14, 0x0B,
+    0x00, 0x00, 0xD4, 0xC9, 0xD2, 0xE6, 0xFA, 0xD9, 0xF5, 0x02, 0xE6, 0xEC,
+    0xEF, 0x08, 0x00, 0xF9, 0x01, 0x09, 0xF6, 0x0C, 0x0F, 0xF8, 0xFC, 0x20,
+    0x0B, 0x2A, 0x0F, 0x18, 0x14, 0x1E, 0x2F, 0xF9, 0x0B, 0x04, 0xFC, 0xEA,
+    0xF9, 0x0F, 0x16, 0xF6, 0x03, 0xD8, 0xD2, 0xE2, 0xD7, 0xD0, 0xE7, 0xFA,
+    0xF9, 0xFA, 0xFF, 0xEF, 0xFD, 0x0C, 0x10, 0xFC, 0x07, 0xF2, 0x1A, 0x11,
+    0x0C, 0x1B, 0x25, 0x0E, 0x22, 0x14, 0x26, 0x32, 0x15, 0x30, 0xF1, 0xF3,
+    0xF3, 0xF9, 0x14, 0xED, 0x0F, 0x13, 0x13, 0x02, 0xF0, 0xEE, 0xE6, 0xF1,
+    0xD0, 0xF2, 0xFC, 0xE8, 0xE2, 0x00, 0xE1, 0xFC, 0xFD, 0xF0, 0xF8, 0xF0,
+    0x19, 0xFF, 0x1B, 0x1B, 0x25, 0x0C, 0x13, 0x0A, 0x06, 0x11, 0x21, 0x16,
+    0x1F, 0x00, 0xE6, 0x01, 0xF4, 0xFB, 0x13, 0x10, 0x0A, 0x00, 0xC3, 0xEC,
+    0xD9, 0xD9, 0xDB, 0xF3, 0xF9, 0xD7, 0xFC, 0xDD, 0xF5, 0x02, 0x07, 0xF5,
+    0xF2, 0x02, 0x17, 0x09, 0x00, 0x13, 0x13, 0x06, 0x18, 0x02, 0x17, 0x25,
+    0x0F, 0x2B, 0x36, 0x36, 0xF1, 0xE8, 0xF3, 0xF7, 0x15, 0x14, 0x18, 0x0A,
+    0x02, 0xC7, 0xC7, 0xCB, 0xF0, 0xF5, 0xEA, 0xFD, 0xD6, 0xFD, 0xF4, 0x03,
+    0x08, 0xFA, 0x0B, 0xFE, 0xF9, 0x17, 0x13, 0x11, 0x07, 0x20, 0x23, 0x13,
+    0x1D, 0x2A, 0x22, 0x1D, 0x23, 0x36, 0x1E, 0xE9, 0xF5, 0xFA, 0x00, 0x16,
+    0xFA, 0x07, 0xFC, 0xE5, 0xEC, 0xE8, 0xE3, 0xCF, 0xDC, 0xF6, 0xEE, 0xFA,
+    0xFC, 0x02, 0x04, 0xF8, 0x07, 0xF6, 0x07, 0x0D, 0x12, 0x0E, 0x15, 0xFB,
+    0x0A, 0x09, 0x01, 0x2C, 0x23, 0x21, 0x11, 0x22, 0x1D, 0x17, 0x0C, 0xEC,
+    0x04, 0x0C, 0xFC, 0xEF, 0x00, 0x0B, 0xCC, 0xDE, 0xE2, 0xD0, 0xE4, 0xDE,
+    0xFB, 0xE7, 0xEB, 0x00, 0xF8, 0xED, 0xF8, 0xED, 0x05, 0x00, 0x0B, 0xFE,
+    0x1F, 0x18, 0x18, 0x25, 0x13, 0x0B, 0x13, 0x0C, 0x25, 0x24, 0x21, 0x1C,
+    0xFF, 0x06, 0xFF, 0x11, 0x06, 0x13, 0x1B, 0xF7, 0xC7, 0xCF, 0xEB, 0xCE,
+    0xF9, 0xFB, 0xEB, 0xFA, 0xE6, 0xE0, 0x06, 0x02, 0xEA, 0x01, 0xE9, 0xEB,
+    0x12, 0xFA, 0x11, 0xFA, 0x03, 0x26, 0x29, 0x0B, 0x20, 0x16, 0x1A, 0x2A,
+    0x28, 0x30, 0x1B, 0xF4, 0x00, 0x03, 0xF1, 0x19, 0x05, 0xC3, 0xCA, 0xDC,
+    0xE3, 0xDC, 0xE9, 0xFB, 0xF6, 0xF2, 0xE4, 0xF8, 0x00, 0x01, 0x03, 0x07,
+    0x11, 0x0D, 0x13, 0x0A, 0x00, 0x02, 0xFC, 0x15, 0x1E, 0x23, 0x23, 0x0C,
+    0x18, 0x2A, 0x27, 0x1E, 0x35, 0xF0, 0x03, 0x08, 0x0A, 0x0F, 0x06, 0xC3,
+    0xCA, 0xC8, 0xE0, 0xDB, 0xD5, 0xD3, 0xF2, 0xFE, 0xE0, 0xE4, 0xF7, 0xFC,
+    0xF4, 0x03, 0x0D, 0x0F, 0x12, 0x0B, 0x05, 0x21, 0x05, 0x04, 0x23, 0x0F,
+    0x26, 0x10, 0x30, 0x27, 0x30, 0x12, 0x17, 0xF8, 0xFC, 0xF9, 0x03, 0xFF,
+    0x17, 0xDB, 0xD4, 0xDC, 0xEA, 0xE2, 0xE6, 0xF4, 0xD4, 0x00, 0x03, 0xF1,
+    0xF0, 0xED, 0xE7, 0xF0, 0xF4, 0x10, 0xFD, 0x07, 0xFC, 0x02, 0x13, 0x20,
+    0x01, 0x25, 0x2C, 0x0A, 0x14, 0x1B, 0x26, 0x1A, 0x2D, 0xEC, 0xEE, 0xF3,
+    0x01, 0xF5, 0xD8, 0xDC, 0xDE, 0xD1, 0xF0, 0xE5, 0xE4, 0xEC, 0xD8, 0xF0,
+    0xE7, 0xEA, 0x03, 0x09, 0x03, 0xFD, 0x14, 0xF1, 0xF6, 0x02, 0x1A, 0x1D,
+    0x14, 0x20, 0x16, 0x09, 0x2C, 0x2E, 0x35, 0x1C, 0x21, 0x2B, 0x3F, 0xFC,
+    0x08, 0x11, 0xF8, 0x18, 0xEA, 0xE7, 0xD5, 0xE6, 0xE7, 0xD8, 0xD9, 0xDA,
+    0xEB, 0xF3, 0xE2, 0x03, 0xE3, 0xFD, 0x07, 0xF3, 0x03, 0xF5, 0xF5, 0x07,
+    0x13, 0x18, 0xFF, 0x0D, 0x0F, 0x0A, 0x08, 0x2A, 0x31, 0x13, 0x19, 0x38,
+    0x41, 0xFF, 0xF6, 0xF3, 0x06, 0xD5, 0xE6, 0xD3, 0xC5, 0xD6, 0xE7, 0xDE,
+    0xEC, 0xF1, 0xE0, 0xD9, 0xF0, 0xE2, 0xF8, 0x06, 0xEB, 0xFF, 0xFF, 0xF9,
+    0xF3, 0x0B, 0x01, 0x23, 0x28, 0x0B, 0x0B, 0x1F, 0x07, 0x29, 0x18, 0x2B,
+    0x3B, 0x41, 0x3E, 0x0A, 0x11, 0x03, 0xE1, 0xE4, 0xD1, 0xE3, 0xCE, 0xEB,
+    0xEF, 0xD1, 0xDB, 0xEC, 0xFF, 0xE0, 0xE1, 0xF8, 0x0B, 0xF6, 0x13, 0x12,
+    0x06, 0x16, 0x07, 0x00, 0x03, 0x0C, 0x06, 0x25, 0x27, 0x30, 0x32, 0x0D,
+    0x21, 0x2E, 0x2D, 0x1B, 0xFA, 0x0E, 0x0F, 0xDF, 0xC8, 0xC7, 0xC6, 0xEB,
+    0xE0, 0xD4, 0xF9, 0xEC, 0xFC, 0xEB, 0x01, 0x00, 0x07, 0x0B, 0xF9, 0xF5,
+    0x00, 0x16, 0x00, 0xF7, 0x1B, 0x06, 0x0B, 0x05, 0x11, 0x04, 0x1F, 0x17,
+    0x1F, 0x19, 0x3A, 0x1D, 0x36, 0x1C, 0x01, 0xEC, 0xBE, 0xD0, 0xC5, 0xD6,
+    0xC8, 0xCA, 0xE6, 0xCE, 0xD6, 0xD9, 0xEF, 0xF9, 0xEB, 0xED, 0xF5, 0xFB,
+    0x0B, 0xEC, 0x00, 0x0E, 0xF4, 0x15, 0x17, 0x0E, 0x1A, 0x08, 0x03, 0x1C,
+    0x32, 0x2F, 0x0E, 0x14, 0x27, 0x21, 0x1C, 0x0F, 0x16, 0xDA, 0xDD, 0xDA,
+    0xDA, 0xDA, 0xF2, 0xCD, 0xF9, 0xF0, 0xE2, 0xE7, 0xDC, 0xF2, 0xE4, 0xE9,
+    0xF9, 0x02, 0x07, 0x09, 0xF8, 0xF7, 0xF9, 0x06, 0x24, 0x00, 0x04, 0x21,
+    0x0C, 0x17, 0x31, 0x26, 0x1F, 0x23, 0x3E, 0x2D, 0x06, 0xF1, 0xE0, 0xC1,
+    0xEA, 0xC9, 0xC9, 0xDA, 0xD0, 0xD8, 0xF9, 0xEA, 0xDF, 0xE1, 0xEC, 0xEB,
+    0xE9, 0x03, 0xED, 0x01, 0x06, 0xF9, 0x0E, 0x0D, 0x05, 0x10, 0x1C, 0x18,
+    0x06, 0x20, 0x0B, 0x29, 0x2D, 0x1A, 0x21, 0x2D, 0x20, 0x32, 0x06, 0xC9,
+    0xE2, 0xE4, 0xE9, 0xD8, 0xEE, 0xF5, 0xF9, 0xE7, 0xF1, 0xFC, 0xE7, 0xF7,
+    0xE0, 0xFA, 0xE8, 0xFC, 0xF7, 0xED, 0x00, 0x17, 0x06, 0x00, 0x13, 0x27,
+    0x16, 0x02, 0x31, 0x0E, 0x2F, 0x2D, 0x3A, 0x1E, 0x35, 0x28, 0x27, 0x08,
+    0xD5, 0xC6, 0xC5, 0xDF, 0xD8, 0xD2, 0xCD, 0xD7, 0xE9, 0xD9, 0xDE, 0xDC,
+    0xFB, 0xF0, 0xE6, 0x0C, 0xF9, 0xEF, 0x16, 0x08, 0x03, 0x16, 0x08, 0x1A,
+    0x22, 0x28, 0x23, 0x23, 0x2E, 0x15, 0x1A, 0x17, 0x28, 0x23, 0x3E, 0x2C,
+    0xDE, 0xBC, 0xDB, 0xEA, 0xD9, 0xD2, 0xD8, 0xF2, 0xF0, 0xEF, 0xE5, 0x02,
+    0xF3, 0xFA, 0xE5, 0xEA, 0xF3, 0x01, 0xF0, 0x0A, 0x02, 0xFC, 0x03, 0x24,
+    0x07, 0x06, 0x28, 0x0E, 0x2A, 0x32, 0x11, 0x37, 0x32, 0x22, 0x38, 0x2D,
+    0x42, 0xCD, 0xBF, 0xCE, 0xDD, 0xCD, 0xD2, 0xD9, 0xF1, 0xF0, 0xED, 0xFC,
+    0x02, 0xEC, 0xF9, 0xE8, 0x02, 0xFF, 0x07, 0xF4, 0xF8, 0xF4, 0x1E, 0x09,
+    0x01, 0x11, 0x02, 0x1D, 0x2F, 0x19, 0x19, 0x18, 0x30, 0x30, 0x24, 0x29,
+    0x40, 0xF5, 0xD3, 0xC3, 0xE9, 0xC5, 0xD2, 0xE1, 0xCC, 0xDD, 0xD8, 0xE4,
+    0xDE, 0xE5, 0xEC, 0xF7, 0xEF, 0xEE, 0x0E, 0xEF, 0x07, 0x06, 0xF9, 0x09,
+    0x06, 0x0C, 0xFE, 0x12, 0x11, 0x19, 0x33, 0x34, 0x35, 0x31, 0x32, 0x2E,
+    0x2A, 0x2D, 0xF9, 0xBE, 0xDA, 0xD4, 0xCC, 0xF1, 0xCE, 0xD6, 0xF0, 0xE5,
+    0xE0, 0xEA, 0xFE, 0x00, 0xFF, 0xF9, 0xE6, 0x0F, 0x08, 0x04, 0xFF, 0xF6,
+    0x1E, 0x17, 0x0B, 0x24, 0x2C, 0x26, 0x0C, 0x16, 0x34, 0x33, 0x1F, 0x15,
+    0x35, 0x3A, 0xF2, 0x11, 0xCD, 0xDA, 0xDC, 0xDC, 0xDA, 0xE8, 0xE2, 0xE7,
+    0xE4, 0xFC, 0xEA, 0xF0, 0xFA, 0x08, 0xF3, 0x04, 0xEF, 0xF8, 0x01, 0x0D,
+    0x0B, 0x1D, 0x22, 0x23, 0x15, 0x1F, 0x2F, 0x2A, 0x20, 0x0F, 0x1F, 0x24,
+    0x18, 0x3B, 0x0A, 0xFB, 0xC3, 0xDB, 0xDD, 0xE4, 0xDD, 0xD1, 0xEB, 0xDA,
+    0xD4, 0xEE, 0xEC, 0x02, 0xE1, 0x07, 0xF3, 0xE6, 0xFD, 0xF0, 0xF0, 0xFE,
+    0x12, 0x0A, 0x1F, 0x16, 0xFF, 0x18, 0x15, 0x07, 0x2A, 0x36, 0x12, 0x1E,
+    0x23, 0x27, 0x2D, 0x09, 0xF7, 0xE4, 0xE7, 0xD9, 0xE1, 0xD9, 0xD7, 0xDC,
+    0xDC, 0xD7, 0xF0, 0xF2, 0x00, 0xFD, 0xEA, 0xF0, 0xFC, 0xF9, 0x02, 0x10,
+    0x00, 0x01, 0x21, 0xFA, 0x25, 0x10, 0x1A, 0x28, 0x09, 0x1A, 0x35, 0x1A,
+    0x2D, 0x17, 0x3B, 0x09, 0x0D, 0x09, 0xE1, 0xE7, 0xCB, 0xDE, 0xF2, 0xF2,
+    0xDA, 0xE4, 0xDE, 0xDA, 0xE3, 0x05, 0xFA, 0x05, 0xF3, 0xF8, 0x0A, 0x10,
+    0xFD, 0x0A, 0x06, 0x0A, 0x0C, 0x00, 0x04, 0x10, 0x1D, 0x09, 0x34, 0x37,
+    0x17, 0x3B, 0x1C, 0x04, 0x10, 0x0A, 0xF1, 0xD1, 0xE2, 0xCC, 0xF2, 0xCD,
+    0xF0, 0xF3, 0xD7, 0xF9, 0xFA, 0xED, 0xF3, 0xFE, 0x0C, 0xFC, 0x08, 0x12,
+    0x14, 0xFB, 0x08, 0x16, 0x10, 0x0C, 0x15, 0x13, 0x19, 0x2E, 0x1A, 0x17,
+    0x2F, 0x12, 0x2C, 0xFB, 0xEF, 0x08, 0x04, 0xC4, 0xC4, 0xEC, 0xE9, 0xD5,
+    0xEB, 0xE3, 0xD6, 0xF6, 0x01, 0xE0, 0xF7, 0xE3, 0x08, 0xEB, 0xE8, 0x06,
+    0x08, 0x15, 0x0E, 0xFB, 0x18, 0xFF, 0x12, 0x2B, 0x1C, 0x20, 0x2D, 0x15,
+    0x2B, 0x17, 0x2A, 0x22, 0x0A, 0xEB, 0xEF, 0xF5, 0xE1, 0xE7, 0xE1, 0xE0,
+    0xE2, 0xD2, 0xD3, 0xE3, 0xFD, 0xFF, 0xED, 0x03, 0x02, 0xF8, 0xF7, 0xFE,
+    0xF2, 0x13, 0x18, 0x15, 0xFD, 0x06, 0x0F, 0x23, 0x28, 0x05, 0x0E, 0x23,
+    0x16, 0x1D, 0x22, 0x1F, 0xEA, 0xF1, 0x01, 0xF8, 0xF5, 0xE6, 0xC4, 0xD7,
+    0xD3, 0xCE, 0xD4, 0xDC, 0xE6, 0xFD, 0x04, 0x00, 0xEB, 0xF4, 0x04, 0x05,
+    0xEF, 0x13, 0xFA, 0xF6, 0x0D, 0x1E, 0x1A, 0x1F, 0x0E, 0x21, 0x26, 0x2B,
+    0x12, 0x1B, 0x31, 0x30, 0x08, 0x09, 0xFF, 0x03, 0x1A, 0xD1, 0xC5, 0xE4,
+    0xF2, 0xE1, 0xF2, 0xD7, 0xE8, 0xFF, 0xE3, 0xE5, 0xE3, 0xE6, 0x01, 0x09,
+    0x12, 0x00, 0x11, 0x08, 0x15, 0xFE, 0x24, 0x27, 0x13, 0x28, 0x0A, 0x21,
+    0x10, 0x26, 0x3A, 0x34, 0xE5, 0x0B, 0xFE, 0xF0, 0xFA, 0x19, 0xCA, 0xC5,
+    0xE6, 0xF0, 0xEC, 0xF5, 0xF3, 0xD7, 0xEC, 0x00, 0xF0, 0x02, 0xFD, 0x0A,
+    0xE9, 0xEB, 0xEE, 0x05, 0x02, 0x03, 0x0B, 0x0D, 0x1C, 0x1D, 0x24, 0x18,
+    0x0E, 0x31, 0x2B, 0x39, 0x15, 0xFC, 0xFF, 0xF6, 0xFA, 0xFF, 0xF6, 0xE3,
+    0xD2, 0xCF, 0xF6, 0xDE, 0xE6, 0xDB, 0xDE, 0x03, 0xE0, 0x00, 0xFD, 0xE6,
+    0xFF, 0xF7, 0xFB, 0xF7, 0x1B, 0x00, 0x01, 0x21, 0x00, 0x22, 0x09, 0x13,
+    0x29, 0x21, 0x0D, 0x15, 0x27, 0xFB, 0x06, 0x03, 0xEF, 0xF3, 0xF8, 0x04,
+    0xD8, 0xEC, 0xDA, 0xF7, 0xEF, 0xDC, 0xF1, 0xE8, 0xF0, 0xFB, 0x06, 0x09,
+    0x02, 0x11, 0xF6, 0x00, 0xF7, 0x0D, 0x00, 0x00, 0x00, 0x05, 0x09, 0x14,
+    0x16, 0x10, 0x0D, 0x19, 0x26, 0x00, 0xF3, 0xEC, 0xEA, 0x01, 0x17, 0x00,
+    0xD1, 0xC8, 0xE7, 0xD2, 0xF9, 0xE2, 0xF0, 0xF9, 0xF6, 0xF1, 0xE5, 0xE7,
+    0xFE, 0xE7, 0x06, 0xF9, 0x11, 0xFF, 0xFF, 0x0B, 0xFF, 0x12, 0x09, 0x09,
+    0x20, 0x0A, 0x1E, 0x27, 0x39, 0xFB, 0xE6, 0x00, 0xEB, 0xF3, 0x0E, 0xFE,
+    0x13, 0xDA, 0xD3, 0xEC, 0xDA, 0xE5, 0xE0, 0xFB, 0xF9, 0xFF, 0x00, 0xF5,
+    0xE3, 0x0D, 0x02, 0x10, 0x0C, 0xF4, 0x0B, 0x0A, 0x0B, 0x1D, 0x13, 0x04,
+    0x27, 0x05, 0x11, 0x23, 0x2B, 0x36, 0x08, 0xEA, 0x08, 0xF4, 0x17, 0xF3,
+    0x05, 0xFB, 0xDB, 0xEA, 0xCF, 0xD2, 0xDB, 0xF5, 0xDA, 0xFD, 0xDE, 0xFF,
+    0xFF, 0xEF, 0xEF, 0x0F, 0xFD, 0x18, 0x0F, 0x1C, 0x16, 0xFC, 0xFF, 0x26,
+    0x17, 0x12, 0x0C, 0x13, 0x2D, 0x2D, 0xF6, 0x0C, 0x0F, 0x11, 0x0D, 0xF2,
+    0xF4, 0xF4, 0xF8, 0xD1, 0xCA, 0xEE, 0xD4, 0xEA, 0xE4, 0xFA, 0xE7, 0xEB,
+    0x02, 0x02, 0xEB, 0xF4, 0xF1, 0x02, 0x13, 0x11, 0x18, 0x07, 0xFC, 0x00,
+    0x1D, 0x26, 0x10, 0x30, 0x33, 0x16, 0x39, 0x06, 0x01, 0xFC, 0xF5, 0xF1,
+    0xF0, 0x0D, 0x17, 0x1C, 0xED, 0xDE, 0xF1, 0xF3, 0xDE, 0xE2, 0xE4, 0xEA,
+    0xFE, 0xE6, 0xFE, 0x06, 0xFD, 0x02, 0xF0, 0xF8, 0x17, 0x08, 0x11, 0x11,
+    0x03, 0x29, 0x21, 0x2A, 0x26, 0x31, 0x23, 0xE3, 0xF6, 0x0A, 0x0A, 0x0B,
+    0xEF, 0xFD, 0x07, 0x1E, 0xFE, 0xE8, 0xEE, 0xEF, 0xD9, 0xF2, 0xF0, 0xEB,
+    0xE6, 0xE1, 0xEE, 0xF4, 0xE9, 0xF5, 0x03, 0x0A, 0x1A, 0x17, 0xFE, 0x12,
+    0x20, 0x08, 0x16, 0x28, 0x13, 0x14, 0x25, 0x24, 0xE8, 0x06, 0x0E, 0x10,
+    0xEF, 0x0D, 0x07, 0x17, 0xF5, 0x17, 0xE4, 0xF3, 0xD1, 0xD5, 0xE4, 0xF6,
+    0x00, 0xE7, 0x06, 0x07, 0xF1, 0xFB, 0xFA, 0xEC, 0xFF, 0x0F, 0x0E, 0xFD,
+    0x06, 0x0F, 0x09, 0x0C, 0x1A, 0x0F, 0x1B, 0x16, 0xF1, 0xE2, 0x0B, 0xFE,
+    0xEB, 0xFF, 0xF3, 0x19, 0xF3, 0x05, 0x10, 0xD7, 0xE3, 0xF6, 0xD5, 0xE9,
+    0xDE, 0xF4, 0xF1, 0xE4, 0xF7, 0xEA, 0xF0, 0x09, 0xFE, 0x14, 0xFE, 0xFC,
+    0x19, 0x0C, 0x25, 0x12, 0x25, 0x25, 0x1C, 0x33, 0x2F, 0xE6, 0x00, 0xE9,
+    0xF4, 0xEC, 0x10, 0x11, 0x0E, 0x06, 0x02, 0x11, 0xD0, 0xE1, 0xD2, 0xD2,
+    0xF8, 0x00, 0xF3, 0xED, 0xF4, 0xE6, 0xFF, 0x08, 0xFC, 0x05, 0x18, 0x0C,
+    0xFE, 0x02, 0x01, 0x08, 0x1B, 0x1F, 0x23, 0x2C, 0x2D, 0x35, 0xE6, 0xF2,
+    0xE9, 0xEF, 0xF2, 0xEF, 0x11, 0x0E, 0xFB, 0x16, 0x19, 0xD8, 0xD7, 0xD9,
+    0xF7, 0xF9, 0xF4, 0x00, 0xDD, 0xEA, 0x08, 0xFD, 0xF7, 0xFD, 0xEE, 0x04,
+    0x0B, 0xFE, 0x14, 0x1B, 0x0A, 0x0A, 0x03, 0x1B, 0x0F, 0x2C, 0x22, 0xF7,
+    0xE6, 0xE5, 0xF9, 0xF2, 0x0A, 0x02, 0x10, 0xFF, 0xFB, 0x02, 0xFF, 0xF1,
+    0xE8, 0xE6, 0xF3, 0xF5, 0xF3, 0xEF, 0x00, 0x02, 0xF2, 0xE8, 0x0B, 0xEE,
+    0x0D, 0x10, 0x19, 0x1C, 0x1C, 0x14, 0x0C, 0x08, 0x1A, 0x22, 0x31, 0xED,
+    0xF4, 0x08, 0x0B, 0xFB, 0xFF, 0xF9, 0xF7, 0x16, 0x13, 0xFE, 0x04, 0x0E,
+    0xE3, 0xF8, 0xEC, 0xFD, 0xDB, 0xDF, 0xFC, 0xE7, 0x07, 0x01, 0xFF, 0x0E,
+    0x0F, 0xF6, 0x0C, 0x0D, 0x06, 0x10, 0x1A, 0x1F, 0x1C, 0x25, 0x13, 0x24,
+    0xF9, 0xE5, 0x04, 0x0A, 0xFD, 0x03, 0xFB, 0x07, 0x05, 0x0F, 0xFF, 0xFA,
+    0x17, 0x13, 0xD8, 0xEC, 0xE9, 0xD7, 0xDE, 0xF3, 0xEF, 0x01, 0xE8, 0xFE,
+    0xF0, 0x00, 0x0B, 0x18, 0x10, 0x1A, 0xFC, 0x05, 0x27, 0x0B, 0x1A, 0x1B,
+    0x32, 0x00, 0xE4, 0xEC, 0x05, 0xE7, 0x09, 0xEE, 0x0A, 0xF9, 0x02, 0x00,
+    0x02, 0x1E, 0x01, 0xE6, 0xD6, 0xD8, 0xEE, 0xD9, 0xE2, 0x05, 0x05, 0xFF,
+    0x08, 0xEC, 0x04, 0x09, 0xF3, 0xFF, 0x11, 0x0F, 0x00, 0x16, 0x22, 0x1D,
+    0x0C, 0x10, 0xE5, 0xEE, 0xF0, 0x05, 0xEA, 0xF9, 0xEF, 0x13, 0xF5, 0x05,
+    0x0E, 0x00, 0x21, 0x00, 0x09, 0xDC, 0xDC, 0xE0, 0x00, 0xF8, 0xFF, 0xE0,
+    0xE8, 0xF3, 0xEE, 0x03, 0xF9, 0xFD, 0xF7, 0x1D, 0x13, 0x16, 0xFE, 0x0E,
+    0x02, 0x2C, 0x30, 0x11, 0xFA, 0xF1, 0x00, 0xE2, 0xFA, 0x07, 0xF9, 0x00,
+    0xFF, 0x15, 0x19, 0x16, 0x1B, 0x1C, 0xD5, 0xF5, 0xE5, 0xDF, 0xEC, 0xDF,
+    0xED, 0xE5, 0x07, 0xFB, 0xEC, 0x14, 0x12, 0xF9, 0x11, 0x00, 0x07, 0x0F,
+    0x06, 0x24, 0x19, 0x20, 0x24, 0xEF, 0xFC, 0xEA, 0xFB, 0x0D, 0x00, 0x08,
+    0x0E, 0x06, 0xFE, 0x0F, 0x04, 0x0D, 0x0D, 0x00, 0xE1, 0xEA, 0xD9, 0xF8,
+    0x00, 0xE2, 0xFA, 0xE3, 0x01, 0x0A, 0x0C, 0x14, 0x16, 0xF6, 0xF5, 0x05,
+    0xFD, 0x09, 0x26, 0x10, 0x14, 0x0C, 0xD9, 0x03, 0x00, 0x03, 0xFD, 0x01,
+    0xEA, 0x02, 0xF9, 0xF3, 0x0E, 0x1A, 0x03, 0x00, 0x07, 0x27, 0xE6, 0xDC,
+    0xE8, 0xFA, 0xEA, 0xF6, 0xF3, 0xF2, 0xF9, 0xF2, 0x0D, 0x03, 0xFB, 0xF8,
+    0xF6, 0x21, 0x09, 0x0B, 0x13, 0x0D, 0x29, 0x10, 0xE1, 0xDE, 0x05, 0x05,
+    0xEB, 0x05, 0xE9, 0x00, 0xFA, 0x0A, 0x05, 0xFA, 0xF9, 0x12, 0x0F, 0x10,
+    0xF9, 0xEE, 0xFA, 0xE3, 0xEA, 0x06, 0x05, 0x0A, 0xF5, 0x01, 0x0C, 0xF5,
+    0xFA, 0xF7, 0x04, 0x00, 0x01, 0x20, 0x17, 0x1B, 0x1E, 0xFF, 0xFA, 0xE2,
+    0xFB, 0xF7, 0x00, 0xEC, 0xFE, 0xF4, 0xFD, 0x11, 0x15, 0xFE, 0x17, 0x06,
+    0x22, 0x28, 0xE7, 0xD5, 0xFA, 0xDA, 0xE0, 0x05, 0xED, 0x09, 0xFF, 0xF3,
+    0x00, 0x12, 0xF9, 0x0A, 0xFC, 0x14, 0x0E, 0x05, 0x06, 0x23, 0x22, 0xE4,
+    0xEB, 0xFB, 0xFD, 0xE8, 0x03, 0x01, 0xF8, 0x11, 0xF9, 0x17, 0x0B, 0x13,
+    0x1D, 0x15, 0x08, 0x05, 0xD7, 0xEB, 0xDC, 0xDB, 0xF0, 0xE1, 0xF5, 0x02,
+    0x02, 0x12, 0x09, 0x0C, 0x06, 0x12, 0x07, 0x0D, 0x0B, 0x02, 0x26, 0x0F,
+    0xE2, 0xFA, 0xDA, 0x02, 0xE4, 0xF1, 0x0A, 0x09, 0x00, 0xF9, 0xFC, 0x09,
+    0x02, 0x06, 0xFD, 0x11, 0x09, 0x05, 0xF3, 0xE3, 0x00, 0xE6, 0xFC, 0xF0,
+    0x04, 0x00, 0x0A, 0xF4, 0xFC, 0xFF, 0xF3, 0x16, 0x06, 0x20, 0x16, 0x07,
+    0x20, 0x1B, 0xF2, 0xF2, 0xEF, 0x01, 0x02, 0x09, 0xEE, 0xFD, 0x03, 0x10,
+    0xFD, 0xFD, 0xFF, 0xFB, 0x0E, 0x1E, 0x23, 0x14, 0x07, 0xE6, 0xDF, 0xF6,
+    0xF4, 0xE7, 0xFA, 0xF2, 0xF0, 0x0A, 0xF3, 0x00, 0x0F, 0xF8, 0xFB, 0x09,
+    0xFD, 0x1E, 0x0A, 0x11, 0xD9, 0xF2, 0xFD, 0xF5, 0xE2, 0xE4, 0x0C, 0x05,
+    0x0F, 0x14, 0x09, 0xF2, 0x08, 0x0C, 0x21, 0x10, 0x01, 0x10, 0x2B, 0xE9,
+    0xEC, 0xE5, 0x00, 0xE8, 0xFF, 0x0A, 0x0C, 0xEF, 0x04, 0xF6, 0x00, 0xFF,
+    0x10, 0x1C, 0x0C, 0x12, 0x06, 0x04, 0xDD, 0xF9, 0xF8, 0xE1, 0xF9, 0xE9,
+    0xF9, 0xF2, 0xF6, 0x10, 0xFA, 0x06, 0x05, 0x00, 0x14, 0x0E, 0x26, 0x21,
+    0x1B, 0xEE, 0xDD, 0xF6, 0x04, 0xE0, 0xE3, 0x05, 0xF0, 0xF7, 0x00, 0xFB,
+    0xFD, 0x14, 0x0D, 0x05, 0x14, 0x1D, 0x05, 0x0E, 0xF9, 0xF8, 0xFF, 0xE1,
+    0xFE, 0xE4, 0x00, 0x07, 0xEB, 0x14, 0x16, 0x0A, 0x0A, 0xFE, 0xFC, 0x1A,
+    0x07, 0x13, 0x22, 0x2B, 0xF3, 0xE5, 0xDC, 0xF5, 0xF3, 0xEC, 0xED, 0x00,
+    0xF2, 0x00, 0xF4, 0xF6, 0x07, 0x09, 0x09, 0x1D, 0x01, 0x01, 0xEB, 0xEE,
+    0xE1, 0xFB, 0xE6, 0xEE, 0x06, 0xF0, 0xF8, 0x0C, 0x02, 0xF0, 0x10, 0x0C,
+    0x15, 0x1E, 0x1B, 0x1F, 0x0F, 0x2C, 0xE6, 0xD8, 0x02, 0xF6, 0xEB, 0xFE,
+    0xF5, 0x07, 0xF1, 0xF2, 0xF2, 0x01, 0x1A, 0x14, 0xFB, 0x00, 0x23, 0x0E,
+    0xEE, 0xD6, 0xF0, 0xE6, 0xE2, 0xF9, 0xF1, 0x05, 0xE9, 0xFD, 0xF2, 0x03,
+    0xFA, 0x12, 0x16, 0x05, 0x04, 0x13, 0x26, 0x0F, 0x29, 0xF9, 0xF2, 0xF0,
+    0xEA, 0x0A, 0xEE, 0xF3, 0x11, 0x11, 0xFB, 0x05, 0x15, 0x12, 0xFB, 0x12,
+    0x0D, 0x10, 0xF8, 0xDE, 0xF7, 0xE6, 0xFB, 0xF1, 0xE3, 0xFD, 0x05, 0x0B,
+    0xEB, 0xF5, 0x02, 0x16, 0x17, 0x1E, 0x20, 0x00, 0x18, 0x12, 0x1B, 0x0F,
+    0xE6, 0xE1, 0xFB, 0xFC, 0xE6, 0xE6, 0xEE, 0xED, 0x04, 0xF1, 0x03, 0x05,
+    0x0A, 0x04, 0x0E, 0x14, 0xD1, 0xF9, 0xDD, 0xFF, 0xDB, 0xF9, 0xEF, 0xF1,
+    0xF7, 0xFD, 0x12, 0x13, 0xFD, 0x12, 0x19, 0x00, 0xFA, 0x24, 0x12, 0x1A,
+    0x28, 0x12, 0x20, 0xEA, 0xF6, 0x04, 0xE6, 0xEB, 0xFF, 0x11, 0xF4, 0x0A,
+    0x03, 0x18, 0x08, 0x00, 0x18, 0x05, 0x05, 0xF0, 0xEC, 0xEE, 0xDE, 0xE4,
+    0xF4, 0xF1, 0x0A, 0xFA, 0xEB, 0x12, 0x11, 0xFE, 0x12, 0x06, 0x14, 0x1D,
+    0x23, 0x00, 0x21, 0x1A, 0x17, 0xE6, 0xE3, 0xF7, 0xF0, 0xF7, 0x08, 0xEC,
+    0x02, 0xEC, 0xF0, 0xFD, 0x14, 0x0B, 0x1D, 0x10, 0x04, 0xEB, 0xF4, 0xEE,
+    0xE2, 0xDC, 0xF7, 0x00, 0xFE, 0xF7, 0x0B, 0xEE, 0xFE, 0x0A, 0xFA, 0x0C,
+    0x0F, 0x1B, 0x0E, 0xFE, 0x03, 0x14, 0x18, 0x16, 0xEC, 0xE1, 0xE6, 0xF9,
+    0xF4, 0x0B, 0xFB, 0x02, 0x13, 0x0E, 0x16, 0xF8, 0x06, 0x0C, 0x0C, 0x1C,
+    0xE0, 0xF0, 0xEE, 0xF1, 0x00, 0xE0, 0x03, 0x01, 0xFC, 0x07, 0x00, 0x14,
+    0x04, 0x15, 0x16, 0x0A, 0x03, 0x09, 0x1F, 0x0F, 0x19, 0x1B, 0x22, 0xEF,
+    0xEC, 0xE5, 0x06, 0xE8, 0x02, 0x06, 0x05, 0xF6, 0x06, 0x0C, 0x19, 0x15,
+    0x00, 0x0A, 0xED, 0xDC, 0xDE, 0xEE, 0xDC, 0xDE, 0xEF, 0xF0, 0xFF, 0x01,
+    0xF0, 0x0A, 0x0A, 0x13, 0x08, 0x0F, 0xFF, 0x03, 0x21, 0x02, 0x11, 0x2C,
+    0x09, 0x13, 0xE0, 0x02, 0xF6, 0x02, 0xEA, 0xEA, 0xF0, 0x12, 0xFF, 0x13,
+    0x0C, 0xFE, 0x17, 0xFF, 0xE3, 0xD1, 0xE6, 0xD8, 0xEF, 0xE0, 0xEE, 0xEA,
+    0xE7, 0xE9, 0xE6, 0x02, 0x09, 0x0E, 0xF5, 0xFE, 0x06, 0x19, 0x15, 0x23,
+    0x25, 0x07, 0x15, 0x2D, 0x16, 0xFD, 0xDE, 0xF1, 0xE7, 0xF9, 0xE9, 0x06,
+    0x0C, 0x0D, 0xF2, 0x18, 0x0A, 0x10, 0x1D, 0xD7, 0xE1, 0xEA, 0xE1, 0xE9,
+    0xEF, 0xF0, 0xF0, 0xE5, 0xEF, 0xEE, 0x08, 0xFD, 0xF1, 0x08, 0x0A, 0xF6,
+    0x04, 0x0F, 0x07, 0x15, 0x22, 0x21, 0x29, 0x1C, 0xED, 0xEC, 0xE4, 0x00,
+    0xF5, 0xFE, 0x02, 0x09, 0xFE, 0xFD, 0x01, 0x1E, 0x1E, 0x17, 0xD2, 0xF6,
+    0xE2, 0xF4, 0xE8, 0xED, 0xED, 0xFE, 0xFD, 0xFF, 0xF5, 0xEC, 0x0E, 0x05,
+    0xF7, 0x13, 0x00, 0x1D, 0x18, 0x02, 0x02, 0x1A, 0x1B, 0x1E, 0x21, 0x03,
+    0xF2, 0xE9, 0xEF, 0xE8, 0xF6, 0x09, 0xFF, 0x0B, 0x0E, 0xFD, 0x15, 0x10,
+    0xCF, 0xDF, 0xD4, 0xD4, 0xDA, 0xDF, 0xDF, 0x02, 0xEA, 0xE3, 0xED, 0xFF,
+    0x11, 0x0B, 0x09, 0x00, 0x00, 0x08, 0xFF, 0x02, 0x04, 0x00, 0x27, 0x18,
+    0x0E, 0x21, 0xF9, 0xEF, 0x00, 0xEA, 0xF0, 0x0A, 0xF5, 0xFD, 0x0A, 0x16,
+    0xFA, 0x14, 0x15, 0xDF, 0xDD, 0xE8, 0xF9, 0xF5, 0xE4, 0x04, 0xEF, 0xFB,
+    0xF3, 0xE9, 0x10, 0xEB, 0xFE, 0xF9, 0x02, 0xF7, 0xFE, 0x02, 0x0B, 0x04,
+    0x21, 0x1F, 0x21, 0x23, 0x30, 0x16, 0xE6, 0xF1, 0xEE, 0xFF, 0x04, 0xF8,
+    0x12, 0xFE, 0x06, 0xF6, 0x0E, 0xE0, 0xCF, 0xD9, 0xD8, 0xDA, 0xF5, 0xE7,
+    0xE4, 0xF2, 0xE5, 0x0B, 0xEB, 0xFD, 0x0A, 0x0D, 0x13, 0x0C, 0xF6, 0x09,
+    0x1F, 0x07, 0x1B, 0x07, 0x1A, 0x1C, 0x12, 0x25, 0x28, 0xEC, 0xEB, 0xF6,
+    0xFE, 0x04, 0x0F, 0x0F, 0x05, 0x04, 0x0B, 0x03, 0xEC, 0xE2, 0xE8, 0xF2,
+    0xFC, 0xE9, 0xF6, 0xE0, 0x00, 0xFC, 0x07, 0x01, 0x07, 0x09, 0x0A, 0xF8,
+    0x16, 0xFD, 0x00, 0x0C, 0x19, 0x0B, 0x03, 0x21, 0x19, 0x10, 0x1E, 0x2B,
+    0xE4, 0xF1, 0x01, 0xFC, 0xFE, 0x01, 0xF8, 0x00, 0xF9, 0x12, 0xD9, 0xD7,
+    0xDE, 0xDC, 0xE6, 0xE4, 0xF3, 0xEC, 0x00, 0x00, 0x05, 0x00, 0xF0, 0x0D,
+    0xF6, 0xF0, 0x01, 0x0F, 0x0C, 0x14, 0x05, 0x0E, 0x19, 0x17, 0x08, 0x0C,
+    0x14, 0x1D, 0x0F, 0x03, 0xEC, 0x08, 0x0F, 0x07, 0x0B, 0xF4, 0xFD, 0xF5,
+    0xF7, 0xDA, 0xDD, 0xEB, 0xDA, 0xF7, 0xDD, 0xE3, 0xEC, 0xF6, 0x01, 0xFA,
+    0x08, 0xF6, 0x0D, 0xF3, 0x16, 0x02, 0xF9, 0x04, 0x10, 0x18, 0x0D, 0x24,
+    0x12, 0x24, 0x2D, 0x22, 0x1E, 0x29, 0xE5, 0xEA, 0xFC, 0xEE, 0x12, 0xEF,
+    0x15, 0x00, 0x0B, 0x00, 0xDE, 0xD7, 0xE7, 0xD7, 0xE4, 0xF5, 0xDC, 0xEA,
+    0xFE, 0xF2, 0xF5, 0x0B, 0xEA, 0xF6, 0x08, 0xFD, 0x19, 0x12, 0x19, 0x0B,
+    0xFD, 0x13, 0x00, 0x0B, 0x15, 0x08, 0x18, 0x22, 0x2E, 0xF6, 0x03, 0x08,
+    0x10, 0xF5, 0x01, 0x17, 0x0E, 0x02, 0xEE, 0xDD, 0xDB, 0xD2, 0xEF, 0xD8,
+    0xFD, 0xFE, 0x04, 0xF9, 0x04, 0xF2, 0xE9, 0x01, 0xFF, 0x0F, 0xFC, 0x02,
+    0x06, 0x1A, 0x14, 0x15, 0x0A, 0x10, 0x09, 0x0F, 0x0A, 0x29, 0x20, 0x24,
+    0xEC, 0xF2, 0xEE, 0x10, 0xEF, 0xF5, 0xFE, 0xF5, 0x13, 0xCB, 0xF1, 0xD1,
+    0xF3, 0xF1, 0xDD, 0xF1, 0xEA, 0xFC, 0xE5, 0xE2, 0x00, 0xEA, 0x07, 0x02,
+    0x0C, 0x15, 0xFA, 0xFD, 0x1E, 0x0A, 0x10, 0x27, 0x0B, 0x22, 0x2E, 0x24,
+    0x16, 0x31, 0x23, 0x00, 0x0D, 0xF5, 0x04, 0x08, 0x0E, 0x10, 0xFE, 0xEF,
+    0xE0, 0xE6, 0xDC, 0xF4, 0xD8, 0xEC, 0xE3, 0xFC, 0x05, 0xEA, 0xEF, 0xF0,
+    0xF4, 0xEF, 0x0A, 0x0E, 0x01, 0x04, 0x0B, 0xF9, 0x05, 0x14, 0x0C, 0x13,
+    0x22, 0x08, 0x28, 0x31, 0x28, 0x1E, 0xFF, 0x08, 0xF0, 0xFB, 0x03, 0x08,
+    0x1A, 0xDC, 0xD9, 0xD1, 0xDF, 0xF9, 0xE1, 0xE7, 0xF1, 0xDC, 0xE5, 0x06,
+    0xFC, 0x09, 0xFE, 0x00, 0x10, 0xF3, 0x17, 0xFB, 0x13, 0xFB, 0x0E, 0x0B,
+    0x09, 0x1B, 0x1D, 0x15, 0x1C, 0x2A, 0x35, 0x33, 0x03, 0x0B, 0xF2, 0x08,
+    0x05, 0x08, 0xFA, 0x02, 0xE5, 0xF1, 0xDC, 0xEF, 0xED, 0xEF, 0xF7, 0xDA,
+    0xF4, 0xFE, 0xF6, 0xE3, 0xFC, 0x00, 0x05, 0x03, 0xF4, 0xF2, 0x0B, 0x13,
+    0x13, 0x19, 0x14, 0x03, 0x14, 0x16, 0x17, 0x12, 0x2C, 0x1B, 0x36, 0x0B,
+    0xFF, 0xFF, 0xF2, 0xFC, 0x01, 0x15, 0xD2, 0xE2, 0xCC, 0xEC, 0xD3, 0xE6,
+    0xFC, 0xE4, 0xE8, 0x03, 0xE4, 0xE9, 0xEF, 0xFF, 0xFC, 0x11, 0x05, 0x08,
+    0x17, 0x12, 0x1A, 0x1A, 0x00, 0x00, 0x21, 0x1E, 0x08, 0x1B, 0x0F, 0x31,
+    0x1A, 0x29, 0x0D, 0x00, 0x0E, 0xFC, 0xFD, 0xF6, 0xD2, 0xE0, 0xD1, 0xE7,
+    0xEF, 0xF8, 0xF2, 0xDE, 0xE3, 0xE3, 0x04, 0xF5, 0xE6, 0x00, 0xFE, 0xFD,
+    0xFD, 0x0D, 0x07, 0xFE, 0x1E, 0x0D, 0x09, 0x15, 0x13, 0x0D, 0x1E, 0x2E,
+    0x32, 0x20, 0x14, 0x35, 0xF3, 0x05, 0x11, 0x04, 0x02, 0xF2, 0xED, 0xF0,
+    0xE1, 0xCF, 0xDA, 0xD7, 0xFB, 0xDB, 0xFC, 0xDD, 0xE8, 0xFE, 0xFE, 0xE6,
+    0xFF, 0xEE, 0x07, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x05, 0x0E, 0x06, 0x1B,
+    0x15, 0x09, 0x29, 0x12, 0x1D, 0x39, 0x1E, 0xEB, 0xFB, 0xEC, 0x06, 0x0E,
+    0xDF, 0xDA, 0xF0, 0xD3, 0xE0, 0xD3, 0xD9, 0xF4, 0xF8, 0xDE, 0xFD, 0xE6,
+    0x06, 0xF7, 0x00, 0xF4, 0x08, 0xFA, 0x03, 0x0E, 0x09, 0xFB, 0x1E, 0xFF,
+    0x1F, 0x25, 0x0C, 0x1D, 0x22, 0x13, 0x18, 0x33, 0x20, 0x05, 0x02, 0xEC,
+    0x15, 0x08, 0xDF, 0xE0, 0xEF, 0xDD, 0xDC, 0xD2, 0xDA, 0xEA, 0xFA, 0xEB,
+    0xF9, 0xF5, 0xF1, 0xEA, 0x0C, 0xFB, 0xFC, 0xF5, 0x17, 0x17, 0xFB, 0x1F,
+    0x0D, 0x0C, 0x1C, 0x1B, 0x28, 0x0F, 0x29, 0x2E, 0x2F, 0x33, 0x13, 0x18,
+    0xFB, 0x0B, 0xF1, 0x15, 0xEA, 0xCA, 0xE6, 0xDB, 0xDC, 0xF0, 0xF1, 0xF5,
+    0xE3, 0xFE, 0xE7, 0xEB, 0xF8, 0xF6, 0xEC, 0x02, 0x10, 0xFA, 0xF8, 0x00,
+    0x1A, 0x08, 0x00, 0x12, 0x03, 0x10, 0x1B, 0x1B, 0x0D, 0x1A, 0x30, 0x1D,
+    0x1A, 0x34, 0xFA, 0x0B, 0xFC, 0x0F, 0xD4, 0xDA, 0xE4, 0xD5, 0xE5, 0xF5,
+    0xEF, 0xDE, 0xEE, 0xEC, 0xEC, 0xF0, 0xF5, 0xF5, 0xEE, 0xF6, 0x11, 0x13,
+    0xFD, 0x14, 0x1C, 0x06, 0x03, 0x0F, 0x1A, 0x04, 0x2B, 0x1C, 0x0A, 0x31,
+    0x30, 0x34, 0x38, 0x16, 0xF8, 0x0E, 0x12, 0xC2, 0xDC, 0xDF, 0xDD, 0xE4,
+    0xD2, 0xE7, 0xE5, 0xDA, 0xE7, 0xF1, 0xFD, 0xE5, 0xEF, 0xEC, 0x09, 0x06,
+    0x0F, 0x16, 0x02, 0xF4, 0xFB, 0x09, 0x22, 0x10, 0x22, 0x15, 0x29, 0x24,
+    0x1E, 0x28, 0x26, 0x39, 0x2E, 0x2B, 0xF1, 0xFD, 0x0F, 0xE4, 0xD5, 0xDE,
+    0xCB, 0xEC, 0xEE, 0xF1, 0xDB, 0xFD, 0xE8, 0xE8, 0xDF, 0xFF, 0x01, 0x0A,
+    0x09, 0x05, 0xF7, 0xF7, 0x04, 0xF9, 0xFC, 0x17, 0x1B, 0x11, 0x17, 0x26,
+    0x09, 0x1D, 0x1F, 0x18, 0x12, 0x39, 0x1C, 0x1B, 0x07, 0x00, 0xD4, 0xD8,
+    0xDC, 0xD2, 0xE5, 0xF5, 0xED, 0xFB, 0xE6, 0xD8, 0xFC, 0xE9, 0xF5, 0xF3,
+    0xFB, 0xE8, 0x11, 0x08, 0xF9, 0x13, 0x00, 0x0E, 0x15, 0x19, 0x17, 0x08,
+    0x02, 0x20, 0x18, 0x0F, 0x2A, 0x17, 0x29, 0x27, 0x18, 0x2B, 0x0D, 0xC4,
+    0xD1, 0xED, 0xC8, 0xE7, 0xEC, 0xDA, 0xE0, 0xF4, 0xE5, 0xFB, 0xEF, 0xFF,
+    0xEA, 0xFA, 0xED, 0xFA, 0xFD, 0x01, 0x0F, 0x04, 0x00, 0xFE, 0x06, 0x00,
+    0x23, 0x05, 0x11, 0x15, 0x2B, 0x1B, 0x14, 0x16, 0x20, 0x25, 0x2E, 0xF4,
+    0xD0, 0xD2, 0xE0, 0xE0, 0xEB, 0xD1, 0xE4, 0xD4, 0xF7, 0xF0, 0xFF, 0xE2,
+    0xE7, 0xE6, 0xF5, 0xFF, 0x03, 0x00, 0xF6, 0xF4, 0x15, 0x0A, 0x08, 0x14,
+    0x17, 0x1C, 0x03, 0x28, 0x10, 0x08, 0x13, 0x12, 0x24, 0x28, 0x38, 0x25,
+    0x36, 0xDD, 0xE3, 0xD1, 0xDF, 0xE3, 0xF2, 0xD0, 0xDE, 0xE0, 0xFA, 0xE7,
+    0xEC, 0xDE, 0xEE, 0xED, 0xF4, 0xF8, 0x03, 0x0A, 0x11, 0xF1, 0x11, 0x08,
+    0xF9, 0x09, 0x17, 0x00, 0x22, 0x0D, 0x1D, 0x15, 0x2B, 0x29, 0x22, 0x23,
+    0x1E, 0x25, 0xD9, 0xCB, 0xCD, 0xE9, 0xEC, 0xE9, 0xE9, 0xE3, 0xEA, 0xED,
+    0xDB, 0xF1, 0xFA, 0xF4, 0x02, 0xF9, 0xE7, 0xEF, 0xF2, 0x11, 0x14, 0x1A,
+    0x15, 0x0F, 0x1B, 0x01, 0x18, 0x16, 0x21, 0x2B, 0x26, 0x0C, 0x30, 0x19,
+    0x1C, 0x35, 0x20, 0xC1, 0xCA, 0xDB, 0xE8, 0xD8, 0xE2, 0xEA, 0xED, 0xE7,
+    0xF0, 0xE4, 0xF5, 0xFC, 0xE0, 0x07, 0xFF, 0xFB, 0xEC, 0x09, 0xF7, 0xF4,
+    0xFF, 0x0D, 0x06, 0x05, 0x02, 0x20, 0x18, 0x24, 0x21, 0x2A, 0x18, 0x16,
+    0x16, 0x2B, 0x32, 0x37, 0x09, 0xD7, 0xCE, 0xCF, 0xD5, 0xF1, 0xDC, 0xE4,
+    0xDD, 0xDC, 0xE4, 0xEF, 0xE7, 0x00, 0xE6, 0x01, 0x01, 0x0E, 0x0E, 0x14,
+    0xFA, 0xFC, 0x00, 0xFE, 0x1B, 0x06, 0x1A, 0x25, 0x12, 0x19, 0x0B, 0x25,
+    0x28, 0x39, 0x26, 0x2E, 0xF6, 0xEF, 0xCF, 0xD6, 0xCA, 0xEA, 0xEA, 0xDE,
+    0xE9, 0xF2, 0xF2, 0xDB, 0xE2, 0xF2, 0xEE, 0xF8, 0xFD, 0xF2, 0xFA, 0xFB,
+    0xF6, 0x17, 0x18, 0x0B, 0x02, 0x18, 0x1C, 0x02, 0x11, 0x1E, 0x2F, 0x1D,
+    0x27, 0x24, 0x24, 0x17, 0x39, 0xF9, 0xD8, 0xE7, 0xDF, 0xDA, 0xCE, 0xD0,
+    0xD8, 0xDE, 0xEA, 0xD7, 0xEF, 0xF0, 0xF5, 0xF6, 0x07, 0x09, 0xFC, 0xF2,
+    0xF7, 0xF9, 0x03, 0x04, 0x07, 0x1A, 0x21, 0x02, 0x28, 0x18, 0x1D, 0x0E,
+    0x16, 0x13, 0x32, 0x20, 0x2D, 0xED, 0xFB, 0xDB, 0xCA, 0xEC, 0xCF, 0xCD,
+    0xDC, 0xE5, 0xDA, 0xD9, 0xE0, 0xE3, 0xEA, 0x00, 0x00, 0x0C, 0xFB, 0xF7,
+    0xFC, 0x17, 0x00, 0x1A, 0x08, 0xFF, 0x08, 0x19, 0x1F, 0x06, 0x26, 0x18,
+    0x13, 0x29, 0x34, 0x2A, 0x28, 0x0B, 0x05, 0xF8, 0xD0, 0xCE, 0xCE, 0xE2,
+    0xEB, 0xF7, 0xD7, 0xD6, 0xFB, 0xE6, 0x03, 0xFF, 0xEC, 0xFE, 0xF3, 0x09,
+    0x07, 0x02, 0xF6, 0x05, 0x18, 0x1C, 0x1E, 0x01, 0x25, 0x12, 0x0E, 0x13,
+    0x12, 0x16, 0x1A, 0x3A, 0x30, 0xF8, 0xFC, 0xFD, 0xE8, 0xC8, 0xE5, 0xE6,
+    0xE6, 0xE6, 0xEC, 0xF2, 0xDF, 0xF6, 0xEF, 0x05, 0xF4, 0xEE, 0x0B, 0x07,
+    0xFF, 0xF1, 0x05, 0xF5, 0x09, 0x05, 0x11, 0x01, 0x0F, 0x1A, 0x23, 0x12,
+    0x1F, 0x0D, 0x1C, 0x28, 0x24, 0xFB, 0xFD, 0x00, 0xC6, 0xE7, 0xD8, 0xE3,
+    0xD5, 0xF1, 0xEA, 0xE9, 0xFA, 0xEF, 0xF3, 0xEC, 0xF2, 0xFE, 0x04, 0x06,
+    0x10, 0x07, 0x0F, 0x11, 0x06, 0x0E, 0x15, 0x03, 0x27, 0x0A, 0x20, 0x11,
+    0x14, 0x23, 0x24, 0x31, 0x34, 0x10, 0xEE, 0x0D, 0x0D, 0xE7, 0xCF, 0xE4,
+    0xEA, 0xD9, 0xE7, 0xD6, 0xF0, 0xFF, 0xE8, 0xF4, 0xFD, 0xF0, 0xEE, 0x00,
+    0xFC, 0xF3, 0x0D, 0xF7, 0x0C, 0x16, 0x17, 0x1B, 0x07, 0x25, 0x07, 0x2E,
+    0x26, 0x26, 0x14, 0x16, 0xEF, 0xFE, 0x0F, 0x16, 0x08, 0xCF, 0xD1, 0xD0,
+    0xE9, 0xF3, 0xE9, 0xE4, 0xF6, 0xE9, 0xEC, 0xED, 0xEC, 0x08, 0x0E, 0xFC,
+    0x0F, 0x00, 0x07, 0xF6, 0x02, 0x08, 0x19, 0x14, 0x23, 0x29, 0x09, 0x28,
+    0x1E, 0x29, 0x12, 0x37, 0xF1, 0x10, 0xF8, 0x08, 0x05, 0xDB, 0xD9, 0xEC,
+    0xD1, 0xDA, 0xF1, 0xE3, 0xEA, 0xFF, 0x04, 0xF7, 0xF2, 0xF8, 0xEE, 0x08,
+    0xFF, 0xFC, 0x03, 0xF6, 0xFC, 0xFC, 0x23, 0x11, 0x26, 0x08, 0x2D, 0x26,
+    0x12, 0x10, 0x29, 0xEA, 0xEA, 0xFB, 0xF0, 0x04, 0x18, 0xD0, 0xD3, 0xF1,
+    0xEF, 0xD7, 0xFB, 0xF4, 0xF1, 0xEC, 0xEC, 0x06, 0x00, 0xF4, 0xEE, 0xED,
+    0x13, 0x13, 0x07, 0x0F, 0x1A, 0x0F, 0x0B, 0x17, 0x19, 0x17, 0x13, 0x26,
+    0x2E, 0x13, 0xEA, 0xED, 0xF5, 0x0E, 0xFC, 0x06, 0xEC, 0xCE, 0xEA, 0xE8,
+    0xDD, 0xF4, 0xFA, 0xDF, 0xF0, 0xE9, 0xFD, 0xE3, 0x00, 0x0B, 0xF6, 0x05,
+    0x0E, 0x00, 0x15, 0x1E, 0x0F, 0x10, 0x19, 0x06, 0x07, 0x27, 0x28, 0x16,
+    0x20, 0x1B, 0xF9, 0x0F, 0x08, 0x10, 0xF6, 0x07, 0xE6, 0xEE, 0xF0, 0xEA,
+    0xDE, 0xDE, 0xEC, 0xE4, 0xF7, 0xF0, 0xF2, 0xEA, 0x04, 0x00, 0x11, 0x04,
+    0x05, 0x14, 0x0F, 0x0A, 0x0E, 0x0A, 0x0E, 0x07, 0x2C, 0x0E, 0x27, 0x2C,
+    0x1B, 0xF0, 0x0D, 0xFA, 0x13, 0x12, 0x05, 0xC9, 0xE6, 0xF3, 0xE5, 0xDB,
+    0xE1, 0xD9, 0xED, 0xF9, 0xE8, 0xF9, 0xEA, 0xF1, 0xF0, 0xEF, 0x01, 0x01,
+    0x13, 0xF9, 0x02, 0x03, 0x13, 0x06, 0x26, 0x28, 0x1B, 0x21, 0x30, 0x1E,
+    0xF5, 0xFC, 0xF4, 0x0F, 0x00, 0x0C, 0x1C, 0xE9, 0xED, 0xD2, 0xE6, 0xF3,
+    0xFA, 0xFA, 0xF2, 0x01, 0xF3, 0x08, 0xE7, 0xFE, 0x0E, 0x0C, 0xF2, 0xFA,
+    0x00, 0x18, 0x02, 0x06, 0x17, 0x23, 0x1D, 0x2D, 0x21, 0x23, 0x00, 0x01,
+    0xF2, 0x07, 0xF5, 0x10, 0x0D, 0x12, 0xD6, 0xD9, 0xE3, 0xF5, 0xEC, 0xD9,
+    0xE5, 0xE4, 0xE7, 0xEE, 0xF0, 0x01, 0xF4, 0x00, 0xF9, 0xFB, 0x10, 0x17,
+    0x0E, 0x05, 0x08, 0x18, 0x0B, 0x21, 0x2F, 0x15, 0x2A, 0xEF, 0x00, 0xFA,
+    0x10, 0x07, 0x00, 0x0A, 0x00, 0xED, 0xF4, 0xD4, 0xEC, 0xF5, 0xFB, 0xEE,
+    0xE2, 0xF6, 0xE2, 0x08, 0xFD, 0x10, 0x03, 0xF6, 0x15, 0x1B, 0x10, 0x0F,
+    0x0D, 0x1C, 0x0B, 0x07, 0x23, 0x2F, 0x0F, 0x16, 0xE6, 0xE8, 0x08, 0x12,
+    0x04, 0xFD, 0x01, 0x03, 0xE7, 0xE6, 0xDA, 0xEF, 0xDC, 0xDE, 0xDB, 0xE6,
+    0xE3, 0x08, 0xE7, 0xED, 0x02, 0x03, 0xFC, 0x19, 0xF8, 0x07, 0x07, 0x19,
+    0x0D, 0x0B, 0x2A, 0x20, 0x23, 0x30, 0x00, 0xF6, 0xFB, 0xEF, 0xEF, 0x09,
+    0x07, 0xFE, 0x00, 0xD7, 0xD6, 0xF0, 0xD4, 0xF9, 0xEA, 0xE1, 0xFA, 0xEB,
+    0xE7, 0xFD, 0x00, 0x05, 0xF6, 0xF5, 0x02, 0x03, 0x11, 0x18, 0x21, 0x23,
+    0x1B, 0x2B, 0x0C, 0x18, 0x15, 0x02, 0x07, 0x0B, 0x0B, 0xF1, 0x0C, 0x0F,
+    0x03, 0x12, 0xCF, 0xE6, 0xD9, 0xDD, 0xED, 0xF9, 0xF5, 0xEA, 0xF9, 0x00,
+    0xFC, 0xFB, 0xEF, 0xF5, 0xF4, 0x12, 0x18, 0x05, 0x08, 0x24, 0x1E, 0x1F,
+    0x1E, 0x1E, 0x2D, 0xF9, 0xEB, 0xFB, 0x09, 0xF6, 0xF8, 0x04, 0xFC, 0xFE,
+    0x17, 0xE2, 0xDA, 0xF5, 0xD9, 0xE0, 0xDC, 0xFC, 0xFF, 0xFC, 0x09, 0x03,
+    0xF5, 0x00, 0xFE, 0x16, 0x10, 0x19, 0x18, 0x0C, 0x04, 0x0E, 0x17, 0x22,
+    0x1F, 0xF1, 0x05, 0x09, 0xEC, 0xFD, 0x0F, 0xF8, 0xFC, 0x1A, 0x1A, 0xEA,
+    0xEE, 0xDA, 0xF7, 0xE0, 0xF9, 0xE8, 0xFD, 0xFD, 0xF7, 0x00, 0xFD, 0xFB,
+    0x13, 0x00, 0x19, 0x07, 0x07, 0x12, 0x10, 0x27, 0x0F, 0x24, 0x1E, 0xED,
+    0xE3, 0xE6, 0xF1, 0xFA, 0xF7, 0x0A, 0x14, 0x11, 0x01, 0x11, 0xED, 0xDC,
+    0xDE, 0xEC, 0xEA, 0xDF, 0xF0, 0xF9, 0xEE, 0xF6, 0x01, 0x0F, 0xFE, 0xFA,
+    0x0B, 0x18, 0xFA, 0x20, 0x20, 0x21, 0x23, 0x15, 0x1E, 0xE3, 0xEE, 0xF0,
+    0xFF, 0xF7, 0xF7, 0x0F, 0x0D, 0x09, 0xFD, 0x0D, 0xD4, 0xE9, 0xE5, 0xF6,
+    0xF6, 0xF5, 0xF4, 0xEE, 0x06, 0xEF, 0x03, 0x0E, 0xF5, 0x03, 0x0A, 0x0B,
+    0x08, 0x1C, 0x0F, 0x16, 0x1B, 0x1E, 0x1B, 0xFF, 0xF6, 0xED, 0xED, 0x0C,
+    0xED, 0x0D, 0xFE, 0x17, 0x08, 0x01, 0x02, 0xF3, 0xFA, 0xE2, 0xF2, 0xF8,
+    0xE8, 0xF6, 0xF0, 0xFC, 0x04, 0x03, 0xFB, 0x0A, 0x0B, 0x02, 0x0D, 0x0B,
+    0x12, 0x16, 0x23, 0x1D, 0x08, 0xDF, 0xEB, 0x05, 0xE8, 0xFB, 0x0E, 0x13,
+    0x02, 0xFA, 0x12, 0x1E, 0xFC, 0xEE, 0xDF, 0xF8, 0xD9, 0xE9, 0xFD, 0xF5,
+    0xE9, 0xEE, 0xF6, 0x06, 0x00, 0x05, 0x0C, 0x18, 0x13, 0x18, 0x12, 0x23,
+    0x19, 0x0F, 0x12, 0x01, 0xFF, 0x08, 0xF0, 0xEB, 0x05, 0x09, 0x13, 0xF7,
+    0x13, 0x07, 0x04, 0xF0, 0xD8, 0xF9, 0xE7, 0xF5, 0xFB, 0xF8, 0xEB, 0x0A,
+    0xEF, 0x00, 0xF0, 0x16, 0x13, 0xFF, 0x0A, 0x18, 0x03, 0x05, 0x21, 0x13,
+    0x13, 0xE2, 0x06, 0x06, 0x00, 0xEF, 0xEC, 0x03, 0x04, 0x17, 0x06, 0x1C,
+    0x19, 0x1D, 0xD4, 0xF3, 0xF4, 0xFE, 0xEF, 0x02, 0xF7, 0x01, 0xF7, 0xF4,
+    0x09, 0xF4, 0x05, 0x13, 0x1D, 0x0C, 0x08, 0x05, 0x24, 0x29, 0x27, 0xEF,
+    0xF2, 0xF4, 0xFE, 0xFF, 0x0B, 0x10, 0x00, 0x0B, 0xFE, 0x14, 0xFE, 0x07,
+    0xD3, 0xE1, 0xF1, 0xF6, 0xE6, 0xF6, 0xF4, 0xF4, 0x06, 0xFD, 0x0A, 0x03,
+    0x11, 0xFC, 0x0D, 0x00, 0x13, 0x0E, 0x29, 0x0B, 0x26, 0xEF, 0xF9, 0xFC,
+    0xEC, 0xE9, 0x09, 0xF4, 0x07, 0x18, 0x09, 0x05, 0x00, 0x18, 0xF6, 0xDB,
+    0xE6, 0xE5, 0xEB, 0xEA, 0xEB, 0x0A, 0xFC, 0xFF, 0xF4, 0x13, 0xF9, 0x0F,
+    0x1A, 0x14, 0x1E, 0x1C, 0x13, 0x18, 0xE4, 0x00, 0x00, 0x05, 0x04, 0xED,
+    0xFE, 0x0C, 0x00, 0x14, 0x00, 0x19, 0x01, 0x10, 0xF0, 0xE1, 0xF6, 0xF1,
+    0xEE, 0x04, 0x02, 0xFA, 0x02, 0x0C, 0x07, 0x0A, 0xFB, 0x02, 0x15, 0x05,
+    0x19, 0x1E, 0x19, 0x25, 0xFF, 0xFE, 0xEB, 0xED, 0xED, 0xEC, 0x01, 0x02,
+    0x16, 0x11, 0x1B, 0xFA, 0xFF, 0x0E, 0xFB, 0xF1, 0xE7, 0xE4, 0x03, 0x06,
+    0x00, 0xFA, 0x04, 0x09, 0xFF, 0x01, 0x01, 0x09, 0x02, 0x0B, 0x07, 0x1F,
+    0x17, 0xF0, 0xF7, 0xF5, 0xF4, 0xFD, 0x04, 0x0A, 0xF7, 0xF6, 0xF5, 0x1A,
+    0x0A, 0x19, 0xFE, 0x1C, 0xE8, 0xE8, 0xFB, 0xE5, 0xF4, 0xFD, 0xE9, 0xF2,
+    0x04, 0xF1, 0xF8, 0x15, 0x17, 0xFF, 0x18, 0x07, 0x24, 0x03, 0x26, 0xFE,
+    0xFE, 0xE4, 0xFC, 0x03, 0x06, 0x08, 0x06, 0xF2, 0x00, 0x06, 0x14, 0x02,
+    0x03, 0x1E, 0xEF, 0xDC, 0xF6, 0xEB, 0xF1, 0xEE, 0xF6, 0xF4, 0xFC, 0x01,
+    0xF1, 0x04, 0x0C, 0x13, 0x00, 0x21, 0x0E, 0x13, 0xEE, 0xF0, 0xFE, 0xE1,
+    0x07, 0xF0, 0x03, 0xF5, 0x08, 0xF2, 0x03, 0x11, 0x1D, 0xFD, 0x17, 0x02,
+    0xEA, 0xDE, 0xF4, 0xF2, 0x00, 0xF7, 0x00, 0x0A, 0x0F, 0xF3, 0xFA, 0x0B,
+    0x0B, 0x06, 0x02, 0x1A, 0x0A, 0x15, 0xE0, 0xFA, 0x00, 0x03, 0xFE, 0xEC,
+    0xFF, 0x11, 0xF9, 0xF8, 0x00, 0x13, 0x1C, 0x00, 0x1F, 0x0F, 0xF7, 0xE5,
+    0xFE, 0xFC, 0x04, 0xFF, 0x0D, 0x00, 0xF3, 0xFD, 0x11, 0x05, 0xFC, 0x00,
+    0x0A, 0x0A, 0x12, 0xF2, 0x00, 0xEE, 0xF7, 0x05, 0xE6, 0x08, 0x00, 0xF7,
+    0x03, 0x18, 0x04, 0xF9, 0x1C, 0x0C, 0x0F, 0x0F, 0xF8, 0xFC, 0xE3, 0xF3,
+    0xF3, 0x02, 0x00, 0xF5, 0xF4, 0x14, 0x02, 0x02, 0x06, 0x0C, 0x22, 0x17,
+    0x0C, 0xFD, 0xE0, 0xF7, 0xE8, 0xF7, 0xFC, 0xEE, 0x0A, 0x09, 0xF4, 0xF6,
+    0xFE, 0x0C, 0x1C, 0x20, 0x24, 0xE6, 0xE3, 0xFD, 0xF4, 0x06, 0x07, 0xEA,
+    0xFC, 0x0B, 0x0B, 0xF3, 0x13, 0x05, 0xFC, 0x09, 0x09, 0x02, 0xF4, 0xE7,
+    0xE1, 0xE4, 0x03, 0xFF, 0xF7, 0x0E, 0xF1, 0x0E, 0xFC, 0xFD, 0xFF, 0xFF,
+    0x10, 0x07, 0x0D, 0xDE, 0xF3, 0xF3, 0xFB, 0xFA, 0xF6, 0x03, 0x02, 0x11,
+    0x0A, 0x09, 0x1B, 0x16, 0x04, 0x1E, 0x19, 0x0C, 0xDA, 0xFC, 0xF8, 0xEA,
+    0xEB, 0x0A, 0xEE, 0xF8, 0xFA, 0x15, 0x08, 0x04, 0x1C, 0x1D, 0x0A, 0x03,
+    0x1A, 0xFF, 0xE6, 0xEB, 0xE4, 0xF2, 0xFE, 0x07, 0x10, 0xFE, 0xF5, 0x0A,
+    0x08, 0x14, 0x02, 0x13, 0x07, 0xDB, 0xF9, 0xF4, 0xF0, 0xFD, 0xFB, 0x04,
+    0xF3, 0xFF, 0x0C, 0xFA, 0x16, 0x16, 0x01, 0x1D, 0x21, 0x11, 0x15, 0xE3,
+    0xE5, 0xE4, 0xE9, 0xEC, 0x07, 0x0E, 0xFE, 0x02, 0xFA, 0x0F, 0x05, 0x0D,
+    0x0C, 0x06, 0xE2, 0xE9, 0xE6, 0xE2, 0xE2, 0x06, 0xFE, 0xED, 0xF4, 0x0A,
+    0xF8, 0x03, 0x08, 0x12, 0x00, 0x10, 0x25, 0x20, 0x15, 0xF5, 0x00, 0xE9,
+    0xEB, 0x07, 0xFF, 0x06, 0x09, 0xFE, 0xFE, 0xFB, 0x00, 0x19, 0xFE, 0x12,
+    0xEF, 0xEF, 0xE7, 0xFA, 0xF5, 0xF8, 0xF1, 0xEF, 0x08, 0x00, 0x0F, 0x06,
+    0x0E, 0xF9, 0x0F, 0x15, 0x0B, 0x27, 0x2A, 0xF3, 0xE9, 0xFD, 0xF7, 0x01,
+    0xF6, 0xFF, 0xF8, 0xF7, 0x0A, 0xFB, 0x17, 0x1E, 0x07, 0xF2, 0xDB, 0x00,
+    0xE8, 0xE8, 0x05, 0xF1, 0x07, 0xEB, 0x05, 0xF0, 0x03, 0x13, 0x0F, 0x06,
+    0x1D, 0x0D, 0x18, 0x0E, 0xFB, 0xE2, 0x03, 0x03, 0x0A, 0x02, 0xF9, 0xF4,
+    0x04, 0x05, 0x07, 0x06, 0x18, 0x05, 0x13, 0xF0, 0xFD, 0xE5, 0xEF, 0xFC,
+    0xE7, 0x05, 0x05, 0xF4, 0xFB, 0xF9, 0x12, 0x1A, 0x1C, 0x1E, 0x13, 0x06,
+    0x06, 0x11, 0xE5, 0xED, 0x03, 0x04, 0xE8, 0xF7, 0xFD, 0xF6, 0xF5, 0x04,
+    0x13, 0x17, 0x0A, 0x09, 0xE5, 0xF7, 0xEC, 0xEB, 0xE1, 0xE4, 0xEF, 0xF6,
+    0xFF, 0x0E, 0x11, 0x00, 0x07, 0x04, 0x04, 0xFE, 0x0A, 0x14, 0x1B, 0x08,
+    0xFE, 0xE2, 0xEB, 0x00, 0x00, 0xED, 0x08, 0xF9, 0xFB, 0xFF, 0x00, 0x1B,
+    0x0C, 0xE4, 0xF8, 0xF4, 0xF9, 0xF0, 0x03, 0xF6, 0xE8, 0xF0, 0x0F, 0x04,
+    0x03, 0x00, 0x08, 0x11, 0x09, 0x1D, 0x02, 0x20, 0x07, 0x12, 0xF6, 0xE3,
+    0xF2, 0xFD, 0xFB, 0x07, 0xEF, 0x06, 0xF8, 0x14, 0xFC, 0x1D, 0x04, 0xDD,
+    0xF9, 0xE7, 0xE5, 0xEB, 0xFA, 0x05, 0xFE, 0x0B, 0xEE, 0x0B, 0x02, 0xFB,
+    0x0B, 0x06, 0xFD, 0x1B, 0x14, 0x24, 0x17, 0x1C, 0x00, 0x03, 0xFF, 0x03,
+    0xFC, 0x05, 0xF2, 0x03, 0x15, 0x19, 0xFA, 0x1B, 0xDD, 0xF2, 0xDF, 0x00,
+    0xFE, 0xE2, 0xE4, 0xE5, 0xF4, 0xF7, 0xF1, 0xFD, 0x16, 0x06, 0x13, 0xFF,
+    0x14, 0x19, 0x08, 0x1B, 0x24, 0x23, 0xE7, 0xF1, 0x07, 0xF5, 0xFB, 0xEE,
+    0xF8, 0x0D, 0x13, 0x13, 0x13, 0x02, 0xDE, 0xE8, 0xE7, 0xEF, 0xF4, 0xFF,
+    0xFE, 0x00, 0xE9, 0x0B, 0xF1, 0xF3, 0x00, 0x02, 0x0E, 0xFB, 0x21, 0x16,
+    0x1D, 0x24, 0x14, 0x16, 0x01, 0xF5, 0xF9, 0x00, 0xF7, 0xF1, 0x07, 0xF9,
+    0x03, 0x1C, 0x17, 0xF4, 0xF0, 0xEF, 0xD9, 0xFC, 0xF7, 0xE9, 0x05, 0xED,
+    0xEC, 0xFD, 0x11, 0x07, 0x08, 0x0E, 0xFD, 0x14, 0x13, 0x23, 0x13, 0x22,
+    0x0D, 0x24, 0xF9, 0xF7, 0xEB, 0x0C, 0xEC, 0x00, 0xFC, 0x15, 0x0E, 0x0E,
+    0xFF, 0xEC, 0xD5, 0xF9, 0xE3, 0xF6, 0xEA, 0xEA, 0xF8, 0xFC, 0xEB, 0xF7,
+    0xF1, 0xF9, 0x12, 0xFF, 0x03, 0x00, 0x12, 0x15, 0x0D, 0x1E, 0x11, 0x1E,
+    0xE9, 0xF2, 0xFF, 0x01, 0x08, 0xFA, 0xF4, 0x09, 0x11, 0x08, 0x19, 0xD2,
+    0xE5, 0xED, 0xE1, 0xEC, 0xE9, 0x00, 0x02, 0x09, 0x06, 0xF6, 0x06, 0x14,
+    0x10, 0xF8, 0x0E, 0x0D, 0x10, 0x00, 0x10, 0x27, 0x2D, 0x22, 0xFE, 0xE9,
+    0xF8, 0x00, 0x0B, 0xF3, 0x0B, 0x10, 0x01, 0x10, 0xD5, 0xE0, 0xF7, 0xF5,
+    0xF6, 0xF1, 0xE0, 0xF8, 0xE6, 0xF8, 0x09, 0xF2, 0x12, 0x13, 0xF8, 0x19,
+    0x19, 0x0F, 0x1F, 0x04, 0x0E, 0x15, 0x2D, 0x1A, 0xFF, 0x08, 0xFE, 0xEA,
+    0xF0, 0x11, 0xFB, 0x0A, 0xF7, 0x0D, 0xDF, 0xDA, 0xDF, 0xE4, 0xF3, 0xEE,
+    0xEF, 0xE5, 0x01, 0x02, 0xFF, 0xFF, 0x08, 0xF7, 0x06, 0x0B, 0x03, 0x02,
+    0x02, 0x06, 0x13, 0x1C, 0x0D, 0x12, 0xE4, 0xE6, 0xFE, 0xFD, 0xF0, 0x06,
+    0x0B, 0x0F, 0x13, 0x00, 0xE8, 0xE7, 0xF9, 0xF1, 0xEF, 0x00, 0xFC, 0xF0,
+    0xE6, 0x09, 0x0A, 0xFC, 0xF8, 0x00, 0x11, 0xF9, 0xFC, 0x02, 0xFF, 0x1B,
+    0x23, 0x24, 0x1A, 0x0C, 0x1D, 0xF5, 0xF1, 0xF6, 0x0D, 0x10, 0xFA, 0xFB,
+    0x1A, 0x00, 0xE1, 0xE1, 0xDC, 0xD9, 0xED, 0x00, 0xEE, 0xEE, 0xE9, 0xF1,
+    0x01, 0xFF, 0xF5, 0x0B, 0xFA, 0x0A, 0x06, 0x00, 0x14, 0x0A, 0x1C, 0x29,
+    0x0D, 0x1A, 0x1F, 0xEB, 0x0B, 0xF0, 0xFA, 0xFE, 0x00, 0x00, 0x15, 0xDE,
+    0xDD, 0xE2, 0xF5, 0xFB, 0xEF, 0xE8, 0xED, 0xEE, 0xF8, 0xF3, 0xF9, 0xF9,
+    0xF6, 0xF5, 0xFE, 0xFB, 0x05, 0x14, 0x19, 0x1E, 0x25, 0x21, 0x2A, 0x25,
+    0x29, 0xF0, 0x04, 0xF1, 0xF7, 0x11, 0x0F, 0xF8, 0x0B, 0xDA, 0xEC, 0xEC,
+    0xD9, 0xFB, 0xDD, 0xF9, 0xE2, 0xF8, 0x08, 0xFC, 0xF4, 0xF1, 0x09, 0xFB,
+    0x07, 0x1A, 0x01, 0x1E, 0x07, 0x17, 0x1B, 0x26, 0x1F, 0x1D, 0x13, 0x2D,
+    0xFE, 0xEB, 0xF6, 0xF6, 0x06, 0xFF, 0xFE, 0xCE, 0xD0, 0xE3, 0xE3, 0xFA,
+    0xEB, 0xE1, 0xFE, 0xF4, 0xF7, 0xFC, 0x05, 0xFF, 0x0F, 0x14, 0x01, 0x12,
+    0xFA, 0x12, 0x00, 0x07, 0x06, 0x11, 0x28, 0x1A, 0x26, 0x1E, 0xEF, 0x03,
+    0x08, 0xF3, 0xF3, 0x16, 0x00, 0xE6, 0xE4, 0xDC, 0xDB, 0xD9, 0xE7, 0xE6,
+    0xE3, 0xE4, 0xE4, 0x06, 0xEA, 0xFC, 0x08, 0x11, 0xFD, 0xFE, 0x06, 0x1C,
+    0x1A, 0x05, 0x11, 0x1F, 0x14, 0x23, 0x27, 0x20, 0x1D, 0xEA, 0xFC, 0xFD,
+    0x03, 0x10, 0x09, 0xE6, 0xF1, 0xD5, 0xED, 0xED, 0xEA, 0xFA, 0xE2, 0xF4,
+    0xE9, 0xED, 0xF7, 0xFD, 0xF2, 0x10, 0xF6, 0xF9, 0x05, 0x06, 0x1A, 0x19,
+    0x15, 0x0A, 0x08, 0x1E, 0x15, 0x30, 0x2D, 0xF9, 0xFB, 0xFA, 0x07, 0x13,
+    0x13, 0xEA, 0xCE, 0xEA, 0xDB, 0xF4, 0xE1, 0xF5, 0xFA, 0xF3, 0xE4, 0xEE,
+    0xE7, 0x05, 0x00, 0x03, 0x07, 0xFD, 0xFD, 0x17, 0xFE, 0x0D, 0x20, 0x10,
+    0x1F, 0x1E, 0x0C, 0x27, 0x17, 0x23, 0xF7, 0xEE, 0xF4, 0x09, 0xF8, 0xFD,
+    0xD4, 0xEB, 0xE1, 0xE3, 0xDD, 0xD9, 0xE0, 0xEF, 0xF1, 0x00, 0x07, 0xFC,
+    0xFC, 0x0E, 0xF3, 0x06, 0x0B, 0x0B, 0x01, 0x09, 0x07, 0x12, 0x23, 0x10,
+    0x0A, 0x28, 0x1F, 0x32, 0xFA, 0xF5, 0x07, 0xF8, 0x07, 0x00, 0xD9, 0xE5,
+    0xEC, 0xE2, 0xD7, 0xE3, 0xED, 0xFC, 0xE0, 0xF4, 0xFB, 0xEF, 0xFD, 0x0D,
+    0xFA, 0x0C, 0x05, 0xF9, 0x0A, 0xFC, 0x12, 0x08, 0x16, 0x22, 0x22, 0x1A,
+    0x21, 0x12, 0x2F, 0x00, 0xFA, 0x0C, 0x0A, 0xFB, 0xE0, 0xCD, 0xDF, 0xF5,
+    0xF4, 0xF2, 0xF9, 0xE4, 0xED, 0xEC, 0x00, 0x06, 0xE9, 0x0E, 0xF8, 0xF4,
+    0x02, 0x10, 0x12, 0x19, 0x0F, 0x21, 0x16, 0x10, 0x19, 0x1A, 0x12, 0x21,
+    0x29, 0x1A, 0xF8, 0xF6, 0x05, 0xF6, 0xF4, 0xD6, 0xF1, 0xE1, 0xD7, 0xDC,
+    0xE0, 0xE3, 0xF5, 0xEB, 0xF0, 0xEA, 0xFD, 0xFC, 0xFD, 0x09, 0x10, 0x06,
+    0x0D, 0x19, 0x06, 0x03, 0x0A, 0x02, 0x19, 0x14, 0x14, 0x10, 0x29, 0x12,
+    0x29, 0x03, 0x08, 0x0D, 0xF8, 0xED, 0xE4, 0xCE, 0xDD, 0xE3, 0xF1, 0xF7,
+    0xF4, 0xF7, 0xE0, 0xF7, 0xE9, 0x05, 0x08, 0xFA, 0x09, 0x08, 0x05, 0x06,
+    0xFF, 0xFC, 0x00, 0x1F, 0x24, 0x05, 0x1F, 0x21, 0x11, 0x0E, 0x23, 0x22,
+    0x08, 0xFC, 0x07, 0xF7, 0xED, 0xEF, 0xE4, 0xEC, 0xE3, 0xFA, 0xDE, 0xF9,
+    0xFD, 0xFB, 0xEE, 0xE7, 0x0B, 0xED, 0xFA, 0x11, 0xF8, 0x07, 0xF9, 0x05,
+    0x1F, 0x02, 0x13, 0x12, 0x20, 0x23, 0x21, 0x21, 0x30, 0x21, 0x36, 0xED,
+    0x07, 0xF8, 0xD2, 0xCB, 0xE2, 0xEF, 0xDB, 0xD7, 0xF3, 0xF6, 0xDD, 0xF4,
+    0xE5, 0xEF, 0x08, 0xEC, 0x00, 0x00, 0x09, 0x0E, 0x00, 0x16, 0x15, 0x01,
+    0x1B, 0x18, 0x0D, 0x1F, 0x23, 0x15, 0x24, 0x23, 0x2B, 0x2E, 0x00, 0x06,
+    0x02, 0xC8, 0xD6, 0xDA, 0xDD, 0xE8, 0xE7, 0xF2, 0xFA, 0xED, 0xFF, 0xE2,
+    0xFC, 0x06, 0xF6, 0xFF, 0xED, 0xF0, 0xFF, 0x00, 0x17, 0x1A, 0x03, 0x0B,
+    0x0E, 0x03, 0x27, 0x13, 0x0D, 0x25, 0x18, 0x2B, 0x17, 0x02, 0xF4, 0xFF,
+    0xCC, 0xD5, 0xE5, 0xDD, 0xF0, 0xED, 0xE5, 0xE1, 0xFD, 0xF3, 0xFC, 0xFE,
+    0xF9, 0xEB, 0xEF, 0x01, 0x12, 0xF8, 0x07, 0x0F, 0x11, 0x08, 0x0C, 0x14,
+    0x11, 0x13, 0x11, 0x28, 0x28, 0x30, 0x2E, 0x22, 0xF9, 0x06, 0xD2, 0xE3,
+    0xD4, 0xD4, 0xEE, 0xDB, 0xD9, 0xE2, 0xE8, 0xE5, 0xFB, 0xFB, 0xE5, 0xFE,
+    0x00, 0xF1, 0x07, 0xFD, 0xFD, 0x02, 0x01, 0x13, 0x19, 0x22, 0x07, 0x05,
+    0x10, 0x18, 0x2E, 0x27, 0x29, 0x19, 0x32, 0x1F, 0xEF, 0xCD, 0xE8, 0xE3,
+    0xED, 0xD7, 0xF1, 0xF8, 0xDA, 0xF5, 0xDD, 0xE9, 0xEC, 0x00, 0xE7, 0x02,
+    0xEF, 0x02, 0x12, 0xF3, 0x09, 0xF9, 0x1A, 0x18, 0x09, 0x21, 0x03, 0x28,
+    0x0F, 0x28, 0x18, 0x24, 0x17, 0x1E, 0x1D, 0x0D, 0xD7, 0xD4, 0xCF, 0xDC,
+    0xE1, 0xDB, 0xE5, 0xD8, 0xFA, 0xF7, 0xF7, 0xE1, 0xF6, 0xFC, 0xEC, 0x01,
+    0xFB, 0x10, 0x01, 0x12, 0xFD, 0x10, 0x19, 0x20, 0x01, 0x13, 0x0D, 0x1D,
+    0x16, 0x12, 0x2F, 0x30, 0x2C, 0x1B, 0xF1, 0xE0, 0xD3, 0xEE, 0xDD, 0xDA,
+    0xDF, 0xF0, 0xDE, 0xDA, 0xF7, 0xFA, 0x00, 0xFB, 0x00, 0x01, 0xF9, 0xFE,
+    0xEF, 0x06, 0x00, 0x00, 0x04, 0x13, 0x20, 0x08, 0x08, 0x24, 0x0E, 0x26,
+    0x26, 0x16, 0x34, 0x20, 0x2E, 0x27, 0xD9, 0xCB, 0xDA, 0xCF, 0xE5, 0xD8,
+    0xDA, 0xF7, 0xD9, 0xFB, 0xE1, 0xFA, 0xF5, 0xF6, 0xF6, 0x06, 0x0C, 0xF7,
+    0x06, 0x15, 0x14, 0x18, 0x0D, 0x0E, 0x08, 0x1E, 0x26, 0x08, 0x2A, 0x0B,
+    0x22, 0x20, 0x31, 0x21, 0x21, 0xE6, 0xE2, 0xCB, 0xE4, 0xDE, 0xD4, 0xD9,
+    0xF0, 0xE1, 0xF8, 0xEE, 0x00, 0xEE, 0xEA, 0xE8, 0xF3, 0x00, 0xFD, 0xFD,
+    0xFD, 0x07, 0x12, 0x03, 0x07, 0x00, 0x17, 0x0E, 0x18, 0x2B, 0x21, 0x16,
+    0x12, 0x1B, 0x28, 0x2A, 0x01, 0xE5, 0xEB, 0xD9, 0xDE, 0xF3, 0xE3, 0xE3,
+    0xE9, 0xF4, 0xF2, 0xFF, 0xE9, 0xE9, 0x08, 0xFA, 0x07, 0x00, 0x0C, 0x0D,
+    0x00, 0x00, 0x18, 0xFF, 0x20, 0x0F, 0x12, 0x1A, 0x27, 0x1B, 0x1C, 0x31,
+    0x1E, 0x1E, 0x24, 0xFD, 0xCA, 0xD5, 0xD7, 0xD1, 0xD3, 0xD6, 0xE9, 0xF8,
+    0xEC, 0xE6, 0xF2, 0xE8, 0x02, 0x05, 0xF3, 0xF2, 0x03, 0x02, 0x0B, 0x09,
+    0x0B, 0x0E, 0xFB, 0x0A, 0x0F, 0x0B, 0x0C, 0x1B, 0x21, 0x1E, 0x21, 0x17,
+    0x19, 0x1A, 0x05, 0x0C, 0xD1, 0xCA, 0xD4, 0xF1, 0xE5, 0xF3, 0xE4, 0xFB,
+    0xF3, 0xF2, 0xF4, 0xFB, 0xF9, 0x08, 0xEC, 0x07, 0x0F, 0x0E, 0xFB, 0x04,
+    0x07, 0x1B, 0x11, 0x0E, 0x02, 0x1A, 0x1F, 0x0A, 0x2A, 0x20, 0x11, 0x2B,
+    0x25, 0x30, 0xF7, 0x13, 0xD1, 0xCE, 0xDA, 0xD5, 0xDC, 0xD5, 0xE4, 0xE9,
+    0xE7, 0xF0, 0xEA, 0xFE, 0xFC, 0x09, 0x08, 0x07, 0xF5, 0xF7, 0x00, 0x01,
+    0x19, 0x04, 0xFE, 0x0B, 0x1F, 0x10, 0x0F, 0x0C, 0x16, 0x23, 0x20, 0x26,
+    0x2E, 0x0A, 0xF6, 0x00, 0xEB, 0xD4, 0xEB, 0xED, 0xF2, 0xF3, 0xDC, 0xFD,
+    0xF6, 0xEE, 0xED, 0xE9, 0x08, 0xFD, 0xFD, 0x09, 0xFB, 0xFB, 0x11, 0x0A,
+    0xFE, 0x0C, 0x08, 0x09, 0x25, 0x07, 0x2B, 0x1E, 0x15, 0x16, 0x2A, 0x24,
+    0x00, 0xFA, 0xF8, 0xDA, 0xD0, 0xEA, 0xD4, 0xE8, 0xE2, 0xF5, 0xF6, 0xF2,
+    0xE1, 0xF2, 0xF5, 0x06, 0xED, 0xFB, 0x0A, 0x03, 0x04, 0x0A, 0xFB, 0xFC,
+    0xFE, 0x07, 0x14, 0x1C, 0x0A, 0x20, 0x2B, 0x0B, 0x20, 0x22, 0x1D, 0x2F,
+    0xF9, 0x00, 0x05, 0xCA, 0xE7, 0xD5, 0xE5, 0xEE, 0xF3, 0xF2, 0xFE, 0xDC,
+    0xE3, 0xE6, 0x00, 0xEC, 0xE9, 0xFD, 0xF0, 0xFE, 0x01, 0xF5, 0x15, 0x0B,
+    0x19, 0x19, 0x12, 0x22, 0x1C, 0x10, 0x26, 0x17, 0x16, 0x16, 0x2E, 0x04,
+    0xFD, 0x08, 0xFD, 0xE4, 0xCF, 0xD4, 0xF4, 0xF7, 0xDD, 0xEA, 0xFE, 0xF9,
+    0xF2, 0xF3, 0xFD, 0x06, 0xFF, 0xF4, 0xF6, 0x00, 0xF3, 0x0C, 0x01, 0x01,
+    0x00, 0x08, 0x12, 0x17, 0x09, 0x1B, 0x19, 0x2C, 0x12, 0x12, 0xFB, 0x07,
+    0x11, 0xFA, 0xF4, 0xD1, 0xE6, 0xDC, 0xE5, 0xF7, 0xDB, 0xE3, 0xE9, 0xEC,
+    0xFA, 0xEC, 0x02, 0x02, 0x00, 0xF7, 0xF0, 0xFB, 0xFB, 0xFF, 0x14, 0x06,
+    0x0B, 0x05, 0x1A, 0x08, 0x1F, 0x1E, 0x14, 0x2B, 0x2F, 0x2E, 0x01, 0xF8,
+    0x00, 0x08, 0x0B, 0xDB, 0xD8, 0xD7, 0xD9, 0xEB, 0xF8, 0xE7, 0xF5, 0xF0,
+    0xF9, 0x02, 0xFC, 0x03, 0xF7, 0xF9, 0x00, 0xFD, 0x09, 0x0B, 0x07, 0x13,
+    0x0F, 0x20, 0x23, 0x0B, 0x17, 0x2B, 0x19, 0x0E, 0x2A, 0x05, 0x0A, 0xFA,
+    0x06, 0x04, 0xCC, 0xED, 0xE6, 0xD4, 0xDB, 0xF1, 0xF0, 0xDE, 0xEB, 0xF0,
+    0x05, 0xF9, 0xF9, 0x00, 0xF2, 0x0D, 0xFE, 0xFE, 0xF8, 0x1A, 0x18, 0x0C,
+    0x11, 0x01, 0x1B, 0x0F, 0x25, 0x26, 0x23, 0x2B, 0x0A, 0xF0, 0x01, 0xF0,
+    0xFB, 0x0E, 0xD9, 0xED, 0xE8, 0xDC, 0xE0, 0xEA, 0xDE, 0xF9, 0xFF, 0xE5,
+    0xF6, 0xF7, 0xFF, 0xFC, 0x0B, 0x00, 0x0D, 0x14, 0x09, 0xFA, 0x13, 0x1D,
+    0x1C, 0x1F, 0x0D, 0x12, 0x2A, 0x24, 0x17, 0x14, 0xF2, 0x09, 0x0C, 0xF9,
+    0xFF, 0x0F, 0xEB, 0xD0, 0xDC, 0xF1, 0xEE, 0xE1, 0xFB, 0xE8, 0xF8, 0x00,
+    0xE7, 0xF2, 0xFC, 0x01, 0x00, 0x06, 0x06, 0x0D, 0x18, 0x03, 0x0A, 0x11,
+    0x0D, 0x0F, 0x15, 0x29, 0x2C, 0x0E, 0x12, 0x06, 0xEC, 0x09, 0xEF, 0xFB,
+    0x02, 0x06, 0xCE, 0xF3, 0xDB, 0xEA, 0xE7, 0xEE, 0xFA, 0x00, 0xFE, 0xF9,
+    0xF1, 0x06, 0xF5, 0xF2, 0x0C, 0x11, 0x06, 0x19, 0x08, 0xFE, 0x05, 0x04,
+    0x06, 0x19, 0x1B, 0x0D, 0x23, 0x2F, 0x16, 0xFD, 0xF3, 0xF9, 0xF8, 0x0F,
+    0x0F, 0x03, 0xDA, 0xE7, 0xD5, 0xDA, 0xE7, 0xF4, 0xE4, 0xFF, 0x00, 0xF0,
+    0x07, 0x01, 0xFD, 0xF5, 0x06, 0xFF, 0x0B, 0xFC, 0x07, 0x12, 0x05, 0x15,
+    0x25, 0x1E, 0x23, 0x17, 0x13, 0x15, 0xF3, 0x09, 0x0C, 0xFA, 0x04, 0xF6,
+    0x06, 0xDD, 0xF0, 0xDB, 0xF9, 0xF2, 0xEA, 0xED, 0xFD, 0x02, 0x01, 0xF7,
+    0x02, 0xF5, 0xF1, 0x0A, 0x0E, 0x00, 0xFE, 0xFA, 0x05, 0x0E, 0x1A, 0x0E,
+    0x15, 0x18, 0x19, 0x27, 0x0E, 0x01, 0xFF, 0xF3, 0xFE, 0xF6, 0xFF, 0xFB,
+    0x0D, 0xF2, 0xE0, 0xE7, 0xE0, 0xF0, 0xFC, 0xF1, 0xE7, 0xED, 0xF9, 0x01,
+    0x09, 0x0D, 0x04, 0xF3, 0x04, 0x14, 0x0D, 0xFF, 0x1A, 0x13, 0x17, 0x11,
+    0x0F, 0x28, 0x26, 0x14, 0xEB, 0x08, 0xFA, 0x01, 0xF7, 0xFA, 0x10, 0x0E,
+    0x05, 0xDC, 0xE1, 0xE0, 0xF2, 0xEB, 0xEF, 0xE0, 0xE8, 0xFD, 0x05, 0xF9,
+    0xFC, 0xFF, 0x0C, 0x10, 0xFA, 0x00, 0x00, 0x06, 0x0C, 0x12, 0x01, 0x21,
+    0x18, 0x11, 0x10, 0x25, 0x07, 0x00, 0xF9, 0xFD, 0xFB, 0xFD, 0x09, 0xFE,
+    0x16, 0xD4, 0xED, 0xE0, 0xE0, 0xDD, 0xE0, 0xFF, 0xFC, 0xE6, 0xF1, 0xFA,
+    0x05, 0xFA, 0xF2, 0x0B, 0xF7, 0x19, 0x1B, 0x1C, 0x12, 0x15, 0x18, 0x15,
+    0x14, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0x14, 0x02, 0x17,
+    0xF0, 0xF2, 0xE1, 0xDA, 0xFD, 0xE6, 0x01, 0xF6, 0xEF, 0xF8, 0x00, 0xFB,
+    0xF5, 0xEF, 0x00, 0x07, 0xFF, 0x0C, 0x1B, 0x1B, 0x0E, 0x05, 0x06, 0x09,
+    0x14, 0x27, 0x01, 0xF5, 0xFD, 0xFA, 0xF5, 0x05, 0x05, 0xFE, 0xFC, 0x10,
+    0xF1, 0xF1, 0xF0, 0xEB, 0xE9, 0xF6, 0xFA, 0xEF, 0xF6, 0x07, 0xF1, 0x0E,
+    0xF5, 0x00, 0x13, 0x00, 0x18, 0x04, 0x0C, 0x0C, 0x23, 0x03, 0x09, 0x20,
+    0x24, 0xEA, 0xFE, 0xFE, 0xFC, 0x09, 0x09, 0xF4, 0x09, 0x0F, 0x15, 0x11,
+    0xEA, 0xF0, 0xE4, 0xEB, 0xE3, 0xFA, 0xF6, 0xE7, 0xEF, 0x08, 0xFB, 0xEF,
+    0x0C, 0xF9, 0x00, 0x17, 0x00, 0x07, 0x1F, 0x1E, 0x19, 0x12, 0x29, 0x16,
+    0xF8, 0x02, 0xF4, 0x03, 0xFD, 0x04, 0xF5, 0xF9, 0x0A, 0x07, 0x08, 0xF0,
+    0xF0, 0xF3, 0xFB, 0xF6, 0xED, 0xE1, 0x00, 0x04, 0xEE, 0xFF, 0xF9, 0xF8,
+    0x0E, 0x16, 0x07, 0x00, 0x1C, 0x07, 0x0D, 0x15, 0x0E, 0x26, 0x2A, 0x04,
+    0xF7, 0x00, 0xEB, 0x08, 0xFB, 0x01, 0xF7, 0x0F, 0x14, 0x10, 0x13, 0xDD,
+    0xF5, 0xF7, 0xFB, 0xEB, 0xE3, 0xF8, 0x03, 0xF4, 0xF2, 0x00, 0x08, 0x0C,
+    0x13, 0x09, 0x12, 0x19, 0x10, 0x10, 0x1C, 0x14, 0x12, 0x19, 0xF8, 0xFC,
+    0x05, 0x02, 0xF7, 0x03, 0xFB, 0xFA, 0x15, 0x06, 0x15, 0x19, 0xD9, 0xF9,
+    0xDF, 0xE1, 0xE0, 0xE3, 0xF7, 0x06, 0xEB, 0xF5, 0x09, 0x01, 0xFE, 0x00,
+    0x00, 0x0C, 0x1B, 0x01, 0x21, 0x09, 0x0F, 0x27, 0x08, 0x01, 0xE8, 0xEA,
+    0xEE, 0xEB, 0xF7, 0xF6, 0x02, 0x15, 0xF9, 0x0A, 0x11, 0xE9, 0xE8, 0xE5,
+    0xF9, 0xE7, 0xEF, 0x02, 0xFF, 0x00, 0xF6, 0xF7, 0xF7, 0x0B, 0x00, 0xFB,
+    0x0B, 0x03, 0x0C, 0x10, 0x18, 0x09, 0x23, 0x08, 0x02, 0xF3, 0x01, 0xEE,
+    0xF1, 0x04, 0x07, 0x04, 0x0A, 0x18, 0x0A, 0x14, 0xEB, 0xFA, 0xFB, 0xE8,
+    0xF7, 0xFC, 0xFF, 0xE6, 0xEA, 0x06, 0x03, 0xF7, 0xFD, 0x05, 0x17, 0x06,
+    0x01, 0xFE, 0x0E, 0x19, 0x0B, 0x12, 0x17, 0xF4, 0xED, 0xEC, 0x03, 0xF0,
+    0xFA, 0xF8, 0xF5, 0x00, 0x12, 0x13, 0x10, 0x16, 0xDB, 0xF0, 0xFF, 0xF7,
+    0xE4, 0xF7, 0x07, 0xF9, 0xF2, 0xFE, 0x10, 0x0D, 0xFE, 0xFC, 0x1A, 0x1A,
+    0x19, 0x04, 0x13, 0x1A, 0x10, 0x00, 0xF2, 0x00, 0xF1, 0xEA, 0x0C, 0xF5,
+    0x09, 0x11, 0x03, 0x16, 0x07, 0x12, 0x17, 0xDB, 0xDA, 0xF6, 0xF3, 0xEA,
+    0xF4, 0xEE, 0xED, 0x00, 0xFE, 0xF6, 0x07, 0xFD, 0x08, 0x07, 0x0C, 0x0F,
+    0x1F, 0x03, 0x1E, 0x06, 0xFA, 0xFB, 0xE5, 0xEC, 0x04, 0x08, 0xEE, 0xF8,
+    0x00, 0x0E, 0xFF, 0x13, 0x01, 0x17, 0xF6, 0xEC, 0xDD, 0xFF, 0xED, 0xEF,
+    0xF9, 0xF9, 0x04, 0xF9, 0xF3, 0x08, 0x11, 0x0F, 0x05, 0x06, 0x0D, 0x15,
+    0x20, 0x0C, 0x0A, 0x01, 0xF7, 0xFF, 0xF6, 0x0A, 0xF6, 0xF1, 0xF9, 0x03,
+    0x07, 0x11, 0x0F, 0x15, 0x01, 0xE9, 0xF4, 0xF8, 0xF1, 0x02, 0xFA, 0xF6,
+    0x04, 0xEE, 0xF3, 0xFC, 0xFD, 0x12, 0xFF, 0xFC, 0x01, 0x01, 0x16, 0x07,
+    0x12, 0xEF, 0xFE, 0xEF, 0xF1, 0x04, 0x02, 0x04, 0x00, 0xF4, 0x12, 0x0B,
+    0x02, 0x1D, 0x14, 0x02, 0xF0, 0xFC, 0x00, 0xEE, 0xFA, 0xEE, 0xF0, 0xFD,
+    0x0C, 0x10, 0x0F, 0x11, 0x05, 0x00, 0x10, 0x13, 0x19, 0x03, 0x0F, 0xF8,
+    0xE6, 0xEF, 0x05, 0xF5, 0xF9, 0xF4, 0xF5, 0xF4, 0xF5, 0x04, 0x19, 0x12,
+    0x0D, 0x18, 0xE0, 0xFA, 0xF3, 0xF4, 0xE8, 0xFF, 0x06, 0xF2, 0xF5, 0xFE,
+    0x02, 0xFD, 0x02, 0x05, 0x11, 0x00, 0x05, 0x23, 0x1A, 0x0D, 0xFD, 0xE6,
+    0xF3, 0x06, 0xFD, 0x02, 0x0D, 0x0C, 0x0D, 0x17, 0x03, 0x07, 0x16, 0x1B,
+    0x20, 0xF6, 0xE4, 0xF6, 0xEA, 0xF6, 0x00, 0x02, 0x04, 0x06, 0xF1, 0x0B,
+    0x10, 0x09, 0x1B, 0x00, 0x06, 0x02, 0x1B, 0x17, 0xE5, 0xF9, 0xE7, 0xF2,
+    0xFE, 0x07, 0xF1, 0x0B, 0xF6, 0x14, 0x12, 0xFD, 0x0A, 0x0F, 0x21, 0xF9,
+    0xDF, 0xF4, 0xE6, 0xFB, 0xF0, 0xED, 0xF9, 0xFA, 0x05, 0xFC, 0x0B, 0x10,
+    0x00, 0x00, 0x0C, 0x02, 0x0A, 0x0D, 0xEB, 0xEB, 0xFA, 0xE5, 0xF1, 0x04,
+    0xFE, 0x00, 0xF9, 0xFE, 0xFB, 0x0A, 0x00, 0x06, 0x0B, 0x17, 0xF9, 0xF5,
+    0xE6, 0xE4, 0xF9, 0xEE, 0x03, 0xFE, 0xFF, 0xF9, 0x0C, 0xFF, 0xFC, 0x06,
+    0x14, 0x17, 0x0F, 0x03, 0xEE, 0xEB, 0xE2, 0xED, 0xF6, 0xF4, 0xF4, 0xF2,
+    0x08, 0x05, 0x13, 0x1A, 0x1B, 0x02, 0x15, 0x23, 0xFC, 0xFE, 0xE1, 0x04,
+    0xE6, 0x07, 0xEE, 0xF0, 0x0F, 0xF9, 0x04, 0x0A, 0x05, 0x15, 0x14, 0x02,
+    0x20, 0x21, 0xFD, 0xE6, 0xE5, 0xE6, 0xFD, 0xEE, 0x06, 0xEE, 0x01, 0x09,
+    0x17, 0x16, 0x18, 0x1C, 0x01, 0x03, 0xF8, 0xFC, 0xE4, 0x00, 0xE6, 0xF4,
+    0xF2, 0xED, 0xF8, 0x0D, 0x00, 0xF7, 0xF8, 0x03, 0x0B, 0x04, 0x01, 0xF6,
+    0xFF, 0xE0, 0xFC, 0xF7, 0xF8, 0xFE, 0xEE, 0xF7, 0x07, 0x0C, 0xFF, 0x11,
+    0x13, 0xFF, 0x12, 0x06, 0x12, 0xF6, 0xFA, 0xF4, 0x04, 0x05, 0xF4, 0x06,
+    0x0B, 0x00, 0x0C, 0x17, 0x08, 0x05, 0x13, 0x0D, 0x1F, 0xE8, 0xE3, 0xF4,
+    0xE3, 0x06, 0xF0, 0xF9, 0x08, 0x00, 0x09, 0xFC, 0x03, 0x15, 0x12, 0x10,
+    0x0B, 0x14, 0x03, 0xE4, 0xEB, 0xE4, 0x04, 0x04, 0x06, 0xED, 0x0C, 0xF8,
+    0xF8, 0x09, 0x00, 0x1B, 0xFD, 0x05, 0xF6, 0xEB, 0xF7, 0xFA, 0xFA, 0x07,
+    0xF5, 0x09, 0xF9, 0xF4, 0xFB, 0x05, 0x17, 0x0A, 0x02, 0x10, 0x21, 0x1B,
+    0x21, 0xFF, 0xFB, 0xEF, 0xEC, 0xF5, 0xED, 0xF7, 0xFD, 0xF2, 0x0F, 0x0E,
+    0x0E, 0x15, 0x0B, 0x02, 0xDC, 0xDF, 0xF0, 0xF2, 0xEE, 0xF2, 0xFE, 0xFA,
+    0x00, 0xFD, 0xFF, 0xF6, 0x0C, 0xFE, 0x1C, 0xFF, 0x02, 0x1F, 0xEE, 0xE1,
+    0xE3, 0xEF, 0x07, 0xF1, 0xFB, 0x01, 0xFB, 0xF4, 0xF7, 0x07, 0x09, 0x14,
+    0x19, 0xE6, 0xF2, 0xFE, 0xEB, 0xE3, 0xFB, 0xEF, 0x08, 0x06, 0x07, 0xF6,
+    0xFE, 0x06, 0x00, 0x13, 0x16, 0x0B, 0x1D, 0x0D, 0x00, 0xE9, 0xF9, 0xEE,
+    0x07, 0x09, 0x02, 0x0D, 0xF8, 0x09, 0x0D, 0xFA, 0x00, 0x1E, 0x0D, 0xED,
+    0xFB, 0xFB, 0xF9, 0xF2, 0xEC, 0xE9, 0xED, 0xF4, 0xF7, 0x0D, 0x0D, 0x06,
+    0x06, 0x16, 0x02, 0x0B, 0x23, 0x25, 0xF5, 0xFA, 0x02, 0x00, 0x0B, 0x09,
+    0xFF, 0xF2, 0xF5, 0x0B, 0xF9, 0x18, 0x11, 0x0E, 0xF8, 0xE2, 0xFD, 0x00,
+    0xE5, 0x00, 0xEB, 0xFF, 0x05, 0x0E, 0x06, 0x07, 0x00, 0x15, 0x1C, 0x17,
+    0x06, 0x02, 0x11, 0xFF, 0xE8, 0xFC, 0xF5, 0xF0, 0xF0, 0xF6, 0xF4, 0x13,
+    0xF9, 0x0D, 0x0C, 0x16, 0x12, 0xF7, 0xF4, 0xF2, 0xEF, 0xEF, 0xF0, 0x00,
+    0xF3, 0xF8, 0x10, 0xF4, 0x00, 0x0D, 0xFD, 0x06, 0x0E, 0x13, 0x16, 0x0B,
+    0x28, 0xE8, 0xF5, 0xEC, 0xF7, 0x0A, 0xF7, 0x0F, 0x0E, 0x00, 0x0C, 0x09,
+    0x15, 0x10, 0xF4, 0xFD, 0xE1, 0xE0, 0xE7, 0xF2, 0xE7, 0x00, 0x03, 0x08,
+    0xF5, 0x00, 0x0B, 0x02, 0x15, 0x01, 0x20, 0x15, 0x10, 0x15, 0xEB, 0x04,
+    0xEE, 0xF7, 0xFB, 0xEF, 0xF0, 0x0E, 0x00, 0xF8, 0x10, 0x01, 0x0D, 0xEB,
+    0xF2, 0xE2, 0xEB, 0xF6, 0x05, 0xF4, 0xFF, 0xF9, 0x09, 0x06, 0x0F, 0x0D,
+    0xFA, 0x0F, 0x1C, 0x14, 0x04, 0x22, 0x11, 0xFA, 0xEE, 0xE6, 0xEC, 0x07,
+    0xF3, 0x0D, 0x07, 0x06, 0xFA, 0x03, 0x00, 0xF7, 0xF1, 0xE2, 0xF6, 0xE4,
+    0xEF, 0xF6, 0xFF, 0xFA, 0x07, 0x05, 0x10, 0xFF, 0x08, 0x15, 0x02, 0x0D,
+    0x16, 0x1A, 0x0B, 0x0D, 0xFA, 0xFB, 0xF4, 0xFC, 0xF3, 0x05, 0x0F, 0x14,
+    0x06, 0x09, 0x0E, 0x04, 0xED, 0xEE, 0xF9, 0xF9, 0xEF, 0xFB, 0xFE, 0x00,
+    0xF5, 0xF9, 0x10, 0xF3, 0x11, 0x06, 0x17, 0x04, 0x0C, 0x1D, 0x18, 0x11,
+    0x27, 0xE9, 0x02, 0xEB, 0xF8, 0x08, 0x0B, 0xFD, 0x08, 0x16, 0x13, 0xFD,
+    0x17, 0xEE, 0xF8, 0xEE, 0xF0, 0xFC, 0xF0, 0xF3, 0x05, 0xFA, 0x0E, 0xFC,
+    0xF9, 0x0B, 0x15, 0x0D, 0x04, 0x04, 0x1B, 0x24, 0x13, 0x17, 0x00, 0xFF,
+    0x00, 0xF2, 0xF6, 0xFE, 0xF7, 0xF8, 0x00, 0x07, 0x0D, 0xE2, 0xE9, 0xE8,
+    0xFB, 0xF8, 0xE9, 0xF1, 0xF2, 0xF6, 0xEC, 0xF0, 0xF9, 0x12, 0xFC, 0xFB,
+    0x05, 0x18, 0x1F, 0x23, 0x0C, 0x10, 0x22, 0xE4, 0xF5, 0x07, 0x03, 0xF4,
+    0x02, 0xF6, 0x09, 0xFF, 0x12, 0xD7, 0xE1, 0xF8, 0xF6, 0xF6, 0xE2, 0xFB,
+    0xF3, 0xEE, 0xEE, 0xEF, 0x0C, 0x0D, 0x11, 0x13, 0x01, 0x13, 0x13, 0x1E,
+    0x14, 0x0B, 0x1E, 0x10, 0xEF, 0xF8, 0xF2, 0x0A, 0xF2, 0x0F, 0x12, 0x0C,
+    0xFC, 0x00, 0xF4, 0xF9, 0xF4, 0xFD, 0xEC, 0x02, 0xEA, 0xFE, 0x07, 0xEC,
+    0xFC, 0xF3, 0xF9, 0x12, 0x10, 0x11, 0x07, 0x03, 0x06, 0x0E, 0x17, 0x1B,
+    0x27, 0xF5, 0xFD, 0xF7, 0xF3, 0xF5, 0x12, 0xFC, 0x18, 0x0A, 0xE4, 0xE6,
+    0xF4, 0xF0, 0xDF, 0xE1, 0xF8, 0xEC, 0xFD, 0xEB, 0xFA, 0x02, 0x09, 0xF8,
+    0x13, 0x19, 0x17, 0x1E, 0x14, 0x06, 0x1B, 0x1D, 0x18, 0x03, 0xFE, 0xFA,
+    0x00, 0xFC, 0xF2, 0x0F, 0x0B, 0x0E, 0xE2, 0xE3, 0xDF, 0xEE, 0xE0, 0xFF,
+    0x00, 0xFA, 0xF9, 0x0B, 0x0A, 0x0B, 0x10, 0xF8, 0x15, 0x0D, 0x14, 0x02,
+    0x01, 0x19, 0x17, 0x11, 0x24, 0x0E, 0xFD, 0x00, 0x00, 0x0C, 0x04, 0x14,
+    0xFE, 0xFA, 0xDD, 0xF4, 0xE6, 0xE2, 0xE2, 0xEF, 0xEE, 0xE7, 0xF4, 0xF9,
+    0x0B, 0xFE, 0xFB, 0x00, 0x10, 0x05, 0xFF, 0x0F, 0x0B, 0x1B, 0x0C, 0x0B,
+    0x1D, 0x24, 0xF6, 0xF3, 0x00, 0x02, 0x0D, 0xF4, 0x01, 0x0C, 0xDA, 0xF2,
+    0xE9, 0xF9, 0xF5, 0x00, 0x02, 0x00, 0xEF, 0xF3, 0x0C, 0x0B, 0x10, 0x00,
+    0x12, 0xF9, 0x0F, 0x0B, 0x06, 0x1F, 0x18, 0x09, 0x25, 0x0C, 0xE6, 0xF6,
+    0xF2, 0x02, 0xFD, 0xFB, 0x16, 0x06, 0xD7, 0xEC, 0xE8, 0xEA, 0xFB, 0xE2,
+    0xE2, 0x03, 0xED, 0xF1, 0x0B, 0xFC, 0xFA, 0x04, 0xF7, 0x0D, 0x0B, 0x12,
+    0x20, 0x17, 0x18, 0x22, 0x13, 0x24, 0x0E, 0x07, 0x05, 0xFC, 0x03, 0x12,
+    0x08, 0x12, 0xEB, 0xF1, 0xE1, 0xE2, 0xF2, 0xF6, 0xE7, 0x00, 0xE7, 0xF0,
+    0x07, 0xFF, 0xF7, 0x04, 0x13, 0xFF, 0x05, 0x07, 0x0F, 0x09, 0x08, 0x26,
+    0x26, 0x25, 0x19, 0xF4, 0xEF, 0x01, 0x00, 0x00, 0x13, 0x04, 0xED, 0xEA,
+    0xEE, 0xFA, 0xF1, 0xE6, 0xF2, 0xEE, 0xEA, 0xF4, 0x08, 0x09, 0xFC, 0x00,
+    0x15, 0x0D, 0x19, 0x0D, 0x15, 0x0A, 0x11, 0x1C, 0x09, 0x0F, 0x2C, 0xEF,
+    0xFE, 0x06, 0xFB, 0x09, 0x0D, 0xEB, 0xE0, 0xF5, 0xEE, 0xDD, 0xDF, 0xF6,
+    0xF5, 0xEE, 0x02, 0xF2, 0xEF, 0x0F, 0x00, 0xF6, 0x09, 0x13, 0x0B, 0x0E,
+    0x01, 0x06, 0x0F, 0x17, 0x21, 0x2A, 0x22, 0x00, 0xF4, 0xF5, 0xF6, 0x00,
+    0x0D, 0xF2, 0xF2, 0xDB, 0xE0, 0xE0, 0xF6, 0xF2, 0xE7, 0xEC, 0x05, 0xEA,
+    0x03, 0xF7, 0x11, 0x00, 0x0C, 0x05, 0x0F, 0x1A, 0x18, 0x0A, 0x19, 0x07,
+    0x21, 0x16, 0x1D, 0xF2, 0xED, 0x0A, 0xFA, 0xFF, 0xE2, 0xE8, 0xEF, 0xF8,
+    0xF6, 0xF9, 0xF3, 0x00, 0xE6, 0x00, 0x02, 0x0A, 0xF7, 0x09, 0x0E, 0x01,
+    0xF7, 0x01, 0x1A, 0x00, 0x1C, 0x16, 0x08, 0x16, 0x0E, 0x27, 0x2C, 0xF2,
+    0xFE, 0xF2, 0x0F, 0xFC, 0xE2, 0xF3, 0xF5, 0xE6, 0xF0, 0xE3, 0xEF, 0xED,
+    0xF9, 0xFB, 0x00, 0x05, 0x00, 0xF1, 0x05, 0xFF, 0x03, 0x00, 0x16, 0x02,
+    0x0B, 0x14, 0x0F, 0x1A, 0x1C, 0x13, 0x13, 0x0C, 0x02, 0xFE, 0xF9, 0xE3,
+    0xE5, 0xF4, 0xE9, 0xE5, 0xE7, 0xE1, 0xE9, 0xE4, 0xE7, 0xF5, 0xFB, 0xED,
+    0x0A, 0x0B, 0x09, 0x0F, 0x07, 0x14, 0x06, 0x0B, 0x18, 0x0A, 0x08, 0x1C,
+    0x1C, 0x1F, 0x01, 0xF8, 0xFF, 0x04, 0x05, 0xDD, 0xE9, 0xF0, 0xDB, 0xE3,
+    0xE0, 0xE7, 0xEE, 0xF5, 0xE8, 0xFE, 0x02, 0xF1, 0xF8, 0x01, 0xFD, 0xF9,
+    0x09, 0x04, 0x12, 0x0A, 0x04, 0x0D, 0x28, 0x17, 0x29, 0x13, 0xFF, 0x0B,
+    0x04, 0x07, 0xD5, 0xD9, 0xD4, 0xF7, 0xE6, 0xDD, 0xFD, 0xF2, 0xEC, 0xF5,
+    0xEA, 0xF3, 0xF2, 0xF9, 0x09, 0x00, 0xF7, 0x11, 0x02, 0x11, 0x16, 0x23,
+    0x22, 0x1D, 0x11, 0x28, 0x21, 0x31, 0x0A, 0x01, 0xF5, 0xE9, 0xD5, 0xEC,
+    0xF1, 0xF8, 0xDD, 0xF2, 0xEC, 0xE2, 0xE5, 0xFA, 0xF3, 0xEB, 0x00, 0xF8,
+    0x07, 0x15, 0x15, 0x16, 0x00, 0x1B, 0x21, 0x15, 0x13, 0x09, 0x26, 0x0E,
+    0x1B, 0x2F, 0x00, 0x03, 0xF5, 0xE9, 0xE4, 0xE7, 0xD8, 0xF2, 0xF6, 0xF5,
+    0xEF, 0xEB, 0x00, 0x04, 0x03, 0xF5, 0x00, 0xF4, 0x12, 0x00, 0x02, 0x0C,
+    0x12, 0x19, 0x17, 0x07, 0x0E, 0x1B, 0x1C, 0x14, 0x27, 0xEE, 0xFF, 0xFD,
+    0xDA, 0xD0, 0xE3, 0xDF, 0xDD, 0xFB, 0xEA, 0xE0, 0xF4, 0xF7, 0xEF, 0xFC,
+    0x04, 0x02, 0x0B, 0x09, 0x13, 0x15, 0x0A, 0x0F, 0x10, 0x1A, 0x21, 0x1A,
+    0x22, 0x21, 0x2B, 0x25, 0x1D, 0x0C, 0x00, 0xE1, 0xD8, 0xE9, 0xD8, 0xEC,
+    0xEF, 0xEE, 0xE1, 0x01, 0xE7, 0xFF, 0x01, 0xF9, 0xF2, 0x0C, 0xF8, 0xFE,
+    0xFB, 0x11, 0x19, 0x16, 0x05, 0x14, 0x1F, 0x27, 0x10, 0x21, 0x1A, 0x30,
+    0x0A, 0xFA, 0xEB, 0xD7, 0xEE, 0xD9, 0xF1, 0xEA, 0xEE, 0xFA, 0xF6, 0xE5,
+    0xEA, 0xF0, 0x06, 0xF2, 0xFE, 0xFD, 0x10, 0xF9, 0x00, 0x00, 0x14, 0x15,
+    0x20, 0x0E, 0x0E, 0x17, 0x1E, 0x14, 0x14, 0x27, 0x0C, 0xD4, 0xE8, 0xD9,
+    0xEC, 0xED, 0xF2, 0xEB, 0xF1, 0xF8, 0x02, 0xF1, 0xFA, 0xF3, 0xF9, 0x00,
+    0x08, 0x02, 0x0E, 0x03, 0x1A, 0x18, 0x18, 0x15, 0x23, 0x0A, 0x20, 0x16,
+    0x20, 0x13, 0x16, 0xF2, 0xD0, 0xE5, 0xDC, 0xEE, 0xD9, 0xDF, 0xED, 0xDE,
+    0xE9, 0x00, 0x01, 0x00, 0xF9, 0x07, 0x0A, 0xF8, 0xFA, 0xFB, 0x11, 0x13,
+    0x08, 0x01, 0x02, 0x1B, 0x0B, 0x26, 0x18, 0x2D, 0x23, 0x1B, 0x25, 0xE0,
+    0xD8, 0xED, 0xE6, 0xE6, 0xE3, 0xF1, 0xED, 0xF4, 0xE5, 0xEF, 0x03, 0xFE,
+    0x02, 0xF6, 0xFB, 0xFD, 0xFD, 0x0F, 0xFA, 0x08, 0x19, 0x14, 0x0E, 0x18,
+    0x16, 0x24, 0x13, 0x20, 0x1E, 0x2F, 0xE0, 0xED, 0xD4, 0xD1, 0xEB, 0xE2,
+    0xF8, 0xF3, 0xF7, 0xF3, 0xE7, 0xED, 0x00, 0xF1, 0xEF, 0x02, 0xF3, 0x06,
+    0x09, 0x0B, 0x14, 0x0A, 0x13, 0x15, 0x08, 0x1F, 0x29, 0x11, 0x2B, 0x29,
+    0x20, 0xF0, 0xED, 0xD6, 0xF2, 0xDC, 0xF5, 0xF0, 0xF6, 0xEF, 0xEB, 0x02,
+    0xF2, 0xFB, 0x09, 0x0A, 0xFE, 0xF2, 0xFD, 0x12, 0xFE, 0x07, 0x06, 0x0C,
+    0x1B, 0x06, 0x0E, 0x12, 0x18, 0x25, 0x2D, 0x26, 0xFF, 0xD5, 0xD9, 0xE3,
+    0xD6, 0xDD, 0xE8, 0xEF, 0xE1, 0xEB, 0xEB, 0xFB, 0xFC, 0x03, 0xF9, 0x09,
+    0xF5, 0x12, 0x08, 0x07, 0xFD, 0x15, 0x03, 0x0D, 0x0D, 0x07, 0x13, 0x15,
+    0x27, 0x26, 0x2D, 0xF4, 0xDB, 0xD9, 0xE0, 0xEA, 0xD5, 0xE9, 0xED, 0xF3,
+    0xE9, 0xEA, 0xFF, 0x00, 0xEB, 0x0A, 0xF3, 0x08, 0x0B, 0x11, 0xFD, 0x12,
+    0x1B, 0x14, 0x06, 0x09, 0x06, 0x26, 0x0A, 0x13, 0x2D, 0x33, 0xF0, 0x04,
+    0xE0, 0xED, 0xEF, 0xED, 0xDB, 0xEE, 0xDE, 0xE6, 0xEA, 0x02, 0x05, 0xFE,
+    0xF6, 0x07, 0xF1, 0xF7, 0x03, 0x02, 0x16, 0x0B, 0x01, 0x09, 0x1B, 0x05,
+    0x24, 0x0C, 0x26, 0x2F, 0x21, 0xF8, 0x0F, 0xD6, 0xE4, 0xDD, 0xD9, 0xE4,
+    0xED, 0xF6, 0xEE, 0xED, 0xEA, 0xFC, 0xFC, 0xFC, 0x03, 0x0F, 0xFF, 0xFE,
+    0x08, 0x14, 0x0D, 0x00, 0x12, 0x1A, 0x1A, 0x09, 0x0D, 0x22, 0x1E, 0x28,
+    0x01, 0x00, 0xF3, 0xE0, 0xEC, 0xF2, 0xEE, 0xF1, 0xFB, 0xEA, 0xEA, 0x00,
+    0xF0, 0xFB, 0xF8, 0x00, 0x04, 0xFF, 0x12, 0x02, 0xFB, 0x13, 0x1A, 0x0D,
+    0x1F, 0x1F, 0x12, 0x19, 0x0D, 0x24, 0x16, 0x01, 0x09, 0xFE, 0xCF, 0xE3,
+    0xD6, 0xF2, 0xF0, 0xE5, 0xF0, 0xEA, 0xEA, 0xFD, 0xE8, 0xF7, 0xF1, 0xF8,
+    0xF4, 0xFB, 0x0B, 0x12, 0x1A, 0x12, 0x0C, 0x05, 0x13, 0x12, 0x25, 0x1F,
+    0x28, 0x23, 0xF5, 0x0E, 0xF8, 0xD8, 0xD5, 0xD6, 0xF6, 0xEF, 0xF3, 0xF3,
+    0xE6, 0xE5, 0xEF, 0xF3, 0x01, 0x09, 0x0C, 0xF5, 0xFE, 0x05, 0xFD, 0x0E,
+    0x1C, 0x10, 0x13, 0x04, 0x0A, 0x0B, 0x0D, 0x1F, 0x13, 0xF0, 0x05, 0x10,
+    0x03, 0xD2, 0xE1, 0xF1, 0xE8, 0xE5, 0xEF, 0xF6, 0xF2, 0xFB, 0xE9, 0xEE,
+    0x03, 0x07, 0xFC, 0x10, 0x11, 0x09, 0x19, 0x19, 0x0A, 0x0B, 0x11, 0x26,
+    0x26, 0x1B, 0x20, 0x13, 0xF3, 0xF6, 0x00, 0xFD, 0xDF, 0xE5, 0xDD, 0xED,
+    0xF7, 0xE5, 0xE1, 0x00, 0x01, 0xFA, 0xFC, 0xF6, 0xFA, 0x0D, 0x0A, 0xFB,
+    0x03, 0x11, 0x19, 0xFF, 0x20, 0x1D, 0x06, 0x11, 0x22, 0x1E, 0x28, 0xED,
+    0xF2, 0x06, 0x00, 0xDF, 0xE3, 0xD8, 0xE1, 0xF3, 0xE4, 0xE4, 0xEC, 0xF0,
+    0xEC, 0xF3, 0xF5, 0xF9, 0xF5, 0xF6, 0x12, 0x09, 0xFF, 0x03, 0x16, 0x09,
+    0x13, 0x19, 0x15, 0x0D, 0x17, 0x24, 0xF6, 0xF9, 0x04, 0x0C, 0xFC, 0xEC,
+    0xF4, 0xF3, 0xF4, 0xE1, 0xEB, 0xF4, 0xED, 0xF0, 0x05, 0xEE, 0xF9, 0xF4,
+    0xF7, 0x0B, 0xF7, 0x13, 0x11, 0x12, 0x11, 0x1A, 0x05, 0x14, 0x11, 0x24,
+    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x11, 0xE6, 0xE8, 0xD9, 0xF7, 0xDE, 0xFA,
+    0xE3, 0xF8, 0xF7, 0xED, 0x06, 0xFE, 0xF7, 0x02, 0x11, 0x02, 0x14, 0x19,
+    0x06, 0x13, 0x0F, 0x0D, 0x1E, 0x27, 0x0D, 0x1B, 0xFF, 0xF5, 0xF0, 0x0C,
+    0x00, 0xF9, 0xED, 0xDA, 0xE1, 0xDA, 0xEF, 0xFC, 0x00, 0xFE, 0x04, 0xFE,
+    0x04, 0xF5, 0x00, 0x02, 0x11, 0x16, 0x00, 0x18, 0x12, 0x1A, 0x21, 0x16,
+    0x1C, 0x13, 0x29, 0xF2, 0x09, 0x03, 0x00, 0x0A, 0x00, 0xEE, 0xF1, 0xEE,
+    0xF4, 0xE5, 0xEA, 0xF4, 0xF1, 0xEC, 0xF7, 0xED, 0xEE, 0x07, 0xF5, 0xFC,
+    0x0D, 0x04, 0x0E, 0x10, 0x15, 0x1F, 0x05, 0x0D, 0x12, 0x17, 0x03, 0xEF,
+    0x0D, 0x04, 0xF4, 0x11, 0xFB, 0xD6, 0xDA, 0xE3, 0xEF, 0xF4, 0xE7, 0x00,
+    0x00, 0xF9, 0x00, 0x03, 0xF5, 0x04, 0x04, 0x0C, 0x10, 0xFC, 0x09, 0x0C,
+    0x16, 0x0B, 0x07, 0x27, 0x14, 0x00, 0x05, 0xFE, 0x06, 0xF2, 0x01, 0x12,
+    0xEC, 0xE5, 0xE4, 0xF7, 0xE4, 0xF8, 0xF4, 0xEA, 0xF1, 0xF3, 0x07, 0xFC,
+    0xFC, 0xF7, 0xFE, 0xFA, 0xFF, 0x14, 0x10, 0x0E, 0x04, 0x13, 0x09, 0x17,
+    0x20, 0x07, 0x03, 0xFF, 0x08, 0xF7, 0xF9, 0x04, 0xE4, 0xDF, 0xEF, 0xEB,
+    0xEC, 0xE3, 0xF2, 0xF3, 0xED, 0x09, 0xF3, 0x05, 0x0C, 0xF6, 0xF9, 0xFD,
+    0xFD, 0x18, 0x0A, 0x15, 0x0B, 0x0A, 0x27, 0x26, 0x02, 0xF8, 0xF2, 0xFB,
+    0xFB, 0x0F, 0x0A, 0xEB, 0xEE, 0xDF, 0xFB, 0xE5, 0xEF, 0xE9, 0x00, 0xF4,
+    0x09, 0x02, 0x09, 0xFD, 0xFF, 0x08, 0x0F, 0x03, 0x0B, 0xFF, 0x05, 0x17,
+    0x15, 0x21, 0x13, 0xFE, 0xF1, 0x04, 0xF9, 0x03, 0x13, 0xFE, 0x09, 0xD7,
+    0xDC, 0xE3, 0xFB, 0xE1, 0xEF, 0x01, 0xE8, 0xFF, 0x03, 0x0C, 0x02, 0xFD,
+    0xF6, 0xFF, 0x0C, 0x01, 0x12, 0x20, 0x13, 0x1C, 0x0A, 0x13, 0xEF, 0x00,
+    0xF0, 0xF5, 0xF9, 0xF9, 0x0C, 0x05, 0xFB, 0xD7, 0xE4, 0xE7, 0xE1, 0xEC,
+    0xFC, 0xF1, 0xEA, 0xF3, 0x01, 0x0A, 0xF8, 0xF6, 0x0A, 0x07, 0x0B, 0x01,
+    0x16, 0x20, 0x0E, 0x16, 0x23, 0x13, 0xEF, 0xF5, 0xFF, 0x08, 0xF3, 0xFA,
+    0x01, 0x0D, 0xF2, 0xE9, 0xF7, 0xDD, 0xE3, 0x00, 0xF3, 0xED, 0xEA, 0x01,
+    0xF8, 0xF1, 0xF5, 0x13, 0xF9, 0x05, 0x01, 0x03, 0x1D, 0x08, 0x0E, 0x17,
+    0x28, 0x01, 0x00, 0xED, 0x0B, 0xF5, 0x12, 0x06, 0x0D, 0x17, 0xF5, 0xF3,
+    0xEB, 0xE9, 0xFE, 0xFC, 0xE6, 0xFC, 0xFD, 0xF5, 0xEF, 0x10, 0x0E, 0xF8,
+    0xFB, 0x17, 0x05, 0x07, 0x0E, 0x0D, 0x25, 0x21, 0x02, 0x03, 0xFB, 0xF7,
+    0x04, 0xFA, 0x0A, 0x0B, 0x10, 0x13, 0xF3, 0xE8, 0xEE, 0xE0, 0xF9, 0xE6,
+    0xEC, 0xEC, 0xF8, 0x07, 0xF9, 0xFA, 0x02, 0x01, 0x03, 0xFE, 0x00, 0x1E,
+    0x20, 0x1D, 0x08, 0x13, 0x05, 0xE9, 0x05, 0x00, 0x0C, 0x11, 0x00, 0xFA,
+    0xFA, 0xFC, 0xEC, 0xE7, 0xE8, 0xFA, 0xEB, 0xE5, 0xEE, 0xF2, 0xF4, 0xF1,
+    0x00, 0x00, 0x01, 0x14, 0x0A, 0x08, 0x12, 0x01, 0x0A, 0x24, 0x26, 0xF2,
+    0xE8, 0xF3, 0xEE, 0x0B, 0x0A, 0xF5, 0xFB, 0x04, 0xFE, 0x10, 0xF1, 0xE9,
+    0xF8, 0xEE, 0xED, 0x03, 0xF0, 0xF1, 0x0B, 0x0C, 0x00, 0xF5, 0x0F, 0x08,
+    0xFB, 0x17, 0x04, 0x11, 0x12, 0x25, 0x22, 0xEA, 0xF5, 0x04, 0xF2, 0x09,
+    0x03, 0x09, 0x14, 0x00, 0x11, 0x0F, 0xEC, 0xE3, 0xEC, 0xF0, 0x01, 0x00,
+    0xF0, 0xFD, 0x06, 0xF9, 0x00, 0xF7, 0x09, 0x09, 0x00, 0x17, 0x0C, 0x15,
+    0x1D, 0x15, 0xF3, 0xE7, 0xE9, 0xFC, 0x00, 0xF1, 0xF4, 0xF7, 0x10, 0x00,
+    0x00, 0xFF, 0xF0, 0xEF, 0xEE, 0xE7, 0x01, 0xFB, 0xEE, 0x06, 0xF9, 0x06,
+    0x00, 0xFA, 0xFF, 0x17, 0x19, 0x09, 0x0A, 0x06, 0x1C, 0x25, 0xF5, 0xF6,
+    0xEF, 0x08, 0xEE, 0x01, 0x0F, 0x14, 0x08, 0xFC, 0x0F, 0xFF, 0xE5, 0xF3,
+    0xF8, 0xE8, 0xFE, 0xF5, 0xEE, 0xEE, 0x08, 0xF1, 0x02, 0x10, 0xFC, 0x0E,
+    0x0C, 0x0A, 0x03, 0x19, 0x14, 0x01, 0x01, 0xF0, 0x08, 0x0B, 0x07, 0x0A,
+    0x11, 0x10, 0xFD, 0x10, 0x18, 0x0C, 0xE5, 0xF7, 0xE1, 0xF4, 0xF8, 0xF8,
+    0xF4, 0x0A, 0x0B, 0xF8, 0x06, 0xFF, 0xFA, 0xFB, 0x05, 0x0F, 0x17, 0x1B,
+    0x0C, 0xFD, 0x02, 0x01, 0xEB, 0xFA, 0xF9, 0x03, 0x02, 0x14, 0x06, 0x04,
+    0x0D, 0x16, 0xE8, 0xFE, 0xEB, 0x01, 0xF7, 0xFF, 0xFB, 0xFD, 0x07, 0x0E,
+    0x05, 0x10, 0x07, 0xFD, 0x17, 0x13, 0x01, 0x07, 0x1C, 0xEE, 0x02, 0x01,
+    0xF1, 0x08, 0x00, 0x01, 0x0A, 0x09, 0x0C, 0x10, 0x02, 0x0D, 0xEF, 0xEB,
+    0xE3, 0xF0, 0xE9, 0xF3, 0xFC, 0x07, 0xF3, 0xF2, 0x0B, 0x02, 0x0A, 0x07,
+    0x0F, 0x0A, 0x20, 0x0A, 0x1D, 0x00, 0xFD, 0xE9, 0xFA, 0x0A, 0x0C, 0x0D,
+    0x07, 0x01, 0x07, 0xFF, 0x16, 0x09, 0xF4, 0xFB, 0xEA, 0xF5, 0xF7, 0xF9,
+    0xEA, 0xF1, 0x00, 0xF3, 0x00, 0x02, 0x0F, 0x04, 0x02, 0x05, 0x1B, 0x19,
+    0x19, 0xF1, 0x04, 0xF8, 0xFC, 0xFA, 0x0C, 0xF4, 0xF6, 0x10, 0x05, 0xFB,
+    0x07, 0x10, 0xE9, 0xDE, 0xFE, 0xF7, 0xF1, 0xEB, 0xFE, 0x08, 0x03, 0x01,
+    0x00, 0x03, 0x15, 0x06, 0x0F, 0x04, 0x17, 0x06, 0xF4, 0xFC, 0xF7, 0xEE,
+    0x00, 0x08, 0x0A, 0x08, 0xFD, 0xF9, 0xFF, 0x04, 0x13, 0x1C, 0x17, 0xDE,
+    0xEA, 0xFB, 0xF8, 0xEA, 0xF8, 0xFE, 0x03, 0x03, 0x09, 0xFE, 0x10, 0x0B,
+    0xFF, 0x05, 0x04, 0x1F, 0xE1, 0xEF, 0x02, 0xE7, 0x01, 0xF6, 0xFA, 0xF4,
+    0x0D, 0xF6, 0x08, 0x08, 0x06, 0x16, 0x0A, 0xFA, 0xF5, 0xE9, 0xE5, 0xF3,
+    0x00, 0xF8, 0xF3, 0xF2, 0xFC, 0x13, 0x06, 0x0A, 0x0F, 0x0F, 0x06, 0x0E,
+    0xF0, 0xFF, 0xF9, 0xED, 0xF3, 0xFE, 0x0A, 0x0B, 0x06, 0x03, 0x0B, 0x01,
+    0x14, 0x0A, 0x07, 0x12, 0xF5, 0xFF, 0x01, 0xF5, 0xE9, 0x00, 0xFC, 0x09,
+    0xFE, 0xF6, 0x10, 0x06, 0x09, 0x19, 0x0D, 0x14, 0xEB, 0xF9, 0xE5, 0xF8,
+    0x02, 0xF0, 0x03, 0x06, 0x0B, 0x0A, 0x04, 0x0F, 0x00, 0xFF, 0x0E, 0x20,
+    0xDF, 0x00, 0xEF, 0xFE, 0xEE, 0xED, 0xFD, 0x00, 0x00, 0xFF, 0x06, 0x07,
+    0x0D, 0xFE, 0x1B, 0x1C, 0x0D, 0xF4, 0xE6, 0xEA, 0x00, 0xF7, 0xFA, 0xF6,
+    0xFF, 0x0E, 0xFF, 0x0E, 0x0E, 0x12, 0x0B, 0x1E, 0x18, 0xEA, 0xFA, 0xF6,
+    0xEB, 0xF1, 0xF6, 0x0C, 0x05, 0xF3, 0x12, 0x05, 0x12, 0x0A, 0x1C, 0x05,
+    0x08, 0xF5, 0x00, 0xE7, 0xEB, 0x03, 0x01, 0xEF, 0xF3, 0x05, 0x08, 0x0D,
+    0x16, 0x02, 0x01, 0x13, 0x13, 0xEA, 0x00, 0xF1, 0xEB, 0xFC, 0xFB, 0xF5,
+    0xFA, 0x05, 0x01, 0x0F, 0xFE, 0x14, 0x1B, 0x14, 0x04, 0xF9, 0xEB, 0xF0,
+    0xFF, 0xF0, 0xF6, 0x06, 0xFE, 0x04, 0x0D, 0xFB, 0x02, 0x00, 0x00, 0x1D,
+    0x1F, 0x04, 0xF5, 0xF7, 0xFE, 0x03, 0xF4, 0xF9, 0xFA, 0x04, 0x10, 0x0D,
+    0x0B, 0x14, 0x13, 0x0F, 0x13, 0xE6, 0xFD, 0xE7, 0xF7, 0xED, 0x00, 0x04,
+    0x00, 0xF5, 0x05, 0x04, 0x0E, 0x04, 0x06, 0x07, 0x04, 0x06, 0x0A, 0xE4,
+    0xEC, 0xEB, 0xEE, 0xFF, 0x07, 0x00, 0x08, 0x03, 0xF8, 0x03, 0x05, 0x0F,
+    0x09, 0xE5, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0x0B, 0xF5, 0xFC, 0x0D,
+    0xF7, 0x0A, 0x06, 0x07, 0x05, 0x09, 0x1F, 0xF1, 0xF7, 0xE7, 0xFF, 0xEC,
+    0x05, 0xFA, 0x04, 0xFE, 0x13, 0xFD, 0x15, 0x0F, 0x15, 0x0E, 0xEE, 0xE5,
+    0xF2, 0xE8, 0xEB, 0xED, 0xF7, 0xF9, 0xF6, 0x0F, 0xFB, 0x03, 0x17, 0x0A,
+    0x08, 0x19, 0x0D, 0x06, 0x00, 0xF9, 0xEB, 0x04, 0xFD, 0x02, 0xF9, 0x06,
+    0xF9, 0xFF, 0x0B, 0x13, 0x0C, 0x09, 0xE5, 0xDF, 0xE1, 0xF3, 0x03, 0x00,
+    0xF1, 0xFA, 0x0C, 0x0B, 0xFE, 0x09, 0x05, 0x07, 0x19, 0x07, 0x05, 0x09,
+    0x18, 0xFA, 0xEB, 0xF3, 0x04, 0x01, 0xF7, 0x0D, 0x10, 0xFD, 0xFC, 0xFE,
+    0x00, 0x0A, 0xEE, 0xE4, 0xE2, 0xFB, 0xFB, 0x05, 0x02, 0x09, 0xF9, 0xF5,
+    0x08, 0x08, 0x03, 0x15, 0xFB, 0x03, 0x18, 0x0F, 0x1C, 0x15, 0xF1, 0xFC,
+    0xE9, 0x05, 0xF6, 0xF4, 0x0A, 0x01, 0x07, 0x11, 0x06, 0x0E, 0x0E, 0xF4,
+    0xF0, 0xF5, 0xE7, 0xF7, 0xFD, 0xEE, 0xF0, 0xFC, 0xF5, 0x06, 0x0C, 0x0C,
+    0x0C, 0x09, 0x16, 0x1B, 0x14, 0x1F, 0x23, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x0B, 0x0F, 0xFC, 0x07, 0x16, 0x03, 0x1B, 0xE6, 0xF9, 0xF7, 0xE2, 0xFF,
+    0xFA, 0x06, 0xFE, 0x09, 0x0A, 0x05, 0x0C, 0x01, 0x16, 0xFF, 0x07, 0xFF,
+    0x07, 0x1D, 0x1E, 0x0E, 0xFD, 0xFF, 0xF1, 0x01, 0xF1, 0x05, 0xFA, 0xF6,
+    0x15, 0x0B, 0xFD, 0x04, 0xE7, 0xE9, 0xE6, 0xE6, 0xFC, 0xFF, 0xFE, 0xFC,
+    0xFD, 0xFD, 0xF3, 0x01, 0x02, 0xFF, 0x16, 0x08, 0x00, 0x0C, 0x0C, 0x11,
+    0x17, 0xFE, 0xFB, 0x02, 0x04, 0x02, 0x02, 0xFC, 0xF6, 0x04, 0xFA, 0x0E,
+    0xF1, 0xF4, 0xF7, 0xE4, 0xEA, 0xF6, 0xF1, 0xFC, 0xF7, 0xFE, 0xF9, 0x0D,
+    0x10, 0xF7, 0x10, 0x16, 0x15, 0x0F, 0x05, 0x20, 0x14, 0x11, 0x04, 0xED,
+    0xFA, 0xFF, 0xF5, 0x04, 0xF7, 0x11, 0x11, 0xFD, 0x0F, 0xDD, 0xE0, 0xF4,
+    0xE5, 0xFE, 0xF7, 0xFC, 0xF6, 0xF0, 0xFB, 0xFF, 0xF5, 0x01, 0x15, 0x0A,
+    0x0A, 0x1B, 0x19, 0x05, 0x0B, 0x1E, 0x17, 0x00, 0x00, 0xF7, 0x01, 0xFE,
+    0x03, 0x0E, 0x04, 0x08, 0x18, 0x17, 0xEB, 0xF7, 0xEF, 0xFA, 0x00, 0xF4,
+    0xF6, 0xF3, 0xFB, 0x03, 0x01, 0x04, 0x0C, 0x01, 0x15, 0x05, 0x02, 0x1B,
+    0x02, 0x0D, 0x11, 0x0A, 0xEA, 0x04, 0x00, 0xF3, 0xF4, 0xFA, 0x04, 0x13,
+    0x0D, 0x0B, 0xDC, 0xEB, 0xEA, 0xFE, 0xE4, 0xFC, 0xFA, 0x05, 0xF8, 0xF9,
+    0xF9, 0x04, 0xFD, 0x01, 0x02, 0x17, 0x04, 0x1A, 0x0A, 0x03, 0x20, 0x0A,
+    0x12, 0x02, 0xFC, 0x09, 0x06, 0x0C, 0xF5, 0x0E, 0x0D, 0x05, 0x09, 0xEE,
+    0xFA, 0xE8, 0xFE, 0xF6, 0x01, 0xFB, 0xFC, 0x00, 0xEF, 0x0D, 0x02, 0x05,
+    0x00, 0x04, 0x0B, 0x19, 0x09, 0x1C, 0x1A, 0x0D, 0x11, 0x10, 0xFB, 0xEC,
+    0xFD, 0xF3, 0x0B, 0xFE, 0xFD, 0x14, 0x02, 0x00, 0xF5, 0xDD, 0xEE, 0xE4,
+    0xF8, 0xE6, 0xF2, 0xF7, 0xF1, 0x07, 0x07, 0xFD, 0xFE, 0x05, 0x0C, 0x07,
+    0x05, 0x0C, 0x18, 0x1B, 0x06, 0x1B, 0x23, 0x00, 0x05, 0x06, 0x07, 0xF9,
+    0x0D, 0x0F, 0xFE, 0xFC, 0xDF, 0xEA, 0xF3, 0xF9, 0xE8, 0xF6, 0xFC, 0x00,
+    0x01, 0x09, 0xF3, 0xFB, 0xF4, 0x03, 0x06, 0x01, 0x13, 0x07, 0x0B, 0x04,
+    0x05, 0x17, 0x20, 0x18, 0x00, 0xFA, 0x06, 0x05, 0xF9, 0xF8, 0x0A, 0x03,
+    0xFE, 0xEC, 0xF6, 0xEF, 0xF6, 0xF9, 0xE6, 0xE8, 0xF4, 0xFB, 0xEF, 0xF3,
+    0x09, 0xF6, 0x01, 0x07, 0xFD, 0x0E, 0x07, 0x0B, 0x0D, 0x22, 0x20, 0x1C,
+    0x10, 0x01, 0xF1, 0xF3, 0xF2, 0x0A, 0x05, 0x00, 0x03, 0x07, 0xE4, 0xF8,
+    0xDE, 0xFD, 0xE7, 0xF6, 0xE6, 0xE9, 0xF8, 0xFB, 0x08, 0x09, 0xFE, 0x00,
+    0x0E, 0xFE, 0x06, 0x0D, 0x14, 0x13, 0x11, 0x0F, 0x25, 0x13, 0xF7, 0x00,
+    0x0A, 0x0A, 0xF8, 0xFE, 0x08, 0x05, 0xE5, 0xE8, 0xF9, 0xF7, 0xF0, 0xEB,
+    0xFC, 0xF5, 0x00, 0x01, 0xF8, 0xEF, 0xFF, 0x0F, 0xFB, 0x15, 0x14, 0x19,
+    0x12, 0x07, 0x07, 0x07, 0x22, 0x1F, 0x17, 0x02, 0xEE, 0x05, 0xF4, 0xF7,
+    0xF6, 0x0D, 0x13, 0xDE, 0xF1, 0xDF, 0xDE, 0xF9, 0xF6, 0xED, 0x00, 0xF8,
+    0xFD, 0x04, 0x02, 0x01, 0x10, 0x13, 0x12, 0x09, 0xFF, 0x0C, 0x03, 0x04,
+    0x19, 0x1A, 0x22, 0x25, 0x04, 0xFB, 0xF9, 0x0D, 0xF6, 0x05, 0x03, 0xF2,
+    0xE0, 0xF3, 0xF1, 0xFD, 0xE5, 0xEF, 0xE6, 0xE9, 0xF6, 0xF1, 0xF9, 0xFA,
+    0xF2, 0xFD, 0xF6, 0x0B, 0x0C, 0x02, 0x0F, 0x15, 0x15, 0x11, 0x22, 0x1B,
+    0x21, 0x04, 0x08, 0x06, 0xF2, 0x04, 0x0A, 0x03, 0xE4, 0xDB, 0xEC, 0xE2,
+    0xE8, 0xFD, 0xE5, 0xED, 0xFC, 0xF2, 0xEE, 0x07, 0x02, 0xF2, 0xF6, 0x01,
+    0x08, 0x0E, 0x15, 0x0B, 0x11, 0x14, 0x23, 0x1F, 0x26, 0x1C, 0xF8, 0x03,
+    0x09, 0xF5, 0xF7, 0x0A, 0x03, 0xEC, 0xF4, 0xE3, 0xE7, 0xEC, 0xEC, 0xF2,
+    0xFB, 0xEA, 0x07, 0xEF, 0x0C, 0xFE, 0x01, 0x05, 0xF9, 0xFA, 0x00, 0x09,
+    0x14, 0x11, 0x1C, 0x0A, 0x1B, 0x0F, 0x29, 0x01, 0x07, 0xF8, 0xFF, 0x0C,
+    0x03, 0xEC, 0xE7, 0xF1, 0xF9, 0xE9, 0xE8, 0xE4, 0xF0, 0xE9, 0xF4, 0xF4,
+    0xFF, 0x07, 0x0A, 0xFA, 0xFD, 0xFA, 0x01, 0x07, 0x14, 0x02, 0x0E, 0x07,
+    0x1C, 0x21, 0x0A, 0x11, 0xFE, 0xF2, 0xFA, 0x05, 0xFE, 0x00, 0xDB, 0xDF,
+    0xE4, 0xE9, 0xEE, 0xE2, 0xF5, 0xF8, 0xEA, 0xF7, 0xED, 0xFE, 0xF4, 0x08,
+    0x01, 0xFA, 0x13, 0x07, 0x09, 0x12, 0x02, 0x14, 0x17, 0x0A, 0x12, 0x1D,
+    0x27, 0xEE, 0x09, 0x07, 0x10, 0x0B, 0x10, 0xD8, 0xE7, 0xEC, 0xDE, 0xFB,
+    0xE5, 0xF0, 0xFB, 0xFC, 0xF8, 0xF6, 0x00, 0x03, 0x00, 0x09, 0x0A, 0xFA,
+    0x00, 0x16, 0x13, 0x02, 0x13, 0x10, 0x12, 0x0E, 0x1B, 0x12, 0xF9, 0x05,
+    0x06, 0x0C, 0x02, 0xF1, 0xEE, 0xF1, 0xEE, 0xED, 0xEF, 0xEE, 0xF6, 0xFA,
+    0xF1, 0xF7, 0x06, 0xF2, 0xFB, 0x0F, 0x03, 0x03, 0x13, 0x05, 0x07, 0x17,
+    0x14, 0x03, 0x1E, 0x17, 0x18, 0x1C, 0x23, 0x0A, 0xF0, 0x03, 0x05, 0x08,
+    0xE7, 0xE7, 0xDA, 0xEC, 0xF7, 0xFC, 0xF1, 0xE7, 0xED, 0xFE, 0xEE, 0xFF,
+    0xFA, 0x00, 0x0C, 0x10, 0x0C, 0x13, 0x05, 0x00, 0x0C, 0x0F, 0x18, 0x17,
+    0x1A, 0x1E, 0x17, 0x1F, 0x06, 0xF1, 0xFD, 0xFE, 0xEF, 0xEF, 0xD7, 0xF1,
+    0xEB, 0xEF, 0xEF, 0xF6, 0xFA, 0xF2, 0xEE, 0xFB, 0x04, 0x00, 0x04, 0xFB,
+};
+
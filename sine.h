@@ -0,0 +1,40 @@
+/* sine.h
+ * one full period of sin() in 256 steps, 4.12 fixed point
+ * cos(a) is sin_lut[(a + 64) & 255] */
+
+#define sin_lut_size 256
+
+const short sin_lut [] = {
+    0, 101, 201, 301, 401, 501, 601, 700,
+    799, 897, 995, 1092, 1189, 1285, 1380, 1474,
+    1567, 1660, 1751, 1842, 1931, 2019, 2106, 2191,
+    2276, 2359, 2440, 2520, 2598, 2675, 2751, 2824,
+    2896, 2967, 3035, 3102, 3166, 3229, 3290, 3349,
+    3406, 3461, 3513, 3564, 3612, 3659, 3703, 3745,
+    3784, 3822, 3857, 3889, 3920, 3948, 3973, 3996,
+    4017, 4036, 4052, 4065, 4076, 4085, 4091, 4095,
+    4096, 4095, 4091, 4085, 4076, 4065, 4052, 4036,
+    4017, 3996, 3973, 3948, 3920, 3889, 3857, 3822,
+    3784, 3745, 3703, 3659, 3612, 3564, 3513, 3461,
+    3406, 3349, 3290, 3229, 3166, 3102, 3035, 2967,
+    2896, 2824, 2751, 2675, 2598, 2520, 2440, 2359,
+    2276, 2191, 2106, 2019, 1931, 1842, 1751, 1660,
+    1567, 1474, 1380, 1285, 1189, 1092, 995, 897,
+    799, 700, 601, 501, 401, 301, 201, 101,
+    0, -101, -201, -301, -401, -501, -601, -700,
+    -799, -897, -995, -1092, -1189, -1285, -1380, -1474,
+    -1567, -1660, -1751, -1842, -1931, -2019, -2106, -2191,
+    -2276, -2359, -2440, -2520, -2598, -2675, -2751, -2824,
+    -2896, -2967, -3035, -3102, -3166, -3229, -3290, -3349,
+    -3406, -3461, -3513, -3564, -3612, -3659, -3703, -3745,
+    -3784, -3822, -3857, -3889, -3920, -3948, -3973, -3996,
+    -4017, -4036, -4052, -4065, -4076, -4085, -4091, -4095,
+    -4096, -4095, -4091, -4085, -4076, -4065, -4052, -4036,
+    -4017, -3996, -3973, -3948, -3920, -3889, -3857, -3822,
+    -3784, -3745, -3703, -3659, -3612, -3564, -3513, -3461,
+    -3406, -3349, -3290, -3229, -3166, -3102, -3035, -2967,
+    -2896, -2824, -2751, -2675, -2598, -2520, -2440, -2359,
+    -2276, -2191, -2106, -2019, -1931, -1842, -1751, -1660,
+    -1567, -1474, -1380, -1285, -1189, -1092, -995, -897,
+    -799, -700, -601, -501, -401, -301, -201, -101
+};
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+# aiasm.py
+# assembles an animatronic AI script into a header of bytecode for fnaf.c
+#
+# usage: aiasm.py guest.ai guest_ai.h
+#
+# a script is one instruction per line, with labels ending in a colon and
+# comments starting with a semicolon:
+#
+#     loop:
+#         get r0, player_x    ; r0 = afton's x
+#         jlt r0, r1, loop
+#
+# the opcode and sensor numbers must match the AI section of fnaf.c
+
+import os
+import sys
+
+# name: (opcode, operand kinds) - r is a register byte, s a sensor byte,
+# b an unsigned byte, i a signed 16 bit number and t a 16 bit jump target
+OPS = {
+    "halt": (0, ""),
+    "yield": (1, ""),
+    "wait": (2, "b"),
+    "set": (3, "ri"),
+    "mov": (4, "rr"),
+    "add": (5, "ri"),
+    "addr": (6, "rr"),
+    "sub": (7, "rr"),
+    "get": (8, "rs"),
+    "put": (9, "sr"),
+    "jmp": (10, "t"),
+    "jlt": (11, "rrt"),
+    "jge": (12, "rrt"),
+    "jeq": (13, "rrt"),
+    "jne": (14, "rrt"),
+    "rand": (15, "rb"),
+    "path": (16, "rrr"),
+    "dist": (17, "rrr"),
+    "roomx": (18, "rr"),
+}
+
+SIZES = {"r": 1, "s": 1, "b": 1, "i": 2, "t": 2}
+
+SENSORS = {
+    "self_x": 0,
+    "self_y": 1,
+    "self_frame": 2,
+    "self_turned": 3,
+    "player_x": 4,
+    "player_y": 5,
+    "hour": 6,
+    "power": 7,
+    "self_touching": 8,
+    "self_sees_player": 9,
+}
+
+REGISTERS = 8
+
+
+def fail(filename, line, message):
+    sys.exit("%s:%d: %s" % (filename, line, message))
+
+
+def parse(filename):
+    """returns a list of (line number, op, operands) and a dict of labels"""
+    program = []
+    labels = {}
+    address = 0
+    with open(filename) as source:
+        for number, text in enumerate(source, 1):
+            text = text.split(";")[0].strip()
+            while ":" in text:
+                label, text = text.split(":", 1)
+                label = label.strip()
+                if label in labels:
+                    fail(filename, number, "label %s is defined twice" % label)
+                labels[label] = address
+                text = text.strip()
+            if not text:
+                continue
+
+            parts = text.split(None, 1)
+            op = parts[0].lower()
+            if op not in OPS:
+                fail(filename, number, "unknown instruction %s" % op)
+            operands = [o.strip() for o in parts[1].split(",")] if len(parts) > 1 else []
+            kinds = OPS[op][1]
+            if len(operands) != len(kinds):
+                fail(filename, number, "%s takes %d operands" % (op, len(kinds)))
+
+            program.append((number, op, operands))
+            address += 1 + sum(SIZES[k] for k in kinds)
+    return program, labels
+
+
+def operand(filename, number, kind, text, labels):
+    """returns the bytes for one operand"""
+    if kind == "r":
+        if not text.lower().startswith("r") or not text[1:].isdigit() or int(text[1:]) >= REGISTERS:
+            fail(filename, number, "%s is not a register" % text)
+        return [int(text[1:])]
+    if kind == "s":
+        if text.lower() not in SENSORS:
+            fail(filename, number, "%s is not a sensor" % text)
+        return [SENSORS[text.lower()]]
+    if kind == "t":
+        if text not in labels:
+            fail(filename, number, "no label %s" % text)
+        value = labels[text]
+        return [value & 0xff, value >> 8]
+
+    value = int(text, 0)
+    if kind == "b":
+        if not 0 <= value <= 255:
+            fail(filename, number, "%s does not fit in a byte" % text)
+        return [value]
+    if not -32768 <= value <= 32767:
+        fail(filename, number, "%s does not fit in 16 bits" % text)
+    return [value & 0xff, (value >> 8) & 0xff]
+
+
+def assemble(filename):
+    program, labels = parse(filename)
+    code = []
+    for number, op, operands in program:
+        opcode, kinds = OPS[op]
+        code.append(opcode)
+        for kind, text in zip(kinds, operands):
+            code += operand(filename, number, kind, text, labels)
+    if len(code) > 0xffff:
+        sys.exit("%s: the script is too long" % filename)
+    return code
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: aiasm.py script.ai header.h")
+
+    code = assemble(sys.argv[1])
+    name = os.path.splitext(os.path.basename(sys.argv[2]))[0]
+
+    with open(sys.argv[2], "w") as header:
+        header.write("/* %s\n * AI bytecode made by tools/aiasm.py from %s, do not edit */\n\n"
+                     % (os.path.basename(sys.argv[2]), os.path.basename(sys.argv[1])))
+        header.write("#define %s_size %d\n\n" % (name, len(code)))
+        header.write("const unsigned char %s [] = {\n" % name)
+        for i in range(0, len(code), 12):
+            header.write("    " + ", ".join("0x%02x" % b for b in code[i:i + 12]) + ",\n")
+        header.write("};\n\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#
+# roomgraph.py
+# turns the graph of rooms the animatronics walk between into a header of
+# all-pairs next-hop and distance tables for fnaf.c
+#
+# usage: roomgraph.py rooms.graph rooms.h
+#
+# a graph lists each room with its x position in the level in pixels, then
+# the links between rooms, which go both ways - a link's cost is the walking
+# distance between the rooms unless one is given:
+#
+#     room stage 32
+#     room dining 160
+#     link stage dining
+#     link dining kitchen 300    ; a long way round
+#
+# the paths are found with Floyd-Warshall here, so the game only has to look
+# up the next room to head for
+
+import os
+import sys
+
+# the game's tables use these for rooms which cannot be reached
+NO_ROOM = 0xff
+NO_PATH = 0xffff
+
+
+def fail(filename, line, message):
+    sys.exit("%s:%d: %s" % (filename, line, message))
+
+
+def parse(filename):
+    """returns the room names, their x positions and the links between them"""
+    names = []
+    xs = []
+    links = []
+    with open(filename) as source:
+        for number, text in enumerate(source, 1):
+            words = text.split(";")[0].split()
+            if not words:
+                continue
+
+            if words[0] == "room" and len(words) == 3:
+                if words[1] in names:
+                    fail(filename, number, "room %s is defined twice" % words[1])
+                names.append(words[1])
+                xs.append(int(words[2], 0))
+            elif words[0] == "link" and len(words) in (3, 4):
+                for name in words[1:3]:
+                    if name not in names:
+                        fail(filename, number, "no room %s" % name)
+                a = names.index(words[1])
+                b = names.index(words[2])
+                cost = int(words[3], 0) if len(words) == 4 else abs(xs[a] - xs[b])
+                if cost <= 0:
+                    fail(filename, number, "a link must cost something")
+                links.append((a, b, cost))
+            else:
+                fail(filename, number, "expected room <name> <x> or link <room> <room> [cost]")
+
+    if len(names) >= NO_ROOM:
+        sys.exit("%s: too many rooms" % filename)
+    return names, xs, links
+
+
+def floyd_warshall(count, links):
+    """returns the all-pairs distance and next-hop tables"""
+    distance = [[NO_PATH] * count for _ in range(count)]
+    next_hop = [[NO_ROOM] * count for _ in range(count)]
+
+    for i in range(count):
+        distance[i][i] = 0
+        next_hop[i][i] = i
+    for a, b, cost in links:
+        for x, y in ((a, b), (b, a)):
+            if cost < distance[x][y]:
+                distance[x][y] = cost
+                next_hop[x][y] = y
+
+    for k in range(count):
+        for i in range(count):
+            if distance[i][k] == NO_PATH:
+                continue
+            for j in range(count):
+                through = distance[i][k] + distance[k][j]
+                if distance[k][j] != NO_PATH and through < distance[i][j]:
+                    distance[i][j] = through
+                    next_hop[i][j] = next_hop[i][k]
+
+    for i in range(count):
+        for j in range(count):
+            if distance[i][j] != NO_PATH and distance[i][j] >= NO_PATH:
+                sys.exit("the path from room %d to %d is too long" % (i, j))
+    return distance, next_hop
+
+
+def write_table(header, kind, name, rows):
+    header.write("const %s %s [] = {\n" % (kind, name))
+    for row in rows:
+        header.write("    " + ", ".join("%d" % value for value in row) + ",\n")
+    header.write("};\n\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: roomgraph.py rooms.graph rooms.h")
+
+    names, xs, links = parse(sys.argv[1])
+    distance, next_hop = floyd_warshall(len(names), links)
+
+    with open(sys.argv[2], "w") as header:
+        header.write("/* %s\n * room tables made by tools/roomgraph.py from %s, do not edit\n"
+                     " * room_next[from * rooms_count + to] is the room to head for next and\n"
+                     " * room_distances[from * rooms_count + to] how far it is altogether */\n\n"
+                     % (os.path.basename(sys.argv[2]), os.path.basename(sys.argv[1])))
+        header.write("#define rooms_count %d\n" % len(names))
+        header.write("#define ROOM_NONE %d\n" % NO_ROOM)
+        header.write("#define ROOM_NO_PATH %d\n\n" % NO_PATH)
+        for i, name in enumerate(names):
+            header.write("#define ROOM_%s %d\n" % (name.upper(), i))
+        header.write("\n")
+        write_table(header, "short", "room_x", [xs])
+        write_table(header, "unsigned char", "room_next", next_hop)
+        write_table(header, "unsigned short", "room_distances", distance)
+
+
+if __name__ == "__main__":
+    main()
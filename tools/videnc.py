@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+#
+# videnc.py
+# turns a strip of full screen frames and a raw sound into a header of block
+# coded video for the mode 4 player in fnaf.c
+#
+# usage: videnc.py frames.png sound.raw video.h [tolerance]
+#
+# the png is the frames one under the other, each 240x160, like the sprite
+# sheets - any colors are fine, they are cut down to a 256 color palette with
+# black first, since the pages start out cleared to color 0
+#
+# the sound is signed 8 bit samples at 44100 a second, the same as the music,
+# because both direct sound channels are clocked by the one timer
+#
+# each frame is 60x40 blocks of 4x4 pixels coded in order, across then down,
+# as a run of ops which each start with a byte - the top two bits are the op
+# and the low six one less than how many blocks it covers:
+#
+#     0 skip     the blocks are left as they are in the page
+#     1 vector   a byte each, the block from the codebook to copy
+#     2 fill     one byte, the color every pixel of the blocks is set to
+#     3 raw      sixteen bytes each, the pixels of the block row by row
+#
+# the player decodes into whichever of the two pages is not being shown, so a
+# skipped block keeps what was there two frames before - the encoder keeps a
+# copy of both pages to know what that is
+#
+# the codebook is the 256 blocks used most, and a block may be coded as
+# the same as its page or a codebook entry if no more than tolerance of its
+# pixels are different, 2 unless given
+
+import os
+import struct
+import sys
+import zlib
+
+WIDTH = 240
+HEIGHT = 160
+BLOCK = 4
+BLOCKS_WIDE = WIDTH // BLOCK
+BLOCKS_HIGH = HEIGHT // BLOCK
+FPS = 30
+SOUND_RATE = 44100
+
+OP_SKIP = 0
+OP_VECTOR = 1
+OP_FILL = 2
+OP_RAW = 3
+MAX_RUN = 64
+
+# every byte of a block which is not zero has its low bit set in this
+LOW_BITS = int("01" * 16, 16)
+
+
+def read_png(filename):
+    """returns the width, height and rows of (r, g, b) tuples of a png"""
+    with open(filename, "rb") as source:
+        data = source.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a png" % filename)
+
+    offset = 8
+    compressed = b""
+    palette = []
+    alpha = []
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif kind == b"tRNS":
+            alpha = list(chunk)
+        elif kind == b"IDAT":
+            compressed += chunk
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if depth != 8 or interlace or channels is None:
+        sys.exit("%s: only 8 bit non-interlaced pngs are read" % filename)
+
+    raw = zlib.decompress(compressed)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    position = 0
+    for _ in range(height):
+        kind = raw[position]
+        line = bytearray(raw[position + 1:position + 1 + stride])
+        position += 1 + stride
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = previous[i]
+            corner = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xff
+            elif kind == 4:
+                guess = left + up - corner
+                a, b, c = abs(guess - left), abs(guess - up), abs(guess - corner)
+                nearest = left if a <= b and a <= c else (up if b <= c else corner)
+                line[i] = (line[i] + nearest) & 0xff
+        previous = line
+
+        # see-through pixels are black, the same as the cleared pages
+        pixels = []
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                pixels.append((p[0], p[0], p[0]))
+            elif color == 4:
+                pixels.append((p[0], p[0], p[0]) if p[1] >= 128 else (0, 0, 0))
+            elif color == 2:
+                pixels.append(tuple(p))
+            elif color == 3:
+                seen = alpha[p[0]] if p[0] < len(alpha) else 255
+                pixels.append(palette[p[0]] if seen >= 128 else (0, 0, 0))
+            else:
+                pixels.append(tuple(p[:3]) if p[3] >= 128 else (0, 0, 0))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def to_gba(rgb):
+    """returns a color as the gba's 15 bits, blue in the top"""
+    return (rgb[0] >> 3) | ((rgb[1] >> 3) << 5) | ((rgb[2] >> 3) << 10)
+
+
+def make_palette(rows):
+    """returns the 256 color palette, black first, and the rows as indices"""
+    counts = {}
+    for row in rows:
+        for rgb in row:
+            color = to_gba(rgb)
+            counts[color] = counts.get(color, 0) + 1
+
+    # if there are too many colors keep the most used and match the rest to them
+    colors = sorted((c for c in counts if c != 0), key=lambda c: -counts[c])
+    palette = [0] + colors[:255]
+    index = {c: i for i, c in enumerate(palette)}
+    for color in colors[255:]:
+        r, g, b = color & 31, (color >> 5) & 31, color >> 10
+        index[color] = min(range(len(palette)), key=lambda i: (r - (palette[i] & 31)) ** 2 +
+                           (g - ((palette[i] >> 5) & 31)) ** 2 + (b - (palette[i] >> 10)) ** 2)
+
+    pixels = [[index[to_gba(rgb)] for rgb in row] for row in rows]
+    return palette + [0] * (256 - len(palette)), pixels
+
+
+def split_blocks(pixels, top):
+    """returns the blocks of the frame starting at row top, as 16 byte strings"""
+    blocks = []
+    for by in range(BLOCKS_HIGH):
+        for bx in range(BLOCKS_WIDE):
+            block = bytearray()
+            for y in range(BLOCK):
+                row = pixels[top + by * BLOCK + y]
+                block += bytes(row[bx * BLOCK:(bx + 1) * BLOCK])
+            blocks.append(bytes(block))
+    return blocks
+
+
+def differences(a, b):
+    """returns how many pixels of two blocks are not the same"""
+    x = int.from_bytes(a, "little") ^ int.from_bytes(b, "little")
+    x |= x >> 4
+    x |= x >> 2
+    x |= x >> 1
+    return bin(x & LOW_BITS).count("1")
+
+
+def make_codebook(frames):
+    """returns the 256 blocks which appear most often"""
+    counts = {}
+    for blocks in frames:
+        for block in blocks:
+            if block.count(block[0]) != len(block):
+                counts[block] = counts.get(block, 0) + 1
+    used = sorted(counts, key=lambda b: -counts[b])[:256]
+    return used + [bytes(16)] * (256 - len(used))
+
+
+def encode(frames, codebook, tolerance):
+    """returns the coded frames, one after another"""
+    pages = [[bytes(16)] * len(frames[0]), [bytes(16)] * len(frames[0])]
+    exact = {block: i for i, block in enumerate(codebook)}
+    nearest = {}
+    out = bytearray()
+
+    for number, blocks in enumerate(frames):
+        page = pages[(number + 1) & 1]
+        ops = []
+        for i, block in enumerate(blocks):
+            if differences(block, page[i]) <= tolerance:
+                ops.append((OP_SKIP, None))
+                continue
+            if block.count(block[0]) == len(block):
+                ops.append((OP_FILL, block[0]))
+                page[i] = block
+                continue
+            if block not in nearest:
+                if block in exact:
+                    nearest[block] = exact[block]
+                else:
+                    best = min(range(256), key=lambda e: differences(block, codebook[e]))
+                    nearest[block] = best if differences(block, codebook[best]) <= tolerance else None
+            entry = nearest[block]
+            if entry is not None:
+                ops.append((OP_VECTOR, entry))
+                page[i] = codebook[entry]
+            else:
+                ops.append((OP_RAW, block))
+                page[i] = block
+
+        # runs of the same op go together, a fill only with the same color
+        i = 0
+        while i < len(ops):
+            op, value = ops[i]
+            run = 1
+            while (i + run < len(ops) and run < MAX_RUN and ops[i + run][0] == op and
+                   (op != OP_FILL or ops[i + run][1] == value)):
+                run += 1
+            out.append((op << 6) | (run - 1))
+            if op == OP_FILL:
+                out.append(value)
+            elif op == OP_VECTOR:
+                out += bytes(ops[j][1] for j in range(i, i + run))
+            elif op == OP_RAW:
+                for j in range(i, i + run):
+                    out += ops[j][1]
+            i += run
+    return out
+
+
+def write_table(header, kind, name, values, per_line, form):
+    header.write("const %s %s[] __attribute__((aligned(4))) = {\n" % (kind, name))
+    for i in range(0, len(values), per_line):
+        header.write("    " + ", ".join(form % v for v in values[i:i + per_line]) + ",\n")
+    header.write("};\n\n")
+
+
+def main():
+    if len(sys.argv) not in (4, 5):
+        sys.exit("usage: videnc.py frames.png sound.raw video.h [tolerance]")
+    tolerance = int(sys.argv[4]) if len(sys.argv) == 5 else 2
+
+    width, height, rows = read_png(sys.argv[1])
+    if width != WIDTH or height % HEIGHT:
+        sys.exit("%s: frames must be %dx%d, one under the other" % (sys.argv[1], WIDTH, HEIGHT))
+    palette, pixels = make_palette(rows)
+    frames = [split_blocks(pixels, top) for top in range(0, height, HEIGHT)]
+    codebook = make_codebook(frames)
+    data = encode(frames, codebook, tolerance)
+
+    with open(sys.argv[2], "rb") as source:
+        sound = source.read()
+
+    # the sound is pulled 4 bytes at a time
+    sound += bytes(-len(sound) % 4)
+
+    name = os.path.splitext(os.path.basename(sys.argv[3]))[0]
+    words = []
+    for block in codebook:
+        words += struct.unpack("<4I", block)
+
+    with open(sys.argv[3], "w") as header:
+        header.write("/* %s\n * video made by tools/videnc.py from %s and %s, do not edit\n"
+                     " * %d frames at %d a second, %d bytes of blocks */\n\n"
+                     % (os.path.basename(sys.argv[3]), os.path.basename(sys.argv[1]),
+                        os.path.basename(sys.argv[2]), len(frames), FPS, len(data)))
+        header.write("#define %s_frames %d\n" % (name, len(frames)))
+        header.write("#define %s_fps %d\n" % (name, FPS))
+        header.write("#define %s_sound_bytes %d\n" % (name, len(sound)))
+        header.write("#define %s_sound_rate %d\n\n" % (name, SOUND_RATE))
+        write_table(header, "unsigned short", name + "_palette", palette, 8, "0x%04x")
+        write_table(header, "unsigned int", name + "_codebook", words, 4, "0x%08x")
+        write_table(header, "unsigned char", name + "_data", list(data), 12, "0x%02x")
+        write_table(header, "signed char", name + "_sound", list(sound), 12, "0x%02X")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,33 @@
+@ vwf_blit.s
+
+/* ors one 8 pixel wide 4bpp glyph into a strip of tiles at a pixel position,
+ * the part which hangs past the edge of a tile goes into the next one
+ * r0 is the strip, r1 the 8 rows of the glyph and r2 the x position
+ * this is arm code and lives in iwram so it runs at full speed */
+
+.section .iwram, "ax", %progbits
+.arm
+.align 2
+.global	vwf_blit
+vwf_blit:
+    stmfd sp!, {r4-r6}
+    mov r3, r2, lsr #3
+    add r0, r0, r3, lsl #5
+    and r2, r2, #7
+    mov r2, r2, lsl #2
+    rsb r3, r2, #32
+    mov r12, #8
+.row:
+    ldr r4, [r1], #4
+    ldr r5, [r0]
+    ldr r6, [r0, #32]
+    orr r5, r5, r4, lsl r2
+    orr r6, r6, r4, lsr r3
+    str r6, [r0, #32]
+    str r5, [r0], #4
+    subs r12, r12, #1
+    bne .row
+.end:
+    ldmfd sp!, {r4-r6}
+    bx lr
+    